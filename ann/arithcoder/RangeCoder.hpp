@@ -0,0 +1,159 @@
+/*
+ * Binary range coding
+ *
+ * LZMA-style coder for bits: a 32-bit range, probabilities of RC_PROB_BITS
+ * bits, one byte out per normalization. It writes into a caller-provided
+ * buffer and reads from a plain byte array, with no virtual calls and no
+ * streams on the per-bit path.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+const int RC_PROB_BITS = 12;
+const std::uint32_t RC_PROB_ONE = 1u << RC_PROB_BITS;
+const std::uint32_t RC_TOP = 1u << 24;
+
+
+// P(bit=0) as a coder probability, from P(bit=0) * 2^30 (what
+// BinaryFrequencyTable takes). Kept inside (0, 1) so both bits stay codable.
+inline std::uint32_t rangeProbability(std::uint32_t zeroFrequency) {
+  std::uint32_t p = zeroFrequency >> (30 - RC_PROB_BITS);
+  return p < 1 ? 1 : p > RC_PROB_ONE - 1 ? RC_PROB_ONE - 1 : p;
+}
+
+// The same from a float P(bit=0).
+inline std::uint32_t rangeProbability(float zeroProbability) {
+  long double p0 = zeroProbability;
+  if (!(p0 > 0)) {
+    return 1;
+  }
+  if (p0 >= 1) {
+    return RC_PROB_ONE - 1;
+  }
+  return rangeProbability((std::uint32_t)(p0 * (1u << 30)));
+}
+
+
+class RangeEncoder final {
+public:
+  // Upper bound on the bytes encoding n bits. A bit costs at most
+  // RC_PROB_BITS bits, plus under 2^-11 bits for the truncation of
+  // range >> RC_PROB_BITS (range >= RC_TOP); bits / 1024 bytes covers
+  // that, 16 the flush.
+  static std::size_t maxSize(std::size_t bits) {
+    return bits * RC_PROB_BITS / 8 + bits / 1024 + 16;
+  }
+
+  // Writes to out[0, capacity). Throws std::length_error past that.
+  RangeEncoder(unsigned char *out, std::size_t capacity)
+      : out(out), capacity(capacity) {}
+
+  // Codes bit with P(bit=0) = p0 / RC_PROB_ONE, p0 in [1, RC_PROB_ONE).
+  void encode(std::uint32_t p0, int bit) {
+    std::uint32_t bound = (range >> RC_PROB_BITS) * p0;
+    std::uint32_t mask = 0u - (std::uint32_t)bit;
+    low += bound & mask;
+    range = (bound & ~mask) | ((range - bound) & mask);
+    while (range < RC_TOP) {
+      range <<= 8;
+      shiftLow();
+    }
+  }
+
+  // Flushes the coder. Returns the number of bytes written.
+  std::size_t finish() {
+    // any value in [low, low + range) decodes the same: take the one
+    // ending in the most zero bytes, which the decoder reads anyway
+    for (int bits = 32; bits > 0; bits -= 8) {
+      std::uint64_t mask = (1ull << bits) - 1;
+      std::uint64_t value = (low + mask) & ~mask;
+      if (value < low + range) {
+        low = value;
+        break;
+      }
+    }
+    for (int i = 0; i < 5; i++) {
+      shiftLow();
+    }
+    while (size > 0 && out[size - 1] == 0) {
+      size--;
+    }
+    return size;
+  }
+
+private:
+  unsigned char *out;
+  std::size_t capacity;
+  std::size_t size = 0;
+  std::uint64_t low = 0;
+  std::uint32_t range = 0xffffffff;
+  unsigned char cache = 0;
+  std::uint64_t cacheSize = 1;
+  bool started = false;
+
+  void put(unsigned char byte) {
+    // the first byte is always 0 and is left out
+    if (!started) {
+      started = true;
+      return;
+    }
+    if (size == capacity) {
+      throw std::length_error("Range coder output buffer is full");
+    }
+    out[size++] = byte;
+  }
+
+  // Emits the top byte of low, held back while a carry may still reach it.
+  void shiftLow() {
+    if ((std::uint32_t)low < 0xff000000u || (low >> 32) != 0) {
+      unsigned char carry = (unsigned char)(low >> 32);
+      unsigned char byte = cache;
+      do {
+        put((unsigned char)(byte + carry));
+        byte = 0xff;
+      } while (--cacheSize != 0);
+      cache = (unsigned char)(low >> 24);
+    }
+    cacheSize++;
+    low = (low & 0x00ffffffu) << 8;
+  }
+};
+
+
+class RangeDecoder final {
+public:
+  // Reads data[0, size). Past the end the input reads as zeros.
+  RangeDecoder(const unsigned char *data, std::size_t size)
+      : data(data), size(size) {
+    for (int i = 0; i < 4; i++) {
+      code = (code << 8) | next();
+    }
+  }
+
+  // Decodes a bit coded with the same p0 as RangeEncoder::encode().
+  int decode(std::uint32_t p0) {
+    std::uint32_t bound = (range >> RC_PROB_BITS) * p0;
+    int bit = code >= bound;
+    std::uint32_t mask = 0u - (std::uint32_t)bit;
+    code -= bound & mask;
+    range = (bound & ~mask) | ((range - bound) & mask);
+    while (range < RC_TOP) {
+      range <<= 8;
+      code = (code << 8) | next();
+    }
+    return bit;
+  }
+
+private:
+  const unsigned char *data;
+  std::size_t size;
+  std::size_t pos = 0;
+  std::uint32_t code = 0;
+  std::uint32_t range = 0xffffffff;
+
+  std::uint32_t next() { return pos < size ? data[pos++] : 0; }
+};
@@ -0,0 +1,104 @@
+/*
+ * Throughput of the binary coders on model-like input: skewed
+ * probabilities, bits drawn from them. Prints bits/second for encoding
+ * and decoding with ArithmeticCoder (32-bit state, BinaryFrequencyTable,
+ * bit streams) and with RangeCoder, and the bytes each one writes.
+ *
+ * Usage: ./bench_coders [bits]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ArithmeticCoder.hpp"
+#include "RangeCoder.hpp"
+
+double seconds(std::chrono::high_resolution_clock::time_point start) {
+  return std::chrono::duration<double>(
+             std::chrono::high_resolution_clock::now() - start)
+      .count();
+}
+
+void report(const char *name, std::size_t bits, double encode, double decode,
+            std::size_t bytes) {
+  std::cout << name << ": encode " << bits / encode << " bits/second, decode "
+            << bits / decode << " bits/second, " << bytes << " bytes"
+            << std::endl;
+}
+
+int main(int argc, char **argv) {
+  std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+  // mostly confident predictions, like a trained bit model's
+  std::mt19937 random(1);
+  std::vector<std::uint32_t> frequency(n); // P(0) * 2^30
+  std::vector<int> bits(n);
+  double entropy = 0;
+  for (std::size_t i = 0; i < n; i++) {
+    double logit = std::normal_distribution<double>(0, 4)(random);
+    double p0 = 1 / (1 + std::exp(-logit));
+    frequency[i] = (std::uint32_t)(p0 * (1u << 30));
+    bits[i] = std::uniform_real_distribution<double>(0, 1)(random) >= p0;
+    entropy -= std::log2(bits[i] ? 1 - p0 : p0);
+  }
+  std::cout << n << " bits, entropy " << (std::size_t)(entropy / 8)
+            << " bytes" << std::endl;
+
+  {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::stringstream sout;
+    BitOutputStream bout(sout);
+    BinaryFrequencyTable freqs;
+    ArithmeticEncoder enc(32, bout);
+    for (std::size_t i = 0; i < n; i++) {
+      freqs.set(0, frequency[i]);
+      enc.write(freqs, static_cast<std::uint32_t>(bits[i]));
+    }
+    enc.finish();
+    bout.finish();
+    std::string data = sout.str();
+    double encode = seconds(start);
+
+    start = std::chrono::high_resolution_clock::now();
+    std::stringstream sin(data);
+    BitInputStream bin(sin);
+    ArithmeticDecoder dec(32, bin);
+    for (std::size_t i = 0; i < n; i++) {
+      freqs.set(0, frequency[i]);
+      if ((int)dec.read(freqs) != bits[i]) {
+        std::cerr << "ArithmeticCoder: bit " << i << " differs" << std::endl;
+        return 1;
+      }
+    }
+    report("ArithmeticCoder", n, encode, seconds(start), data.size());
+  }
+
+  {
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<unsigned char> data(RangeEncoder::maxSize(n));
+    RangeEncoder enc(data.data(), data.size());
+    for (std::size_t i = 0; i < n; i++) {
+      enc.encode(rangeProbability(frequency[i]), bits[i]);
+    }
+    data.resize(enc.finish());
+    double encode = seconds(start);
+
+    start = std::chrono::high_resolution_clock::now();
+    RangeDecoder dec(data.data(), data.size());
+    for (std::size_t i = 0; i < n; i++) {
+      if (dec.decode(rangeProbability(frequency[i])) != bits[i]) {
+        std::cerr << "RangeCoder: bit " << i << " differs" << std::endl;
+        return 1;
+      }
+    }
+    report("RangeCoder", n, encode, seconds(start), data.size());
+  }
+  return 0;
+}
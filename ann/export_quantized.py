@@ -0,0 +1,159 @@
+"""
+export_quantized.py
+
+Export a trained bit model checkpoint (state_dict saved by lstm.py,
+lstm_fc.py or fc.py) as a fixed-point model for quantized_model.cpp.
+Inference is then integer only, so the probabilities the arithmetic coder
+sees are bit-identical on every x86-64 machine.
+
+Quantization:
+  - Weights are int8 with one scale per row (max |w| / 127).
+  - Each row carries a multiplier and a shift that turn the int32 dot
+    product into a Q8 pre-activation (1/256 units): (acc * m) >> shift.
+  - Biases are int32 in Q8, the two LSTM biases summed.
+  - LSTM hidden states are Q15, FC hidden activations Q8, input bits 0/1.
+  - sigmoid and tanh are tables over Q8 inputs in [-8, 8), Q15 outputs,
+    computed here so that no floating point runs on the C++ side.
+
+Format, all fields little-endian:
+  magic "BITQ", uint32 version = 1, uint32 kind (0 = BitLSTM, 1 = BitFC)
+  BitLSTM: uint32 num_layers, uint32 hidden_size
+           per layer: matrix weight_ih, matrix weight_hh, bias
+           then matrix fc.weight, fc bias
+  BitFC:   uint32 seq_length, uint32 hidden_size
+           matrix net.0.weight, bias, matrix net.2.weight, bias,
+           matrix net.4.weight, bias
+  matrix:  per row int32 multiplier, int32 shift, then the int8 weights
+           row-major
+  bias:    one int32 per row
+  int16 sigmoid[4096], int16 tanh[4096]
+
+Usage:
+  python export_quantized.py --checkpoint models/best_bit_lstm_model128.pth \
+      --output models/best_bit_lstm_model128.q.bin
+"""
+
+import argparse
+import math
+import struct
+
+import torch
+
+MAGIC = b"BITQ"
+VERSION = 1
+KIND_LSTM = 0
+KIND_FC = 1
+
+# fixed-point formats of the values a matrix multiplies
+Q_BITS = 0
+Q_FC_HIDDEN = 8
+Q_LSTM_HIDDEN = 15
+Q_PRE_ACTIVATION = 8
+
+TABLE_SIZE = 4096
+
+
+def quantize_multiplier(real):
+    """(m, shift) with m in [2^30, 2^31) and m / 2^shift ~ real."""
+    if real <= 0:
+        return 0, 0
+    shift = 0
+    while real * 2**shift < 2**30 and shift < 62:
+        shift += 1
+    m = int(round(real * 2**shift))
+    if m >= 2**31:
+        m = (m + 1) // 2
+        shift -= 1
+    return m, shift
+
+
+def write_matrix(f, weight, input_q):
+    weight = weight.detach().to(torch.float64)
+    rows, cols = weight.shape
+    if cols > 512:
+        raise ValueError("rows longer than 512 would overflow the int32 sums")
+    for r in range(rows):
+        row = weight[r].tolist()
+        scale = max(abs(w) for w in row) / 127
+        if scale == 0:
+            scale = 1.0
+        q = [max(-127, min(127, int(round(w / scale)))) for w in row]
+        m, shift = quantize_multiplier(scale * 2 ** (Q_PRE_ACTIVATION - input_q))
+        f.write(struct.pack("<ii", m, shift))
+        f.write(struct.pack("<%db" % cols, *q))
+
+
+def write_bias(f, bias):
+    values = [int(round(b * 2**Q_PRE_ACTIVATION)) for b in bias.detach().tolist()]
+    f.write(struct.pack("<%di" % len(values), *values))
+
+
+def write_tables(f):
+    sigmoid, tanh = [], []
+    for i in range(TABLE_SIZE):
+        x = (i - TABLE_SIZE // 2) / 2**Q_PRE_ACTIVATION
+        sigmoid.append(min(32767, int(round(32768 / (1 + math.exp(-x))))))
+        tanh.append(int(round(32767 * math.tanh(x))))
+    f.write(struct.pack("<%dh" % TABLE_SIZE, *sigmoid))
+    f.write(struct.pack("<%dh" % TABLE_SIZE, *tanh))
+
+
+def export(state, output):
+    with open(output, "wb") as f:
+        f.write(MAGIC)
+        if "lstm.weight_ih_l0" in state:
+            num_layers = 0
+            while "lstm.weight_ih_l%d" % num_layers in state:
+                num_layers += 1
+            hidden_size = state["lstm.weight_hh_l0"].shape[1]
+            f.write(struct.pack("<IIII", VERSION, KIND_LSTM, num_layers, hidden_size))
+            for k in range(num_layers):
+                write_matrix(
+                    f,
+                    state["lstm.weight_ih_l%d" % k],
+                    Q_BITS if k == 0 else Q_LSTM_HIDDEN,
+                )
+                write_matrix(f, state["lstm.weight_hh_l%d" % k], Q_LSTM_HIDDEN)
+                write_bias(
+                    f, state["lstm.bias_ih_l%d" % k] + state["lstm.bias_hh_l%d" % k]
+                )
+            write_matrix(f, state["fc.weight"], Q_LSTM_HIDDEN)
+            write_bias(f, state["fc.bias"])
+            print(f"BitLSTM: {num_layers} layer(s), hidden size {hidden_size}")
+        elif "net.0.weight" in state:
+            hidden_size, seq_length = state["net.0.weight"].shape
+            f.write(struct.pack("<IIII", VERSION, KIND_FC, seq_length, hidden_size))
+            for layer, input_q in [(0, Q_BITS), (2, Q_FC_HIDDEN), (4, Q_FC_HIDDEN)]:
+                write_matrix(f, state["net.%d.weight" % layer], input_q)
+                write_bias(f, state["net.%d.bias" % layer])
+            print(f"BitFC: window {seq_length}, hidden size {hidden_size}")
+        else:
+            raise ValueError("checkpoint is neither a BitLSTM nor a BitFC")
+        write_tables(f)
+
+
+def main(args):
+    state = torch.load(args.checkpoint, map_location="cpu")
+    if hasattr(state, "state_dict"):
+        state = state.state_dict()
+    export(state, args.output)
+    print(f"Saved quantized model to: {args.output}")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "--checkpoint",
+        type=str,
+        required=True,
+        help="Path to the .pth state_dict of a BitLSTM or BitFC model.",
+    )
+    parser.add_argument(
+        "--output",
+        type=str,
+        required=True,
+        help="Path of the quantized model file to write.",
+    )
+    args = parser.parse_args()
+
+    main(args)
@@ -0,0 +1,89 @@
+"""
+export_weights.py
+
+Export a trained bit model checkpoint (state_dict saved by lstm.py,
+lstm_fc.py or fc.py) into the flat binary format read by the native
+inference engine (native_model.cpp), so the C++ coder runs without libtorch.
+
+Format, all fields little-endian:
+  magic "BITM", uint32 version = 1, uint32 kind (0 = BitLSTM, 1 = BitFC)
+  BitLSTM: uint32 num_layers, uint32 hidden_size
+           per layer: weight_ih, weight_hh, bias_ih, bias_hh
+           then fc.weight, fc.bias
+  BitFC:   uint32 seq_length, uint32 hidden_size
+           net.0.weight, net.0.bias, net.2.weight, net.2.bias,
+           net.4.weight, net.4.bias
+  Every tensor is float32, row-major, in the shape PyTorch stores it.
+
+Usage:
+  python export_weights.py --checkpoint models/best_bit_lstm_model128.pth \
+      --output models/best_bit_lstm_model128.bin
+"""
+
+import argparse
+import struct
+
+import torch
+
+MAGIC = b"BITM"
+VERSION = 1
+KIND_LSTM = 0
+KIND_FC = 1
+
+
+def write_tensor(f, tensor):
+    data = tensor.detach().to(torch.float32).contiguous().view(-1).tolist()
+    f.write(struct.pack("<%df" % len(data), *data))
+
+
+def export(state, output):
+    with open(output, "wb") as f:
+        f.write(MAGIC)
+        if "lstm.weight_ih_l0" in state:
+            num_layers = 0
+            while "lstm.weight_ih_l%d" % num_layers in state:
+                num_layers += 1
+            hidden_size = state["lstm.weight_hh_l0"].shape[1]
+            f.write(struct.pack("<IIII", VERSION, KIND_LSTM, num_layers, hidden_size))
+            for k in range(num_layers):
+                for name in ["weight_ih", "weight_hh", "bias_ih", "bias_hh"]:
+                    write_tensor(f, state["lstm.%s_l%d" % (name, k)])
+            write_tensor(f, state["fc.weight"])
+            write_tensor(f, state["fc.bias"])
+            print(f"BitLSTM: {num_layers} layer(s), hidden size {hidden_size}")
+        elif "net.0.weight" in state:
+            hidden_size, seq_length = state["net.0.weight"].shape
+            f.write(struct.pack("<IIII", VERSION, KIND_FC, seq_length, hidden_size))
+            for layer in [0, 2, 4]:
+                write_tensor(f, state["net.%d.weight" % layer])
+                write_tensor(f, state["net.%d.bias" % layer])
+            print(f"BitFC: window {seq_length}, hidden size {hidden_size}")
+        else:
+            raise ValueError("checkpoint is neither a BitLSTM nor a BitFC")
+
+
+def main(args):
+    state = torch.load(args.checkpoint, map_location="cpu")
+    if hasattr(state, "state_dict"):
+        state = state.state_dict()
+    export(state, args.output)
+    print(f"Saved weights to: {args.output}")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "--checkpoint",
+        type=str,
+        required=True,
+        help="Path to the .pth state_dict of a BitLSTM or BitFC model.",
+    )
+    parser.add_argument(
+        "--output",
+        type=str,
+        required=True,
+        help="Path of the flat weight file to write.",
+    )
+    args = parser.parse_args()
+
+    main(args)
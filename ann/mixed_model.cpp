@@ -0,0 +1,237 @@
+/**************************************************************
+ * mixed_model.cpp
+ *
+ * Context mixing around a bit model, after the lpaq/zpaq
+ * predictors:
+ *   1) Logistic domain: squash and its inverse, stretch.
+ *   2) The models: hashed order-N contexts, the low orders primed
+ *      from mixed_priors.h, and a match model, updated as bytes
+ *      complete.
+ *   3) The mixer, learning online since reset().
+ **************************************************************/
+
+#include "mixed_model.h"
+#include "mixed_priors.h"
+
+#include <algorithm>
+
+/**************************************************************
+ * 1) Logistic domain
+ **************************************************************/
+namespace {
+
+// Maps a stretched prediction in [-2047, 2047] to a 12-bit probability,
+// interpolating 33 points of 4096 / (1 + e^(-d / 256)).
+int squash(int d) {
+  static const int t[33] = {1,    2,    3,    6,    10,   16,   27,
+                            45,   73,   120,  194,  310,  488,  747,
+                            1101, 1546, 2047, 2549, 2994, 3348, 3607,
+                            3785, 3901, 3975, 4022, 4050, 4068, 4079,
+                            4085, 4089, 4092, 4093, 4094};
+  if (d > 2047) {
+    return 4095;
+  }
+  if (d < -2047) {
+    return 0;
+  }
+  int w = d & 127;
+  d = (d >> 7) + 16;
+  return (t[d] * (128 - w) + t[d + 1] * w + 64) >> 7;
+}
+
+uint64_t hashMix(uint64_t h, uint64_t x) {
+  h = (h ^ x) * 0x9E3779B97F4A7C15ull;
+  return h ^ (h >> 29);
+}
+
+void adapt(uint16_t &t, int bit, int rate) {
+  if (bit) {
+    t += (65535 - t) >> rate;
+  } else {
+    t -= t >> rate;
+  }
+}
+
+} // namespace
+
+MixedBitModel::MixedBitModel(std::unique_ptr<NativeBitModel> lstm,
+                             int warmUp)
+    : lstm(std::move(lstm)), warmUp(warmUp),
+      tables(ORDERS, std::vector<uint16_t>(1 << TABLE_BITS)),
+      last(1 << MATCH_BITS), matchP(32), weights(MIXERS * INPUTS) {
+  int next = 0;
+  for (int x = -2047; x <= 2047; x++) {
+    for (int v = squash(x); next <= v; next++) {
+      stretch[next] = x;
+    }
+  }
+  for (; next < 4096; next++) {
+    stretch[next] = 2047;
+  }
+
+  for (int k = 0; k < PRIMED; k++) {
+    std::fill(tables[k].begin(), tables[k].end(), 1 << 15);
+  }
+  prime(0, 1, MIXED_PRIOR0);
+  // no previous byte: the first byte of a block, as the warm-up zeros
+  // reach only the wrapped model
+  prime(1, 2, MIXED_PRIOR1[256]);
+  for (int c = 0; c < 256; c++) {
+    prime(1, hashMix(2, c), MIXED_PRIOR1[c]);
+  }
+  primed.assign(tables.begin(), tables.begin() + PRIMED);
+  reset();
+}
+
+/**************************************************************
+ * 2) Models
+ **************************************************************/
+// Writes prior into the blocks predict() reads for the context hash of
+// the given order: the first nibble's, and each second nibble's.
+void MixedBitModel::prime(int order, uint64_t hash, const int8_t *prior) {
+  for (unsigned start = 1; start < 32; start = start == 1 ? 16 : start + 1) {
+    size_t block =
+        (hashMix(hash, start) >> (64 - TABLE_BITS)) & ~(size_t)15;
+    for (unsigned node = 1; node < 16; node++) {
+      int length = 0; // bits of the nibble in node
+      while (node >> (length + 1)) {
+        length++;
+      }
+      unsigned partial = (start << length) | (node ^ (1u << length));
+      tables[order][block | node] = squash(prior[partial - 1] * 16) << 4;
+    }
+  }
+}
+
+// P(1) of the match model: by length, up to 15, and the expected bit
+int MixedBitModel::matchSlot() const {
+  return (int)std::min<uint32_t>(matchLen, 15) * 2 + expected;
+}
+
+void MixedBitModel::byteDone() {
+  history.push_back((char)(partial & 255));
+  partial = 1;
+  bitCount = 0;
+  size_t n = history.size();
+
+  // a match that got through the byte goes on, else look for a new one
+  if (matchLen > 0) {
+    matchPtr++;
+    matchLen = std::min<uint32_t>(matchLen + 1, MAX_MATCH);
+  }
+  if (n >= MIN_MATCH) {
+    uint64_t h = 0;
+    for (size_t j = n - MIN_MATCH; j < n; j++) {
+      h = hashMix(h, (unsigned char)history[j]);
+    }
+    uint32_t &end = last[h >> (64 - MATCH_BITS)];
+    if (matchLen == 0 && end > 0) {
+      uint32_t len = 0;
+      while (len < end && len < MAX_MATCH &&
+             history[end - 1 - len] == history[n - 1 - len]) {
+        len++;
+      }
+      if (len >= MIN_MATCH) {
+        matchPtr = end;
+        matchLen = len;
+      }
+    }
+    end = (uint32_t)n;
+  }
+
+  for (int k = 0; k < ORDERS; k++) {
+    uint64_t h = k + 1;
+    for (int j = 1; j <= k && (size_t)j <= n; j++) {
+      h = hashMix(h, (unsigned char)history[n - j]);
+    }
+    hashes[k] = h;
+  }
+}
+
+/**************************************************************
+ * 3) Mixer
+ **************************************************************/
+void MixedBitModel::predict() {
+  // contexts are hashed once per nibble, its bits index a 16-slot block
+  if (bitCount % 4 == 0) {
+    for (int k = 0; k < ORDERS; k++) {
+      base[k] = (hashMix(hashes[k], partial) >> (64 - TABLE_BITS)) &
+                ~(size_t)15;
+    }
+    node = 1;
+  }
+  expected = matchLen == 0
+                 ? 0
+                 : ((unsigned char)history[matchPtr] >> (7 - bitCount)) & 1;
+  mixer = matchLen == 0 ? 0 : matchLen < 16 ? 1 : matchLen < 32 ? 2 : 3;
+
+  uint32_t p0 = std::min<uint32_t>(4095, lstm->zeroFrequency() >> 18);
+  st[0] = stretch[4095 - p0];
+  for (int k = 0; k < ORDERS; k++) {
+    st[1 + k] = stretch[tables[k][base[k] | node] >> 4];
+  }
+  st[ORDERS + 1] = stretch[matchP[matchSlot()] >> 4];
+  st[ORDERS + 2] = 256;
+
+  const int *w = &weights[mixer * INPUTS];
+  long long dot = 0;
+  for (int k = 0; k < INPUTS; k++) {
+    dot += (long long)w[k] * st[k];
+  }
+  p = std::min(4095, std::max(1, squash((int)(dot >> 16))));
+}
+
+void MixedBitModel::update(int bit) {
+  int err = (bit << 12) - p;
+  int *w = &weights[mixer * INPUTS];
+  for (int k = 0; k < INPUTS; k++) {
+    w[k] += (st[k] * err) >> 10;
+  }
+  for (int k = 0; k < ORDERS; k++) {
+    adapt(tables[k][base[k] | node], bit, 4);
+  }
+  adapt(matchP[matchSlot()], bit, 5);
+  lstm->update(bit);
+
+  if (matchLen > 0 && bit != expected) {
+    matchLen = 0;
+  }
+  node = node * 2 + bit;
+  partial = partial * 2 + bit;
+  if (++bitCount == 8) {
+    byteDone();
+  }
+  predict();
+}
+
+void MixedBitModel::reset() {
+  lstm->reset();
+  for (int i = 0; i < warmUp; i++) {
+    lstm->update(0);
+  }
+  for (int k = 0; k < ORDERS; k++) {
+    if (k < PRIMED) {
+      std::copy(primed[k].begin(), primed[k].end(), tables[k].begin());
+    } else {
+      std::fill(tables[k].begin(), tables[k].end(), 1 << 15);
+    }
+  }
+  std::fill(last.begin(), last.end(), 0);
+  std::fill(matchP.begin(), matchP.end(), 1 << 15);
+  matchPtr = matchLen = 0;
+  expected = 0;
+  // start out trusting the LSTM alone
+  for (int m = 0; m < MIXERS; m++) {
+    for (int k = 0; k < INPUTS; k++) {
+      weights[m * INPUTS + k] = k == 0 ? 1 << 16 : 1 << 14;
+    }
+    weights[m * INPUTS + INPUTS - 1] = 0;
+  }
+  history.clear();
+  partial = 1;
+  bitCount = 0;
+  for (int k = 0; k < ORDERS; k++) {
+    hashes[k] = k + 1;
+  }
+  predict();
+}
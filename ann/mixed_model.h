@@ -0,0 +1,78 @@
+#ifndef MIXED_MODEL_H
+#define MIXED_MODEL_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "native_model.h"
+
+// Mixes a bit model (the LSTM) with fast models of the bytes seen since
+// reset(): hashed order-0 to order-4 contexts and a match model that
+// follows the last occurrence of the previous bytes. A logistic mixer,
+// picked by the match length, learns online how much to trust each one,
+// so exact repeats (hashes, addresses) come from the match model and the
+// rest from the LSTM. The order-0 and order-1 models start from priors
+// trained offline (train_priors.cpp, mixed_priors.h), the others at 1/2.
+// Integer arithmetic only, like the model it wraps when that is a
+// quantized one.
+class MixedBitModel final : public NativeBitModel {
+public:
+  // reset() steps lstm over warmUp zero bits (the left padding it was
+  // trained on) before the first real bit. The other models and the
+  // mixer never see them.
+  explicit MixedBitModel(std::unique_ptr<NativeBitModel> lstm,
+                         int warmUp = 0);
+
+  float probability() const override { return p / 4096.0f; }
+  uint32_t zeroFrequency() const override {
+    return (uint32_t)(4096 - p) << 18;
+  }
+  void update(int bit) override;
+  void reset() override;
+
+private:
+  static const int ORDERS = 5; // order-0 to order-4
+  static const int PRIMED = 2; // order-0 and order-1 start from priors
+  static const int INPUTS = ORDERS + 3; // the LSTM, the match model, a bias
+  static const int TABLE_BITS = 18;
+  static const int MIN_MATCH = 6;
+  static const int MAX_MATCH = 65535;
+  static const int MATCH_BITS = 16;
+  static const int MIXERS = 4;
+
+  std::unique_ptr<NativeBitModel> lstm;
+  int warmUp;
+  std::array<int, 4096> stretch;
+
+  // order-N models: 16-bit P(1) in 16-slot blocks, one block per nibble
+  std::vector<std::vector<uint16_t>> tables;
+  std::array<uint64_t, ORDERS> hashes;
+  std::array<size_t, ORDERS> base;
+  std::vector<std::vector<uint16_t>> primed; // tables[0, PRIMED) at reset()
+
+  // match model
+  std::vector<uint32_t> last; // hash of the last MIN_MATCH bytes -> end
+  std::vector<uint16_t> matchP; // P(1) by length bucket and expected bit
+  uint32_t matchPtr = 0, matchLen = 0;
+  int expected = 0;
+
+  std::vector<int> weights;
+  std::array<int, INPUTS> st;
+  int mixer = 0;
+  int p = 2048; // P(1) in 12 bits
+
+  std::string history; // the bytes since reset()
+  unsigned node = 1; // 1 followed by the bits of the nibble so far
+  unsigned partial = 1; // 1 followed by the bits of the byte so far
+  int bitCount = 0;
+
+  void prime(int order, uint64_t hash, const int8_t *prior);
+  int matchSlot() const;
+  void byteDone();
+  void predict();
+};
+
+#endif // MIXED_MODEL_H
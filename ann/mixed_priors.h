@@ -0,0 +1,4659 @@
+// Generated by train_priors from 61151 lines, 1642804 bytes.
+// Stretched P(1) / 16 of each bit of a byte, by the bits
+// before it (1 followed by them, the index + 1) and, for
+// MIXED_PRIOR1, by the previous byte (256: none).
+
+#ifndef MIXED_PRIORS_H
+#define MIXED_PRIORS_H
+
+#include <cstdint>
+
+const int8_t MIXED_PRIOR0[255] = {
+    -4, -7, 0, -11, -1, 0, -1, -17, -1, -1, -1, -2, -2, -3, -1, -22,
+    -3, 0, -2, -2, -1, 0, -2, -1, 0, -2, 2, -1, -1, 0, 0, -31,
+    -4, 0, -1, -4, -3, -1, -1, -5, -2, -2, 0, -1, -2, -2, -1, -3,
+    -2, -1, 0, -5, -2, -1, 0, -6, -3, -1, -1, -3, -3, -1, -1, -35,
+    -1, -2, -2, -4, 2, -3, 0, -5, 0, -6, 1, -1, 0, -2, 1, -7,
+    -1, -6, -1, -1, -1, 0, -2, -2, -1, -5, 0, 0, -1, 0, 1, -5,
+    -2, -5, -1, -2, 1, -1, -1, -6, 0, -4, -2, -1, -1, -1, 1, -8,
+    0, -4, 1, -3, 0, 0, 0, -4, 0, -4, -1, 0, -1, 0, 2, -19,
+    -8, -3, -5, -7, 4, -3, 0, -4, 1, -2, 2, -4, -1, -1, 1, -7,
+    1, 0, 0, -8, 1, 0, -1, -2, 1, -2, -1, -1, -2, -1, -1, -12,
+    2, -2, 0, -8, -1, -3, 0, -5, -1, 1, -2, -2, -1, 1, 0, -2,
+    -1, -1, -1, -10, -2, 0, 1, -4, -1, -2, -1, -2, 0, -1, 1, -8,
+    -2, -2, -1, -8, -1, -1, -1, -4, 0, 0, 1, 0, -1, -2, -1, -10,
+    1, -1, 0, -7, -2, 0, 0, -1, -2, -2, 0, 1, -1, 0, -3, -10,
+    -2, 0, 0, -6, 2, -2, -1, -3, 1, -1, 1, 0, 0, 0, 0, -7,
+    -2, -1, 0, -10, 0, 1, 0, -1, -2, -2, 1, -3, -3, -1, 4,
+};
+
+const int8_t MIXED_PRIOR1[257][255] = {
+  {
+    -20, -46, 0, -43, -7, 10, -12, -36, -11, 12, -3, -15, -14, -32, -21, -39,
+    -10, -7, -9, -4, 21, -5, -7, -14, -4, -21, 14, -28, -7, -25, 0, -52,
+    -17, 14, -4, -5, 3, 6, 4, -15, 5, -1, 34, 1, 7, -5, -2, -14,
+    -4, -4, -2, -24, -7, -5, -22, -27, -8, -3, -1, -24, -3, 1, -9, -40,
+    -2, 17, 0, 1, 12, -3, -2, -3, 0, -10, 27, 1, -12, -5, 6, -17,
+    -4, -2, -1, -14, -10, -5, -44, -7, -2, 1, 14, -9, -10, 0, 2, -9,
+    -3, -8, -2, 0, -6, -5, -1, -20, -7, -1, -1, 3, -1, 9, 10, -22,
+    -4, -2, 1, -2, 2, 0, -4, -19, -20, -8, 13, 8, -5, 15, 8, -59,
+    -28, 8, -20, 4, 25, 0, -5, -4, -5, -10, 25, 3, 0, -5, 2, -5,
+    -3, 3, -2, -8, -3, -6, -41, -4, -4, -28, 3, -7, -10, -2, -11, -23,
+    -4, -1, 7, -5, 6, 0, 3, -5, -5, -15, -1, -8, -2, 12, 0, -1,
+    -3, -7, 10, -7, -2, 0, 17, -6, 0, -4, 7, -5, 10, -3, -10, -11,
+    -4, -6, 1, -2, -6, -1, -7, 0, 0, 4, 2, -1, -2, -1, -1, -18,
+    -7, 1, -1, 2, -11, -4, 6, 0, -3, -10, -1, -5, -11, 0, -6, -16,
+    -10, -5, -8, 9, 0, -1, -6, 2, 2, -4, -10, -8, -4, 14, -1, -22,
+    -7, -10, 1, -13, -15, 8, 19, -15, -8, -17, -1, -6, -32, -9, 10,
+  },
+  {
+    -12, -20, 2, -29, 2, 0, -2, -39, 0, -2, 6, -3, 0, -5, 3, -50,
+    -1, 1, 1, -3, -1, 0, -10, -3, -1, 1, 2, 7, -1, -1, 2, -59,
+    0, -4, 2, -3, -2, 0, 3, -4, 1, 2, 0, 5, -1, 6, 1, -7,
+    0, 0, 0, -1, 1, -1, 3, -4, -4, -1, -1, -3, 1, -1, -6, -64,
+    2, -2, -1, 2, -4, -2, -2, -2, 2, 0, -2, 1, -1, 1, 6, -2,
+    -1, -3, -2, -3, -1, -1, -1, 0, 0, -4, 3, -2, -5, 2, 1, -2,
+    4, 2, -2, 5, -4, -3, 0, 0, -3, -5, -4, -1, 0, 3, -2, -5,
+    1, 8, 17, -4, 6, 5, 6, 2, 0, -2, 0, 4, -6, 8, 4, 60,
+    -6, 1, -4, -4, -7, 0, -1, 5, 6, -1, 3, -3, -4, 1, 0, -4,
+    -1, 1, 1, -3, 5, 3, 5, 1, -3, 0, 1, 0, 3, -4, -1, -5,
+    -6, -2, 3, -5, 1, -8, 3, -1, -4, -1, -3, -3, 3, -2, 4, -7,
+    -2, 1, 6, -6, 0, 3, 2, 6, 2, 3, 2, 0, 8, 3, -3, -7,
+    -13, 3, 0, -5, -2, 0, -2, 7, 0, -5, -3, -2, -4, 5, 2, -5,
+    -5, -3, 1, -3, -6, 13, -6, 0, 1, 1, -6, 5, 0, -13, -2, -12,
+    6, 6, 3, 2, 17, 5, 21, -8, 1, 2, 3, -1, 11, -2, -4, 1,
+    4, -3, -6, 0, 6, 2, -3, -3, 3, -5, -2, -6, -10, 2, -4,
+  },
+  {
+    2, -4, 16, -15, -12, 1, 23, -20, -5, -14, 1, -8, -3, -6, -30, -30,
+    -3, -3, -5, -26, -4, 3, -3, -3, -4, 5, 3, 4, -4, 13, 7, -37,
+    -1, -2, 3, -6, -1, -3, 5, -41, 1, -4, -3, -1, -1, -6, 4, -6,
+    -5, 5, 1, -4, -7, -7, -3, 6, -8, -7, -6, -6, -15, -2, -11, -45,
+    -1, -3, 0, 9, -2, -1, -6, 5, 11, -11, -6, -14, -7, 4, 2, 40,
+    0, -4, -3, -4, 13, -9, -2, -2, -6, -9, 0, -10, 12, 1, 9, 0,
+    3, 3, 3, 0, 13, 0, -2, 11, -2, 12, -12, -4, 1, -5, -1, -7,
+    -15, 4, -9, -1, 0, 9, -5, 42, 14, 2, -4, 10, -1, -3, -4, -36,
+    -1, -1, -7, -6, -2, 2, 1, -5, 4, 4, 5, -1, 4, 0, 8, 6,
+    6, 1, 9, 2, 2, -21, 8, -13, -4, 2, 2, 0, -7, -1, -1, -16,
+    62, 8, -15, -10, 9, -1, 0, -25, -15, -6, -8, -15, -1, 5, -14, 7,
+    -17, -3, -5, -1, -9, -13, 1, -9, -2, -3, -4, -17, 6, 0, 2, -8,
+    4, -1, -6, -8, 9, 4, 3, -15, 3, -10, 0, -6, 3, 3, 8, -5,
+    -16, 12, -5, 3, -25, 11, 7, 3, 1, 9, 4, -13, -17, 9, 8, -17,
+    -9, -27, 1, 2, -7, 3, -5, -3, -9, -6, 3, -13, 6, -3, 3, 5,
+    -14, 33, 34, -51, 2, -5, -7, 0, -4, -16, -14, -13, -1, 2, -5,
+  },
+  {
+    -1, -5, -1, -4, -2, -1, 0, -15, 7, 5, 3, 3, -1, -6, 2, -9,
+    -4, -2, 10, -1, 4, -1, -4, -3, -5, -3, 0, 8, 6, 1, 2, 6,
+    3, 7, 7, 4, -2, -5, -18, 2, -2, -9, -7, -4, 1, -7, 1, 3,
+    -3, -14, 1, 3, -7, 12, 3, 6, -7, -8, -14, -9, -9, -2, -14, -19,
+    0, 5, -15, 9, 9, 2, 4, -4, 6, -2, -3, -10, 0, 8, 7, 0,
+    -12, -1, -2, 3, -7, -10, -3, 8, -1, 4, -2, -13, 8, 2, -1, 5,
+    -5, -9, -5, 5, 2, 10, 1, 1, -11, -10, 0, -4, 11, -5, -3, -2,
+    7, -11, 9, 0, 1, 21, 2, 5, -4, -22, 5, 4, 2, 6, -6, -17,
+    -5, -19, 3, -12, 23, -14, 6, 10, 5, -3, -3, 0, -1, -8, 9, -4,
+    3, -1, 18, -1, 5, -4, 3, -13, 2, -13, -4, 24, -43, -6, 14, -1,
+    -7, -14, -2, -14, 2, 2, -3, -5, -14, -2, -5, -25, 6, -16, -7, -7,
+    -2, 7, -3, -8, -3, 1, 6, 4, -8, 0, 10, -3, 1, 5, 4, 2,
+    -3, 0, 10, -14, 1, -2, -6, 9, 19, 1, -1, -6, 7, -7, 8, 0,
+    5, -22, 2, -13, -4, -11, -7, -6, 1, -3, 26, 13, 4, -2, -6, -13,
+    -2, 8, -14, -32, 16, -13, 22, -10, 11, 4, -7, 1, 6, -1, 0, -1,
+    -2, 10, 2, 5, -1, -3, -15, -11, -7, 1, -1, -7, -23, -8, 9,
+  },
+  {
+    -3, -4, 3, -15, -5, -1, -3, -4, 0, -12, -4, 1, -2, -11, 5, -7,
+    -23, -3, -3, -17, 2, 2, 0, -4, 3, 3, 9, 11, -2, -1, 6, -8,
+    -19, -26, 0, -2, -7, 0, 0, -24, -2, 0, -1, -2, -11, -3, -3, -16,
+    -6, -6, -8, -1, 0, 2, 6, -9, 16, 0, 2, -11, -2, 2, -11, -27,
+    9, -25, -3, -25, 4, -4, 4, -10, 1, -22, 2, -3, 0, 4, 4, -28,
+    3, -5, 8, 0, -3, 0, 10, -7, 10, 12, -8, 0, 0, 0, 3, -3,
+    3, -5, 3, 3, 1, 16, -6, -5, 3, 2, 6, -7, 6, 0, 1, -11,
+    -11, -10, 31, 1, -12, 0, -6, -15, 4, -3, -3, 2, 10, 11, 0, -27,
+    -7, -8, -16, 15, -1, -6, 7, 44, 14, 1, -6, -1, 0, -7, 2, 1,
+    -3, -2, 7, -10, -11, -3, 13, -14, 9, 6, -2, 2, -6, 3, -8, -27,
+    -1, 9, -7, -4, 0, -6, -9, 6, 6, -1, 6, -9, -1, -5, -2, -11,
+    2, 4, 2, -5, 9, 7, 9, -9, 8, -6, 3, 4, -4, -7, -4, -7,
+    -5, -6, -12, -2, 2, 13, -3, -5, -15, -7, -12, -11, 13, 5, 1, -9,
+    -23, -3, 5, -7, 2, -5, 2, -3, -4, -3, 8, -2, -2, -19, 21, -7,
+    8, -2, 0, -8, 1, 4, -22, 2, -1, 18, 8, 5, 6, 9, -6, -4,
+    -4, 0, -7, -13, -10, 17, -8, 10, -7, 19, 12, 6, -24, -3, -1,
+  },
+  {
+    2, 1, 7, -2, 2, -1, -7, -7, -3, 1, -3, -1, -3, 4, 3, -10,
+    -8, 0, 1, -2, -6, 3, -8, 6, -1, -2, -1, -5, -7, 1, 0, -14,
+    0, -11, -6, 7, -7, -7, -8, -3, -1, -10, -2, -20, -14, 10, 1, -6,
+    -12, 3, 1, 1, -2, -1, 2, 12, 4, 2, 3, -11, 2, -9, -13, -16,
+    -6, 7, 3, 0, -9, 2, -12, 0, 5, -14, -4, -10, -1, -7, 9, -10,
+    4, 0, 2, -8, 13, 0, 3, -17, 0, 19, 2, 2, 20, 7, 0, 2,
+    -6, -11, 5, -1, -11, -3, -2, -5, -9, -8, 8, -3, 5, -5, 2, -2,
+    -5, 7, 12, -24, -5, 2, -1, -6, 3, -7, -12, 23, -5, -3, -8, -15,
+    -2, 5, 4, -13, 7, -4, 8, -19, 15, 0, 0, -1, 3, -12, 12, 0,
+    -8, -10, -2, 5, 13, -1, -6, 5, -7, 3, -2, -11, -10, 3, -14, -5,
+    -7, -4, -10, -8, -25, -7, 4, -22, -13, -5, 17, -2, -2, 4, 11, 20,
+    -2, 0, 6, 5, 27, -4, -4, 1, -1, -13, -31, 3, -7, 12, 2, -8,
+    6, 4, 3, -5, -2, -12, 4, -12, -8, 9, -14, -17, -9, 1, -3, 4,
+    -5, 5, -10, -12, 7, 7, 7, 17, -8, -2, -10, 1, 0, 8, -6, -8,
+    2, 21, -15, -19, 21, -7, -1, 10, 3, -32, -29, -3, -20, -13, -24, -12,
+    6, -8, -7, -19, -6, 11, -4, 2, -28, 5, -3, -8, -12, -1, 1,
+  },
+  {
+    -8, -12, 0, -19, 1, -2, 1, -15, -4, -2, 0, -7, -3, -3, 5, 2,
+    -2, 5, -2, 5, 2, -2, -1, -5, 3, -4, -1, 6, -1, -1, 2, -34,
+    -6, 5, -18, -4, -10, -5, -7, 3, -2, 2, -2, -5, -3, 6, 1, -13,
+    -9, 1, 4, 3, -2, -1, -6, 0, 12, 3, 3, -5, 0, -4, -2, -4,
+    0, -19, -6, -7, 14, -17, 1, -2, -6, -10, -6, 17, 1, 0, 3, -2,
+    0, 0, 9, 5, -2, 1, 1, -14, 6, -4, -2, 4, -4, 3, 2, -23,
+    2, -1, 1, -3, -3, -7, -3, -4, -10, -2, -4, 5, 2, -10, -2, 6,
+    3, 3, 12, 1, 12, -5, -6, 1, 9, 0, -1, 8, -2, 16, -2, -43,
+    44, -2, 4, -24, 10, 1, -1, -6, 2, -6, 8, -15, -18, -7, 0, 5,
+    -4, -13, 4, -11, -2, 1, 0, -4, -10, -10, 5, -6, -5, -6, -6, -10,
+    13, 4, -3, 0, -13, -1, 3, -6, 2, -6, 1, -4, -5, 9, -6, -10,
+    6, -3, 13, -5, 14, -1, -7, 12, 5, -15, -2, -7, -9, 10, -4, -5,
+    -1, 11, -11, -7, 0, -7, 3, -2, 1, 7, 3, -14, 3, 5, 6, 1,
+    -2, -15, -19, -3, -1, -8, -1, 0, 0, -3, 13, 2, -1, 18, 10, -3,
+    0, 0, 11, -2, 2, 5, -2, -2, -3, -9, 0, -1, -1, 1, -20, -6,
+    -1, 14, -1, -10, -8, -4, 14, -2, 18, 0, 1, -9, 14, -6, -1,
+  },
+  {
+    0, -1, 2, 2, 2, -2, -2, -6, -6, -3, -1, -2, 2, 0, 4, -5,
+    0, 2, -2, 2, 0, -3, -5, -2, 3, -1, 0, 7, -11, -1, -1, -7,
+    -2, -5, -4, 4, -13, -2, 7, -2, 3, -3, 2, -9, 6, -3, -6, -10,
+    5, -2, -7, -10, -4, -6, 0, 2, -3, -10, 3, 0, -6, 5, -4, -20,
+    -13, -8, -3, -3, 6, -2, -1, 1, 12, -16, 1, -5, 0, -7, -1, 1,
+    6, -12, -8, 1, 1, 2, -2, -16, 4, 0, 10, 4, 3, -6, 2, -8,
+    3, 0, -12, -1, 5, 5, -4, 2, -6, -10, 4, -4, 0, 11, -6, -5,
+    -2, 8, 12, 9, -9, -6, -3, -4, -9, -15, 12, 1, -16, -9, 3, -12,
+    3, -7, 4, -6, -1, 0, 12, -1, -2, 1, 5, 2, 5, -2, 3, 1,
+    0, 3, 21, -7, 2, -4, 3, 18, 5, 3, 8, -3, 3, -16, -7, -9,
+    8, 5, -12, -10, -3, 1, -3, 5, 1, 2, 7, 0, -11, 3, 2, -3,
+    -2, -8, -3, -3, 0, -3, 25, 1, 13, -11, -3, -1, 6, -4, -14, -22,
+    5, 9, 6, -14, 4, 18, 3, 11, 0, 4, -2, -1, 1, 2, 15, 20,
+    2, -11, -14, -1, 13, 0, 12, 6, 2, -8, -2, 5, 2, -16, 2, -3,
+    -5, -8, 7, -9, 24, -6, 29, -3, -11, -10, -8, -6, -13, 0, -12, -6,
+    -5, -19, 7, -15, 7, -8, -3, -16, 12, -21, 3, -2, -13, 8, 10,
+  },
+  {
+    -7, -9, 5, -1, -6, -3, -2, -18, -15, -2, -1, 0, -3, 1, 5, -22,
+    -5, -20, -5, 1, -9, 4, -2, -1, 3, 2, 1, 5, -5, 4, -3, -27,
+    -2, -4, -6, -29, -5, 1, 0, -15, 5, -17, 1, 4, -2, -3, -5, -6,
+    -3, 0, 0, 0, -12, -3, -5, 2, 10, 8, 3, -4, -8, 3, 4, -33,
+    -4, -3, 0, 3, -2, 0, -8, 42, -9, -1, -1, -8, -1, 1, 4, -19,
+    7, 10, -1, 16, -2, -1, 4, -3, -1, -4, -2, -2, 12, 1, -9, -1,
+    2, -8, -4, -1, -12, -4, -3, -3, 2, -2, 0, -3, 1, 1, 2, 0,
+    -7, -3, 10, 8, 16, 2, 11, -3, 3, -5, 3, 0, -9, 3, -9, -24,
+    -7, -16, -3, -15, -6, 3, 4, -4, -2, -11, -5, -4, 9, -9, 3, -13,
+    62, 2, -6, 6, 9, -1, 7, 5, 3, 8, -11, 3, -4, -3, 1, -7,
+    0, -10, 10, -22, 0, -17, 2, 0, -17, -8, 1, -4, -7, -4, 3, -3,
+    2, -6, 4, -16, -2, 5, 0, -1, 0, 3, 1, 8, 4, -10, -18, -16,
+    2, 0, -9, -7, -2, 3, 2, 1, -18, -3, -3, -7, 4, -2, 2, 13,
+    2, -14, -6, -14, 1, -8, -14, 5, -3, 0, 1, 2, -8, 8, -20, 1,
+    5, -8, 6, -6, -11, -1, -13, -3, -8, 5, -2, 0, -11, -10, -9, 3,
+    6, 2, 2, 0, -6, 18, 3, -6, 0, 2, -2, 2, -16, -15, -2,
+  },
+  {
+    -2, -6, -1, -4, -1, 0, 1, -16, -1, -2, 0, -3, -1, -2, 3, -18,
+    -1, 5, -3, -4, 10, -1, 2, -9, -1, -1, 3, -3, 3, 1, -1, -24,
+    4, 1, -1, 1, -8, 8, -8, -9, -1, -6, -4, 1, 7, -2, 0, -2,
+    -4, -8, 0, -4, -9, -3, -10, 1, -1, -3, -12, 1, 5, 1, 3, -20,
+    3, -8, -4, -5, -4, 4, 6, 6, -6, -20, -1, -5, 9, 8, 0, 1,
+    0, 5, -4, 1, -11, -13, 8, 6, 5, -5, -1, 7, -2, -12, 10, 5,
+    -8, -8, 7, -6, -1, -4, 2, -2, 4, -1, -8, -2, -14, 14, 3, 6,
+    -14, -10, -7, 0, 0, -7, 1, -2, 1, -4, 7, -6, -6, -2, 8, -21,
+    1, -17, -13, -14, -4, -7, -9, -1, 4, -4, 0, -4, 3, -7, -13, -9,
+    1, -5, 5, -24, -9, 17, 13, 1, 1, 5, -21, 9, 12, -1, 5, -13,
+    15, -8, 14, -13, 3, 7, 5, 6, -10, -4, 0, 20, 2, -2, 4, 0,
+    -10, -6, -23, -9, 9, -2, -1, -3, -7, -10, 2, 4, 7, -8, 19, 3,
+    -8, -5, 2, -1, -5, -4, 18, 7, -6, 0, 7, -11, -6, -5, -1, -16,
+    -4, -1, 12, -6, 2, -1, -5, -7, 10, 2, 1, 5, 21, 3, 4, -5,
+    8, 19, 4, -1, -4, -6, -1, -10, 10, 3, -5, -12, -9, 0, 0, 3,
+    -9, 1, -10, 1, 3, -4, 6, -8, 7, -29, 3, -5, -9, -3, 14,
+  },
+  {
+    -5, 0, 1, -10, 3, 0, -3, -13, 1, 2, 15, -3, 0, -5, 0, -14,
+    -1, 2, 2, 0, -1, -1, 19, -1, 0, 5, -4, -5, -1, 3, 0, -21,
+    3, 2, 9, -7, -5, 3, 2, -2, -1, -3, -9, -7, -7, 0, 21, -1,
+    -6, 0, -1, -3, -3, -1, -1, -10, -6, 5, -4, 5, -7, 4, -5, -24,
+    2, -10, 1, -10, 6, -3, 6, -4, -2, -2, -8, -7, -1, -3, 3, -7,
+    -4, -4, -5, 2, -9, 19, -7, -6, 1, -7, -6, 2, 11, 0, 25, -3,
+    0, -7, -10, -1, 7, -8, -1, -3, -1, -7, 2, 5, -2, 5, -3, 15,
+    -2, -7, 5, 1, 4, 4, -4, -3, 4, 2, 1, 1, -9, 7, -3, -36,
+    -1, -17, -15, -4, -22, 4, -11, -4, -1, 0, 4, 6, 8, -5, 11, -8,
+    -8, -9, -1, -5, 1, 2, 12, -5, 0, -5, 2, 7, 5, -3, -13, -15,
+    -4, 11, 3, -5, 5, 7, 4, -10, -22, -11, 8, -1, 17, 9, -10, -1,
+    7, -8, 0, -13, -7, 1, 10, 9, 3, 5, -7, 10, 6, 20, 48, 9,
+    15, -9, 1, -6, -2, 1, 1, 7, 5, 11, -4, -2, 5, 6, 0, -11,
+    -7, 11, 9, -9, 10, -5, 6, 0, 0, 17, -6, 0, 9, 3, -13, -11,
+    15, -1, -5, -16, -2, -14, -11, -6, -6, -2, 10, -13, 0, -1, 11, -3,
+    -6, -4, -15, -20, 16, -4, 0, 6, -8, 11, -3, 12, -11, 9, -1,
+  },
+  {
+    11, -2, -15, -3, 0, 5, -2, -3, 2, 1, -6, -9, -10, 0, -3, -7,
+    3, 4, -2, 2, -4, 3, 0, 27, 9, 0, -2, -5, 0, 6, 2, -13,
+    -2, -2, 10, -5, -5, -6, -5, -7, -4, -3, 2, 3, -7, -5, 2, -10,
+    -8, 14, 26, -37, -6, -7, -5, -13, -3, -8, -7, -4, -10, -1, -6, -30,
+    9, -9, -11, -4, -10, 3, 11, -5, -5, 1, 4, 2, -5, 9, 1, -7,
+    1, 4, -7, 12, 4, -5, -14, 7, 1, -12, -6, -1, -4, -3, 0, -9,
+    1, 21, -25, 3, 13, -1, -37, 3, -6, -32, -33, -2, -23, -15, -24, -18,
+    2, -6, 10, -8, -1, 5, 5, 5, -1, 23, 1, -2, -6, 7, 7, -17,
+    24, -4, -16, -10, -3, -3, -5, -8, -12, 3, -2, -1, -3, -11, 4, -9,
+    -4, 3, 13, -3, -17, 2, -19, 9, 1, 14, 14, -20, -8, -4, 9, -11,
+    0, 3, 3, -24, 12, -8, 12, 5, -14, 4, -4, -9, -4, -5, 9, 2,
+    -19, 0, -3, 0, -1, 7, -1, -11, 10, -7, 8, -5, -13, -9, 4, -11,
+    1, 3, 12, -2, 6, -40, -11, -5, 5, -7, -30, 1, 9, -16, 14, -39,
+    52, 11, -19, -44, -5, -42, 3, 34, 4, -33, 3, 36, -4, -23, 8, -21,
+    -16, -8, 0, -11, 2, 7, -2, 2, 8, -7, 3, 3, -16, -5, 3, -3,
+    2, 4, 15, -14, 30, -3, 2, 1, 5, 2, 11, -7, 9, 7, 12,
+  },
+  {
+    -4, -4, 0, -6, -4, -6, -3, -5, -1, -7, 3, -2, -2, -4, 1, -3,
+    0, 0, -1, -9, 3, -2, -1, -1, 1, 1, -1, -5, 1, 2, 1, -7,
+    -13, -3, 0, -8, 6, 1, 5, -12, -5, -4, 4, -1, -1, 0, 1, -8,
+    -1, -4, 4, 2, 1, 0, 3, -5, -1, 3, -4, 1, -3, 5, -2, -11,
+    -1, -16, 2, -3, -8, -5, -7, -9, -3, -4, 1, -12, -11, -6, -6, -12,
+    -5, -7, -5, 4, -6, -6, -2, -15, -3, -7, 4, -5, -4, -2, 3, -10,
+    4, 1, 1, 0, -4, -9, 1, -10, -2, -12, 3, -9, -2, 5, -5, -5,
+    -3, -5, 9, -2, 7, 5, -1, -5, 9, -3, -14, -4, -5, 3, 3, -21,
+    2, 19, 4, 6, -5, -3, 6, -23, 4, -13, -8, -13, 14, -18, 2, -15,
+    3, -1, -4, -2, 2, -6, -2, -10, -2, 13, -2, -13, -2, 0, 9, -6,
+    3, 11, 7, 2, 1, 2, 7, -1, -4, -4, -3, 10, 8, -3, -5, -7,
+    -2, 10, 1, 2, -3, 16, 8, -9, 8, 4, 20, 4, -1, 5, -16, -4,
+    -7, -3, -8, -5, 7, 5, 4, -22, -10, -6, -4, -5, -2, 6, -2, 3,
+    1, 0, 2, -10, -9, -2, -1, -5, -6, -2, 0, 2, 3, -10, 2, 5,
+    0, -18, 8, -23, 3, 3, -7, 3, 3, -2, 8, 3, 7, 0, 4, 4,
+    -2, 4, -10, -10, -4, -6, -8, -17, -2, -2, -4, 1, 4, -2, -4,
+  },
+  {
+    -2, 0, 0, -7, -3, -3, 2, -8, -1, -7, -2, -6, -5, 0, -3, -7,
+    -3, 1, -5, -9, -2, 1, -6, 3, -2, 7, 2, 2, -2, -5, -2, -12,
+    -3, -4, 1, 0, -3, -4, 0, -14, -1, -1, -3, 0, 2, -4, -4, -3,
+    -12, 8, -4, -3, -10, 0, 5, -3, -4, 0, 5, -2, -4, -1, -7, -14,
+    -6, -11, -1, -3, 0, -13, -4, -3, -8, -8, 5, -1, -4, 4, 7, -23,
+    -12, -9, -2, 0, -6, 3, -4, 2, 3, -12, -9, -1, -4, 10, -9, -3,
+    7, -19, -1, -2, -9, 2, 1, 1, 7, -16, -16, -1, -4, 8, -11, -2,
+    -1, -5, 4, -3, -4, -2, 10, -22, 14, -6, 5, 5, 14, 9, 2, -18,
+    2, -5, 13, 3, 5, 2, -6, -8, 2, -4, 1, -5, -3, -1, 5, 8,
+    -1, -1, 4, -7, -3, -4, 10, -3, 12, -3, -5, 1, -1, 6, 7, -41,
+    -2, 15, 5, -13, 1, 3, 6, -9, -6, 4, 4, -3, -3, -7, -7, -13,
+    9, -6, -5, -26, -8, -17, -2, -7, 7, -1, 0, 0, -6, -1, -4, 4,
+    -14, -7, 6, -28, -5, 4, -3, -9, -6, -8, 0, 0, 4, 12, -13, -2,
+    3, -4, -3, -12, -2, -9, -11, -8, -9, -4, -2, 7, 4, 2, -2, 1,
+    3, -7, -4, -9, -6, -6, 5, -2, 7, 9, 8, 3, 7, 1, 13, -20,
+    9, -4, -21, -6, -8, -9, 0, 2, -11, 7, 4, -4, 2, 2, -5,
+  },
+  {
+    -1, -3, 2, -5, 2, -1, -4, -9, -4, -2, 0, 0, 1, -5, -2, -16,
+    -1, 9, -6, 4, -5, 1, -1, -1, 1, 0, 4, -2, -1, -3, 4, -23,
+    -5, 0, 1, -4, -6, 6, -1, -6, -5, -5, -2, -5, -1, -6, 1, -2,
+    6, -2, 1, 3, -2, 2, 5, -16, 9, -8, 4, -2, 4, -1, -1, -25,
+    -4, -9, -9, -7, 0, -2, 4, -8, 8, -22, 0, -4, -6, -9, 1, -10,
+    2, -7, 5, -19, 2, -13, 5, -4, -4, 3, 7, -12, -9, -7, -5, -12,
+    8, 2, -20, -11, 7, 0, -2, -3, 3, -9, 2, -4, 0, -1, 1, 14,
+    0, -9, -4, 4, -8, -4, -4, -4, 8, -8, 1, -4, -1, -6, -9, -38,
+    -1, -12, 6, -3, 6, 11, 3, -8, 3, 10, -10, -1, -14, 1, -12, -15,
+    0, -11, 3, -24, 4, 2, -1, 7, 9, -22, -5, -10, 1, 2, -5, -3,
+    -4, -4, 0, -19, 0, -12, 8, -15, -3, 6, 5, -7, 0, -1, -7, 6,
+    -4, -1, -3, -4, 3, 3, 2, -21, 7, -5, -2, -5, 4, -10, 20, -17,
+    1, 1, -10, -9, -1, 2, 14, -5, -2, -8, 8, -1, 5, 16, 4, 6,
+    -9, 2, 18, -9, 2, -6, -26, -6, 1, -2, -10, 13, 3, -2, -7, -7,
+    31, 11, 5, -7, -12, -9, 9, -7, 5, -5, 5, 1, -8, -12, -18, 8,
+    -8, 5, -12, -25, -4, 2, 10, -13, 14, -6, 6, -6, 2, 0, -4,
+  },
+  {
+    1, -3, 0, 0, 1, -2, -2, -5, 3, -2, -3, -8, -1, 3, 2, -11,
+    4, 0, 3, -2, -3, 1, 0, 10, -1, -8, 0, 1, -9, 4, -8, -10,
+    -5, -5, -5, -9, -2, 1, -12, -1, -5, 3, 1, 4, -8, 3, -3, -4,
+    -13, -1, -2, -2, -3, -2, -6, -9, -5, -11, -4, -5, 6, -10, 7, -24,
+    -4, 3, 0, -5, 2, 7, -1, 1, 2, -1, -1, -2, 14, -24, -4, 5,
+    -6, -12, -12, -1, -1, -6, 1, 6, 1, -1, -3, -6, -8, 2, -3, 3,
+    0, 22, 2, -6, 1, 3, 1, -13, -4, -5, 5, -8, 0, 7, -8, 13,
+    -6, -12, -2, -17, 0, 0, 4, 6, -2, -14, -9, 0, -3, 1, 2, -25,
+    7, -8, -5, -4, 13, 6, -2, 5, 1, -2, 4, -7, 13, -6, 1, -7,
+    20, 9, -2, -15, 13, -10, -10, 7, 8, -8, -1, -25, -3, -15, -14, -9,
+    -14, 5, 2, -6, 7, 3, -13, 4, 12, 12, 1, -2, -1, -6, 1, 6,
+    -11, 6, 3, -1, -12, 8, 1, 10, 5, 2, -6, 10, 9, -7, 8, -10,
+    2, -3, -10, -5, -34, -11, 7, -4, -9, -7, 2, 8, 2, 13, -2, -7,
+    -2, -20, 0, -3, 2, -11, -2, 10, -13, -2, -4, 3, -8, -4, 5, 3,
+    6, -4, -9, 10, 5, 15, -6, -39, -2, -2, 1, 0, 4, 7, 1, 7,
+    -5, -5, 3, -26, -4, -9, -7, -9, -4, -4, 1, -3, 0, 2, 10,
+  },
+  {
+    -6, -8, -1, -11, -1, 3, -1, -16, 1, -3, 1, 1, -7, -1, 0, -15,
+    -3, 0, 2, 0, 0, -2, -7, -8, -3, -2, -2, 5, -6, 0, -1, -19,
+    -12, 5, -4, -9, -4, 11, -4, 7, -7, 5, 2, -1, -2, -3, -2, -7,
+    -2, -5, 1, -14, 4, -5, 3, -8, -8, 5, 5, 3, 7, -7, 5, -40,
+    -4, -2, -5, -5, 10, -10, -4, 10, -15, 3, 4, 7, 12, 11, -2, -7,
+    18, -2, -8, -5, -8, -9, 10, -5, -12, -3, 7, 4, 0, 4, -3, -1,
+    -5, 3, 0, -7, -6, 9, -5, -25, 2, -7, -12, -13, -6, -1, 2, -3,
+    -1, -23, 2, 9, -2, 3, 4, -2, 6, -7, 5, 8, -5, -7, 10, -35,
+    -4, -4, -5, 2, 12, -8, 6, 0, 7, -4, 20, -10, -3, 9, 3, -7,
+    19, -6, 0, -11, -6, 3, 8, 0, 4, 2, 16, -8, 17, 4, 2, -7,
+    0, 1, -20, -4, -23, -14, -4, 1, -11, 10, 4, 13, 15, 6, -17, 1,
+    -2, 2, 0, -6, 4, -6, 2, -7, 15, -5, 5, 1, 9, -5, -1, -11,
+    0, 1, 0, -4, 3, -9, 0, 10, -10, -12, -16, -9, -4, -1, -9, -34,
+    9, 2, 8, -7, -15, 1, -4, -12, 14, 21, 5, 15, -3, -5, -3, -1,
+    1, 3, 8, -28, 8, 5, -13, 4, 11, 16, 5, 5, 1, -10, -8, -11,
+    -22, 8, 7, -16, 11, 5, 7, 2, -15, -7, -4, 1, 1, -1, -9,
+  },
+  {
+    1, -4, -5, -7, -1, 7, 2, -3, 0, -4, -4, -1, -16, -2, -1, -11,
+    -3, 0, -1, -2, -2, -4, 3, -3, 3, 20, 0, 1, -1, 5, 3, -20,
+    1, -9, 6, 0, -4, 1, -5, -5, -1, -1, 2, -1, -1, -3, 2, -9,
+    2, -1, -2, 0, 24, 0, 1, 4, -4, 2, 0, 1, 0, -1, -1, -16,
+    -2, -5, -5, 17, 7, 0, -10, -3, 2, -10, 19, 2, 3, 0, 5, -15,
+    5, -5, 1, -9, 0, 6, -1, 0, 5, 1, 1, 3, -8, 5, -2, -6,
+    0, -3, 1, 5, -5, -9, -6, -3, 3, -1, -34, 1, 5, 4, 3, -6,
+    -10, -2, 2, -1, 5, -2, -1, 2, -4, 2, 3, 5, 5, 4, -5, -15,
+    -14, -6, -4, -9, -14, 3, 18, -8, 26, -3, -6, -9, 10, 4, 2, -2,
+    12, 2, 7, -9, -13, -15, -1, 0, 3, 2, -1, -10, -7, -1, -1, -6,
+    -7, -9, 7, -1, -4, -4, 6, -2, 10, 0, -1, 1, 7, 3, 1, -6,
+    7, 11, 14, 0, -1, -8, -6, 4, -1, 0, -5, -6, -6, -3, 3, -5,
+    -3, 8, -4, 2, 5, 6, 3, 9, -6, -4, 0, -4, -1, -23, 8, 4,
+    8, 1, -1, -8, 10, 37, -5, 10, 4, 1, 0, 5, -10, -16, 8, -8,
+    -6, -7, 2, -3, -3, 3, 12, 2, 3, 4, 1, 3, 6, 0, 1, 6,
+    3, 5, 14, -5, 4, -5, 20, 5, 6, -1, 1, 2, 4, -4, 8,
+  },
+  {
+    0, -1, 1, -4, 0, 0, 0, -5, -2, 2, -3, -4, 2, -5, 3, -11,
+    -4, 1, 2, 0, 3, 3, -3, 0, 2, 2, 2, 7, -4, 1, 0, -16,
+    -4, -6, 4, -5, 3, -2, 6, -6, -12, 4, 7, -6, -1, -8, 2, 2,
+    -6, 2, -2, -12, 0, -8, -4, -7, -6, -2, -7, -5, -9, 4, 1, -25,
+    1, -5, -11, -3, -7, -1, 3, 5, 8, -7, -7, -6, 3, -10, -4, -6,
+    -3, -4, 1, -4, -3, 4, 13, 2, 0, -8, 2, 5, -10, -1, 1, 4,
+    2, 15, 0, -1, 5, 11, 7, -5, -6, -5, -13, 9, -3, -12, -3, -2,
+    1, 9, -2, -5, -7, -2, 2, 13, 2, -12, 1, -4, -14, -7, 11, -31,
+    -10, 3, 1, -3, 5, 4, -24, 14, -6, -47, -2, -6, 4, 11, -6, -12,
+    -4, 0, -5, -8, -9, -22, 0, -1, 2, 0, 9, -6, 14, -9, -13, -21,
+    2, -4, -7, 2, 3, -3, 6, -10, -11, 6, -1, -8, 2, -6, 3, -11,
+    13, -1, 5, 7, -3, -8, -1, 1, 1, 6, -11, -1, -8, 0, -11, -13,
+    -10, -11, 16, 2, 12, -11, -11, 2, 1, 6, 2, -1, -8, 7, 4, -11,
+    -1, 13, -20, -4, -5, 18, -11, 6, -21, 12, 11, 16, 1, 10, 6, -7,
+    -6, 18, -21, -3, 18, -12, -3, -4, -3, -5, -3, -2, 17, 3, -1, -9,
+    -2, -15, -7, -3, 7, 7, 12, 1, 3, -24, -4, -11, 6, -8, -12,
+  },
+  {
+    0, 1, -3, 1, -4, -4, -1, -8, 4, -12, 1, -5, 0, 4, 1, -7,
+    -4, 2, -5, -11, -2, 3, 1, 8, 11, -3, 3, 3, 3, -2, -9, -7,
+    -8, 9, -1, -1, -7, -12, -3, -25, -3, 0, 8, 3, -5, 6, -4, -4,
+    0, -3, -5, -8, -4, -4, 1, 1, -5, -6, 0, -1, 2, 14, -4, -14,
+    -5, 1, 0, -1, -13, 6, 4, 4, -1, -7, -13, -14, 4, -9, -3, -28,
+    8, -14, -3, -4, 3, -1, 3, -5, 3, -4, 0, 1, 5, 4, 5, 7,
+    4, -24, -7, -7, -12, -19, 8, -6, 5, 2, 5, -9, 0, 15, -3, 3,
+    8, 10, -2, 0, 3, 4, 5, -7, -2, -1, 2, -7, -20, -4, 6, -20,
+    7, -9, -5, -10, -3, 0, -2, -10, -1, 24, 7, -1, -9, -7, 8, 4,
+    5, -5, -1, -13, -4, 9, -6, -24, -1, 1, 6, -11, 6, 6, 2, -42,
+    7, 13, 9, 3, 8, 3, 5, 2, 1, -12, -20, -5, -6, 4, 5, -3,
+    1, 1, -4, -6, -16, -1, -1, 1, -1, -1, -6, 9, -5, -1, 5, -4,
+    -13, 3, -7, -26, 1, 18, 20, -30, 4, -9, -9, 25, -4, -16, 7, -13,
+    -11, -14, 9, -5, 8, 6, 5, -6, 2, -3, 0, -10, 9, -1, 3, -1,
+    -7, -9, 10, -6, 21, -1, 16, -5, -2, -4, 6, 13, -5, 2, 3, -7,
+    -2, 6, -9, -16, 12, 0, -2, -4, -6, -36, -11, 4, -3, -6, 5,
+  },
+  {
+    -4, 0, 1, -5, 5, -1, 0, -11, 0, -1, -9, -3, 1, -2, 0, -12,
+    -2, 0, 5, -2, -1, -14, 6, 0, 1, -3, -6, 0, 3, -3, 6, -5,
+    -10, -8, 4, -7, 1, 2, 13, -1, 1, 4, 9, -21, -5, -1, 1, -5,
+    0, -3, 0, 3, -2, 9, -2, 10, -3, 5, -2, -4, -7, -2, 9, -20,
+    15, -13, -3, 7, -7, 2, -5, -13, -9, -7, 8, -7, -1, 1, 7, -6,
+    -2, -3, -2, 3, -6, -6, 4, -29, -3, -5, 1, -4, 2, 3, 9, -4,
+    -3, -8, 8, -1, -15, 1, 6, -1, -15, -2, 0, -1, 10, 3, -7, 3,
+    0, -4, 6, 3, 0, -3, 2, -3, 19, -12, -2, -8, 3, 3, 11, -18,
+    14, 3, 15, -20, -6, 8, 4, -7, 16, 4, -1, -2, -2, 6, 2, -11,
+    4, -7, 4, -1, -8, -6, 6, -5, -2, -6, -3, 0, 1, 17, -16, 6,
+    9, 5, 6, -21, 13, -5, -14, 1, 13, -17, -5, -13, -1, -9, -3, -28,
+    0, 10, -4, 2, -6, 4, 7, -5, -1, -1, -3, -6, 28, -11, -14, 20,
+    -6, -16, -4, -6, 4, 7, 1, -4, 12, 14, 2, -3, 2, 5, 3, 12,
+    13, -14, 2, 3, 13, 3, 6, 3, -11, -3, -33, -2, -7, -4, -5, -8,
+    -3, 6, 15, -7, 5, -13, 8, 1, -5, -1, 1, 2, -4, -9, 1, -3,
+    -3, -3, 11, -10, 5, 1, -1, -20, -4, 1, 0, -4, 2, -11, -24,
+  },
+  {
+    -2, 1, 0, -4, 0, -1, -4, -5, -1, 1, 2, -6, -3, -3, -3, -8,
+    -2, -1, -4, -7, -3, 7, -8, -4, -1, -7, 4, 8, 9, -1, 3, -12,
+    -3, -7, -7, -4, -1, -2, 1, -4, -4, -8, 4, 2, -1, -2, 3, 9,
+    6, -1, 0, 3, 0, 3, 1, -6, 0, 3, -13, -1, -5, -5, -4, -5,
+    1, -4, 4, 3, 1, 18, 2, -8, 2, -2, 4, -8, -6, 1, 5, 8,
+    -6, 0, -2, -13, 4, -3, 3, -2, 5, 2, 2, 14, -2, 0, -12, -3,
+    3, -8, -10, -7, -1, -1, -3, -9, 0, -8, 0, -9, 0, -8, -1, -4,
+    -4, -4, -9, 1, -2, -15, 4, -4, -11, 0, -5, 0, -9, 9, 3, -27,
+    16, 7, 11, -21, -3, -4, 13, 13, 12, 2, 4, -6, 5, 4, 10, -16,
+    -1, -3, 14, -3, 11, 0, 14, -13, 8, 7, 12, 6, -23, 1, 8, -6,
+    -10, -13, -1, -8, -4, -12, -7, 6, 11, 7, -1, -17, -2, 3, 4, -11,
+    5, -6, -2, -4, 20, -29, 6, -5, -25, -3, -6, -6, -5, 6, -15, 0,
+    -3, -3, -7, -9, 8, -3, 9, -4, -8, -3, 0, -9, -1, 5, -2, -1,
+    0, -6, -15, -9, -2, -9, 9, -5, 6, 5, 1, -1, -7, -12, 6, -5,
+    -1, -5, 7, -10, 13, 13, -2, -2, -9, 0, -16, -31, 7, -1, 0, -12,
+    -4, -2, 9, 1, 1, -2, 11, 3, 9, 5, 19, -3, -12, 7, -1,
+  },
+  {
+    -3, 3, 2, -4, 7, -3, -3, -11, -2, 1, 13, 1, -4, -10, -1, -13,
+    -6, -3, 3, -2, -6, -4, -26, 5, -6, 3, 1, 12, 1, 5, -1, -28,
+    10, -8, -3, 3, -8, -6, -3, 0, -1, -15, -7, -4, -6, 8, 2, -1,
+    -1, -9, 3, -3, -8, -4, 1, 1, -15, -1, -6, 1, 2, 1, -5, -34,
+    -2, -2, -16, 3, 0, 9, 0, -6, -3, -10, -3, 5, 8, 8, -1, -11,
+    -9, 2, -10, -22, 11, -3, -2, 16, 9, -14, 11, 10, -33, 0, -7, -8,
+    0, 3, 9, 23, 8, -4, 3, -6, 8, -13, -5, -3, 3, 2, -2, 7,
+    -1, -17, -14, 0, 0, 0, -10, 6, 1, 6, 10, -11, 0, -15, 8, 1,
+    -2, 2, -2, -7, -5, -24, -9, -1, -4, -2, 0, 11, -4, 3, 11, 6,
+    -2, 15, -10, 2, 3, 1, -6, -1, 1, 3, -4, -8, 21, 6, 2, 7,
+    0, 23, -4, -7, -3, -7, -2, -35, 18, 0, 7, -9, -1, -7, -6, 0,
+    31, 4, 11, 1, 0, -4, 9, -14, 40, -24, -12, -4, -2, -10, -1, 5,
+    2, -6, 4, -6, -12, -12, -12, 0, 23, 11, 5, -6, -4, -15, 14, -9,
+    12, 1, -11, -13, 3, 11, -12, 2, 10, 1, -12, -1, 1, 0, -7, -4,
+    3, -3, -11, 27, 16, -35, 1, -10, -8, -2, 11, -3, -10, -5, 3, -9,
+    -1, 4, 0, 4, 18, 1, -14, -17, 7, -19, 4, -23, 13, 0, -3,
+  },
+  {
+    -6, 4, -2, -5, -8, -2, -1, 3, 2, 3, -1, -8, -4, -2, -1, -6,
+    -5, 4, 8, -24, 5, -6, -6, 8, -1, 3, -7, 1, -9, 1, -7, -20,
+    1, 20, -15, -4, 8, -3, -17, 7, 1, -22, -29, 8, -14, -8, -7, -4,
+    14, -2, -4, -1, -2, 0, 1, -5, -5, 13, 3, -1, 1, -2, -1, -23,
+    -6, 2, 1, -1, 8, -23, -11, -15, 0, -4, -16, 4, 7, -22, 10, -28,
+    37, -6, -1, -26, -7, -33, -6, 13, 9, -14, -7, 19, 0, -11, 8, -3,
+    -3, -3, -26, -3, -9, -3, -3, -2, 2, 5, -11, 10, -1, 1, 7, 3,
+    -3, -2, 2, 9, 18, -5, 0, -3, -1, 1, -10, -4, 4, -11, 6, -25,
+    5, -7, -3, -14, 12, -1, -10, -16, -1, -34, -33, -27, -2, -1, -11, -13,
+    11, -7, -4, -7, -4, 27, 5, 2, 5, -3, 7, 11, 5, 1, -4, 6,
+    -3, -5, -27, -14, 5, -3, -6, -2, 0, -2, -3, -48, -4, 1, 5, 13,
+    21, 18, 6, 13, -13, 16, 0, -1, 17, -5, -6, 19, 3, -3, 7, -4,
+    -13, 1, 1, -1, -1, 39, 4, 0, -1, 7, 0, -4, -2, 7, -16, -5,
+    -3, -7, -8, 2, 14, -8, -7, 15, -18, -5, -12, -10, -4, -4, 6, 7,
+    14, 1, 1, 4, 2, -8, -3, 7, 2, 3, 23, -9, 13, 4, -8, -19,
+    0, 18, -1, -5, -4, -6, 16, -6, -3, -9, -6, -4, 6, -9, -2,
+  },
+  {
+    -1, 2, -5, -4, 5, 8, 2, -12, 1, 1, -12, -3, -9, -2, 1, -6,
+    -1, -5, -8, 0, 5, -15, 2, -1, 1, 0, 6, 6, 3, 6, 0, -12,
+    -7, -5, 4, -6, -6, -7, -4, -4, 2, -3, 2, -12, 0, -1, 6, -2,
+    -1, 11, -3, -22, -20, 0, -12, -8, -6, 4, 1, -3, -6, -3, -12, -26,
+    12, 0, -8, -15, 4, -10, 0, -17, 7, -4, -3, -17, 2, -4, -2, -11,
+    9, -2, -7, -4, 6, 2, -9, -30, -1, -2, 1, -15, -2, -8, 9, 11,
+    8, 1, -8, 4, 14, 4, -4, -21, -2, 23, 2, 0, 1, 21, 7, 2,
+    7, -11, 0, 7, 1, 5, -9, -6, 3, 10, 6, -13, -4, 7, 4, -13,
+    -5, -5, -13, -3, 16, -2, 4, -11, -7, -1, -6, -8, 3, 2, 11, -21,
+    -8, -9, -7, -4, 5, 7, 2, 0, 10, -7, 11, 6, -6, -16, 9, -11,
+    3, -14, -1, -12, -13, -14, -2, -16, 6, 4, 8, 8, 2, 19, -5, -40,
+    4, 0, -2, -8, -13, 1, 9, 7, 1, 2, -7, -2, -12, 9, -3, 4,
+    -18, 9, -17, -17, 2, -5, -5, -4, -10, -4, 0, 0, -1, -12, 3, 32,
+    -8, 6, 7, -12, 33, -3, -10, 2, 0, -4, -5, 0, 34, -1, 4, 0,
+    -4, -1, -4, -20, -4, -7, 2, -13, -7, -11, 8, 0, 1, -21, -13, 4,
+    -7, 3, 12, -10, 3, 6, -5, 33, -2, -12, 7, 3, 8, -15, -2,
+  },
+  {
+    -1, -4, 1, -4, -1, -1, -1, -11, 0, 1, -2, -3, -2, -3, -1, -12,
+    0, 5, 0, 4, 0, 2, 2, -2, -3, 0, 3, 2, -2, 4, -7, -15,
+    6, -6, -6, 0, -8, -1, 1, -2, -5, 1, 5, 0, -9, -1, -5, -7,
+    -3, -3, 3, 0, -5, 1, -1, -5, 3, -4, -1, -3, -2, 6, 1, -26,
+    -7, -10, -16, -2, -2, 0, -9, -11, -2, -17, 0, -4, 4, 2, 5, -8,
+    4, -5, 1, 0, -7, 2, -2, -6, 2, -8, -6, -1, 2, 2, 9, -1,
+    0, -11, 0, -5, -5, 11, -1, -6, -3, -5, -5, -3, 8, 0, -3, -16,
+    4, 0, -2, 5, -4, 0, -8, -1, -2, -17, 1, -8, 7, -4, -1, -30,
+    -3, -8, -5, -9, 1, -15, -2, 11, 2, -2, 6, 11, -5, 8, 11, 12,
+    -1, -7, -8, 6, -1, 5, -3, -4, -2, 3, 7, 15, -2, 15, 4, 2,
+    7, 0, 13, -8, 9, 6, -1, 12, -4, 6, 11, -14, -11, 1, -4, -8,
+    0, 7, -5, -17, 1, -10, -8, 4, 5, 3, -5, -2, -12, 6, -5, 5,
+    4, 1, 1, 1, 5, -14, 9, -1, 6, 6, 8, -3, -11, -12, 9, -7,
+    -3, 8, 2, -7, 3, 6, 0, -3, -12, 5, 4, -17, -21, -4, 5, 13,
+    -5, 2, -15, -13, 5, -7, -3, -13, 0, 13, -3, -3, -2, -7, 7, 6,
+    5, 5, 0, -12, 5, -6, 8, 1, -11, -5, 12, 1, -9, -12, 5,
+  },
+  {
+    0, -2, 3, -2, 0, -3, 2, -7, -1, -3, -6, 1, -1, 2, -9, -8,
+    3, 0, 1, -1, -1, -3, 3, -4, 1, 1, 1, 0, 0, 9, -2, -9,
+    1, -3, 8, -5, -3, -4, 3, 0, -2, 2, -1, 1, -4, 0, 4, 5,
+    -10, -7, -4, 0, -5, 1, -1, -4, 1, -9, -10, 4, 22, 2, -3, -19,
+    -3, -8, -2, 2, 2, 0, -4, -13, 1, 0, -8, -6, -3, 14, 5, -12,
+    -2, -10, -6, -4, -9, 3, 0, 5, 0, -7, -4, 3, -8, -1, 9, 1,
+    -11, -10, 0, -11, 3, -1, 9, 0, 6, -7, -5, 6, -10, 0, 4, -7,
+    10, 5, 3, -8, -5, -4, 6, -4, 4, -6, -34, -1, -9, -7, -5, -29,
+    -1, -9, -14, -10, -1, 4, -3, -2, -7, -8, -7, -12, 2, -4, -22, -10,
+    -8, -7, 3, -7, -4, 4, -10, 1, -4, 5, -3, 7, -13, -2, -3, -1,
+    -11, 7, -4, -3, -5, 4, 4, -4, -2, 4, -2, -13, -3, -29, 1, 0,
+    -1, 8, 11, -7, 2, 8, -16, 5, -15, 4, 6, 0, 27, 7, 4, -4,
+    8, -9, -5, -18, -5, -4, -13, 1, 4, -12, -1, -11, 11, -5, 6, -7,
+    -11, -2, -4, 1, 0, -6, -4, -5, -3, 5, -9, -3, -3, -2, -4, -20,
+    -12, 0, 24, -3, 1, -8, -9, -2, -9, -4, 3, -6, -24, -1, -3, 14,
+    8, -1, 0, -11, -15, 44, 7, -7, 0, 0, -6, -5, 1, 11, 3,
+  },
+  {
+    0, -2, -1, -4, 1, 0, 3, -2, -2, 1, -2, 1, 1, -4, 6, -5,
+    0, 4, 0, 2, -3, -1, 1, 2, 2, 0, 1, 6, -1, 1, 3, -7,
+    -4, 1, -2, -5, -1, 1, 6, 1, -11, -1, -5, -8, -7, 4, -3, -5,
+    -11, 2, -6, 1, -6, 1, 8, -7, 3, -2, 3, 1, 6, 9, -11, -18,
+    -2, -3, 4, -8, -5, 0, 3, -7, 1, -3, 4, 4, 1, -3, -6, -3,
+    4, -10, -1, 3, -1, -3, -5, -14, -4, -6, 1, 5, 6, -17, 3, -3,
+    -9, 1, 3, 1, -2, -13, 4, 3, -8, -1, 3, -3, 5, 0, 14, -11,
+    -1, -7, -7, -1, -9, 2, -2, -2, 2, 0, 6, 1, 9, 15, 5, -24,
+    -2, 19, -1, -2, -13, 0, -9, 10, 10, -9, 0, -1, 7, 2, -6, -19,
+    -9, -3, -6, -4, -2, -5, 19, 3, 6, 0, 5, 12, -18, 9, 7, 8,
+    -19, 2, 11, -11, 9, -12, 1, 8, 12, -6, -1, 4, -4, 12, 3, 12,
+    -1, -3, -14, -1, -5, 2, -7, 3, -2, -1, 7, -13, -3, -15, 7, 1,
+    4, -10, 0, -13, 12, -4, 7, 6, -2, -1, 2, 15, 1, 0, -2, 9,
+    14, 13, -9, -18, -1, 12, -4, -3, 1, -1, 7, -7, 2, -3, -6, 11,
+    -1, -3, 4, -10, 4, -15, 5, -6, -7, -3, -11, 11, -2, 10, 3, 3,
+    3, 1, 1, -11, -1, -9, 1, -1, -1, 6, 17, -4, 26, 1, 11,
+  },
+  {
+    0, -2, 1, -4, 0, -3, 1, -7, -2, -2, 2, -2, 2, -3, 3, -11,
+    -1, 4, -4, -4, 0, -3, -2, -1, 5, 0, -3, 9, -2, 2, -1, -17,
+    1, -3, -3, 2, -2, -3, 1, -6, 0, 0, 1, -6, 2, -10, 5, 2,
+    -9, 3, 6, -3, -6, 6, -6, -2, 3, 2, 3, -2, -10, -4, -1, -25,
+    7, -2, -2, 3, 3, 2, -11, 1, 0, -13, 1, -2, 4, -2, 10, -15,
+    5, -5, 4, 3, 6, -7, 3, -2, 3, -4, 2, 2, -2, -2, -1, 1,
+    -3, -22, -8, -8, -4, 1, 0, 7, -1, -9, 9, -11, -15, 6, -19, -3,
+    0, -5, 19, -6, 5, 4, -5, -8, 10, 4, 2, -7, 0, 8, 3, -1,
+    -3, -8, -6, -18, -2, -4, 15, -2, -3, -3, 2, -7, -7, 6, 3, -5,
+    6, 8, -2, -5, 1, -11, 0, -1, -8, 6, 0, -8, 4, 7, 9, -15,
+    -9, -6, 3, -10, -6, -12, 9, -5, -3, 1, -6, -12, -1, 1, -4, -5,
+    11, -5, -10, -9, -2, 7, -5, 4, 17, 9, 1, -4, -2, -5, -1, -15,
+    -8, -7, 1, 10, -6, -7, 4, -2, 10, -1, 5, -3, -6, -17, 17, -4,
+    -9, -6, -3, -2, -5, -6, -6, -4, 6, 21, 14, 0, -3, -8, -7, 3,
+    -3, 9, 9, -6, 9, 0, -18, -3, 8, -4, 5, -22, 18, 8, -4, 6,
+    3, 3, 4, -5, 2, 15, 4, 4, 12, -2, 2, -8, 16, -2, 5,
+  },
+  {
+    -1, -2, 0, -5, -4, 0, -1, -11, 2, 5, 0, 0, 1, -2, -5, -5,
+    -1, 0, -8, 2, 5, 3, 3, -3, 4, 3, 3, 0, -2, -3, -5, -12,
+    -7, 0, 0, -7, -8, -2, 3, -2, -6, -6, 7, -1, -1, -3, -10, -6,
+    0, -5, -12, -4, -11, 5, 0, -6, -1, 1, 0, 3, -3, 0, 5, -26,
+    -2, -6, 0, -4, 0, -2, -7, -1, -8, -9, -12, 4, 8, 6, -1, -14,
+    -4, -2, -1, -8, 7, -2, 19, 2, -7, -4, -11, 8, -10, -11, 9, -5,
+    -4, 8, 4, 2, -2, -2, 5, -2, 3, 0, 14, -6, -12, -3, -8, -4,
+    -10, 0, -1, -2, -5, 6, 0, -3, 5, -11, -9, 6, 1, 1, -7, -36,
+    -4, -13, -6, -11, 8, 23, -10, 4, 4, 11, -4, -6, -21, 0, 2, -12,
+    -12, -4, -7, -2, 1, 0, -2, -1, -18, 9, -17, -4, -14, 3, 3, -9,
+    0, 3, -2, -3, -5, -8, 1, -11, -1, -1, -4, -10, -3, -10, -33, -9,
+    -15, 2, 1, -4, -5, 3, -1, 0, -1, -8, 10, -8, 5, 5, -3, 8,
+    -13, 2, 2, -6, 7, 3, 2, -3, -7, 2, 1, 18, 28, -1, 9, -4,
+    4, -8, 1, -7, -6, 8, -7, -3, 8, 15, -22, -9, -12, -27, 12, -2,
+    -4, 1, 5, -5, -1, 18, 4, 4, 8, -6, -9, 11, 1, 5, -11, 3,
+    -8, 8, 8, -11, 3, -2, 10, 3, -1, -8, -3, 1, 10, 11, -20,
+  },
+  {
+    0, 0, 0, -2, -1, 1, -1, 1, 5, 0, -4, -1, 1, 2, 2, -6,
+    6, -1, -1, 4, 0, -2, 1, 1, 1, -1, -1, -2, -5, -1, 2, -14,
+    2, -6, 1, -4, 1, 12, 3, -7, -4, -6, -1, -10, -7, 6, 2, -1,
+    -11, -8, -2, -6, -1, -3, 7, 5, 0, 6, 3, -10, -4, 0, -4, -16,
+    6, -1, -3, 2, 6, -4, -14, -10, 2, -8, 4, -10, 12, 3, 4, 3,
+    12, -9, 2, 1, -5, 10, 4, -4, 1, -6, -3, 2, 6, -6, 11, -7,
+    -1, 13, -1, -12, -3, 0, -13, 6, 8, 4, 1, -4, 8, -2, 11, 5,
+    -7, 5, -1, -3, -13, -1, -3, -10, 7, -6, 14, 6, 9, 0, 4, -27,
+    -7, 1, 7, -14, -5, -1, -5, 8, -2, -13, 9, -3, -3, 11, 2, 8,
+    -14, 2, 6, -4, -3, 6, -2, 1, -12, -3, -27, -2, -3, -6, 2, 2,
+    4, -5, 11, 1, 1, -4, 5, -6, -18, 18, 1, -3, -1, -6, 6, -15,
+    -6, -4, -6, -20, -5, -1, -12, 3, -11, -2, 6, -7, -15, 4, 8, 4,
+    0, -13, -4, -1, -17, -6, 7, -13, -2, -9, -4, -2, -7, -12, -7, -10,
+    -17, 3, 12, -16, -1, 5, -2, 2, -3, -3, 10, 1, 0, 11, -20, -14,
+    -9, -13, -6, -12, -2, -5, -9, 7, 4, -17, 4, -14, -12, 5, 12, -5,
+    8, -8, -3, -6, -7, 2, -2, -5, 1, 7, 19, 16, 15, 1, -18,
+  },
+  {
+    0, -2, 2, -3, -4, -1, -4, -4, -3, -3, -2, -1, -4, 2, -1, -3,
+    -3, -3, 2, -3, -7, -1, -2, -4, 2, -3, 1, 5, -12, 4, 1, -6,
+    -2, 5, -2, -5, 1, -4, 0, 12, -1, -6, -7, 1, -2, -4, -1, 5,
+    4, -5, -5, -5, 0, 0, -3, -7, -8, -16, -10, 0, -1, -1, -7, -14,
+    -11, -3, 0, 2, -11, -5, -6, -4, 7, -2, 4, -8, -2, 0, 4, 2,
+    -14, -4, -9, -9, -3, -3, -2, -6, 5, -7, -5, -7, 1, -1, -6, -6,
+    8, -1, 0, 0, -7, 4, -3, -14, -6, -2, -9, -11, 2, 8, 4, -6,
+    2, 19, 8, 16, -10, -2, -3, -4, 6, -12, -4, -3, -11, -9, 1, -18,
+    -4, -17, 7, -13, -10, -7, 0, -3, -7, -10, -5, 12, 11, 0, -1, -2,
+    5, -5, -7, -11, 13, 19, -7, 3, -14, 3, 9, -3, 7, 14, -12, -12,
+    -4, -26, -1, -13, 2, -3, 0, -24, -16, 10, -4, -10, -14, 7, 7, -1,
+    10, 7, 12, -17, 0, -10, -7, -3, 12, -2, 4, 15, 0, -7, -3, 0,
+    -15, -7, -10, -20, -5, -2, -5, 6, 7, 2, -10, -5, -9, -2, 8, -15,
+    5, -1, 9, -22, 7, 7, -13, -6, 1, 0, 9, 8, 1, 1, -3, 0,
+    -8, 7, 4, 3, 28, -2, -5, -3, 34, -7, -8, -1, 5, -13, 1, -10,
+    -14, -12, -5, -5, 4, 13, 1, 2, 3, 0, -4, -18, -4, 1, 4,
+  },
+  {
+    -3, -6, 2, -12, -2, -5, -7, -17, -3, -3, -3, -8, -6, -1, -4, -18,
+    -1, 2, -3, -4, -10, 1, -9, -3, -2, -4, 1, -11, -10, 1, 5, -33,
+    4, 1, -6, -2, -7, -2, 3, 0, 1, 5, -1, -1, 8, 4, 2, -11,
+    7, -3, -8, -10, 0, 1, 1, -19, -3, 7, -1, -6, -6, -3, -10, -45,
+    3, -4, 5, 0, 4, -16, -4, -8, -10, -20, 8, -10, -3, 0, -5, -1,
+    3, -9, -8, 5, -9, -1, -4, -2, 6, -3, 6, 2, -1, -5, 5, 13,
+    -18, -4, -16, 7, -12, -1, -4, -15, 0, -6, 13, 10, 5, -8, 2, -28,
+    10, -11, 6, 2, 26, 0, -6, 7, -2, 4, 6, -3, -3, 2, -1, -49,
+    2, -4, -13, -7, -15, -17, -13, -6, -3, 0, 3, -17, 1, -2, 3, -6,
+    5, 13, -10, -17, 3, 11, 4, -9, 2, -2, 0, 2, 7, -1, 7, -8,
+    5, 15, -10, -3, 9, -10, 7, -6, 12, -6, -21, -15, 2, -7, 10, 7,
+    -5, 3, -6, -14, -8, -8, -11, -1, 11, -5, -3, 2, -5, -2, 6, -11,
+    -15, -18, -8, -15, 5, 10, 2, 6, -5, -7, 19, 9, 7, 4, -5, -26,
+    7, -21, 3, -17, 1, -13, -15, -12, -2, -1, 5, 13, 19, 9, 3, -33,
+    -16, 8, 17, -2, -7, -4, 9, 13, 19, 6, 31, -1, -6, 4, -4, -3,
+    -13, 2, 0, -12, -4, 11, -10, -4, -5, -3, 5, 18, 5, 1, -1,
+  },
+  {
+    0, -3, -2, 1, -2, -4, -1, -7, -3, -6, 0, -6, 2, -3, 3, -10,
+    -1, 7, -2, 3, 1, 3, -1, -11, -4, 0, 3, 0, 0, -4, -1, -17,
+    -4, -3, 2, -3, 19, -11, -2, -6, -10, 1, -2, -5, 3, -4, 4, -14,
+    -2, -8, 3, -6, -4, -3, -5, -13, -2, 5, 0, 1, -3, 0, -4, -14,
+    -6, -1, -6, -9, 10, 3, -7, 0, -6, -10, 8, -9, -6, -2, 1, -12,
+    -10, -1, 8, 4, -11, -9, 0, -3, 7, -5, 10, -4, -3, 0, -5, 15,
+    3, -7, 7, -8, 4, -1, 0, -13, 5, -12, -2, -5, 5, -3, -2, -11,
+    6, -11, 8, 0, 11, 6, -5, 4, 15, -7, 9, -2, 0, 11, 1, -20,
+    8, 6, -3, -8, 7, -1, -3, 5, -5, -6, 8, -9, 3, 1, 6, -3,
+    6, -3, 2, -5, -1, -22, -28, -18, 0, 2, 13, -17, -7, 8, 16, -3,
+    6, -22, 2, -1, 15, -2, 6, -12, 4, 7, -7, 17, 7, -11, 8, -17,
+    -8, -7, 1, -7, 7, 8, -19, -4, -5, 8, -5, 14, -3, -14, 2, -15,
+    -28, -9, 4, -10, -9, 0, -7, 13, -3, -4, 1, -10, 3, -9, -5, 2,
+    0, 6, -7, 2, -2, 3, -2, -7, 3, 0, 11, -2, -6, -7, -3, 0,
+    2, 5, 3, -20, -4, 0, 4, -11, 11, 1, 15, -4, -1, 7, -2, -3,
+    -7, 1, 11, -6, -2, -6, 3, -19, -5, -10, -1, -13, -21, -12, -3,
+  },
+  {
+    -3, -4, -2, 0, 1, 0, -4, -5, -6, -3, -1, 2, -3, -3, 2, -7,
+    1, -4, 0, 1, -2, 0, -5, 3, -4, -1, 2, -1, 1, 4, -3, -14,
+    -2, -3, 6, 12, 4, -6, -6, -4, -6, 3, 6, 4, 0, -1, 1, -11,
+    -6, -8, 3, 0, 6, 0, -5, 0, 0, -3, -1, 8, 1, 0, -5, -2,
+    8, -10, -1, 2, 7, -2, 9, -5, 20, -1, -12, 3, 2, 9, 7, -6,
+    0, -9, -4, -4, -9, -10, -1, 0, 10, -4, 4, -8, -13, 0, 4, 2,
+    -1, 0, -2, 3, -9, -3, 0, -8, 2, -12, 12, -7, -1, -3, 10, -10,
+    3, -4, -2, -2, 7, -9, 5, 1, -6, -2, -1, 2, -8, 4, 5, -15,
+    -15, -11, -4, -18, 9, -10, 18, -1, -5, 3, 7, -3, 7, 1, 4, -2,
+    -6, -4, -31, -7, 4, -25, 6, 5, -5, -3, 1, -1, -22, 10, 5, -12,
+    -1, -8, 11, -3, -10, -1, 9, -6, -5, -11, -1, 4, -7, -5, 3, -4,
+    6, 5, -21, -7, -7, 10, -7, -11, 1, -9, -13, -5, -4, 1, -5, 2,
+    -21, 16, 9, -8, 7, -15, 1, -4, -11, 9, -3, -1, 5, -11, -5, 11,
+    -4, -1, -1, -11, 0, -8, 21, -9, 0, 7, -1, 10, 2, 9, 1, -16,
+    0, -17, -4, -19, 1, 1, 2, -14, -5, -18, -2, 6, -7, -5, 0, -3,
+    -25, 17, 3, -15, -3, -1, 1, 1, 3, -9, -7, 10, 2, 7, -3,
+  },
+  {
+    -3, 6, 0, -3, -10, -2, -3, -4, 0, 8, 1, -5, -3, -5, 3, -3,
+    -8, 4, 1, 8, 26, -1, -2, -4, 2, 6, 7, 4, 2, 0, -2, -10,
+    4, -3, 0, -6, 4, -3, -1, -4, 8, -12, -38, 0, -4, -1, -3, -12,
+    -5, -4, 0, -3, 2, 1, -8, -1, 8, 5, -2, 8, -6, -8, -5, -20,
+    1, -1, -1, 1, -1, -2, -3, 1, -3, 0, -10, 5, -6, -10, -5, -1,
+    8, -13, -20, -3, -3, 26, -7, 2, -4, -15, -1, -6, 3, -8, -6, -18,
+    -1, -3, 3, -4, 1, -9, 1, -6, 1, -10, 10, 3, -7, 6, -1, -2,
+    -4, -2, 10, 1, -16, 10, -5, -2, 5, -16, -7, 7, -5, 0, 3, -21,
+    9, -1, 4, -10, 2, -1, -2, -6, 17, 7, 5, 1, 0, -12, 12, 4,
+    -2, -2, -1, -10, 9, 1, 2, -13, -3, -9, -5, 8, 0, 1, 1, -14,
+    10, -7, 8, -4, -6, -32, -17, -5, 1, 1, 2, -28, -20, -8, 6, -8,
+    3, 1, 7, -10, -4, 2, -3, -4, 0, -6, -20, 1, -5, -4, -8, -35,
+    2, -5, -13, -13, 5, -3, 4, 10, 9, -17, -8, -3, -4, 5, 0, -1,
+    5, 8, 9, -13, 4, 0, 24, 4, 7, -2, 7, -3, -10, 10, -9, -16,
+    -1, -1, 6, -20, 11, -3, 28, -10, 16, 4, 18, -8, 1, 8, 4, 7,
+    -7, 7, 12, -6, -18, -6, 6, 1, 12, -1, -3, -3, -6, 1, 0,
+  },
+  {
+    -1, -3, 1, -3, -1, -2, -2, -1, -1, -1, -3, -1, 4, -2, -2, -9,
+    -5, -2, -2, 1, 0, 4, 5, 2, 2, -1, -1, 0, -7, -3, 0, -12,
+    -3, -4, -2, -9, -2, 1, 3, 6, -1, 4, 7, 3, 1, -3, -4, 0,
+    4, -3, -5, 1, 5, 4, 6, -1, 5, 7, -1, 3, -7, -1, -3, -22,
+    -3, -5, -11, -4, 3, 1, -6, -8, 5, -6, -5, 4, 9, 5, -5, -11,
+    5, -12, -11, -1, -6, -5, -9, -2, -3, -5, 9, -1, 6, -2, -3, 5,
+    -5, -4, 14, 3, 7, -10, 3, -6, 0, -7, 4, 2, 1, -4, 4, -7,
+    9, -4, 3, 1, -1, -3, -1, 1, 2, -4, 1, -3, 0, -9, -4, -21,
+    9, 4, -8, -20, -4, -4, 0, -8, 14, -1, -2, -8, -4, 5, 2, -15,
+    5, -11, 7, -9, 3, 3, 2, -4, 5, -12, 6, 8, -4, 19, -12, -2,
+    3, 4, -2, -3, -2, 0, -1, 7, 7, -3, 7, -4, -11, -4, 5, -7,
+    -6, 7, 4, -4, 3, -11, -6, 9, -2, 0, -8, 10, -5, -17, -1, -4,
+    -7, 4, -1, -14, -7, 2, 9, 3, 10, -5, 5, 17, -1, -10, 0, 7,
+    -9, -9, -4, -12, 0, -3, 1, 2, 3, 12, 4, 3, 4, 7, -2, -5,
+    -3, -8, 8, -20, 12, 12, 14, -3, 0, 10, -4, 7, 0, 0, -2, 3,
+    -2, -2, 9, 5, -10, -2, -9, 2, 4, 1, 7, 1, -8, 11, -7,
+  },
+  {
+    1, 0, 2, -1, 1, 3, 1, -3, -2, 0, -2, 0, -1, -6, 0, -8,
+    -3, 3, -4, -2, -2, -1, -1, -2, -4, -3, 5, 6, -4, -2, 3, -16,
+    6, 14, 5, 2, -5, 7, -2, 2, -6, 0, 2, -1, -5, -5, -7, -3,
+    6, -14, 5, -6, 0, -6, -3, 1, -12, -2, -4, -5, -5, -4, 3, -23,
+    -2, -1, -7, -4, 4, 6, 1, -4, 12, -7, 4, -8, 4, -7, -10, -4,
+    3, -6, 0, 5, 0, 8, -4, 13, 4, 3, 4, 8, 6, 6, -5, 3,
+    3, -7, -8, 5, -5, -3, 10, -21, 1, -6, 9, -2, 8, 0, -1, -3,
+    -2, -2, 0, -1, -12, -1, -1, 1, 10, 2, -2, 1, -3, 0, 2, -26,
+    -8, -11, 0, -2, -5, -3, -2, -4, 10, 3, -10, 3, -1, 2, -4, 1,
+    7, 5, -1, -15, 6, 7, 5, 4, 3, -5, 7, -8, -12, 6, -3, -16,
+    12, -11, 8, -4, -3, -9, 4, -6, 1, 4, 3, 6, 9, 14, -4, -3,
+    0, -8, -8, -18, 8, 2, 2, -9, 16, -13, 2, -6, 12, 23, 5, -3,
+    -5, 1, -3, -12, -3, -2, -14, -6, 6, 2, 8, -7, -7, -14, -1, -19,
+    1, 15, -1, -5, 4, -9, 14, 13, 3, 10, -18, -5, -9, -1, -1, -5,
+    1, -6, 4, -20, -23, -1, -3, -13, 0, 14, 4, 4, -3, 1, 0, 6,
+    -14, 9, -15, -22, 6, 2, -1, -10, 1, 3, 4, -7, -2, 7, 13,
+  },
+  {
+    -1, 2, -1, -4, 4, -1, 0, -5, -1, 2, 1, -6, 0, -2, -4, -3,
+    -1, -4, -1, -2, -3, -8, 2, -4, 7, 5, -2, 5, 2, -2, 2, -13,
+    -3, 1, -5, 8, -1, 2, 6, -10, 0, -8, -5, -11, -7, -2, -13, 7,
+    -4, 0, -3, 3, 1, -2, 2, 1, 7, -2, 6, -5, -4, 5, -1, -14,
+    -2, -11, -6, -10, 3, -10, -7, -1, -8, -6, -3, -2, -1, -4, 4, -10,
+    3, 2, -5, -14, -4, -5, -7, -22, 4, -12, 9, -1, -9, 18, 5, 1,
+    7, -5, 1, 4, 9, 4, 0, 2, 9, -5, 4, -8, 0, 0, -6, -2,
+    1, -3, 5, -1, -3, 8, 9, -6, -4, -2, 6, 1, 5, 2, 2, -12,
+    -4, 6, -4, 3, -24, -1, -6, -13, -7, -7, 10, 13, -1, -4, -5, -3,
+    -1, 15, -6, -20, 1, -15, 8, 1, 3, -4, 4, -5, 6, -3, -14, -25,
+    -10, -3, 1, -9, -10, 2, 14, 12, -2, -5, 1, -1, 3, 1, -5, -28,
+    7, -4, -3, 0, 0, 6, 3, -13, 3, -11, 4, 4, -30, -8, -18, -16,
+    -4, -12, -7, -22, -9, -19, -16, -7, 3, -5, -12, -7, 11, -4, 0, 5,
+    0, 4, 7, -10, -4, 4, -8, 11, 0, -2, -7, -1, 1, 10, -5, -7,
+    -9, -9, -13, -6, 5, -12, 11, -17, 13, 4, -4, -3, -3, -4, 10, 2,
+    -1, -10, 1, -5, 1, -6, -10, -5, 2, 3, 4, 11, -5, -3, 1,
+  },
+  {
+    -1, -1, 0, -2, 0, 1, -1, -3, 5, -1, -3, 0, -1, -2, -1, 0,
+    -3, 1, -9, 10, 3, 7, 6, -4, -1, -1, -1, 3, 5, 3, -2, -8,
+    11, 8, 4, -7, -3, -15, 2, -1, -7, 5, 0, -7, -4, -8, -5, 7,
+    3, 2, -8, -7, -2, 8, -6, -5, 1, 0, -6, 0, -3, -10, 0, -20,
+    -6, -2, -6, -6, 4, 6, -10, 0, 4, -11, 8, 20, 12, -5, -11, -1,
+    -11, -32, -6, 1, 4, 11, 11, -5, 7, -4, 2, 6, -7, -10, 2, -6,
+    3, 2, 6, 5, 3, -6, 11, -8, 0, -7, -3, 3, -10, 0, -4, -6,
+    8, -1, -8, -8, 6, -11, -7, -5, 1, -7, 5, 10, 0, 19, 2, -24,
+    -6, 7, -13, -12, 4, 7, -10, -5, 1, -16, -27, 2, 8, 1, -4, 4,
+    -4, 6, -8, -8, -2, -11, 5, -3, 36, -3, 6, -1, 7, 13, 16, -11,
+    -10, 0, 0, -24, -10, 3, 9, 6, -5, 15, 5, -9, 14, -7, -2, 14,
+    7, 6, 0, 7, 1, -8, 13, -1, -14, -4, -19, 10, -3, -2, -2, 2,
+    -1, -6, -11, -24, 0, -9, -10, -12, -1, 1, 0, -12, -6, -2, 6, 11,
+    3, 3, -2, 1, -4, -12, -4, 0, -7, -10, -9, -8, 6, -1, -2, -14,
+    13, 5, 3, -8, 18, -11, 1, -13, 0, 10, -1, -11, -3, 4, -11, -22,
+    -3, -4, 0, 5, 3, -2, 4, -3, -12, -3, -1, 4, -16, -9, -6,
+  },
+  {
+    -2, -4, 0, -9, -1, -1, 2, -12, -3, 4, -2, 1, 3, -4, -4, -8,
+    -7, 0, 1, 1, 5, -5, 6, -1, -11, 7, -1, -3, -4, -5, 2, -18,
+    4, -2, -3, -1, -9, 4, 2, -7, -7, -2, -8, -2, -3, 3, 8, 3,
+    3, 12, -1, -6, -1, -6, 2, -3, -2, -4, 1, 11, 3, 9, -7, -32,
+    -1, -7, 6, -6, -6, -1, -2, -6, 1, -7, 2, 1, 1, -2, -3, -4,
+    1, -15, -1, -10, 8, -20, 20, -3, 5, -9, -2, 1, 0, -7, -13, -4,
+    -7, 1, -3, 6, 14, -5, 3, -4, 10, -15, 8, 6, -7, 0, 11, -3,
+    -6, -3, 5, 10, -2, -4, -8, 6, 19, -5, -9, 6, 10, -3, 5, -41,
+    3, 1, -29, -5, -9, 2, -1, -6, 8, 4, -10, -8, 4, 3, -3, -22,
+    -3, -4, 11, -13, -2, 2, -14, -8, -4, 2, 1, -3, -2, -1, -2, -12,
+    0, 6, -15, -2, 1, -12, 11, -18, 4, -2, 3, 28, -5, 2, 7, -10,
+    -2, 4, 5, -13, -4, -6, -3, -13, 4, -5, 0, -5, -1, -11, -2, -2,
+    2, 3, -8, -18, 1, 3, -3, -4, 3, -10, 24, 2, -1, -4, -1, -4,
+    -5, 2, 3, 2, 6, 14, 20, 0, -12, -2, -2, 0, -7, -12, 6, -11,
+    0, 11, 8, -14, -3, -1, 13, -11, -6, -7, -7, 1, -5, -1, -5, -9,
+    -1, 17, -24, -11, 4, 6, -15, -1, -11, -4, 23, -7, -23, 1, 12,
+  },
+  {
+    2, -1, -1, -2, 1, 6, 4, -4, -2, -4, 4, -5, -12, -2, -2, -4,
+    1, 1, -5, 1, 2, 1, 0, -2, -3, 18, 0, -5, -3, -2, -1, -12,
+    2, 0, 0, -1, -5, 0, 6, 5, 2, 0, 3, -1, 4, 4, -14, 7,
+    -4, 0, 2, -7, -28, -2, -2, 3, -6, 1, 7, 13, -1, 4, 4, -21,
+    -6, -10, -2, -1, -2, -6, 8, -8, 4, -8, 3, -3, -8, 4, 10, -8,
+    -9, -1, -12, 4, 0, -1, -9, -3, -1, -7, -5, 6, 4, 7, 8, -3,
+    -18, -6, -10, 3, 0, -11, 3, -1, -1, -42, 0, 4, -6, 5, 1, -2,
+    -8, -6, -3, 1, -4, 2, 9, -2, 25, -4, 15, 6, -14, 1, -8, -18,
+    7, -5, 1, -6, 0, -14, -11, 5, -12, -2, -11, -6, -2, 12, -15, -13,
+    -3, -4, -11, -8, -7, -14, 5, -4, -10, -6, -5, -14, -6, 9, 10, -12,
+    13, 4, -3, -7, 3, -6, -8, -13, 2, 5, 7, -9, 3, 6, -8, -3,
+    -3, -3, 7, -22, 4, -13, -3, 3, 8, 6, 0, 8, -31, 17, 4, -5,
+    9, -17, -3, -2, -5, -2, 6, -7, -7, -6, 2, 2, 8, 10, 1, -8,
+    -4, -4, -15, 40, 0, 2, -3, -12, 1, 0, -7, -3, -14, 0, 8, -1,
+    2, 13, -5, -12, -7, -12, -10, 10, 2, -3, 7, 0, -3, 5, -2, -2,
+    3, 4, -41, -7, -15, 13, -26, 3, -2, 21, 5, 4, -9, 19, -13,
+  },
+  {
+    0, 0, -2, -3, -3, -2, 2, -5, -1, -4, -1, -8, 0, 2, -4, -7,
+    2, -2, -1, -8, -6, 0, 1, -11, 2, 3, -4, 0, 2, -5, -1, -14,
+    -5, -1, 4, -8, -4, 0, 1, -4, -4, 2, -1, 6, -1, -3, -4, -16,
+    -1, 7, 3, -6, 1, 0, 2, -1, -3, 8, -1, 5, 0, -1, 1, -21,
+    3, -19, -6, -5, 4, -7, 8, -11, 9, 2, 5, 5, 8, 5, -5, -12,
+    16, -4, 3, -5, -2, -7, 5, 4, 12, -4, 0, -7, 3, 1, -11, -22,
+    -4, -5, 2, -4, 4, 1, 3, -5, 8, -10, 12, 0, -4, -3, 1, -4,
+    3, -6, -5, 2, 6, -5, 2, -4, -4, -12, -1, -6, 7, -4, -6, -26,
+    -2, -7, -1, -15, 18, 0, -27, -5, 6, 8, -3, 5, -8, 0, 7, -13,
+    -6, 6, 5, -1, 4, -12, -1, -7, -13, 0, 4, 3, -9, 3, 0, -22,
+    5, -7, -17, -6, 9, -5, -6, -3, 1, -12, -13, -10, 14, -8, 4, 7,
+    -12, -12, -9, 5, 3, 1, 4, 3, -3, -2, 0, -15, 1, -9, -4, -27,
+    5, -1, -9, -8, -8, -3, 6, -7, 3, -7, -2, -7, 6, 2, 15, 0,
+    -12, -6, 2, -1, -4, -4, 6, 0, -7, 4, 6, -3, -12, 4, 10, -5,
+    11, 3, 3, -16, -5, 2, -3, 0, 9, -2, -1, 1, 3, 6, -5, -4,
+    2, 0, -2, -10, -4, -16, -4, 7, 7, -5, 3, 4, 6, 1, 1,
+  },
+  {
+    -3, -4, -2, -5, 2, -1, -1, -10, 1, 0, 6, 2, 1, 3, 0, 6,
+    1, -2, -3, 0, -3, 0, -12, 5, -1, 0, 2, -2, 0, 2, 2, -16,
+    12, -2, 1, -4, 2, 4, 2, -5, -1, 2, -8, 1, -2, -22, 2, 4,
+    -3, -3, -4, 2, 0, 1, 6, -1, -2, 6, 7, 0, -7, -3, -2, -18,
+    -13, -4, 11, -9, -1, 5, 0, 5, 6, 0, 1, -9, 5, -2, 10, -9,
+    -2, -5, -8, 0, 0, -8, -7, -3, -2, -8, -1, -33, -4, -2, -4, -3,
+    -7, -8, 0, -3, 6, 0, -9, -4, -2, -7, -9, -2, 5, 6, -18, 2,
+    0, 1, 0, -5, -11, -4, 2, 6, 0, -8, -3, 3, -5, 5, 8, -19,
+    -1, -13, -7, 2, -1, -5, 12, -11, 1, -16, 0, -1, -2, 12, -2, 15,
+    -4, 2, 3, -3, -13, 8, 2, 4, 4, 22, -18, -20, 0, -5, 11, -9,
+    0, -18, 1, -10, 3, -8, -6, -6, 10, 10, 9, 15, 6, 6, -3, -2,
+    -3, 11, 8, -3, -2, -7, -9, -42, 0, -14, -3, 6, -1, -13, 1, -8,
+    13, 3, -11, -8, -4, -5, 7, -1, -17, 1, 10, -10, 9, -1, -14, 9,
+    -8, 2, -7, -14, -7, 5, 0, 6, 8, 7, 6, -8, -1, -18, -1, -6,
+    -8, 0, 1, 0, -6, -6, -9, -6, -2, -19, 15, 4, 12, -6, -5, -3,
+    -5, 6, -11, -3, -9, 4, -19, -14, -1, -13, -2, -6, 3, 6, -18,
+  },
+  {
+    1, -3, -5, -3, 2, -6, -3, -8, 1, -1, -2, -17, 5, -1, -4, -1,
+    -2, -2, -3, 1, 1, -1, 3, -21, 3, -1, 6, -1, 4, 3, -4, -1,
+    -3, -5, -2, -3, -4, -3, 5, -5, -1, 3, 6, 0, -6, 7, -3, 28,
+    -1, 1, -1, -7, -3, -6, 13, -1, -3, 1, 11, -3, -4, 3, 5, -21,
+    8, -15, -4, -4, 5, 7, 3, 7, -13, -6, -6, -10, 2, 2, -6, 0,
+    7, -9, -1, -3, 3, 5, 5, -3, 2, 0, 0, -6, 2, 3, -13, -15,
+    -33, -14, -2, 1, -4, 1, 0, -13, -2, -7, 2, 4, 1, 4, -21, -4,
+    9, -3, 3, -1, -4, 3, 17, 0, -8, 6, -9, -5, -1, -11, -2, -43,
+    1, 6, 3, -11, 2, 6, 1, 0, 6, 9, -10, 2, 6, 8, -5, -3,
+    -13, 2, -10, -21, 11, 1, 0, -26, 6, -12, -4, 0, 1, 9, 4, -13,
+    12, 14, 7, -10, -7, -21, -2, -7, -1, -9, 4, -1, -2, -6, -10, -8,
+    7, -8, 3, -17, -7, 13, -2, -13, -4, -3, 3, 11, -11, -11, 7, 17,
+    -1, 10, -13, -4, 12, -13, -4, -10, -6, 7, 4, -7, -10, -4, 3, -10,
+    9, -1, -7, 4, -9, 8, 1, 6, -13, 4, -1, 4, 7, -7, 1, -16,
+    1, 9, -1, -7, -10, -12, 9, 3, -3, -5, 8, -1, -4, 9, -12, 3,
+    -8, -2, -5, -8, -10, 5, -6, 16, 0, 7, 3, -12, -9, -2, 6,
+  },
+  {
+    -2, 1, -1, 0, -1, 0, 0, -6, 5, -2, -8, -2, -4, -1, 1, -7,
+    3, -4, -7, -4, 1, -10, -2, 4, 5, 5, -8, -2, 4, 2, -4, -16,
+    -5, -2, 4, 6, -4, 3, -4, 3, -9, -4, 4, -11, -3, -1, 6, -2,
+    -2, -1, -5, 5, 6, 0, 5, -4, -3, -1, -10, 5, -6, 2, 0, -23,
+    -5, -13, 0, -6, -6, 6, -1, -6, 2, -5, 2, -3, -13, -10, 4, -6,
+    -16, 2, -11, -3, 2, 1, -4, 20, 1, -1, -1, -4, -10, 3, 0, -6,
+    9, -11, -4, 9, -7, -1, 4, -2, -9, -8, -13, -1, -3, -5, -2, -10,
+    -3, -5, -2, -7, -1, 10, -8, -1, 0, -10, -7, -5, 5, 3, -7, -16,
+    3, 1, -3, -18, 1, 2, -3, -9, 5, -5, -16, -2, 9, 4, -12, 5,
+    -11, 4, -29, -9, -13, 2, 11, -7, 3, -15, -6, 7, -6, -6, -2, -20,
+    5, 17, -10, 1, -9, 11, -1, -4, 1, 1, -10, 8, 6, 2, -4, 8,
+    17, -8, -2, -13, -3, 3, 0, 5, -3, -4, -14, -7, -12, 0, 1, -3,
+    8, -4, -5, -21, 7, 7, -1, -14, -1, -8, -8, -12, 14, 5, -2, -14,
+    0, -20, 12, -2, -9, -16, -1, 1, -4, 8, -7, -8, -7, 5, 1, -8,
+    4, 5, -2, -9, 5, -1, -11, -4, 1, 1, 4, -13, 22, -2, -1, -1,
+    -12, -5, 13, -11, 4, 1, 4, -8, 6, -4, 15, -11, -13, 3, 0,
+  },
+  {
+    -1, 0, -3, 4, 1, 2, 1, -8, -6, -6, -5, -7, -3, -2, 3, -5,
+    1, 7, -3, -12, -2, -8, -6, 4, 4, -5, -7, 0, 0, 2, -11, -5,
+    0, -2, -2, 4, 0, -11, -5, 7, -1, 8, -9, 16, -11, -9, 1, -11,
+    16, -2, 3, -5, -8, -11, -5, 7, -5, -5, -2, 5, -1, -15, -5, -12,
+    -2, -7, -8, -2, -13, 2, -5, 0, 1, -9, -12, -14, -2, 3, -2, -19,
+    16, -8, 0, 2, 8, 11, 4, -3, -20, 0, 3, -4, 4, -3, 4, -2,
+    7, -7, -17, -4, 3, -5, 6, -5, -2, -6, 7, -12, 5, 1, -11, 5,
+    13, -2, -7, 6, -5, -2, 4, -2, 13, -11, 1, -14, 2, 3, 1, -25,
+    -4, -11, -8, -7, 5, 14, -4, 1, -4, 2, 2, 2, -5, -4, -1, -5,
+    -6, 7, 16, -16, -2, -4, -7, 20, 3, 4, -2, 0, 11, 7, 2, -23,
+    -8, -5, 26, -21, 2, -4, 5, -1, 8, -3, 11, -6, 11, 13, -10, 6,
+    -4, -34, 2, -11, -17, 5, -9, -20, 16, 0, 7, -12, 5, -3, -8, 8,
+    -22, 3, -8, -10, 13, 21, 16, 1, -15, -2, 7, 9, 12, -2, -10, -14,
+    -20, 5, 15, 15, 3, -6, 7, -30, -7, 0, 1, 9, -5, -2, -2, -8,
+    7, 2, 6, -5, 1, -7, -6, 5, -23, 12, 4, -7, -8, -3, 6, -2,
+    4, 1, 17, -19, 4, 4, 0, 26, -6, 12, -7, -1, -3, -5, -2,
+  },
+  {
+    -4, 1, 0, 1, -2, 2, 1, -5, 0, 1, -4, -2, -3, -3, -4, -3,
+    4, 12, -2, -6, 0, 4, 0, -1, 3, 7, -5, -2, 1, -6, 2, -20,
+    -8, -2, -7, -4, 11, -6, 0, -6, -1, 0, -10, -1, -9, 1, 3, 5,
+    -3, -2, 4, -6, 11, 9, -2, -1, -4, 1, 2, -14, -6, -2, -4, -12,
+    -7, 1, 3, -1, 0, 0, 6, -2, 5, 4, 25, -16, -5, -1, -9, -13,
+    -7, -10, -1, -2, 6, 18, 3, 10, -3, -18, 6, -5, -14, 0, 10, 5,
+    3, -2, -4, -12, 1, 3, 1, -4, -5, -7, 8, -1, -6, -6, 2, 5,
+    -2, -6, 11, 7, -3, 2, -7, -29, -3, -5, -1, -4, 8, 7, 2, -27,
+    1, 0, -17, -8, -6, -7, 2, -15, 17, 6, 9, -13, 5, 7, 12, -6,
+    -7, 10, -2, -10, 1, 6, -16, -18, -8, 0, 6, 2, -11, -10, 6, -33,
+    1, -22, -1, -8, 2, -5, 7, 13, -4, 0, -1, 4, -36, -7, 12, 9,
+    2, 4, 6, -31, -15, -3, -13, -2, -12, -3, -5, 8, 18, 0, 8, -1,
+    19, -6, -4, -5, -3, 6, 4, 0, -6, -6, 12, -9, 0, 0, 10, -6,
+    -1, 10, -7, -23, -6, -11, 21, -9, -10, -9, 11, 6, 0, 6, -1, 0,
+    -3, -2, -1, -8, -6, 0, -5, -8, 2, 1, 5, 0, 8, -1, -3, -40,
+    3, 10, -1, -16, 6, -15, 3, 3, 1, -3, 6, -7, 11, 4, 13,
+  },
+  {
+    -5, -4, -1, -1, 0, 4, 2, -15, 9, -1, -5, -5, -1, -3, -1, -19,
+    -4, -1, -11, -1, -4, -6, -2, -4, -3, -4, 0, 0, -4, -2, 5, -30,
+    5, 0, -1, -2, -3, -5, -12, -7, -4, -9, -2, 0, 3, -8, 1, -11,
+    -5, -3, 1, -18, 4, 3, 0, -1, -2, 5, 4, -15, -7, -5, -7, -31,
+    -8, 1, -1, -8, -2, -9, 1, -13, -4, -9, -7, -5, -7, -13, 2, -8,
+    -5, -11, 1, -16, 14, -4, -9, 5, -12, -1, 7, -15, 4, -3, -7, -8,
+    6, 2, 12, -10, 4, 4, 5, -23, 3, -15, 13, -9, 16, -2, 3, -3,
+    5, -4, -5, -1, -5, -10, -3, 4, 1, -16, -5, -2, -10, -7, 1, -35,
+    -9, -22, -7, -11, -9, 8, 1, 10, -4, -20, 5, -3, -1, -12, 7, -10,
+    -15, 4, -3, -9, 3, 24, -7, -8, -1, -1, -7, -2, -6, 7, 3, 19,
+    5, 6, 1, 1, 5, -3, -1, -25, -9, 2, 11, -11, 4, -9, -2, -8,
+    7, -5, -15, -5, -1, 1, 2, 7, 12, 4, 12, -4, -6, 4, 6, -9,
+    -2, -11, -7, -12, -7, 4, 15, 10, 13, -9, 4, 8, 3, 14, -11, -35,
+    8, -12, 1, 1, -5, 5, 17, -3, 5, 9, 1, 8, -7, 2, 0, -18,
+    2, -1, 5, -15, 11, -7, 6, -6, 8, 0, 15, -11, 8, 13, 3, -13,
+    3, 1, 6, -23, 3, -5, 2, -1, -1, 11, -4, -24, 1, -7, 7,
+  },
+  {
+    -3, -4, -1, 6, 0, 2, 1, -5, 10, 4, -7, -1, 0, -2, -2, -10,
+    -4, 5, -13, 0, 1, -8, -3, -3, 4, 3, -11, -1, 0, -3, -9, -19,
+    -4, -2, 3, -8, 1, -4, -12, 1, -4, 3, 10, -1, 3, -2, -3, -9,
+    -7, 3, 0, 1, -3, -6, 3, -4, -5, 12, -1, -5, -4, -1, -1, -26,
+    2, -2, -2, -13, 1, 1, 3, 0, -12, 2, -5, 0, 6, -15, 3, -3,
+    0, -9, 0, 2, 18, 0, 22, -1, -8, -4, -3, 0, 1, 0, -3, -10,
+    -7, -9, 5, -3, 0, 6, -1, -6, 3, 1, 9, -18, 5, 5, -3, -10,
+    13, -3, 2, 5, 3, -12, -1, -15, -2, -9, 4, 2, 4, 0, -5, -10,
+    10, 2, 1, -8, -3, 9, 8, 1, -4, 1, -9, 7, -4, 9, 5, -20,
+    4, -12, 20, -12, 1, 10, -2, 2, 0, 4, 6, -5, 2, -4, -3, -7,
+    -3, -4, -10, -10, 4, 4, 1, -6, -7, 13, 14, -9, -17, 8, 15, 11,
+    -8, -5, -11, -5, -10, -1, -11, -2, -1, -9, 0, 0, -12, 6, -2, -1,
+    -1, 5, 1, 12, -6, 12, -6, 16, -4, 1, -3, -4, -2, -26, -3, -1,
+    3, 5, -6, -14, -23, -31, -2, -21, 4, -10, 15, -3, -3, -13, -1, 5,
+    -1, 1, -6, -8, -7, -7, -26, -7, 0, 4, 4, 3, -1, -1, -11, 15,
+    1, -14, -4, -11, -6, 9, 4, 4, 5, -4, 8, -2, -6, 3, -8,
+  },
+  {
+    -4, -4, 0, 6, 2, 1, -2, -7, 10, 0, -2, 0, 2, -5, -2, -7,
+    1, 5, -16, 1, -1, -9, 3, 5, -3, 0, -5, -8, -1, -4, 3, -13,
+    -2, -2, -3, 2, 5, -1, -11, -3, -2, -11, -2, -5, -5, 7, -4, 1,
+    -10, -1, 1, -8, -1, -3, -3, -5, -2, -3, 0, -6, 0, 2, -5, -23,
+    3, -8, -6, 0, -2, -6, 2, -8, -3, -10, -7, 7, 2, -14, -3, 3,
+    -4, -5, -8, 13, -1, 9, -5, -9, -3, -10, -8, 2, 16, 1, 12, 2,
+    1, 7, 8, 14, 14, 15, 7, 6, -8, -6, 2, 1, 3, 8, 1, -20,
+    13, -4, -2, -4, 10, 1, -6, 5, 1, -9, 21, -1, 0, -9, -13, -32,
+    -4, -5, -2, -5, -7, 5, -5, 7, 4, -3, 2, -7, 1, -4, 7, 0,
+    8, 1, 9, -13, -5, -12, 3, 3, -10, 8, -4, 1, 1, -2, 8, -19,
+    3, 7, 10, -17, 4, 5, -1, 1, 8, 9, -1, 0, -13, -12, 27, -9,
+    4, 6, -8, -10, 2, 1, -4, 3, -8, -6, -14, -4, 3, -9, 5, -4,
+    -1, -7, 4, -7, -6, 0, -9, -1, 15, 3, -7, -12, 6, -5, -4, -5,
+    -7, -3, 9, -7, -8, -11, -6, -1, 11, 17, -13, -12, -12, -3, 4, -3,
+    7, 1, 12, -10, -8, 8, 4, -6, -7, -4, 8, 0, -3, -3, 7, -2,
+    3, -4, 8, -12, -4, -4, -15, -1, -3, -7, -6, -9, -5, -11, 10,
+  },
+  {
+    -6, -8, -1, 15, 3, -2, -2, -6, 22, -4, -3, -2, -7, 1, 3, -5,
+    -2, 2, -25, 0, 0, -10, -9, -7, 4, 0, -3, -10, -8, 3, -3, -5,
+    -11, 3, 1, -3, 3, -21, -13, -2, -5, -5, -2, 0, -1, -16, -2, 0,
+    0, -7, 8, -6, -6, 6, 4, 9, -3, -7, -3, -3, -5, -1, 3, -9,
+    1, -13, 2, 2, -1, 2, 7, 2, 9, -3, -4, 26, 1, -16, -4, 10,
+    -1, -5, -3, 0, -4, 4, 6, 6, -5, 2, 2, 25, 4, -2, -5, -4,
+    -10, -8, -2, -1, 4, -3, -10, -1, 7, 0, -5, -18, -11, 5, -2, -4,
+    -2, -7, 7, -4, -6, 2, -3, 0, -3, -6, -6, 1, 13, -7, 3, -18,
+    4, -20, -7, 3, 5, -6, 10, -6, 7, 0, 2, -12, -9, 2, -5, -10,
+    -4, 2, 6, -4, -6, -3, 8, -1, 36, -2, -2, -2, -6, -5, 5, -1,
+    16, 5, 1, -6, 4, 9, -15, -10, -9, -3, -5, -12, -3, 8, 3, 13,
+    -9, 4, -15, -8, 3, 1, 8, 1, 22, -10, 9, -11, 2, 4, 12, -12,
+    -3, 4, -3, -4, -7, 4, -6, 9, 7, -6, 8, -10, 3, -8, -4, -2,
+    2, -4, 8, -12, -7, 6, 8, -8, -2, -1, -5, -10, -2, -9, -5, -4,
+    10, 34, 18, -17, 0, -7, 0, 4, 16, -9, 4, 1, 9, 5, -6, 9,
+    -1, 0, -15, -8, 10, -4, 15, 4, 5, -7, -9, -4, 1, 7, 13,
+  },
+  {
+    -6, 0, 0, 4, 6, -1, -3, -8, 13, 1, -18, -2, 0, -7, 4, -4,
+    -4, 3, -9, 3, 0, -15, -2, 2, 1, 0, -2, -3, -4, -2, -4, -15,
+    -4, 0, 2, -1, 5, 0, -5, -5, -1, -7, 1, 10, -3, -2, -5, -3,
+    -9, -2, -8, -7, -7, 3, -6, -6, 1, -5, 3, 0, -6, -4, 6, -16,
+    0, -10, -11, -2, -3, -5, -6, -15, -2, -7, -5, -8, -6, -25, 8, -17,
+    -4, -6, -3, -10, -4, -13, -8, 0, -8, 1, 9, -4, -4, -8, 6, -9,
+    1, -11, -4, -2, 9, 3, 3, -19, -2, -9, -4, 4, -7, 1, -2, -3,
+    0, -3, 6, 0, -4, 3, 1, -6, -4, -1, -4, -10, -4, -2, -3, -31,
+    -6, 5, -1, -4, -6, 8, -7, 0, -4, 6, -8, -2, 10, -13, 0, 2,
+    6, 0, -12, -2, -4, -3, -2, -5, 2, -5, -1, -3, -3, -9, -8, -2,
+    -1, 7, 8, -4, -2, -5, 9, 3, -3, 9, -9, 11, -3, -20, -3, 23,
+    7, -7, -9, -8, -4, -10, 12, -2, 1, 10, -8, -3, -18, 3, 5, -2,
+    -3, 14, 6, -20, -4, 9, 12, -4, 6, -1, 1, -3, -7, 0, -6, -14,
+    -1, -6, 13, -10, 3, -3, -5, 7, -8, 1, -7, 0, -8, -7, -1, -12,
+    7, -18, -5, -1, 12, -5, 1, -10, -5, 2, 1, 7, -2, 2, 8, -7,
+    2, -5, -7, -1, -4, 15, 3, -16, -9, -8, -5, 15, -13, -8, -3,
+  },
+  {
+    -2, -5, -1, 4, 2, 0, -4, -6, 11, 0, -7, 4, 0, 5, 0, -3,
+    -1, 1, -12, 0, 1, -4, -4, 1, -5, -3, -5, 0, 9, 2, 2, -10,
+    0, 2, 4, -7, 0, -1, -8, -3, -1, -1, 1, -1, 3, -5, 1, -5,
+    -4, -4, 5, -4, -5, -15, 0, -4, -6, 0, -22, 5, -1, 0, 2, -16,
+    -14, 3, -6, -5, -12, 3, -13, -2, -4, -2, 7, 2, -2, -23, 2, -2,
+    -2, 3, 0, 4, -5, -2, 18, 7, -7, -4, -9, -5, 2, -5, -3, -8,
+    -7, -6, -1, 9, -12, 0, 3, -5, -9, -12, -7, -4, 1, 2, 6, 9,
+    3, -6, -3, -3, -6, 20, 5, -5, -1, -6, 3, -1, 2, -9, -3, -24,
+    2, -15, 5, -15, -4, -29, -10, -8, -3, -26, -15, 3, 2, -14, 3, 5,
+    1, -3, 12, -8, -8, 14, -9, -8, -6, -1, 0, -2, -5, 0, 2, 2,
+    -3, 3, 3, -4, -8, 1, -4, -5, -7, -1, -8, 2, -7, 12, 8, 9,
+    -3, -4, -7, -11, -14, -5, -14, -2, 9, -1, 12, 4, 11, 0, 10, 0,
+    7, -5, -1, 2, 0, -4, -2, -7, 10, -20, 9, 4, -9, -27, 2, -3,
+    0, 13, -3, -11, -9, 1, 4, -9, -14, -1, -2, -1, 4, -7, -7, 2,
+    -3, -3, -11, -16, -1, 12, -1, -19, -4, 6, -4, 9, 21, -6, 9, 17,
+    0, -5, 7, -7, 14, 5, 4, -7, 1, 1, -17, 1, 1, 1, 1,
+  },
+  {
+    -4, -2, -1, 3, 0, 1, 1, 0, 13, 1, 2, -2, -1, -1, -3, -7,
+    -4, -2, -9, 2, -5, -5, -10, 2, -2, -2, 1, 4, -3, 3, -6, -6,
+    -1, 1, 8, -7, -8, -1, -9, 5, 10, -8, -4, -2, 1, 7, -1, -1,
+    -1, -6, -6, 1, 0, -3, -2, -2, 4, -6, -9, 3, -4, 0, -1, -19,
+    -12, -4, 3, -2, -9, -4, -8, -2, 3, -7, 1, 4, 0, -16, -6, 3,
+    -11, -4, -5, -20, -12, 12, 9, 3, -11, -9, 17, 10, -19, -11, -4, -4,
+    1, -6, 5, -9, 4, -3, 5, -12, -3, 0, -2, 2, -2, 3, 0, -3,
+    -4, -8, 0, -4, -10, -6, 3, -1, -6, 3, 14, 5, -6, 2, 4, -23,
+    -11, 12, -7, -18, -4, -3, 0, 0, -6, 19, -5, 7, -14, 17, 2, -2,
+    -3, 17, -1, -4, -7, 2, -1, -1, -1, -8, -3, 6, -8, -15, -3, 0,
+    -2, -22, -6, -1, 5, -4, -7, 18, 6, -14, -1, 3, -11, -12, 18, 0,
+    2, 1, -7, -11, 8, 11, -10, 8, 12, -18, -7, -1, 0, 15, -1, -7,
+    -12, -11, -2, -18, 5, 3, -9, -8, -1, -7, -3, -9, -8, -5, -9, -16,
+    5, -7, -10, -11, -2, 5, -2, -4, -22, 0, 6, 2, -7, -2, -11, -4,
+    0, 7, -4, -15, -7, 4, 5, -14, -9, -8, -1, -8, -6, 3, 1, 5,
+    2, 4, 4, -11, -8, -17, -3, -2, -15, 18, 3, 3, -7, 6, -6,
+  },
+  {
+    -3, -5, -1, 3, 0, -1, 2, -7, 12, 0, -5, -3, 2, 1, -5, 1,
+    -3, 1, -16, 0, 0, -5, 3, -4, 2, 0, -3, 1, -3, 6, -2, -6,
+    8, 1, -1, -3, 0, -3, -11, -4, -5, 3, -4, -5, -4, -1, 4, -15,
+    1, -5, -2, -2, -9, 6, -2, 2, 2, 5, -2, 2, 4, -8, 0, -20,
+    0, -2, -11, -2, 0, 2, -1, -5, 0, -6, -11, 10, -1, -14, -4, -8,
+    4, -8, 0, -7, 0, -2, 5, 1, -8, -5, 1, -4, 4, -4, 6, -25,
+    1, -7, 2, -4, -1, -8, -5, -6, 4, -1, -6, -7, -4, 5, -4, -1,
+    11, 0, 7, -1, 1, -7, 4, -1, -12, -10, 6, -4, 4, 3, -3, -26,
+    -1, -6, 4, -3, -8, 21, -7, -15, -6, -2, 4, 4, -2, -10, 11, -5,
+    -19, 2, -1, -2, 5, 23, -6, 2, 18, -3, -4, 1, -17, -3, 13, -5,
+    4, -6, -4, -3, -8, -2, 3, 8, 2, 19, -1, -4, 0, -10, 11, -2,
+    -6, -3, -8, -14, -11, 7, 3, -6, -5, -1, 2, -8, 1, 0, -11, -37,
+    -15, 4, 10, -10, 2, -10, -7, 2, -11, 0, 1, -9, 4, -6, -5, -9,
+    -2, -3, -3, -2, 5, -6, -7, -16, -5, 21, -9, -4, 3, 9, 0, -15,
+    -1, 0, -2, -2, -7, 3, 2, -12, -11, -22, 6, 5, 6, -7, -8, -2,
+    4, -11, 5, 5, -2, -5, 2, -9, 2, -10, -6, -15, 4, 0, 1,
+  },
+  {
+    -5, -6, -2, 1, 1, 3, -3, -12, 11, 2, -5, -3, 1, -3, -1, -14,
+    -2, 4, -13, -3, -1, -7, -2, -4, -4, -2, 4, -7, 0, -1, 0, -4,
+    0, 3, -5, 2, -1, 5, -6, -4, -4, -8, -7, -1, -6, -5, 2, -10,
+    -4, -4, 14, 6, 4, 3, -12, -2, 2, -6, 1, 0, 0, 0, 3, -33,
+    -7, -6, 5, 1, 4, -4, 7, -8, 4, -8, -2, -1, 1, -9, -3, -9,
+    12, -17, -7, -7, -3, 3, 2, 5, -4, 0, 2, -23, -6, 0, -3, -6,
+    1, -7, -2, -8, -5, 14, 2, 0, -15, -3, -6, -6, 4, -21, -2, 3,
+    18, -9, 1, -7, 9, -5, -7, -4, 2, -4, -6, -11, 6, 7, 2, -24,
+    -22, 23, 6, -11, -16, -1, -12, -7, -1, 12, -4, -3, 4, -12, -8, -4,
+    -3, 4, 9, -22, -3, 7, 27, -5, -3, 0, -6, 1, -1, 8, -6, 2,
+    12, -4, 7, -6, 3, 10, 14, -16, 13, -7, -20, 7, 18, -8, 6, 3,
+    2, -1, -1, -10, 1, -3, -1, -11, -7, -1, 0, 9, 2, -5, 0, -16,
+    8, 1, 2, -12, -4, 3, -3, -5, -8, 0, 9, -30, -6, -2, -2, 2,
+    -6, 15, -6, -21, -11, 21, -3, 8, -1, -7, -5, 37, 2, -1, 3, -4,
+    4, 9, -7, -2, 8, 2, 7, -8, 9, -1, -12, -2, -15, 14, 8, -2,
+    1, 0, 7, -19, 4, -8, -4, -9, -9, -6, -6, 3, 4, 0, 8,
+  },
+  {
+    0, -4, -1, 8, 1, -4, 2, -6, 11, -4, -4, -5, 6, -4, -3, -3,
+    3, 4, -6, -3, -1, -10, -2, 7, 1, 2, -8, 0, -7, 7, -5, -11,
+    -1, 3, -11, -2, 0, -5, -13, -4, 3, 1, 4, 1, -4, 1, 0, -8,
+    -4, -7, 8, 2, 1, -16, 3, -1, -3, 7, 7, -3, 3, -5, -3, -21,
+    -5, -7, -5, -1, -7, -3, 6, -7, 6, -10, 0, 0, -3, -16, 9, -4,
+    -3, -4, -6, 4, -2, 3, -2, 9, -5, -5, -2, 2, 5, 2, 4, -11,
+    0, -19, 13, -3, -3, -3, -13, 1, -6, -9, 0, 17, -4, 2, 3, 5,
+    3, 7, -5, 0, 3, 4, 1, 1, 1, -14, -17, 13, 7, 9, 9, -13,
+    7, -5, -3, -5, 7, -2, -5, 4, -3, -17, 10, -12, 11, 11, -2, -12,
+    -9, -7, 3, -10, 1, 10, -9, -6, 0, -3, -7, -4, -6, 16, -12, -5,
+    -6, -21, 1, -6, 7, 6, 3, 1, 5, 4, 6, 11, 8, 2, 19, 2,
+    0, -1, -4, -10, -2, -2, -2, -9, -2, 3, -1, -6, 2, -5, -8, 28,
+    2, 1, -11, 1, 0, 4, 33, -2, -2, 13, 1, 1, -13, -12, 5, 3,
+    12, -8, 13, 8, 3, 2, 4, 7, -30, 4, 0, 5, 0, -3, -2, 1,
+    -5, -2, -12, -9, 19, 12, -6, -4, 7, -3, 18, -2, -3, -10, -6, -9,
+    -10, 4, 20, -23, 0, -27, 3, 4, 6, 3, 7, -7, -10, -1, -2,
+  },
+  {
+    -4, -2, -2, -2, 1, -1, 1, -1, -5, -6, -6, 2, 6, 2, -4, -9,
+    -9, 10, -5, -9, 0, 10, -7, -1, 0, -3, 4, 5, 0, 4, -1, -22,
+    -3, -8, -1, -5, 1, -6, 2, -9, -5, 7, 1, -6, -9, -2, 3, -9,
+    -2, -4, 8, -1, 1, -9, 12, -2, -6, -4, -1, -5, -3, -2, -1, -30,
+    3, -13, 8, -17, -20, 12, -8, 0, 5, 9, 20, -7, -2, -9, 0, 18,
+    -7, -5, 6, -1, 0, -5, 5, 15, -9, 8, -4, 18, -9, -3, 0, 5,
+    -1, -7, 10, -16, -3, 6, 2, -1, -6, -4, -3, -9, 0, -6, -26, -2,
+    -2, -4, -3, 3, -5, -6, 0, -3, -8, -19, -3, 2, -10, 2, -8, -11,
+    5, -2, 0, -4, -1, -5, -3, 25, -1, -12, -8, -8, 7, -6, -3, -4,
+    -13, -14, 7, -16, 18, 1, 33, 9, -4, -4, 3, -6, -5, 7, -3, -11,
+    -33, -8, -13, -11, 3, -7, -4, -1, 4, -7, 7, 8, 6, -10, 15, -2,
+    -25, -7, -1, 2, -22, 4, -7, -11, -12, -11, -13, 1, 9, -3, 1, -14,
+    14, -2, 0, -13, -1, 5, -9, -18, 0, -3, -11, 0, -10, -7, -19, -13,
+    14, 3, 0, -13, 6, -7, -9, 10, 0, 5, 10, 6, 7, -26, -4, -4,
+    -7, -12, 8, -8, 2, -11, -6, -8, -1, -2, 11, 15, -1, 1, -3, -6,
+    -3, -9, 1, -17, 8, 7, 0, 4, 2, -5, 12, 4, 0, 11, 7,
+  },
+  {
+    -1, 1, 0, -3, 3, -3, 0, -5, 0, 2, -4, 4, 2, 0, -3, -1,
+    5, 2, -4, 1, -7, 12, -2, -3, 7, 0, -5, 1, -1, -3, -4, -12,
+    -6, 2, 4, -6, -7, 5, 6, -5, 12, -11, -2, 0, 15, -5, -6, 2,
+    -4, -6, -21, 1, 2, 4, 3, -5, 2, -1, 0, -11, -1, 6, 5, -15,
+    0, 6, -5, 3, -5, 0, 9, -8, -8, -14, -8, 9, -2, 1, -2, 3,
+    -7, -11, -10, -16, 2, -7, -1, 6, -2, -6, -25, 14, -8, -4, 4, -8,
+    -6, -4, -3, -3, 3, 6, -1, -3, 5, -11, 2, -3, 0, -6, -1, 10,
+    -1, -3, -14, 2, 2, 11, 6, -5, -2, -5, 5, -2, -8, 4, -2, -30,
+    -2, -2, -12, -13, 20, -16, -12, 3, 12, 5, -8, -16, -4, 9, -16, 17,
+    0, 0, -3, -5, 3, -2, -1, 6, -16, 8, -1, -2, -8, 5, -6, -4,
+    1, 3, -3, -15, 0, 20, 3, 15, -4, -17, 1, 2, 8, 9, -3, 2,
+    -5, 4, -8, -14, 6, 23, -1, -6, 14, -8, 4, -8, 3, -1, -6, -12,
+    0, 6, 0, -10, -6, 4, 4, -5, -3, -3, 11, 21, -22, 1, -1, -3,
+    9, -1, 3, -9, 26, 2, -1, 2, 12, -5, 3, -1, -4, -4, 5, -9,
+    8, 6, 16, -16, 4, 24, -1, -10, -1, 4, 3, 6, 5, -4, 5, 7,
+    -18, 6, -1, -9, 3, -5, -1, -5, 3, 13, -3, 6, 10, -1, 10,
+  },
+  {
+    1, -4, 2, -2, 2, 0, 0, -6, 3, 0, -4, -4, -1, -1, -9, -13,
+    3, -3, -7, 0, 2, 10, 5, -1, -1, 2, -1, -1, 3, -11, 4, -16,
+    -10, 1, 2, 1, 3, -11, -7, 0, 3, -6, -9, -3, 8, 2, -5, 3,
+    5, -2, 8, -1, 7, -8, -7, -2, -1, -6, -4, -16, -4, 3, -12, -23,
+    -1, -2, 2, 7, 4, -10, -4, 0, 9, 1, 4, -4, 4, -1, 4, -4,
+    -9, -5, -9, 3, -1, 1, -2, -2, -9, 1, -14, 3, 0, 5, -7, 13,
+    3, -5, 4, 1, -1, 4, 5, -10, -6, -7, 4, -6, 2, -22, 2, -2,
+    1, -13, 1, -6, -6, 3, 0, 2, 3, -3, -2, -10, 3, -13, 6, -28,
+    -8, -7, -14, -7, -12, 9, -9, -10, -6, 0, -4, 4, 11, -13, -7, 6,
+    -7, 0, 19, 0, 1, 23, -1, -15, -19, -1, -2, -2, 2, 3, 1, -10,
+    15, 1, -8, 3, 1, -18, -10, 4, 11, 7, -15, -14, 7, 3, -8, -5,
+    -9, -6, 5, -6, 1, -21, -24, -16, 1, -7, -4, -7, 4, -7, 4, -8,
+    -3, 8, -9, -10, -4, 0, 1, 11, 4, 2, 0, -11, -3, 6, -19, -14,
+    6, 1, 4, -31, 10, -18, -3, 2, 7, 9, -1, -19, 7, -2, 0, 6,
+    -6, 5, -4, -6, 0, 1, -4, -6, -8, 7, -6, -10, 13, 4, -5, -12,
+    -27, -2, -11, -9, 13, 9, -11, -5, 9, 8, -9, -7, 10, 5, -8,
+  },
+  {
+    0, -2, -1, -5, 0, -2, 1, -7, -1, 0, -3, 3, 0, 1, 1, -4,
+    -6, -8, -3, 4, -2, -1, 2, 6, -7, 1, -3, -3, -4, 0, -1, -15,
+    -13, 4, -1, -9, -8, -1, -4, -1, 3, -2, 1, -5, 0, -2, 5, 0,
+    -2, 10, -3, 5, 0, 4, 1, -3, -8, 3, 0, 4, 6, 5, 1, -19,
+    2, -13, 1, -1, -7, -5, 1, -19, -6, -2, 9, 5, -2, 9, -2, -11,
+    -2, 2, -2, -5, -15, -2, 0, 4, 3, -6, -14, -6, 3, -3, -1, -2,
+    2, 0, -3, 3, 0, -5, -7, -1, 9, -5, -1, -7, 0, 0, -3, -7,
+    0, -7, -4, -7, -2, 6, 4, -9, -12, -8, -4, 9, 6, -5, -2, -13,
+    0, -6, 8, 19, -18, -6, 8, -1, -3, -23, -8, -9, 1, 14, 6, -11,
+    10, 5, 2, -10, 10, -6, -5, 2, 10, -6, 8, -6, 4, -2, 9, -17,
+    6, -15, 3, -6, 17, 12, 8, 4, -1, -4, 4, -8, 1, -4, -11, 4,
+    -12, 6, 3, -10, -3, 10, -1, -5, 1, -19, -2, 1, 11, 5, 3, -9,
+    8, 1, -4, -4, -5, 12, -2, 1, 1, -1, -3, 9, -15, 3, -4, -2,
+    -7, 0, -7, -23, 4, 3, 4, -1, 0, 7, 10, -9, 10, 8, -10, -2,
+    2, 7, -12, -10, -5, -3, -7, 11, 2, 2, 2, -2, 3, 4, -1, 5,
+    13, -16, 8, -16, -20, 12, -3, -11, 5, -7, 4, 0, 9, -13, -2,
+  },
+  {
+    1, -1, -5, -5, -2, -6, -1, -4, 0, 3, -1, -5, 1, -2, 1, 1,
+    -3, 3, -2, 3, 4, -1, 2, -1, -9, 0, 1, -7, -2, 3, 0, -14,
+    12, 0, 2, -8, -6, -5, 2, -1, -1, -3, 3, -1, -3, 2, 7, -13,
+    -8, -21, -1, -9, -1, 1, 8, -4, -2, 6, -5, 3, -7, 11, 2, -12,
+    2, -7, -5, -9, -7, 0, 0, -4, 1, -4, 4, -4, 11, 2, 3, -14,
+    -1, -4, -3, -5, 8, -1, -3, 2, 2, -5, 7, 2, 5, -2, -9, -28,
+    -9, -34, -13, -33, -5, 0, 0, -10, -17, -10, -4, -16, 3, 1, 15, -16,
+    -8, -1, 6, -4, 2, -7, -6, -1, 5, -8, 2, -2, -4, 4, -5, -35,
+    3, 3, -5, -21, 1, 24, -7, 0, -7, -5, 5, -9, -4, -1, 14, -4,
+    0, -3, -4, -7, -5, -9, 4, -6, 9, 19, 3, -4, 10, 21, 5, -9,
+    -3, 2, -17, -10, -5, 3, -5, -12, -4, 2, -4, -19, 5, -8, 1, -4,
+    2, -2, -4, -12, 0, -1, 9, -2, 7, -3, 11, -4, 2, -22, 3, -30,
+    -5, 16, 2, 21, 2, -26, 3, -28, 1, -2, 4, -7, -13, 1, -2, 16,
+    -4, -11, -4, -9, -2, -10, -5, -11, 10, -1, 1, -5, -4, -6, 15, -18,
+    -12, -2, 2, -6, -4, 5, -4, 14, 13, -1, 7, -6, 5, 1, 6, -3,
+    -6, 7, -15, -17, -7, -3, 5, 5, -10, -2, 8, -7, 6, -13, -18,
+  },
+  {
+    0, -2, -1, -4, -2, -2, 1, -5, -2, -2, 1, 3, -3, -1, 0, -11,
+    -2, -3, -1, -1, -4, 5, 2, -3, -6, 8, -1, 7, 1, 1, 4, -18,
+    -2, -7, 0, -7, -11, -6, 2, -8, -6, -9, -2, 0, -1, -5, 3, 3,
+    -5, -3, 1, -2, -7, -2, 0, -4, -7, -7, 8, 1, -3, -6, 11, -26,
+    -6, -9, -3, 6, -2, 7, -2, -16, 8, -9, 3, -8, -5, 8, 3, 9,
+    -2, -11, 12, -13, 4, -2, -2, -8, -4, -5, 9, -2, -4, -3, 1, 0,
+    -3, -7, 2, 8, -5, 0, -10, -8, -4, 8, 7, 3, -4, -6, 0, 5,
+    0, -18, -9, 4, 5, -6, -8, -3, 7, -1, -1, 2, -5, -1, 14, -7,
+    -6, -12, 4, -5, 2, -4, 10, -8, -6, -4, -6, -5, -2, -4, 18, 5,
+    -9, 7, -2, 0, -3, 1, 0, -7, -9, -7, 0, -17, 4, 5, 2, -2,
+    27, -2, -3, -19, -3, -14, 11, -24, -5, -2, -4, 0, -6, -5, -11, -1,
+    -3, 4, -10, -11, -6, 9, 6, 1, -5, -3, 1, -2, 6, -1, 17, -5,
+    -2, 5, 1, -2, -12, 10, 4, -19, 13, 9, 8, 10, -2, -14, -2, 8,
+    6, -7, 0, -10, 13, -8, -4, -6, -11, -5, -9, -5, -13, 6, -9, -8,
+    -4, 1, 8, 6, -3, -7, -16, -3, -11, 7, -4, -1, -1, -27, 1, -9,
+    4, 6, 9, -8, -2, 2, 10, 1, -6, 6, 1, 6, -3, 3, 28,
+  },
+  {
+    -9, -11, 0, -18, -4, -2, -6, -27, -7, -7, 3, 0, -7, -2, 5, -38,
+    1, -6, -2, 7, -9, -5, 5, 5, -10, -10, 4, -9, -13, -1, 3, -37,
+    -6, -9, -2, -13, -14, -18, 6, -9, -5, -16, 7, -16, 1, -4, 0, 3,
+    -5, -17, -1, -19, -7, 0, 3, -19, -3, -10, -1, -5, 2, 8, -16, -52,
+    -3, -10, 6, -11, -4, -9, -4, -21, 7, -13, 4, -12, -7, -15, 2, -8,
+    2, -22, -26, -19, 0, -5, 9, -13, -3, -7, 5, -3, 2, 8, -3, 2,
+    0, -8, 4, -29, 11, -9, 9, -3, 8, 0, 1, 0, 2, 0, -2, -9,
+    -12, -5, -5, -19, 2, -6, -8, -15, 3, -9, 1, -6, -13, 23, 3, -69,
+    1, -8, -25, -9, -2, -8, -1, -18, -1, -7, -11, -15, -2, 1, 9, -13,
+    -4, -8, -3, -21, 0, -5, -3, -23, 12, 5, -17, 6, 1, -5, -9, -6,
+    1, -1, -7, 8, -9, -38, 0, -28, 9, -9, -11, 3, -2, 6, 6, 8,
+    8, -5, -12, -3, -6, 3, -1, -4, 3, 0, -3, 1, 24, 25, -11, -2,
+    -5, -13, -1, -1, 4, 12, -16, -34, 1, 11, -1, -7, -14, -1, 2, -39,
+    -23, 6, -1, -1, 8, -2, -4, -6, -3, -9, 14, 1, 9, -18, 4, -26,
+    -8, 7, -12, -4, 12, -14, 7, -5, 4, -5, 11, -6, -7, 4, -13, -14,
+    -3, -5, -3, -8, 5, 3, -13, -15, -4, -12, 2, -9, -10, -1, 2,
+  },
+  {
+    -2, -2, 0, -5, -5, -1, -1, -5, -2, 4, -2, -1, -5, 4, -3, 1,
+    0, 1, -2, -3, 5, -3, 5, 1, 0, 0, -2, 5, -2, 1, 0, -14,
+    -13, -10, -13, -3, -1, -6, 0, -4, -8, -3, -13, 0, -1, -3, -3, -2,
+    -5, -11, 3, -7, -1, -2, 1, -2, -1, -1, 4, -5, 1, 0, -1, -22,
+    7, 1, -9, -13, -8, 9, -1, -7, -2, -3, 2, -1, 4, -11, -8, 0,
+    -3, -9, 5, -16, 6, -18, -6, -4, -4, -12, 4, -1, 3, -1, -3, 4,
+    1, -6, 0, -12, 3, 4, -4, -2, 0, -4, -1, 1, -9, 0, -4, -3,
+    8, -5, -8, 4, 10, 1, 2, -15, 5, 0, 3, -6, 0, -2, 3, -28,
+    -10, -5, -9, 8, -23, 6, -3, -19, -2, -7, -11, 3, -20, 1, -10, 2,
+    0, 7, -3, -11, 9, 9, -1, -10, 12, 13, -5, -16, 3, 10, 1, -16,
+    3, -1, -4, 1, -2, 13, 3, -16, -7, -1, 15, -26, 8, -8, -4, -6,
+    -6, -5, -5, -3, -4, -8, 8, 0, -12, 7, -2, -10, 7, 4, -15, -7,
+    10, -1, -3, -1, -7, -6, -4, -29, -4, 4, -13, 12, -2, 13, -10, 1,
+    5, 6, -6, -4, -5, 9, 3, 1, -14, -8, -7, -4, 11, -3, -1, -3,
+    10, 3, 3, 1, 7, -14, 11, -9, 13, -21, 2, 1, 3, -6, -2, -8,
+    11, 1, -1, -3, -1, -6, 9, -8, 12, 9, 9, -5, -4, -2, 5,
+  },
+  {
+    -2, -3, -1, -8, -1, -3, 0, -10, -2, -3, 0, 4, -2, -1, 0, -12,
+    -5, 3, 7, 1, 2, 2, 1, -3, -13, 5, 1, -4, -8, 4, 2, -18,
+    0, -2, -5, -2, 2, 1, 0, -3, -11, -3, -1, -2, 0, 5, 3, -6,
+    -6, 8, 5, 0, -7, -2, -4, -7, -3, 1, -5, -2, -4, -1, -1, -17,
+    2, 0, 0, 8, 5, -4, -1, -3, -5, -8, -4, 6, -6, -1, -2, -11,
+    -1, -3, 1, 8, 2, -9, -6, -3, -12, -8, 2, -2, 1, 3, 4, -10,
+    -2, -13, -3, -4, -8, 1, 6, -12, 1, -3, 1, 10, 1, -5, -1, 1,
+    -9, -4, 2, -11, -1, -1, -4, -3, -6, -3, 1, -7, 0, 3, 5, -31,
+    17, 3, -4, -3, 10, 8, -12, -10, -8, -3, -1, 11, 0, -2, -7, -14,
+    -12, -2, 0, -13, -4, -13, 12, 1, 2, -12, 0, -2, -1, 23, 6, -12,
+    -14, 1, 2, -1, 8, 10, 11, -1, -10, -2, -15, 4, 15, -4, 1, 13,
+    10, 0, 3, 13, -3, -7, 10, -8, 3, 5, 0, 0, -7, -2, 12, -16,
+    -8, 10, 10, 4, 2, -10, 6, -12, -7, 27, -7, -2, 6, -6, -10, 8,
+    1, -10, 4, -16, 3, -12, -4, -5, -7, -6, -3, -1, -1, 15, -2, 3,
+    -2, 11, 0, -12, 1, 0, -12, -27, 3, -3, -15, 6, -6, -2, 6, -5,
+    0, 9, 4, -17, -5, -7, -7, -1, -4, -2, -6, -5, -3, -17, 12,
+  },
+  {
+    -7, -12, 0, -4, 0, 1, 1, -20, 13, -3, 2, -2, 3, -1, -2, -13,
+    -1, -3, 22, 4, 0, 3, 0, 2, 0, 5, 1, 3, 1, 2, 2, 22,
+    -8, 5, 3, -5, -2, 2, -25, 3, 6, 3, -2, -2, 3, -7, 4, -2,
+    0, -2, 2, 2, -5, -2, -5, 0, -5, -3, 0, 3, -1, -3, -1, -20,
+    -11, 2, -9, 2, -12, -1, -1, -1, 3, 0, 0, -6, -5, 10, 2, -1,
+    -1, -9, -8, -4, 0, -1, -1, -3, 4, -5, -1, -3, -7, 0, 3, -8,
+    3, 0, -17, 2, -7, 4, 6, 3, -3, -1, 0, -1, 1, -5, 2, 2,
+    9, -4, -2, 5, 0, 3, 0, 3, -4, -9, -6, 3, -2, -12, -10, -27,
+    6, -21, -12, -6, 8, -7, -1, -4, 2, -5, 0, 7, -7, -1, 9, -4,
+    10, -5, 13, -20, 5, -3, -2, -5, -4, 4, 0, 33, -33, 0, -10, -4,
+    3, -10, -9, -14, 3, -18, -7, 2, 16, 4, 3, 10, -6, 7, 1, 7,
+    0, 0, 1, -21, -1, -1, 2, 2, 4, 14, 12, -4, 6, -5, -3, -4,
+    8, 6, 6, -11, -1, 13, -1, 4, 7, 10, 1, -2, -7, -1, -11, 4,
+    -9, -14, 5, -14, -2, 12, 4, 1, 5, -5, 4, 7, 0, -7, 5, -10,
+    0, 8, 4, 10, 5, -6, -3, 1, -9, 7, 9, 3, 5, 2, -4, 2,
+    10, 9, -2, -10, 7, -3, 6, -6, 1, -3, 3, -8, 4, 2, 12,
+  },
+  {
+    0, -4, 3, -3, 0, 0, -3, -6, 1, -1, -3, -2, 5, -1, -2, -13,
+    -1, 1, -4, 1, 1, 5, -2, 1, -1, -1, 3, 11, -14, 5, 5, -8,
+    -1, -3, 1, 0, -5, -7, 8, -5, 8, 4, -6, -2, -8, -2, 6, -7,
+    -1, 5, -3, -3, 3, 1, -1, 0, 17, -12, -3, 1, -13, -1, 0, -17,
+    5, -11, -3, 0, 1, -2, -4, -9, -3, 1, 12, -13, 0, 3, 4, -5,
+    3, -4, -12, -8, 8, -5, -3, 6, 5, 5, 8, -2, -1, 3, 9, 0,
+    4, -8, 1, 5, -3, -11, -10, -5, -3, -2, -4, 11, 3, 7, -8, -16,
+    -6, -6, -1, -22, -7, -5, -6, -5, 0, -23, -12, 0, 2, -4, 3, -26,
+    3, -2, 21, -11, -15, 10, -6, -3, 17, -5, -9, 0, 2, 1, 10, -8,
+    -6, -6, 2, -11, 15, 8, -2, -17, 1, 19, -4, 3, 4, 1, 11, -13,
+    -3, -4, 3, -12, -15, -9, -3, -7, 8, 5, 4, 6, 6, -16, -4, 3,
+    -5, 5, 0, -11, 13, -5, -7, -15, -8, 3, 7, 18, 3, 10, 22, -1,
+    -16, -5, 5, -7, 10, -7, -8, -5, 7, 10, -1, -4, -11, -3, -4, 10,
+    4, 15, 9, -14, 0, 5, -1, 3, -3, -17, -7, -2, -7, -2, -2, 0,
+    6, -7, -1, -4, 1, -12, 24, -36, -10, 13, 8, 2, 11, -1, -6, 0,
+    2, -4, -19, 19, -11, 0, 27, 4, 3, -12, -1, -20, 1, 10, -8,
+  },
+  {
+    -1, -3, 2, -6, 2, 0, 2, 3, -1, -1, 1, 1, -3, 0, -8, -7,
+    12, 2, -3, 4, -1, 4, 2, 1, -1, -1, 1, 1, 0, 5, -2, -15,
+    -4, 0, -17, -1, 1, 2, 0, -1, -3, -2, -3, -1, 1, -4, -2, 0,
+    -2, 3, 5, 5, -7, -9, 8, -4, 0, 0, -3, -7, -14, 4, -1, -25,
+    -3, 3, 9, -3, 1, -29, 15, -6, -11, -3, -16, -4, 6, -3, -3, 10,
+    2, -19, 2, -6, -3, 0, 2, 0, -11, -14, 2, 12, 0, 6, 2, 0,
+    10, -7, -3, -7, 2, 6, 0, -5, 7, 1, 1, 2, -11, 3, 5, -5,
+    -6, -8, 10, -7, -2, 0, -3, 6, 3, 9, -4, -12, -6, -5, 0, -29,
+    -3, 4, -3, -9, -17, 9, 1, 4, 7, -11, -1, 28, 11, -16, -21, 2,
+    16, -5, 0, -7, -5, 26, 0, 5, 3, -6, 8, -3, 0, 10, -9, -10,
+    -16, -1, 9, -25, 1, -1, -2, -13, -1, -5, 0, -1, 0, 9, 2, -8,
+    4, -11, 6, 2, -8, 2, 7, -6, 17, -7, 7, -14, -8, -2, 2, 1,
+    -2, -1, 14, 1, -8, 8, 3, 4, -6, 9, -6, 4, 4, -1, 1, -10,
+    -8, -11, 17, -5, -17, 2, -6, -5, -10, -3, -10, -1, 4, 11, -12, -10,
+    3, -8, -16, -9, 0, 1, -6, 0, -12, -2, -17, -6, -4, 1, -8, -15,
+    11, -3, -13, -14, -5, 3, 4, -5, -3, -10, -12, 3, 3, 10, -8,
+  },
+  {
+    0, -3, -5, -2, -1, 7, 0, -5, -6, 1, 2, 2, 10, -2, 0, -4,
+    5, 6, -2, -6, 1, 3, 0, -1, 2, 6, 10, -2, 1, 1, -6, -14,
+    2, -5, -9, -9, -12, 6, 1, -4, -1, 1, 3, 0, 2, 5, -4, 2,
+    -6, 1, -1, -2, 4, 10, -28, 0, 8, 1, 1, -1, 1, 2, 4, -21,
+    -6, -8, -2, 0, 0, -17, 3, -4, 0, 13, 0, 14, -8, -2, -6, -3,
+    2, -6, -12, 0, -8, -9, -1, -2, -5, -2, -6, 0, -6, 13, 5, -8,
+    -3, -13, -6, -4, 16, -7, -2, -3, -3, -9, 2, -3, -8, 29, 3, -3,
+    -6, -5, 12, -7, 3, -3, 0, -3, -6, -9, -4, 3, 1, 4, 3, -26,
+    3, -3, -9, 3, 4, 1, -11, -3, -6, -1, -10, -17, 4, -12, -14, 1,
+    -3, 15, -8, 2, -32, -7, 5, -3, -4, -10, -7, -3, -9, 8, -2, -8,
+    12, 0, 4, 7, -2, 5, -5, 6, 3, -12, 8, -5, -6, 15, -6, -12,
+    0, 1, 2, -9, -6, 3, 9, 8, 3, -15, -5, 5, -17, 12, 3, -9,
+    -7, -10, 3, 0, -8, 1, -3, 6, 0, 3, -3, 11, 3, -15, 6, -15,
+    11, -4, 6, -8, -4, -8, -7, -6, -20, 0, -10, -13, 29, -4, 9, -7,
+    -3, -1, -5, -1, -10, 9, 8, 8, -3, -2, -7, -10, 8, -4, -3, -8,
+    -7, 2, 7, -16, 2, -5, -4, 6, 1, -1, -2, -15, -5, 1, 4,
+  },
+  {
+    0, -2, -2, -2, 0, 6, 0, -8, -2, -2, 0, -1, -8, -4, 1, -10,
+    -1, -2, -5, 4, -4, 2, 2, 1, -2, -10, 1, 5, 3, -1, 0, -21,
+    -4, 0, -2, 3, -1, -8, 4, -1, -3, 0, -3, -5, -1, 1, -3, 2,
+    -3, -3, 0, 10, -3, -7, 1, -2, -9, -6, -6, -5, 1, -3, -1, -20,
+    3, -1, -6, 1, 4, -2, -1, 2, -10, -1, -1, 9, 0, -7, -5, -8,
+    -2, -2, 4, -1, -8, 0, 8, 0, 4, -10, -3, -11, -5, -9, 3, -2,
+    4, -5, -2, 3, 2, 4, 0, 8, -29, -6, -13, 2, 8, -9, 2, -5,
+    6, 3, 5, 6, 2, -9, 6, 2, -9, 3, -5, 6, -2, 1, -12, -37,
+    2, -5, 1, -6, 4, 10, -2, -4, 9, -16, -3, -8, -3, -4, 4, -11,
+    8, -4, 7, -14, 6, -7, -7, -10, 14, 1, 4, -12, -3, 7, 5, -6,
+    -9, 2, -15, -3, 2, -6, -3, -1, 3, -3, -3, 0, 8, 4, -17, -9,
+    11, -4, -18, -25, -4, 5, 4, -1, 1, -13, -9, -8, 6, -10, -10, -1,
+    -12, -7, -18, -6, -2, -4, -4, -10, -8, -1, -4, -9, -3, -2, 5, -12,
+    23, -38, 12, -12, -2, 3, -2, 3, -13, 6, 5, -2, -4, 10, 15, -1,
+    2, -9, -9, 4, 16, 5, 1, 6, 7, 0, -2, 8, 5, 6, 0, -5,
+    13, -6, 3, -20, -1, 5, -4, 0, 0, 2, 11, -2, -1, 4, 14,
+  },
+  {
+    -5, -8, -1, -12, -3, -2, -2, -16, -4, -1, 2, 5, -2, -1, 2, -25,
+    0, 5, 1, 0, -4, 2, 0, 0, 10, 1, 0, -2, 0, 2, -5, -37,
+    2, 5, -9, -3, 1, 3, -1, -9, -9, -10, -4, 5, -2, 5, -5, -6,
+    -8, -3, 10, -2, 1, -2, -3, -4, -5, -7, 2, 3, -6, -7, 2, -52,
+    1, -4, -5, -14, 2, 7, 0, -2, -5, -7, -11, -7, 2, 9, 5, -15,
+    -6, -20, 10, -6, -2, -7, 1, -5, 7, -2, 6, 3, -2, 0, -4, -5,
+    -1, -6, 8, 4, 3, -1, -16, -2, -8, -9, -9, 0, -13, 0, -3, 2,
+    0, -3, 8, -4, -13, 10, -2, 8, 3, -3, 2, 9, 2, 5, 1, -13,
+    7, 8, -23, -14, -8, -1, -2, -28, 10, -10, -22, 0, 15, -1, -4, -4,
+    -4, -2, 0, -20, 2, -11, -5, -8, -7, 3, -7, 1, -15, -5, -18, -26,
+    -1, 7, 6, 0, 2, -13, -13, -23, -2, -2, 4, 8, 7, 1, 9, -6,
+    9, 9, -4, -8, -2, -14, 0, -3, 1, 4, 2, -8, -15, -4, -2, -11,
+    -12, -4, 0, -8, 1, -6, -1, 1, -5, 8, -6, -9, 4, -20, -18, -16,
+    -6, -1, 0, -7, -1, -4, 10, -3, -10, 11, -16, -8, -2, -2, -23, 1,
+    5, 3, 4, -11, -1, -8, -13, 12, 10, -5, -3, -1, 12, -7, -4, -6,
+    6, 4, -3, -2, 7, -9, 5, 0, 13, -2, -6, 17, 0, 1, -10,
+  },
+  {
+    -1, -3, -1, -4, 1, -2, -1, -5, -1, -3, -3, -1, -2, -1, -1, -13,
+    0, -6, -3, -1, 1, 2, 2, 6, -7, 1, -5, 2, 1, -1, 1, -10,
+    -5, 0, 2, -6, -1, -1, 2, -2, 3, -3, -3, 7, -2, 3, -5, -13,
+    0, -4, -5, 0, 4, 1, -1, -3, -3, -4, -7, 5, -1, -6, -11, -18,
+    0, -3, -6, -4, -12, 0, 1, -18, 6, -7, -5, 10, 1, 6, -7, -15,
+    -2, -8, -14, -11, 2, 7, 0, 7, -1, -11, -4, 0, -7, 4, -2, -6,
+    1, -5, 1, 7, 9, 5, 4, -2, 2, -3, -4, 4, -4, -3, -1, -11,
+    -5, -7, 1, -7, -7, 9, 4, -5, -8, 0, -3, -8, -10, 1, -10, -18,
+    5, 2, -3, -4, 4, 7, -5, -20, 2, -1, -3, -1, -11, 2, -14, -11,
+    21, 2, -19, -1, 1, 7, -4, -14, 9, 5, 11, -3, 11, 9, -12, -2,
+    0, 1, 2, 0, -7, 13, 3, -3, 10, -3, -1, 0, -11, 6, 10, 0,
+    -5, -10, -1, -3, -1, -8, -3, -11, 11, 1, 2, -2, 5, -15, -3, 2,
+    -14, 12, -13, -4, 8, 6, 11, -5, 8, 1, 5, -8, -17, 15, -10, 8,
+    -11, -3, -3, -10, -3, -12, -4, 3, 8, 4, 18, 9, 5, 7, -4, 4,
+    -14, 10, 11, -11, -3, -5, -11, 2, 8, -12, -4, -9, -19, 4, 8, -10,
+    1, 20, -6, -6, 6, 4, -2, -8, 2, 10, 0, 5, -11, -5, 7,
+  },
+  {
+    -1, -1, 2, -4, 0, -3, -4, -3, -1, 1, 3, 1, -2, 1, -4, -6,
+    3, 4, -3, -1, 3, 0, -5, 1, -6, -1, 0, -3, 1, -3, -3, -13,
+    -2, -4, 3, -1, 4, -2, -2, -4, -4, 0, 8, -3, 0, 5, 5, -1,
+    -11, 7, -2, -1, 3, 0, -9, -2, 1, 0, 3, 6, -1, -2, -1, -23,
+    3, -4, -5, -7, -1, -5, 5, -3, 4, -11, 20, 9, -8, 7, 6, 1,
+    2, 0, 2, -2, -4, -5, 6, -9, 6, -11, -4, -6, 13, -7, 2, -11,
+    -3, -8, 1, -4, 17, 2, 6, 1, -3, -9, -1, -3, 3, 2, -5, -16,
+    9, 3, 4, 0, -2, -3, -1, -3, -6, 1, -6, 3, -3, 3, -5, -25,
+    4, 2, 3, -6, -10, 3, 10, -5, 3, -1, 5, 6, 6, -1, 9, -7,
+    -2, 2, 12, -10, 1, -11, -4, -11, 12, -3, -8, 6, 20, 5, -6, -9,
+    -22, 6, 3, -5, -2, -5, 3, 13, 12, -8, -3, 7, -4, 3, -22, 11,
+    4, 0, -10, -9, 0, -2, 1, 5, -4, -3, 20, -4, -14, -4, 7, 7,
+    4, 11, -22, 4, 2, -5, -5, 5, 0, 8, -17, -10, -5, -5, 4, 4,
+    3, 4, 9, -3, 11, 2, 5, -7, -3, -4, -1, -2, -3, -5, -7, -23,
+    8, 3, 6, -3, 6, -6, 6, 1, 10, -3, -6, 1, 0, 4, 12, -2,
+    2, 11, 5, -15, -5, 7, -8, -3, -3, -1, 7, -12, -3, -7, 10,
+  },
+  {
+    -1, -1, 1, -1, 1, 0, -3, -4, -3, -1, 2, -3, -2, -3, 5, -6,
+    2, -3, 2, 1, -5, 2, -5, 0, -1, 1, 8, -1, -2, 0, -5, -12,
+    -7, 3, 0, -5, -1, 8, -8, -4, -6, -1, -1, -4, -8, 3, -7, 5,
+    -6, 4, 0, 2, -1, 3, 3, -2, -1, -5, 10, 0, -2, -4, 4, -19,
+    2, -7, -3, 3, 2, -7, 2, 2, -2, -13, -1, 7, 8, 6, 7, -4,
+    4, -2, -9, 3, 8, -2, -1, 17, 0, 2, -5, -3, -13, 8, -2, 3,
+    -3, -5, 3, -3, 0, -7, 0, 4, 12, 0, 3, 6, 6, 13, 6, 4,
+    -7, -6, -1, -11, -3, 1, -2, -11, -1, 3, -2, -11, -1, 5, 0, -30,
+    2, -11, -4, -12, 3, -20, 10, 7, 0, -1, 0, 7, -6, -5, -5, -28,
+    -20, 6, 1, -25, -5, -2, 8, 5, 2, 2, 4, 3, 10, 1, -4, -8,
+    -14, -13, -2, -10, -12, 9, -3, -3, 4, 5, 19, -4, 9, -5, 12, -8,
+    14, -5, 12, -14, -7, 11, 14, -4, -6, -13, -4, -7, 9, -8, -3, -1,
+    5, 5, -17, -11, -2, 9, 7, 9, -6, 15, 4, 8, -3, -11, 6, 4,
+    4, -1, 5, -9, -13, -6, -1, -5, -1, -7, 9, 7, -15, -3, -9, -5,
+    -5, -13, 1, -4, -1, 1, 15, 5, -10, 7, -10, -6, 11, 13, 2, 3,
+    -2, -1, 8, -17, -1, 5, 5, 5, 11, 6, -10, 5, -9, -3, -7,
+  },
+  {
+    -4, -8, -1, -10, -3, 1, 0, -8, -6, -1, -1, -5, -2, -2, 4, 3,
+    -6, 6, -1, 1, 1, 3, -2, 0, -1, -7, 3, 3, -1, 2, 5, -18,
+    -3, 11, -5, -8, -6, -4, 4, -4, -2, 0, 1, 3, -9, 0, 10, -6,
+    2, 2, -1, -11, 1, -4, -3, 1, 0, -2, 3, 1, -7, 0, -2, -26,
+    7, -18, 5, 1, 0, -12, -1, -9, -4, 1, -3, -7, 7, -1, -4, -9,
+    -1, -3, -4, -12, 3, -4, -2, 1, 4, 3, 6, -2, 4, -9, -8, -12,
+    -5, -5, -3, -6, 6, -3, -2, 21, 5, -2, 1, -7, 8, -2, 5, 5,
+    0, -9, 2, 1, 3, 3, -1, -2, -4, -2, -4, -4, 0, 4, -17, -40,
+    -16, -28, -2, -15, 8, 1, 2, -11, -4, 1, 6, -11, -21, 3, -13, -30,
+    -2, -10, -3, -14, 0, 0, 10, -1, 6, 4, -2, -1, 8, 7, 0, -4,
+    -1, 4, -3, 1, 5, 15, 2, 4, -6, 0, 1, 2, 3, 7, -3, -1,
+    4, 12, 5, 2, -5, 1, -2, 0, 2, -5, -4, -8, -4, -10, 4, -8,
+    6, -2, -17, -2, 6, 4, 5, 5, 0, 12, 16, -2, -2, 14, -1, 4,
+    18, 12, -1, -17, -3, -12, -3, 8, -5, -1, 10, -11, 6, 6, 13, 5,
+    3, 3, 8, -11, -10, 5, 11, 2, 1, 2, 6, 8, -4, 5, 2, 7,
+    12, 2, 12, -13, -2, -3, 5, 1, 0, 8, -5, -8, -10, -12, 0,
+  },
+  {
+    -2, -3, 0, -4, -4, 0, 0, 3, 1, -4, -2, -2, 0, -4, -5, -9,
+    2, 1, -8, 11, -3, -2, 2, -2, 1, 2, 6, -2, 2, 5, 1, -19,
+    3, 5, -16, -2, -3, 1, 1, -1, 14, -3, -9, -1, -1, -5, 1, -4,
+    0, 1, 4, -5, -3, -4, 12, -6, 1, -1, -1, 2, -5, -2, -1, -19,
+    7, 1, 7, -2, -2, -28, -9, -5, -8, -9, 3, -7, -4, 7, -4, -2,
+    3, -9, -21, 4, -3, -4, 1, 9, -7, -2, 0, -4, -1, -5, -1, -13,
+    -7, -11, 5, 0, 0, 4, 1, -3, 14, -7, 1, -4, -3, -1, -7, 7,
+    4, -1, 2, -3, -3, 0, 0, 3, -2, -14, -1, 4, -3, -8, -6, -20,
+    -1, 4, 12, 5, -7, 12, 15, -16, -10, -15, -12, -22, -7, 0, 13, 8,
+    -6, -9, -8, -16, 0, -6, 6, -9, 7, 8, 3, -8, 7, 8, 2, 1,
+    4, 3, -9, -5, 0, 28, 3, -11, 18, 2, -1, 11, -6, -20, -4, 0,
+    -8, -4, -4, -6, 3, -11, 2, 2, 16, -4, -5, -6, 2, -6, -6, 13,
+    7, 7, 5, -4, 0, 4, 2, -6, -6, -5, 0, 6, -2, 2, -6, -9,
+    3, -2, -12, -15, -15, 9, -5, 1, -20, -3, -6, -2, -3, 6, -8, 2,
+    0, 9, -13, 3, 1, -1, -22, -3, 8, -6, -7, 4, -3, 3, 5, 4,
+    -5, 8, 6, -27, 4, 11, 6, 9, -2, 7, 15, -7, -1, 5, -4,
+  },
+  {
+    -1, 0, -1, -1, 0, 3, -1, -5, -1, -8, 3, 3, 0, -1, 2, -1,
+    2, 5, -8, 5, -1, 1, -8, 0, 6, -3, -1, 0, 1, 2, -6, -12,
+    -4, 2, -2, 5, 3, 5, 0, 1, 6, 0, 2, 1, -6, -4, 2, -7,
+    -4, 0, -7, 11, -1, 6, -2, -3, -5, -3, -3, -6, -1, 8, -1, -22,
+    4, 4, -1, -2, -7, 2, -2, -3, -5, -12, -13, -5, 11, -6, 3, -6,
+    -8, -4, -24, 3, 2, -9, -3, 2, -5, -2, 9, -12, -15, 5, -12, -10,
+    -1, -6, 7, -2, 0, 8, 0, -3, 19, -2, 0, -3, -2, 8, -1, -3,
+    4, -13, -5, 4, -3, -4, -4, 0, -1, -2, -1, -5, 1, -5, -3, -29,
+    -3, -8, -1, -16, 14, -15, 7, 4, -1, -7, 3, -8, -13, 2, -4, -4,
+    -7, -5, -6, -6, 1, 29, -1, -3, 7, -1, -13, 12, 3, 6, 6, -26,
+    -1, -3, -7, -7, 1, -19, 0, 12, -2, 3, 11, 6, 10, 4, -17, 2,
+    -11, -5, 0, -16, 0, -6, 0, 18, 6, -2, -2, -10, 0, 1, 7, -6,
+    4, 3, 1, -4, -6, -4, 6, 6, 6, 2, -4, -1, -3, 15, -4, 3,
+    1, 8, -30, -8, -2, -8, 7, -5, -3, -6, 7, 1, -15, -6, -1, -1,
+    -10, -1, -8, -13, -3, -4, 6, -16, 14, 8, -8, 11, 6, -4, -9, -15,
+    3, -5, 6, -3, -3, 8, -5, -7, -4, 13, 17, 8, 1, -11, 1,
+  },
+  {
+    0, 1, 2, -1, 3, 1, 4, -4, -2, -3, 2, -1, -5, -2, -9, -7,
+    2, -3, 3, -1, 1, 4, -1, 0, -1, -3, 0, -4, -3, 8, 5, -11,
+    -2, -1, 6, 2, -4, -1, -3, -8, -2, 4, 0, 1, -10, -4, -4, 2,
+    -1, 2, 3, -7, 6, 0, -3, 6, -3, -2, 0, 1, -22, -2, 4, -17,
+    2, -15, -11, -1, 0, -4, 8, -1, -6, 2, -5, -2, -2, 0, -2, -2,
+    -2, -8, 1, 3, 1, -2, -12, 3, -2, -7, -8, -12, 4, -5, -4, 5,
+    -11, -3, -2, 7, 6, -2, -7, 5, 8, -1, -5, -2, 7, -5, -7, -11,
+    -10, -9, 2, 2, -5, 1, -11, 8, -14, 32, 10, 6, 2, 1, -6, -27,
+    2, -5, 8, -16, -3, -14, 4, 3, -3, 5, -7, 1, -9, 6, -2, 1,
+    -10, -3, -13, 3, 8, 4, 3, 2, 5, -3, -8, -8, -2, 4, -4, 8,
+    -5, -5, 4, -13, -12, 9, -2, -12, -2, -1, -1, 2, -8, 8, -9, 4,
+    -10, 1, -4, -2, -4, -13, 5, -22, -6, -4, -23, -4, -4, 4, 17, -6,
+    -2, -3, 8, -5, 8, 1, 3, -2, 4, 2, -3, 1, 4, 9, -12, -11,
+    12, -14, -2, -21, -4, 24, 1, 3, -12, 6, -5, -1, -4, 14, -4, -20,
+    8, -27, -3, -6, -3, 5, -1, -8, -8, 3, 3, 2, 15, -5, 1, -2,
+    -15, -11, 1, -12, -37, 4, -5, -9, 4, -7, -10, -5, 0, -9, -2,
+  },
+  {
+    -10, -12, 1, -13, -5, 1, 0, -13, -7, -9, 3, -3, -3, -2, 2, -21,
+    -4, -6, -9, -11, -1, 1, -3, -1, -5, -7, 2, -2, 1, 1, 3, -11,
+    -12, -1, 4, -15, -10, 0, 0, -9, -1, -3, 4, -4, -1, -5, -3, -10,
+    -1, -2, 1, -19, 3, 7, -4, -9, -4, 1, -3, -2, -2, -3, -15, -24,
+    -8, 6, -13, -9, 13, -8, 5, -14, 10, -17, -2, -12, 8, -11, -2, 9,
+    -3, -10, -1, -5, -2, 2, 2, -1, 5, -7, 0, 2, 15, 5, 2, -1,
+    3, -6, 6, -4, 0, 2, 1, -17, 1, -6, 10, 2, 0, 5, -6, 1,
+    3, -3, -4, -4, 2, 2, -2, -5, -7, -7, -3, 3, 0, 10, -3, -44,
+    22, -10, 2, -13, 10, -5, -15, 21, 6, -11, -19, 4, 1, 13, -11, -11,
+    0, 12, 6, -12, -10, -7, 4, -16, -3, 21, -3, -6, 6, 4, -7, -28,
+    -44, -9, 1, -11, -4, -7, 4, 5, 2, -11, 5, 6, -4, 11, 5, -3,
+    -10, -5, -6, -1, 4, -1, 6, -12, -18, 11, -4, -12, 7, -2, -15, -8,
+    0, 1, -4, -11, 2, 3, 12, -6, -6, 2, -10, -5, 12, -6, 2, -37,
+    -4, -13, 0, -1, 3, 12, -9, -7, 2, -7, 3, -7, 5, -2, 13, -8,
+    -9, -3, 5, 1, 9, -4, 1, 8, 5, -1, 2, -6, -9, 3, 15, -7,
+    -2, -5, -1, -7, 7, -12, -2, -9, -4, 1, -1, -3, 18, -2, -1,
+  },
+  {
+    -3, -1, 1, -1, 0, -2, 1, -2, 2, 1, 5, -1, 2, 2, -4, -3,
+    -5, -1, -6, -6, -5, -1, 13, -2, 2, 4, -2, 4, 3, 8, -5, -8,
+    0, -4, 0, -6, -5, 11, -8, 4, 6, -12, -3, 3, 0, 1, -16, -3,
+    -7, 3, -4, -8, -3, -5, -4, -2, -4, 3, 1, 4, -3, -6, -4, -17,
+    7, -2, -5, 6, -10, 8, -4, 4, -6, -5, -2, 8, -18, 10, -1, -6,
+    -3, -7, -2, 14, 0, 1, 0, -4, -10, -8, -6, 2, -4, 12, -1, 2,
+    2, 0, 1, 3, 13, 12, -5, -5, -9, -5, 5, -9, -5, -3, -5, 5,
+    -8, -9, -8, -4, 0, 0, -7, 0, -8, -3, 0, -3, -5, 3, -1, -15,
+    -2, -2, 3, -4, 1, 10, 6, 6, 22, -2, 3, 4, -2, 9, -4, -2,
+    -1, 14, -15, -2, 19, -2, 4, 1, -10, -21, -8, -3, -11, -2, -7, 11,
+    -3, -14, -18, -7, 3, 5, 5, 2, -17, 2, -9, 2, -5, 5, 1, 2,
+    6, -1, 2, -2, -8, -3, 5, -13, 0, 8, 1, -20, -26, 0, -11, -10,
+    10, -13, -10, 2, 8, -8, -12, 7, 21, 1, 10, -7, 5, 11, 0, -12,
+    5, -13, 10, -6, 6, -6, 10, 14, 2, -7, -5, 5, 13, 7, 14, 1,
+    6, 4, 7, -13, 12, -10, -2, -12, -7, -11, 8, 4, -8, -18, 2, 6,
+    -4, -15, 8, -21, -6, -11, -9, 1, -19, 2, 3, -15, 2, 7, 8,
+  },
+  {
+    -4, -11, 2, -14, 0, 3, -6, -20, 0, -3, 1, 0, -4, 6, -2, -30,
+    -1, -4, 0, -3, 0, -4, -5, 8, -1, -3, 0, 0, 1, 7, 1, -43,
+    -7, -7, -3, 0, 4, -11, 0, -4, 2, -1, -2, 3, -6, 2, 1, 3,
+    -11, -2, 5, 0, -5, 0, -2, -12, -7, 6, -14, 3, -4, -3, 3, 22,
+    2, -7, 5, -2, -6, -2, -8, -15, -5, -6, -15, -3, -6, 4, -5, -3,
+    -10, -6, 1, -6, 5, -2, -1, -1, -7, -9, -9, 6, 4, 2, 5, -3,
+    -3, 7, -6, -2, -1, -2, -3, -4, -11, 9, 0, 0, 0, 2, 6, -15,
+    6, -6, 8, 2, -27, -10, -7, 0, -5, 2, 3, 1, 2, -7, -10, -25,
+    -59, -14, -7, -19, 8, 5, 7, -12, -4, -11, 2, 11, -5, -2, -1, -8,
+    0, -21, 1, -8, -22, -22, -1, -17, -7, 12, -3, -6, 16, -8, -4, -4,
+    -2, -18, 0, -7, -2, 7, -3, -13, 16, 2, -3, 3, -7, -4, -3, -4,
+    -5, 13, 5, -9, -4, 5, -5, -5, -6, 4, 16, 14, 8, 1, -9, -4,
+    -11, 4, 4, -1, -8, -18, 13, -3, -3, 3, -18, -5, 0, -6, 1, -9,
+    -21, 14, -9, -2, -20, 10, 1, -7, 2, -12, -4, 7, 0, -4, 5, -15,
+    -9, 1, -2, -22, -4, 14, 13, -4, -9, -21, 7, -40, -4, 14, 2, -13,
+    2, -2, 19, -12, -1, 3, 11, 9, 2, -19, 0, -5, 5, -19, -2,
+  },
+  {
+    0, 1, 0, -5, -4, -5, 3, -9, 1, -9, -3, 2, 1, 2, 3, -2,
+    -4, -1, 0, -14, -1, 3, 2, 3, -4, 1, 2, -5, 8, 6, 6, -6,
+    -1, 2, 6, 2, -8, 2, -2, -23, -3, 6, 0, 5, -5, -2, -6, -5,
+    -16, -11, -1, -5, 0, -2, 1, -2, -3, -2, 11, 0, -15, -4, -15, -14,
+    -2, -2, -9, -6, -17, 11, -1, -11, -5, -9, 4, 2, 3, 11, -1, -31,
+    0, -4, -2, 4, 6, -11, 2, -17, 2, 11, -2, 10, -8, -6, -1, -1,
+    -2, 1, 7, -18, -5, -12, 7, 4, -1, 1, -3, 9, 4, 8, -5, -2,
+    -5, -10, -3, -4, -5, 1, -28, 3, 0, 15, 11, -3, 8, 19, -3, -19,
+    -4, -14, -5, -5, -2, -14, 8, -3, -14, 23, -6, 2, -14, 4, -3, 3,
+    -10, -4, 0, 7, -2, 12, -12, -2, 3, 6, 1, 2, -7, -4, -7, -44,
+    -8, 14, -13, -5, -10, 3, 5, -6, 9, 6, -5, 4, 1, -7, -3, -6,
+    13, 4, -3, -17, 0, -13, -4, -20, -6, -13, 14, 4, 9, 6, 4, -4,
+    14, 1, 14, -27, 16, 6, -4, -28, -11, 4, 2, 5, -7, 2, 20, -6,
+    -10, 11, 5, -12, 3, 2, -2, -2, 21, 8, 14, -10, -5, 12, -6, 1,
+    9, 12, 8, 5, -6, 4, -16, -11, 0, -4, 9, 5, 3, -28, 1, -7,
+    -1, -5, -2, -20, 35, -10, 1, -14, 1, -10, -7, -14, -40, 0, -8,
+  },
+  {
+    -2, 0, -3, -5, 4, -1, -1, -6, -2, -7, -8, -3, -2, -3, 3, -8,
+    -5, -2, 1, -3, -2, -1, 1, -1, -4, 3, -1, -1, -4, 2, 1, -20,
+    -6, -5, -1, 0, 1, -2, 9, -8, -2, -3, 1, -8, -2, -1, -3, -9,
+    -9, -8, 1, 2, -6, -4, 4, -5, -1, 1, -4, -2, 0, 2, 2, -17,
+    -2, -4, -3, -12, 4, -5, 0, -12, -10, -4, -4, -4, -4, 1, 4, -8,
+    3, -13, 11, -1, 2, -5, -7, -13, -11, -9, -8, -3, 2, -7, -3, -15,
+    0, -13, 2, 15, 0, -3, 7, 3, -7, -10, 3, -4, 0, 7, 0, -8,
+    -6, -7, 1, 0, 5, -2, 5, -8, -7, -15, 0, -5, -4, -4, 7, -27,
+    8, -3, -4, -13, 11, -2, 6, -10, 7, -7, 18, -3, 0, -3, -16, -13,
+    15, 4, -12, -6, -7, 19, -1, 5, -4, 3, -7, -9, -3, -9, -10, -6,
+    -8, 6, -7, -22, 5, -3, -17, -20, 9, -4, 4, -8, -1, 14, 4, -7,
+    -19, 9, -11, -11, -3, 20, 1, -9, -1, -12, -3, 12, 17, -7, -1, -13,
+    -12, -11, 5, -6, -4, -7, 6, -8, 2, 6, -5, -2, 3, 0, -1, 2,
+    0, 8, 6, -16, 3, 2, 5, -10, -3, -1, 7, 15, 2, 9, 9, -3,
+    3, 0, -7, -1, 0, 5, 2, 0, -7, 4, 7, -3, 21, -7, -2, -14,
+    7, -7, -4, -3, -12, 7, 0, -3, 1, 15, 3, -4, -4, 2, -2,
+  },
+  {
+    -1, 6, -3, -3, -12, 5, 0, -4, -1, 13, -2, 0, 1, 0, 2, -6,
+    5, 0, 1, -11, -24, 1, 3, -1, -3, 12, -7, 0, -5, -1, -3, -15,
+    -4, 1, -1, -7, -4, 3, 5, 11, -2, 32, -4, -3, -1, 3, 2, -3,
+    0, 2, 0, -7, 7, -19, -10, -2, -2, 1, 0, 0, -3, 3, -7, -12,
+    -4, -1, -2, 4, 4, -6, -1, -3, -6, -7, -6, -7, 4, 6, -4, -6,
+    -18, -8, 4, 2, -32, 8, 5, 2, 0, -4, 2, -3, 4, -9, 3, -5,
+    1, -8, 2, -4, -5, -5, 3, 1, -5, 3, -18, -18, 3, -14, -1, -8,
+    2, 2, 3, 4, 5, -9, 0, -3, 0, -5, 7, -4, 1, -13, -5, -27,
+    -13, -4, -4, -9, 3, -17, 2, -7, -7, -2, 4, 11, 15, -9, -3, -6,
+    -2, 21, 16, -7, -6, -3, 7, -1, 1, 0, -1, -7, 11, 4, 14, -5,
+    -2, -21, -3, -9, 0, -9, -6, 1, -2, 53, 8, -11, 7, 4, 7, -3,
+    14, -3, 5, -6, -3, -25, 5, -5, -3, 3, 3, 5, 8, -5, 4, -14,
+    2, -18, -11, -9, -5, 9, -1, -10, -3, 5, -6, 2, -12, -5, 2, 5,
+    8, 4, -3, -17, -15, 19, -6, -2, -15, -2, 5, -5, -1, 11, -3, -13,
+    -2, -4, -4, -26, 10, -11, 1, -7, -4, -7, -28, 2, 6, 1, -3, -5,
+    -16, 0, -22, -19, 1, -4, -7, -7, -5, 10, 4, -2, 3, -12, 1,
+  },
+  {
+    -2, -1, -4, -8, -2, -7, 1, -13, 2, 4, 4, -11, 2, -3, -1, -17,
+    2, 3, -3, -7, 4, 0, 0, 19, -3, 5, 2, 1, -4, -1, 0, 11,
+    0, -1, -1, -1, -1, 7, 0, 0, -2, 6, -15, -5, -1, 4, 9, 4,
+    24, -3, -1, -6, 1, 2, 6, -5, -3, 0, -3, 0, -2, -2, -12, -20,
+    37, -1, -8, -12, -6, -2, -2, -1, -1, -13, -7, -12, -6, -4, 2, -2,
+    -12, 2, 1, 18, -3, 3, -7, 8, 3, -9, 0, 3, -10, -7, 9, -3,
+    1, -7, -18, 6, -4, 13, -4, -2, -3, -3, -7, 7, -3, -5, -18, -4,
+    7, -1, 2, -11, 2, -3, 1, 4, -10, -9, 7, -3, -3, 8, 1, -15,
+    -1, -3, -47, 1, 9, 5, 1, -14, -10, -6, 14, -2, 0, -5, 3, -3,
+    -4, 13, -8, 4, -4, -11, 7, 3, 11, -18, -4, -5, 1, -9, -4, -1,
+    8, -5, 4, -17, 3, -15, -2, -11, -8, -5, 10, 22, 30, -10, -1, -9,
+    18, 4, -6, -11, -19, 7, 3, -9, 9, -22, -3, 5, 1, 1, 28, -3,
+    2, -7, 3, -6, 4, -17, -4, -11, 7, -2, 3, 1, -17, -6, -7, 4,
+    6, 2, 1, -1, 4, 9, 5, -11, -8, -10, 0, -6, -8, -17, -11, -15,
+    2, 4, -3, -16, -8, 1, -7, -1, 4, 6, 3, 7, -7, 20, -7, -15,
+    2, 16, 3, -7, -9, -6, 5, 0, 2, 0, -3, -13, -15, -12, 5,
+  },
+  {
+    0, 0, -1, -2, -1, -1, 1, -7, -2, -2, 0, -2, -3, 3, -1, -5,
+    -4, 4, -2, 0, -2, 0, 6, -6, 4, -3, 5, 0, 2, -1, 7, -15,
+    -7, 0, 0, -3, 7, 2, -5, 2, -6, 0, 3, 2, -3, 2, -13, -14,
+    -3, -3, -8, -2, -4, -1, -6, -1, -1, 0, -6, -6, -3, 0, -6, -23,
+    4, -12, 2, -2, 0, -5, 5, 4, 0, -6, 12, -2, 8, -10, -5, -3,
+    -1, -8, 0, 0, -9, -1, -7, 0, 5, -8, 3, -1, 0, -16, 1, -20,
+    -3, -3, -4, -2, 5, -11, 7, -8, -7, -8, 4, 4, 13, -9, 7, 1,
+    5, -9, -5, 2, 2, -7, 2, 10, 0, -14, 2, -4, 1, 14, -7, -22,
+    -3, 2, 1, -4, 0, 11, 4, 0, -9, 8, -1, 7, -8, 11, 3, -7,
+    11, 9, -4, -7, -1, -7, 19, -11, -7, -8, 2, 5, -5, 3, -4, 6,
+    -20, -10, 1, -12, -4, -4, 7, -10, -2, -6, 8, 11, 1, 13, -4, 4,
+    -1, 3, -7, -13, -6, 16, 12, 1, 4, -7, 0, -19, 10, -2, 0, -11,
+    7, 21, -2, -15, -3, -6, 7, 4, -1, 13, 4, 8, 15, 13, -16, 5,
+    -6, -16, 0, -5, -6, -8, 3, 7, 4, 3, 2, -4, -9, 8, 1, 15,
+    -9, -3, 2, -6, -4, 16, 0, 2, -9, 10, -5, 14, -10, 9, 8, 0,
+    7, 0, 7, -4, 1, 3, -7, -6, 0, -8, -4, 2, -5, 15, 16,
+  },
+  {
+    -2, 1, 3, -5, -4, 0, 0, -4, 3, 12, -2, 3, 1, -5, -1, -10,
+    -5, 2, -3, 0, -21, -8, 6, 1, 1, 1, 3, 8, -2, 6, 6, -10,
+    -5, -4, 1, -5, 2, 2, 4, 0, -7, -30, -2, -1, -3, 5, 9, -4,
+    -4, 4, -5, -1, 4, -2, 3, 2, 7, -2, -4, -2, 10, -1, -15, -21,
+    -2, -6, -2, 5, 2, -2, -6, -5, 2, -6, 0, -5, -6, -1, -13, -4,
+    0, -10, -5, 35, 0, -3, 0, -14, 5, -8, 6, -10, -15, -3, 8, -3,
+    2, 0, -1, 3, -3, 6, -4, -3, -4, 0, -9, 1, -2, 5, -14, -3,
+    -6, 5, 14, -6, -3, 1, -5, -6, -1, -3, -22, 9, 0, 24, 6, -16,
+    10, 1, 0, -7, 0, 2, 15, -5, -7, -3, -18, 8, 3, -5, -4, -3,
+    -12, 3, -7, -16, -2, 16, 2, -6, -5, 8, -2, 4, 14, -10, 6, -24,
+    -1, -1, -3, -2, 3, -9, 13, -7, 47, 2, -9, -1, -1, -2, -2, -20,
+    8, -6, 9, -8, -13, -1, 1, -3, 7, 3, 0, -12, 3, -13, -10, -8,
+    -7, -17, 3, 2, -2, -8, 0, -9, 2, -4, -10, -13, 0, -10, -10, 5,
+    1, 0, 3, -18, 0, -8, -9, -5, 6, -4, 3, -1, -4, -3, -10, -13,
+    -4, -1, 12, -6, 17, -7, 28, 8, -7, 13, -14, -13, 1, 2, 0, -1,
+    -9, 7, 13, -1, 3, -22, -4, 2, -12, 5, -6, -19, -30, -3, -4,
+  },
+  {
+    0, 1, 0, -6, -3, -1, -3, -8, 3, -2, -3, -5, 0, -3, -1, -4,
+    -3, 5, -1, -2, -4, 2, 0, 4, -4, 2, -2, -12, 0, 7, 5, -8,
+    1, -1, -5, 8, -2, -1, -4, -9, -2, -7, 11, 7, -4, -1, -6, 0,
+    2, -2, 2, 2, -5, -1, -9, 9, -1, 0, -5, 4, 3, -2, 7, -22,
+    1, -15, -8, -2, 0, -4, 3, -2, 2, -15, 6, -1, 6, 4, 2, -12,
+    -2, -2, -9, -3, -11, -1, 14, -2, 13, -16, 8, 0, 0, 6, -4, 11,
+    0, -8, -1, -2, 8, 2, -5, 3, -7, -8, -3, 1, -6, 9, -1, -1,
+    12, -1, -8, -4, -7, 0, 5, -1, -1, -8, -14, -5, -1, -5, 5, -22,
+    -6, 2, -8, -12, 5, 13, 2, -4, -2, 17, 2, 9, 1, 0, 5, -20,
+    2, 8, -7, -21, 5, -3, 7, 6, 8, -2, -3, -12, -6, 6, -4, -21,
+    -2, 4, 2, -23, -17, 1, 10, -22, 14, -14, 5, 1, 10, 1, 19, 15,
+    4, 17, 5, -5, -2, -8, 7, -2, -1, -3, -4, 3, -9, -13, -8, 0,
+    -1, -6, -5, -6, -8, 17, -14, -11, 5, -3, 8, -7, -2, 8, 8, -13,
+    -15, 15, 9, -5, 7, 3, 0, -4, -2, -12, 13, 3, -25, -1, -2, -7,
+    8, -12, -25, -4, -16, 10, -20, -8, 7, -12, -7, -3, 20, -4, 8, -3,
+    -5, 12, -2, -7, -10, 27, 0, 18, -13, -1, 8, 1, -8, -1, -23,
+  },
+  {
+    -3, -5, 0, -7, 0, 0, 2, -17, -2, -2, 6, -2, 0, -1, 1, -23,
+    -2, -6, -3, 0, 2, 0, 4, -1, -2, 2, -1, 3, 1, 4, 6, -22,
+    -5, -3, -5, -2, -4, -12, -1, -3, 8, 0, 4, -2, -7, 6, 10, -2,
+    -3, 5, 0, -2, -8, 3, 1, 0, -5, -3, -10, -1, -5, -6, 1, -39,
+    -9, 7, -3, 0, 6, 2, -2, -12, -5, -3, 0, -9, -1, 1, -2, -8,
+    3, -7, -14, 5, 1, 0, -4, -8, 1, -7, 8, 5, 8, 7, 18, -3,
+    2, -6, -7, 1, -2, 6, 0, 0, 8, -7, -2, 3, 13, -6, 0, 1,
+    1, -5, 2, -8, -1, 10, 9, 3, 2, -6, 5, -1, 1, 7, 12, -41,
+    3, 7, -1, -13, -5, 4, 9, -5, 6, -5, 6, -2, -5, 3, 9, 1,
+    3, -6, -3, -9, 1, -6, -8, -8, -4, 2, -5, 8, -1, 3, -4, -17,
+    3, 1, 6, -6, -8, -1, 6, -10, 18, 6, 2, 3, -6, -10, 3, 2,
+    11, 0, -1, 2, -1, 7, 9, -8, 8, 0, -2, -12, -5, 11, -27, -11,
+    0, 7, 13, 1, 4, -3, -16, -4, 8, -6, 8, 5, -15, -6, 6, -3,
+    6, 6, -2, -9, 3, 0, -3, -18, 7, -7, -13, -4, 7, -3, 3, -7,
+    -3, 9, -12, -12, 6, -2, 6, 1, 2, -7, 9, 0, 8, 3, -8, 4,
+    -4, 7, -1, -2, -5, -1, 7, 4, 5, -2, 13, -3, -14, 8, 20,
+  },
+  {
+    -1, -1, 0, -4, 0, 2, 0, -5, -2, 2, -4, 2, 1, -2, -2, 2,
+    4, 0, -1, 2, -1, 1, -4, 2, -1, 3, 6, 0, 1, 4, -1, -15,
+    5, 0, -7, -3, -3, -1, -2, -8, 1, 0, 0, -4, -4, 0, 5, 4,
+    0, -5, 0, 1, -4, 3, -9, 4, 2, -9, -4, -7, -4, -5, 3, -26,
+    -3, -8, 12, -4, -2, 13, 6, 5, 0, -4, -4, -9, 1, -8, -2, -7,
+    2, -4, 11, 6, -12, -5, 0, -8, 3, -4, -5, 0, 3, -11, -3, -2,
+    3, -11, -6, -9, -4, -3, -11, 4, 1, 2, 0, -9, 9, -23, -5, -4,
+    -2, -9, 4, -10, 2, 8, -7, -10, 2, -14, 4, 5, 10, -1, -7, -28,
+    -9, -3, -8, -11, -7, -6, -32, -15, -5, 8, 0, 1, -32, -5, -5, 0,
+    -14, -7, 3, -9, -4, -2, -6, -8, -16, -6, 7, 6, -8, -9, -1, -5,
+    -7, -5, 9, -9, 13, 0, -10, -14, -14, 10, -8, -6, 7, 2, -13, -5,
+    -3, -4, 8, -7, -5, 1, -2, 11, -2, 8, -1, -9, 2, 1, -3, 7,
+    -4, -5, -1, -9, 0, -9, 14, 24, -2, 2, 9, 2, -14, 5, 3, -5,
+    -4, -6, -22, -9, 15, 11, 4, -7, 0, 0, 1, -28, -10, 6, 1, -15,
+    -5, -8, 3, 0, -2, 4, 1, 1, 6, -10, -7, -1, 14, -2, 4, -3,
+    0, 7, 5, -26, 3, 4, 1, -8, -6, -11, 5, -7, 13, -10, 12,
+  },
+  {
+    -1, 0, 0, -3, -3, 0, 3, -6, 1, 3, -5, -7, 2, -2, -7, -9,
+    -1, 4, 4, 0, 1, -7, 1, -7, 0, -1, -1, 6, 2, -5, 0, -16,
+    -2, 4, -3, -6, -6, -6, 13, -3, -1, -10, -13, -16, -2, -1, 2, -10,
+    -1, 1, 5, -11, -1, 10, 8, 1, -6, -6, 1, 6, -1, 1, 6, -26,
+    8, -5, 2, 3, 1, 8, 5, -4, -11, -11, -9, -14, -6, -4, 16, -10,
+    4, -4, 1, -14, 2, 5, -3, 9, -2, -8, -6, 1, -2, 9, -3, 14,
+    8, -1, -6, 0, 2, 3, -2, -17, 4, -5, 1, -1, 9, 4, -15, -12,
+    -2, -12, -3, -1, -6, 2, -3, -10, 22, -5, 14, -7, 4, -11, -7, -34,
+    3, -3, -10, -19, -8, -6, 5, -4, 5, 4, -10, -4, -14, -4, 5, -15,
+    2, 3, -12, -16, -3, 11, 0, 8, 1, -7, -15, 9, 0, -1, -21, -12,
+    -4, -2, -9, -7, 1, 5, 1, -25, 5, 0, 16, 25, -25, -11, -6, -16,
+    -31, 1, 6, -13, 4, -9, 14, -3, -2, 8, 9, 11, 1, 14, -6, -1,
+    -25, -7, 20, -1, 5, -3, -6, 2, 0, 3, 6, -5, -9, 13, 3, -9,
+    3, -1, -24, -9, 0, -15, 5, 12, -9, -14, 25, 4, -4, 23, 0, -6,
+    -10, -9, -7, -5, 15, 5, -2, 4, -12, 2, 0, -9, -6, 5, 1, 17,
+    0, 0, -32, -17, 3, -11, -5, -8, -5, -3, -1, -14, -2, -18, -6,
+  },
+  {
+    -2, 0, -4, -11, 2, 3, -2, -1, -2, -8, -10, 0, -6, -1, -5, -13,
+    14, 3, -1, -11, -4, -15, 5, 5, 4, -3, 3, 7, -2, -8, 0, -8,
+    -4, -10, -13, -2, -2, 2, -5, 0, 0, -15, 2, -23, 2, 7, -2, -1,
+    6, 4, -10, -10, -17, -1, 5, 7, 13, 1, 2, 8, -3, -2, 0, -6,
+    -16, -7, 2, 3, 4, 37, 4, -2, -12, -3, 7, -3, 4, 3, 0, -20,
+    -18, -9, -5, 10, 1, 2, 1, -30, -10, -8, 9, 14, 0, -7, -1, 0,
+    5, -15, 19, -3, 3, 2, -1, 23, -19, 14, -3, -14, -13, 0, -8, -4,
+    -4, -5, 17, -3, 10, -8, -2, -12, -9, -9, -11, 6, 4, -1, 7, -18,
+    23, 36, 2, 2, -1, -1, 8, -9, -4, 4, -1, -9, -36, 7, 22, -15,
+    9, -18, 12, -4, 10, -3, 17, 1, -3, -4, 21, 2, -7, -2, 5, 26,
+    12, 25, -1, -11, -4, -4, 23, -2, -12, 7, 1, 1, -4, 1, 2, 45,
+    4, 0, 6, -11, 6, -4, 10, 0, -7, -6, 6, 2, 9, -2, 1, -2,
+    4, -3, 1, -3, 4, -2, 21, 5, 2, 5, 13, -15, -17, -11, 7, 8,
+    -18, 24, 3, 7, -20, 2, -7, 14, -1, 13, 3, 3, 7, 18, 4, 3,
+    -1, -9, 2, -9, 8, -1, 33, -5, 2, -4, -8, -1, -7, 5, 6, 12,
+    6, -13, 1, -3, 5, -15, -2, -1, -7, 9, -4, -4, 5, -3, 2,
+  },
+  {
+    -2, -2, -1, -1, 4, 1, -1, -5, -4, -2, -3, -2, -2, 2, -2, -12,
+    -7, 6, -4, -1, -2, -7, 1, 3, -1, 4, 2, 0, -9, 2, 0, -16,
+    2, -7, 2, -4, 10, 7, -5, -2, -4, 1, -3, 7, 1, -1, -8, -3,
+    -7, 0, -1, 0, -2, 6, -1, 2, -4, -11, -2, -4, -2, 7, 1, -32,
+    2, -4, 0, -12, -2, -6, -1, 1, -7, -5, -23, -2, -3, 3, 2, -5,
+    0, -9, 3, -2, -1, 15, 10, -19, -25, -9, -1, -9, 2, 3, 3, -15,
+    3, -8, 1, -1, 1, -1, -3, -8, 0, -5, -5, -7, -11, -8, 4, 0,
+    4, -12, 6, -25, -3, 3, 1, -4, -7, -4, -8, -7, 10, -2, 9, -32,
+    0, 2, -7, -6, -2, -3, -2, 1, -10, 3, 3, 3, -3, -6, 5, 1,
+    -11, 6, 13, -8, 9, 36, -4, -2, -4, -2, 1, -7, -5, -5, 15, -4,
+    -6, 0, 2, -6, 12, -4, -7, 10, -3, 1, 3, 7, 3, -5, 1, 23,
+    -12, 31, -7, -2, 1, 5, -14, -17, 1, 2, -3, -1, 4, -8, -5, -13,
+    3, 18, -4, -29, 13, 2, 12, 3, -2, 4, -3, 12, -1, 7, -17, -6,
+    -7, -18, -8, 1, 11, 13, 12, 8, -10, -8, 0, -13, 0, -7, 2, -21,
+    13, 2, -1, -5, -9, -4, -3, 20, -3, -8, -1, 2, 1, 0, -7, -21,
+    6, -8, -1, -17, -4, 15, 2, 1, -1, 4, 15, -10, -6, 0, 6,
+  },
+  {
+    -2, -3, 1, -2, -1, -3, 0, -9, 8, 0, -4, -7, 2, -2, 0, -8,
+    -5, 4, -11, 1, 7, -1, 5, 4, 0, 1, 1, -5, 1, -3, -5, -10,
+    6, -4, 1, -2, 0, -9, -6, -3, 3, -3, 3, 3, -7, -1, 2, 9,
+    3, 1, -3, 0, -2, -1, 2, -15, -1, -3, -9, 5, 4, 14, 6, -8,
+    -3, -2, 0, -10, -3, 6, -7, 5, -7, -3, -1, 1, -8, -1, -3, -7,
+    -6, 6, 3, -7, -3, -3, -5, -5, 18, -12, -5, -5, 2, 3, 2, -2,
+    0, 2, 11, 4, -5, 0, 1, 5, -3, 1, -5, -13, -4, -1, 1, -6,
+    1, -9, -13, -1, -10, -1, 7, -5, 9, -4, 12, 4, -3, 11, 3, -17,
+    15, -9, 9, -14, -4, 14, 9, 10, 1, -6, 6, 10, 1, -7, 1, -8,
+    -9, 5, -6, -6, 4, 9, -11, 17, 6, -8, 11, 5, -2, -3, -1, -6,
+    -7, -6, -2, -11, -8, 4, 12, 9, 13, -6, -2, 17, 21, -8, -9, 10,
+    -2, 0, -26, 3, -6, 7, -5, 0, 8, 12, -2, -7, -11, 13, -8, -9,
+    13, -10, 5, -19, 5, -9, 14, -10, 2, 0, 2, 2, -9, -5, -9, -3,
+    0, 1, 5, -7, -7, 6, 5, -7, 4, -1, 2, -1, -1, 1, -1, -10,
+    -2, -1, 1, -11, -15, 1, -4, -4, -11, 10, -14, -20, -11, -11, -10, 10,
+    -3, -10, 18, -9, 12, 14, -12, -4, 6, -5, 11, -2, -8, 3, -4,
+  },
+  {
+    -1, -4, 2, -11, 1, -3, -8, -13, -4, -10, 5, 2, -6, -15, -2, -19,
+    -2, 1, -3, 7, 0, 2, -6, -11, -9, -4, -3, -22, -3, -2, 2, -22,
+    -10, 0, -6, 5, 7, -3, 3, -6, 11, -2, 2, 4, -6, -14, -13, -10,
+    1, 16, -3, -11, 3, -1, 1, -31, 0, -1, 2, 2, 3, 0, 10, -40,
+    3, -11, -5, -12, -2, 0, -3, 2, 11, -9, 14, 9, 6, 2, -8, -17,
+    0, 14, -5, 0, -2, 2, 0, -9, 7, 1, -4, -13, -3, 10, -2, 16,
+    -7, -2, -4, 1, 28, -1, 0, -23, -2, -10, -1, -10, 6, 2, 3, -19,
+    4, 4, -8, -10, 4, 0, 2, -3, 5, -3, -8, -4, 2, -8, 12, -34,
+    -1, -17, -21, -18, -16, 0, -3, -7, 8, -16, -12, -12, 10, -7, 5, -9,
+    0, 0, 17, -6, -2, 4, 19, -1, 1, 2, 2, 5, -4, -1, -4, -27,
+    8, 3, 8, -19, -7, -24, 32, 4, -1, -1, -1, 4, 8, 5, 5, -8,
+    14, 0, 4, -19, -15, 5, -2, -26, 7, 7, 3, 8, 15, -24, 0, -12,
+    -13, -11, -7, -4, -1, 1, -2, 6, -1, -18, 36, 13, 0, 4, 2, -24,
+    3, -6, -8, -8, -6, -6, 8, 10, -8, 2, -1, -10, 8, -8, 3, -4,
+    23, 3, 1, -9, 5, -1, -2, -7, 8, -3, -11, 9, 0, 6, -2, -10,
+    7, 3, 5, -15, -7, -9, 7, 4, -3, 12, 9, -3, -1, 3, -16,
+  },
+  {
+    -5, 2, 0, 2, 2, -3, -1, -9, 2, -12, -6, -6, -2, -2, 4, -8,
+    0, -5, -8, 19, 2, -3, -4, -2, 4, 1, -2, -6, -6, -2, 1, -11,
+    2, 1, 1, -2, -5, -1, -4, -5, 22, -8, 4, 2, -2, -4, -1, -7,
+    -3, -8, 5, -1, -8, 0, -3, 2, 1, -12, 1, 2, 1, 3, -3, -20,
+    -2, -5, -3, 0, -5, -1, 1, 6, 11, -1, -11, 3, 4, -12, 0, -6,
+    4, -11, 21, 4, -1, -2, 10, 8, 10, -19, -13, 2, -10, -6, 6, -11,
+    -10, -8, -13, 0, -7, -1, 9, -6, 4, 0, -3, 1, 3, 7, 7, -12,
+    15, -6, -7, -22, 0, 4, -10, 1, 3, 1, 6, 3, 2, 11, -6, -22,
+    0, -17, -7, -5, -2, -10, 3, 1, -3, 9, 2, 0, -7, 4, -18, -14,
+    -16, -4, 11, -19, 15, 16, -10, 8, -5, 2, -3, -3, 2, 2, 6, -8,
+    3, -4, -2, -18, 0, -15, 46, -1, 1, 1, -3, -23, 2, 6, -5, -7,
+    11, -2, -10, 6, 4, 17, -3, -8, 1, -3, 8, 2, -8, -10, 10, -14,
+    4, -2, 6, -11, 9, 14, -4, 10, 15, 8, -2, -1, -4, -3, -2, -8,
+    14, 3, -4, -5, 2, -8, -5, -7, -1, 13, 6, 6, -5, 3, -3, -11,
+    -9, 3, -23, -6, 8, 11, 6, -22, -14, -5, 5, 9, 5, 2, -6, -9,
+    1, 7, -16, -6, 3, -1, 1, 4, -22, 25, -2, -13, -28, 10, -6,
+  },
+  {
+    -3, -2, 0, 0, 1, 2, -2, -13, 5, 2, -8, -2, -4, 4, 1, -16,
+    4, 2, -9, 2, -4, -9, 0, -1, -1, 10, 6, 0, -14, 5, -1, -27,
+    -7, 11, 8, -9, 4, -5, -16, -9, 1, 7, -8, 1, -5, -3, -1, -5,
+    -1, -5, 3, 0, 14, 0, 11, -5, -6, -16, -3, 3, -12, -4, 0, -35,
+    -8, -2, -7, 1, 2, 5, 2, 2, -5, -2, -8, 9, 3, -13, -2, -14,
+    -1, -7, -9, -4, 8, 13, -6, -3, -3, -3, 10, -11, -2, 0, -2, -5,
+    3, -5, 1, -1, 1, 2, -6, 4, 1, -6, 16, 4, 2, 1, 11, -7,
+    2, -7, 4, -23, -6, -5, -1, 1, 1, -6, -5, -5, -12, 16, 4, -40,
+    -6, 4, -11, -5, -2, 1, 1, 3, 5, -2, 7, -9, 4, 11, -9, 5,
+    -8, -2, -4, 5, 3, -1, 5, -3, 12, -1, -2, 10, -4, 5, 4, -5,
+    3, 0, 3, -3, -7, 4, 6, -12, -15, 5, -24, 12, -17, 3, -1, 5,
+    -4, -2, -5, -14, -8, 4, 7, -6, -12, -3, 0, 0, -10, -4, 3, -8,
+    13, 5, -6, -5, 1, 0, 1, -7, -7, -15, 12, -15, 15, -5, 3, -9,
+    0, -6, 0, -7, -11, -2, -28, -7, -6, 3, 0, -18, 6, 2, 26, -19,
+    -13, -5, 2, -2, 2, 5, -9, -33, -3, -3, 2, -7, -7, 5, 0, -2,
+    2, 3, 4, -25, 5, -12, -3, 9, -2, 3, 3, -3, 3, -3, -5,
+  },
+  {
+    -2, -3, 2, 0, 1, -2, 1, 1, 10, -4, -7, -1, -1, -4, -4, -9,
+    -14, 0, -5, -5, 7, -8, 0, 3, 2, 9, 4, 2, -9, 6, 2, -10,
+    -4, -14, 8, 2, -4, -6, -9, -12, -1, 3, -2, -1, 1, 2, 0, -10,
+    4, -1, 3, -2, -2, -1, -1, -10, -7, -13, 3, 5, -3, -6, -1, -20,
+    2, -1, -3, -14, 3, -7, -6, -7, 1, -3, -3, -1, -2, -19, -2, -1,
+    5, -1, 0, -3, 4, -12, 4, 6, -1, 7, -2, 4, 5, 3, -1, -9,
+    -5, 0, 2, -10, -2, 4, 2, 1, 23, 2, 2, 2, -2, -1, -1, 12,
+    2, -5, -2, -17, -2, -2, 4, -6, 10, -9, -7, -5, -4, 6, -1, -23,
+    2, 23, -4, -8, 11, -5, 8, -20, 11, 4, -11, 6, 2, -2, -12, -1,
+    0, -2, 11, -4, -2, 3, -1, -6, 6, -1, -2, -4, -2, 2, -10, -3,
+    -9, 0, -3, -11, -4, 2, -3, 4, 7, 1, -14, 9, 4, -6, -19, 5,
+    -5, 11, -17, -18, 3, 1, 8, 3, 4, -6, 6, -2, -11, 2, -8, -8,
+    -1, 0, -6, -13, 0, -1, -22, 6, 1, 8, 4, -6, 0, -22, -8, -16,
+    -1, -3, 6, 3, 3, -2, 11, -12, 2, 3, -6, 10, -5, 0, -1, -3,
+    22, 0, 5, -1, -13, 2, 3, 18, 15, 4, 19, 2, -7, -4, 13, 1,
+    1, -3, -1, -17, -24, 6, 8, -12, 2, 1, 11, -4, -9, 4, -11,
+  },
+  {
+    -3, -3, 0, 0, 1, 0, -4, -5, 8, 0, -5, -3, -1, -2, 1, -6,
+    -3, -2, 0, 3, -8, -6, 3, -3, 0, -8, -1, -4, 3, 1, -3, -16,
+    -10, -4, 4, -2, 0, 1, 1, -2, 4, 3, 3, 0, -3, -2, 0, 3,
+    -3, -5, 0, -7, -4, -4, -3, -6, -4, -2, 6, -7, -5, 3, -5, -36,
+    2, -7, 2, -15, -4, 0, -11, 0, -5, -6, 0, 0, 7, -13, -21, -7,
+    -4, -3, 5, -3, 5, -3, -12, 2, -8, -8, -5, 6, 6, 8, 0, 0,
+    -10, -2, 5, -3, 1, -1, -2, -17, -4, -13, 0, -5, 6, -2, -1, -16,
+    -3, 3, 1, -7, -3, 2, 18, -4, 1, -2, -9, -1, -6, -3, 3, -29,
+    7, 11, 0, -7, -22, -6, 3, -15, 4, -8, 0, 12, 8, -12, 5, -8,
+    -11, 4, 4, -13, -5, 12, -1, 0, -5, 7, 1, 1, 10, -16, -9, -11,
+    1, 15, 5, 4, 3, -14, -20, -1, 4, 8, -3, -4, 10, -5, -3, 3,
+    3, 7, -6, 2, 2, 4, 9, -1, 1, -1, -4, 6, -1, -4, -8, -9,
+    2, -15, -4, -7, 10, 6, 3, -3, -6, -2, 6, 3, -6, 7, -3, -19,
+    -5, -2, 9, -3, -4, -3, 6, 4, 1, -23, 10, -10, -5, -4, 0, 4,
+    -10, -6, 5, -3, -7, 3, 6, 9, 11, 14, -9, -6, 8, 7, -21, -8,
+    4, -6, -5, -8, 18, 3, 18, -11, -1, 9, -3, 14, -3, 0, -3,
+  },
+  {
+    -3, 0, 0, 0, 6, -1, 0, -4, 5, -3, -2, 3, -1, -1, -4, -9,
+    1, -1, -4, -4, -1, -10, 0, 0, -5, -1, 2, 1, -5, 0, -3, -15,
+    3, 7, 8, -9, 1, 1, 0, 10, -1, -5, 0, -1, 1, -3, -8, 0,
+    -4, 15, -2, -1, 0, -12, 2, 3, 1, 0, 1, 5, -2, 0, -5, -23,
+    -6, -10, -8, -4, -4, -5, -17, -1, 0, -4, -9, -10, -1, -10, 4, 1,
+    -13, -3, -1, -8, 6, 3, -4, 9, 6, -11, -15, 4, 6, -3, -2, -9,
+    0, -4, 5, 3, 16, 6, -10, -1, -9, 1, 0, 4, 5, -3, 2, -5,
+    -6, -9, -3, 6, -12, -11, 1, -11, -13, -16, 1, -2, 7, 3, -4, -23,
+    3, -8, 6, -6, -16, -7, -3, -9, -3, 9, 4, 13, 8, -13, -3, -6,
+    -9, 0, -9, -9, -9, 8, -7, 0, -3, 1, 3, 1, -3, 6, -1, -14,
+    30, -8, -3, -17, 7, -3, -5, 8, 0, 8, -7, -3, 1, -3, -9, 14,
+    6, 2, -8, -12, 5, -16, 7, -14, 19, -6, -15, -21, 17, 0, -3, -11,
+    -1, -5, -1, -3, -7, 6, -3, 0, -3, -2, 26, -7, 1, 1, 4, -7,
+    -2, 16, -2, -3, -6, -6, 2, -6, 5, -2, 8, -7, -1, -2, -9, -6,
+    -4, -7, -2, -15, -4, -10, -4, -1, 10, -23, 2, -7, -4, -1, 2, 3,
+    11, 5, -3, 7, 4, 17, -2, -3, -2, 15, 6, -8, 7, 8, -6,
+  },
+  {
+    -5, -5, 0, 0, 3, 1, 2, -8, 2, -3, -5, -1, 1, 0, -2, 6,
+    -3, -2, -6, -1, -1, -8, -5, 4, -3, -4, -4, -3, -6, 1, 0, -14,
+    -7, 0, -5, -2, -2, -3, -2, -4, 2, 4, -1, 4, -4, -5, 5, -3,
+    1, -10, 0, -4, 0, -2, -4, -9, -2, -5, 2, -3, -8, -1, 0, -19,
+    -7, -17, -9, -5, 4, -5, 0, 6, -15, -5, 1, -7, 4, -12, -10, -1,
+    -5, -7, 1, -3, -5, -5, -4, 9, -19, -6, 0, 2, -4, 11, 6, 2,
+    4, 3, 8, -4, 6, 1, -6, -8, 9, -3, -5, 1, -4, 1, 2, 13,
+    -3, -7, 7, -9, -4, -8, 1, -1, -7, -20, 0, 2, 2, 0, -2, -15,
+    10, -5, 27, -10, -5, -4, -5, 17, -5, -2, 8, -11, -13, -14, 15, -8,
+    3, -3, 5, -1, 10, 12, -15, 1, 11, -4, 0, -3, -4, -16, 2, -4,
+    6, 5, -4, -9, -6, -3, -1, 4, 3, -14, -4, -6, 12, 1, 5, 11,
+    -7, -12, -3, -9, 1, -4, 8, 1, 5, -7, -3, 8, -6, 16, 6, -9,
+    3, 2, -5, -16, -13, 0, -9, 3, 4, -12, 6, -1, -3, -9, -13, -12,
+    -6, -8, -20, -14, -10, 16, -3, -1, -13, 3, -4, -13, 11, -12, 6, -3,
+    10, 2, 0, -1, 1, -8, 0, 24, 2, -3, 9, -4, -13, -11, 7, -5,
+    -4, 8, 6, 5, -1, -3, 4, 4, -6, 7, -4, -6, 6, 4, -14,
+  },
+  {
+    -2, 1, -2, -2, -2, 0, -1, -2, 3, 0, -6, -4, -4, -2, 3, -6,
+    -1, -1, -3, -2, -3, 4, 0, 5, -4, -2, -3, -1, -1, -1, -4, -7,
+    -4, 6, -6, -3, -6, -3, 4, 0, 3, -2, -1, 4, -1, -4, 4, -2,
+    0, 3, -1, -7, -1, 5, -4, 2, -1, -5, 0, 1, -1, -2, -5, -13,
+    0, -1, 3, -2, -8, -2, -6, -3, -7, -5, -3, -12, 4, -5, 2, -7,
+    -5, -18, -2, 13, -4, -4, 9, -7, -8, -15, 2, 6, -9, -2, -6, -3,
+    7, -12, 11, 6, 8, 0, 3, -4, 2, -10, 6, 3, -7, 11, 1, 7,
+    -2, -6, -1, 3, 4, 0, 2, -2, 3, -7, -1, -15, -7, -9, 1, -16,
+    9, -10, -23, -10, -7, -4, 9, 3, -2, 7, -3, 3, 4, 16, 2, -21,
+    -11, 6, -1, -9, 3, -12, 1, 8, -3, 3, -8, -2, -9, 7, -1, -19,
+    -11, 4, -3, -22, 17, 4, -14, -9, 1, -14, -3, -1, 12, -3, -2, -7,
+    -3, 21, -13, -19, -4, -5, -9, -9, -14, 3, 15, 0, -1, 4, -1, 1,
+    10, 3, 1, 0, 1, 0, 12, 9, 10, -11, 1, 11, 7, 0, -6, 15,
+    -12, -4, 4, -3, -4, -7, 3, 2, 0, -18, 12, 8, -1, -4, -1, 1,
+    -3, -1, 0, -11, -4, -20, -3, -3, 5, 1, 3, 1, -3, -9, 19, -1,
+    -3, 2, -6, -15, -4, 9, -5, 2, -15, 1, -3, 17, -7, 2, 1,
+  },
+  {
+    -4, -8, -1, -16, 0, 2, -1, -17, -1, -2, 0, -1, 1, -1, -4, -28,
+    -2, -3, 0, -5, -2, -3, -5, 0, 4, -3, -13, -2, 0, 1, -4, -35,
+    -8, -2, -2, -7, -3, 0, 5, -7, 1, 1, -3, 5, 0, -3, -3, -8,
+    -3, -4, -2, -11, -3, -13, -4, -8, -5, 4, 1, 2, -3, -5, 5, -48,
+    -8, -11, -5, -3, 9, -8, -3, -14, -1, -13, 10, -5, -5, 1, 11, -20,
+    -4, 0, -5, 3, -8, -11, -5, 0, -11, -3, 0, 1, -9, 7, -2, -7,
+    6, -5, 3, 3, 6, -4, 6, 16, -3, -6, 9, -18, 3, -10, -1, -14,
+    -1, -15, -3, 6, 5, 3, 7, 5, 0, -8, -4, -5, 0, -1, 5, -11,
+    -2, -3, -7, -12, -14, -17, -5, -11, 16, 0, -1, -1, -3, 2, 8, -16,
+    3, -4, 3, -16, 9, 0, -12, 3, -13, 0, -5, -9, 5, 6, 1, -10,
+    4, -2, 2, -9, 5, 1, 8, -14, 1, -7, 5, -5, 6, -3, 3, -13,
+    3, -6, -1, 2, -9, 0, 4, 5, 1, -17, 2, -1, 0, 1, 2, -9,
+    -8, -12, -3, -17, -6, 5, -2, -14, 1, -11, -4, -17, -22, 14, -19, 2,
+    20, -8, 5, -19, 6, -7, 11, 20, 4, 9, -1, 2, 6, -5, 5, -2,
+    -3, 3, 1, -17, 5, -6, -4, 5, 1, 7, -1, 7, 7, -4, -14, -10,
+    -9, -11, 1, -5, 5, -1, -3, -4, -1, -1, 6, 2, 1, -11, -2,
+  },
+  {
+    -1, 2, 0, -3, 0, 0, 0, -7, 1, -1, -3, -5, 0, 3, 1, -5,
+    1, 5, -4, 3, 0, -2, -6, 0, 2, 7, -6, 6, 5, 3, 4, -16,
+    -6, -5, -7, 3, -7, 3, 1, -7, -12, -1, -5, 3, -2, -3, 4, -2,
+    -6, -3, 3, -1, -7, 0, -3, -2, -5, -2, -12, -8, -6, 0, -3, -20,
+    -4, 5, 5, 3, 7, -2, 1, -5, 1, -10, 3, 7, -11, -2, -10, -10,
+    -5, 11, -4, 6, -3, 10, 4, 10, 8, 0, 6, 3, -7, -1, 0, -5,
+    -5, -7, -8, 0, -9, -1, 5, -4, -5, 3, 4, -13, -4, -2, 8, 7,
+    3, -8, -1, 4, 9, 18, 1, -7, 0, -2, 0, 7, 2, -7, 2, -13,
+    1, -4, -8, -20, 6, 12, -1, -1, -3, 6, 5, 5, -6, 6, -10, -1,
+    -11, -1, 1, -1, 12, 12, 7, -13, -11, 1, -1, -12, 2, -9, -3, -2,
+    -6, 1, 13, -10, 21, 14, -10, 3, -6, -1, 4, 6, -5, 1, -8, -13,
+    18, -2, 15, -14, 2, -2, -12, 4, -1, -13, -4, 0, -1, -11, -3, -7,
+    -10, -4, 3, -5, 0, -1, -5, -12, 1, -4, 6, 5, 3, 1, 8, -4,
+    2, -6, -7, -1, -16, 3, 1, -3, -3, 1, -5, -13, -20, 7, -8, 6,
+    3, 10, -6, -3, 0, -1, 5, -8, 18, 7, -10, 2, -28, -3, 11, -11,
+    -6, -3, 0, -21, -10, 7, -9, -10, -5, -12, 5, -16, 11, 5, -5,
+  },
+  {
+    1, -1, -2, 0, 0, -1, -2, -3, -3, -2, -3, 3, -4, -2, -2, -7,
+    -3, 0, -3, -5, -1, 2, 2, -4, 12, -8, -6, 8, -4, -1, 3, -15,
+    -4, 0, -7, 10, -4, 1, 10, -3, 6, 2, 6, -4, -6, -8, 2, -9,
+    -2, 5, -9, -12, -11, -3, 1, -1, -4, -1, -2, -7, -5, -2, -3, -17,
+    -4, -16, 1, 8, -10, -5, -10, -1, 8, -16, 8, -5, 12, -6, -5, -8,
+    9, -7, -4, 5, -12, -5, 1, -1, 4, -18, -6, 3, 1, 6, 2, 13,
+    1, -5, -9, 8, 2, -24, -10, -20, -9, -5, -9, 0, -3, -4, -18, 7,
+    -6, 2, -6, -8, 0, -2, 6, 3, -2, -5, -7, -7, -5, 10, 2, -25,
+    -1, 5, 7, -8, -11, 7, 13, -3, -13, 2, 1, -3, -3, 6, 11, -6,
+    -5, -2, -9, -9, -2, 0, 15, -1, -10, 6, -8, -9, 13, 22, -17, -4,
+    -13, 22, 1, -6, 3, -16, -3, -2, -14, -1, 10, 10, 6, 18, -1, 1,
+    -9, 3, -4, -16, 0, -4, -7, 11, 13, -7, -1, -2, 19, 6, -1, -5,
+    -25, 3, 11, -12, 1, -20, -7, -1, -3, 5, -9, 39, -5, 6, 9, -16,
+    8, -17, -3, -11, -3, -6, 0, -10, -15, 1, 0, 1, -3, -4, -4, 2,
+    -8, 3, -8, 0, -5, -18, 20, -1, 7, 7, 10, -5, 5, 2, 9, 4,
+    2, 0, -16, -14, -3, 4, -1, 6, 1, -4, 2, -1, -8, -3, -10,
+  },
+  {
+    -1, -1, 0, -3, -1, 4, -3, -6, -1, -2, -4, 0, -1, -5, -3, -8,
+    0, 5, 1, 0, -5, -1, -1, 0, -2, 3, -7, -5, -6, -1, -1, -10,
+    -4, -4, 0, -4, -6, 3, -3, -1, 4, 1, 5, 0, -7, 0, -1, -2,
+    -1, -3, -2, 2, 3, 10, 2, 15, -3, 0, 2, -3, 3, -8, -1, -12,
+    -4, -4, -10, 2, 3, 2, 3, -3, 1, -9, 1, -12, 2, -12, -12, -4,
+    -8, -10, -1, -5, -4, 1, -4, -12, -8, -13, -3, -4, 2, -11, 8, 0,
+    -10, -9, -3, -6, 1, 0, 3, -2, 0, -3, 9, 12, 8, -4, 1, -1,
+    24, 0, -6, 0, -8, 3, 0, 1, -3, 1, 0, 0, -4, -8, 1, -17,
+    15, -12, -16, -16, 3, -20, -1, 3, -2, 8, -4, 1, 3, 6, 3, 7,
+    8, -10, -3, -5, 3, 4, -11, 18, 8, -7, 0, -19, -5, 1, -6, -2,
+    5, -12, 4, -7, 3, -7, -7, -7, 9, -3, 5, 3, -7, 7, 5, -11,
+    2, 1, 3, -11, 12, -11, 1, 1, 7, 4, -1, -5, 4, 1, 6, -2,
+    -1, 2, 1, -5, 3, 7, -4, 0, -2, -3, -2, -3, 1, 7, -4, -8,
+    3, 9, -5, -12, 10, 0, 3, -1, -9, -1, -3, 3, 1, 7, 4, -4,
+    0, -6, 32, -8, -2, -9, 14, -4, -15, 14, -3, -4, 9, 15, -5, -1,
+    8, 3, 2, -4, -5, -7, 3, -3, 10, 0, -13, 0, 7, 3, 7,
+  },
+  {
+    -2, -3, 2, -2, 2, -1, 0, -5, -3, -2, -3, -2, -1, -3, -1, -6,
+    -5, 1, 0, -4, -3, 3, 1, 6, 5, -4, -3, -4, 1, 8, -5, -13,
+    -10, 0, 0, -4, -12, -5, -2, 2, -2, -5, -1, 2, -3, 0, -1, -8,
+    -4, -5, -2, -5, 5, 2, -1, -1, 2, 0, 3, 9, -5, -8, -7, -19,
+    0, 1, -15, 1, 3, -3, 1, -7, -3, 6, -4, -12, 4, 3, -8, -4,
+    -2, -6, 1, -2, -3, 1, 8, 2, -8, 4, 3, 10, 0, -4, -3, 1,
+    0, 10, 0, -3, -1, 5, 10, 0, 3, -5, -1, -3, -3, -12, -2, -8,
+    -12, -11, -4, -7, -5, 0, -2, 3, -5, -2, 0, 2, 0, 2, 1, -34,
+    15, -3, 4, -16, 5, -19, -2, -21, -5, 1, -15, -1, 8, 1, -4, 4,
+    5, 16, 5, -15, 17, 7, 7, 3, -6, 0, -4, -12, -20, 4, -1, -4,
+    7, -7, -4, -8, -9, 1, -2, 0, -13, 3, -2, -3, 13, -35, -4, 8,
+    -5, 9, 3, -7, 17, -13, -9, 0, 16, 20, -6, 18, -14, -1, -8, -16,
+    3, -25, -5, -15, -11, -1, 3, 10, 1, -7, -4, -2, 7, 2, -8, -3,
+    10, 9, -18, 3, -4, 2, -12, -3, 5, -9, 12, 9, -6, 5, -6, 0,
+    0, -4, -5, -11, 4, 0, 7, 8, 1, -6, -4, -4, -4, -12, -2, -18,
+    -15, -17, 7, -20, 11, -4, -2, -1, 11, -12, -4, -6, -13, -6, 3,
+  },
+  {
+    0, -1, -2, -3, -2, -1, 1, -8, 0, 4, -2, -3, -6, 1, -2, -13,
+    -9, 0, 6, -3, -4, -1, -4, -12, 0, 0, 4, 1, 1, -1, 0, -15,
+    -3, -3, -1, -5, -2, 0, -2, 1, -3, 8, 6, 1, -3, -4, 3, -16,
+    -7, 1, 0, -1, -11, -4, 1, -4, 0, -3, 2, 9, -8, 9, -5, 3,
+    2, -2, 6, -1, 7, 5, -6, -6, -1, -15, -3, 2, -1, 2, 0, 2,
+    0, -4, -6, 3, 5, 0, 13, 0, 2, 0, -3, -6, -8, -8, -1, -14,
+    -3, -4, -1, -11, -9, 12, -4, -15, 0, 7, -3, 0, -1, 6, 7, 0,
+    6, -10, 3, -1, 0, 2, 3, -12, -7, 5, 7, -10, 1, 1, 4, -27,
+    27, -2, -5, -12, -3, -2, -3, 5, 1, -5, -10, -1, 3, -1, 7, -8,
+    3, 3, -8, -10, -10, -2, -11, -11, 3, -14, -3, 1, 20, -1, 0, 3,
+    5, -3, -6, -14, -3, -7, 3, -13, 4, -20, -8, -5, -15, 6, 18, -2,
+    -7, -2, 14, -4, -1, 2, 5, -8, -9, 6, 0, 7, 3, 0, 4, -26,
+    -8, 14, -12, -7, -7, 1, 3, -15, 7, 15, -4, 2, 15, 11, -6, -19,
+    3, 3, -14, -2, -26, 3, 11, -4, 4, -7, -10, -1, -7, -3, -3, -12,
+    -6, -8, 4, -8, -4, -3, 3, -1, 10, -7, 4, -1, 2, 2, -3, 1,
+    -20, -15, -2, -10, 3, -3, 1, 5, -3, -3, 16, 2, 1, -10, -12,
+  },
+  {
+    -1, 2, 0, 0, 1, 0, -3, -4, -1, -3, 1, -2, 3, 0, -4, -5,
+    3, 1, 1, -9, -5, 6, -1, 2, -5, 1, 1, -6, 5, -3, 4, -12,
+    -4, -3, 5, 0, 0, -2, 1, 5, -2, -1, 1, -6, -5, 9, -1, -5,
+    4, -3, -6, 8, -1, -5, -1, -14, -3, 0, 5, -11, -3, -6, -1, -20,
+    -2, 2, 1, 5, 1, -14, -6, -4, -1, -6, -1, -3, 2, 6, 10, -8,
+    -12, -11, 2, -8, 3, 4, 7, -1, 1, 0, -9, 0, -10, -3, 8, 0,
+    -1, -4, 1, 7, -14, -1, -4, 1, -1, -3, -1, -2, 0, 7, 0, -16,
+    7, -1, 9, -2, -5, 8, -10, 8, 1, 0, -3, -8, -6, -12, -6, -23,
+    -1, 18, 4, -21, -7, -7, -3, 3, 10, 13, -4, 1, -3, -9, -3, -13,
+    -20, 6, -10, -4, 3, 0, -6, 0, 6, -3, -1, 5, -5, -6, 24, -7,
+    -1, -13, -9, -4, -1, 1, 8, 8, 13, -6, 10, -2, 7, 6, -14, -8,
+    3, -1, 2, -15, -11, 17, 1, 2, 7, -21, 1, -16, 11, -9, 9, -7,
+    -7, 4, 7, -2, -4, -6, 2, -4, 2, -18, 12, -8, -18, -4, 0, -9,
+    -10, 2, -3, -13, 0, -7, 7, -10, -8, -9, -1, 2, -5, 5, -2, -15,
+    3, -7, 8, -11, -8, 19, 13, 3, -7, 3, 4, -2, 6, -13, -2, 2,
+    -16, -1, 9, 1, 7, -7, 7, -5, 13, -15, -2, -11, 3, 1, 0,
+  },
+  {
+    -4, 2, 2, -4, 1, 1, 1, -10, 2, -8, 0, -2, -3, 0, -5, -12,
+    3, -2, -2, -11, -3, 7, -10, 2, -2, 2, 2, 1, 1, -9, -4, -26,
+    -10, 4, 1, -11, -4, -9, 4, 14, -1, -4, 1, 1, 9, -9, 4, 4,
+    -3, -5, -2, -3, -7, 2, 0, -1, -2, 0, 3, -7, -9, -2, -4, -26,
+    -1, -14, 4, -2, -4, -3, 0, 6, 5, 11, -3, -7, 8, -6, 5, -12,
+    29, 0, -1, 6, 4, -3, 6, -5, 7, -1, 8, -18, 2, -2, 0, 6,
+    -6, -2, -9, 1, 6, -3, 5, -4, 0, 1, 4, -4, 3, 7, 4, 6,
+    4, -7, -4, 3, 5, 0, -1, -14, 12, -2, -4, -3, -4, 4, -1, -36,
+    3, -11, 12, -16, -12, -1, -6, -3, 1, 9, 4, -6, 3, -2, -11, -8,
+    2, -6, -5, -5, 8, 10, 3, 14, 4, -3, -9, -8, 2, 15, 1, -20,
+    -8, 2, 41, -16, -1, 1, 1, -7, -7, 6, -2, -4, -1, -4, 3, -7,
+    -5, 7, -4, -6, 4, -10, -18, -14, -2, -1, 6, -8, 9, -2, 6, 1,
+    3, 1, 0, -14, 0, 8, 3, 8, -14, 0, -11, 18, -4, -6, -3, 10,
+    -9, 0, 13, 3, -1, 4, 1, 3, -11, 4, 7, 0, 3, 3, -2, -4,
+    -11, -8, -3, -1, -9, 12, 2, -3, 3, 3, 2, -3, 6, -3, -7, -19,
+    -9, -11, 5, -5, 5, -10, 13, -4, 0, 3, -2, -9, -3, 5, 0,
+  },
+  {
+    -2, -6, 0, -9, 1, 2, 3, -16, 1, -2, 0, 0, 0, 2, 6, -24,
+    -2, 2, -2, 2, -6, 0, -7, -8, -2, -9, -8, 3, -1, -2, 13, -35,
+    0, -5, -11, -12, 5, -3, -13, -11, 2, 4, -1, 0, -2, 3, -2, -10,
+    -9, 1, 6, -11, 0, -10, 7, 0, 2, 2, -6, -7, -7, -4, -15, -32,
+    5, -5, 1, -8, 5, 1, 2, -3, -4, -16, 9, 2, 7, 7, 4, -13,
+    6, 0, -4, -11, -8, 0, 14, -11, -8, 4, -9, 5, -13, -6, 0, -20,
+    0, -7, -3, 3, 6, 7, -14, -20, 4, -9, -4, 18, 8, -1, 6, -6,
+    -2, -12, 1, -2, -2, 11, 0, -7, 0, -9, 0, -3, -5, -6, -10, -36,
+    2, 1, -8, -1, -7, -8, -15, -3, 3, 1, -7, -10, -2, 0, 5, -15,
+    -12, 16, -4, -17, -11, -2, -1, -10, -4, -14, 6, -10, -8, 8, -7, -19,
+    -7, 0, 3, -10, 8, -8, -7, -17, -2, -17, -6, -2, 3, 19, 12, 8,
+    -3, 10, 2, -5, 15, -6, 8, -6, -17, -27, 4, -5, 5, 5, 6, -34,
+    -5, 1, 2, -10, 1, -7, 13, -25, 1, -6, -21, 0, 4, 12, 6, -39,
+    -2, 1, -4, -2, 1, -1, -5, -4, -23, 0, -19, 6, 3, -5, 16, -10,
+    16, -3, 2, -19, -2, 9, 7, -7, 11, 4, -8, 1, -3, -4, -3, -1,
+    -5, 3, -13, -11, -12, 3, 7, 3, -2, 11, -12, -32, -13, -16, 0,
+  },
+  {
+    0, 0, 0, -2, -3, 0, 1, -6, 0, -4, -1, -5, -1, -5, 1, -7,
+    -1, -3, 7, -1, -1, 5, -5, 2, 4, 3, -3, -1, 0, -5, 0, -9,
+    2, -1, 4, -7, -3, -3, -5, -6, 2, 5, -8, -1, -11, -4, 6, 1,
+    0, 2, 11, -1, 0, -12, -1, -8, 0, -2, 1, -8, -6, -2, -3, -16,
+    -18, -13, 4, 0, -10, 1, -5, -11, 0, 3, -2, -6, -1, 7, 2, -15,
+    2, -14, 4, -8, 0, -12, 8, 10, 1, -12, -5, -2, 1, 1, 10, -16,
+    -31, -1, 0, -3, 1, -6, 7, -2, -1, -12, -2, 8, 12, 12, 3, -18,
+    7, -9, 14, -6, -8, 11, 3, 8, 6, 5, 3, -8, 7, 7, 4, -19,
+    -5, -11, -4, -13, -6, -3, 4, -3, 11, 1, 4, -8, -8, -3, 2, -8,
+    -1, -2, -10, -1, 5, 4, 4, -7, 0, 4, 7, 13, 22, 2, 11, -14,
+    -1, -3, -8, -2, 2, 4, -8, 8, 0, -2, 9, -13, 2, -4, -4, 1,
+    4, 2, -5, 2, -15, 11, -5, -12, -11, -6, 6, 8, 4, -8, -8, -2,
+    -9, -17, 8, -12, -5, 9, -14, 4, 4, 4, 1, 0, 3, 4, -7, -6,
+    -6, 3, 22, -6, 1, 3, -5, -11, -19, 13, -11, -20, 9, 6, -5, 11,
+    -2, 9, -9, -4, 4, 5, -24, -4, -7, 5, -1, 9, -1, -5, -7, 10,
+    0, -16, -6, -7, -11, -12, 5, -9, -4, 6, -2, 4, 7, -9, 12,
+  },
+  {
+    -2, -1, 1, -1, 2, 2, 0, -2, -6, 1, -2, 2, 2, 1, 3, -8,
+    -5, -6, -4, -2, -1, 2, -3, 1, -4, 3, 5, -1, -3, -2, -2, -12,
+    -4, -3, 0, -7, 3, -6, 1, -6, 4, 2, 0, -6, -3, 2, 0, -8,
+    -2, -9, -1, -4, -2, -4, 9, 5, -2, 5, 3, -4, 3, 5, -9, -14,
+    7, -1, -4, -5, -2, -10, -2, -7, -6, -17, -5, 7, 7, -6, -4, -10,
+    1, -6, 3, 4, 14, -2, -1, -7, -6, -1, 5, 4, 7, 6, -2, 4,
+    -1, 0, 0, -17, 1, -9, 0, 2, 3, -7, 0, -7, -6, -5, -4, -4,
+    1, -3, 0, -2, -13, 5, -2, -11, 1, -9, 0, 0, 17, -3, -2, -19,
+    -3, 3, -5, -9, -4, -5, 2, 2, 3, 4, 4, -8, 4, -6, -1, -12,
+    -6, 0, -2, -11, 4, -15, 7, 6, -12, 0, 4, -6, 1, 1, 9, -1,
+    -2, 5, -6, -8, 2, 2, -1, 1, -12, -4, -9, 9, 5, -5, -1, 6,
+    2, 1, -6, -16, -16, 1, 10, -1, 9, -1, -6, 5, 10, -1, 9, -10,
+    2, -9, 4, -10, 0, 5, -1, -4, 1, -15, -5, -1, 8, -8, 10, -14,
+    -1, -1, -9, 1, -6, -6, -2, 4, 5, -6, -5, 3, -2, -11, 17, -4,
+    17, -5, 1, -10, -3, 1, 25, -10, -7, 22, -3, 9, -1, 10, 3, 5,
+    -4, -10, -3, -17, -8, 0, -3, 5, 5, -12, -22, 5, 11, -1, 1,
+  },
+  {
+    -1, -1, 1, -3, 6, -3, -1, -2, -2, -2, -11, -3, 0, 4, 4, -11,
+    1, -4, -5, -2, 9, -1, -5, -3, 10, 4, 2, -9, 8, 3, 3, -18,
+    -2, -13, 6, -6, 7, 0, -1, -1, 3, -3, -9, -11, -14, -4, -2, -3,
+    1, 7, -4, -2, 2, 0, -3, 7, 4, -5, -16, 3, -5, -2, 4, -10,
+    0, -2, 8, 3, -1, 5, 23, -12, 4, -8, 10, 6, -2, -3, -1, 0,
+    -7, -6, -1, 2, -6, -24, -4, 27, -10, -34, 12, 7, -7, -6, 4, -18,
+    -19, -1, -5, 1, 9, 5, 11, 9, -1, -21, 1, 0, 5, 6, -2, 1,
+    -7, -7, 7, -16, 0, -26, 0, -3, -10, -10, 6, 1, 0, 2, 0, -21,
+    28, 0, -4, 1, -5, -2, -3, 8, -17, 1, -14, 0, 13, 10, -7, -19,
+    -17, 3, 1, -6, 13, -3, -13, -4, 1, -6, 6, -12, -15, -9, -12, -23,
+    6, -7, -12, -6, 0, -2, -6, -2, -6, -11, -11, 10, 4, -11, 14, -6,
+    -24, 7, -6, -13, 1, -1, 17, 10, 12, -10, -11, 20, -2, -3, 12, 16,
+    -1, 5, -4, -16, -15, -14, -8, -3, -4, 2, -11, -2, 14, -5, -6, -10,
+    8, -3, 0, -6, -5, -16, -17, -9, -4, -8, -4, 3, -10, -6, -6, -2,
+    -11, 19, -1, -16, -3, 7, 16, -1, 0, -11, -3, 7, -1, -3, -6, -1,
+    6, -1, -21, -8, 2, 4, 8, 8, -1, -10, 14, 1, 9, -13, 17,
+  },
+  {
+    -3, 0, 2, -2, 5, -4, -2, -6, -5, 1, -3, -11, -1, -2, -3, -11,
+    -12, -4, -1, 0, 0, 4, -3, -14, 3, 4, 1, 4, -4, -1, -3, -17,
+    7, -1, -1, -10, -7, 1, -4, -5, -1, 12, 8, -2, -7, 1, -3, 13,
+    -1, -1, 5, 1, 3, 0, 3, 5, -8, -5, 1, 4, -3, -2, 3, -12,
+    3, -4, -10, -9, -9, 5, 6, 15, -1, -7, 2, 0, 0, -3, 2, 2,
+    -1, -9, 6, 0, 24, -3, 19, -11, 7, 6, 17, -3, -5, -4, -5, -6,
+    -28, -3, -7, -1, -1, 3, -9, -2, -1, -3, 1, -3, 9, 3, 0, -3,
+    -5, -12, 2, -4, -2, -6, -2, -1, -10, -10, -4, -6, 2, -2, -3, -20,
+    22, 2, -12, -9, -4, -17, -4, -22, 14, 8, -17, 1, 1, -6, 1, -7,
+    -27, -19, 0, -13, 10, -32, -5, -8, 1, -4, 12, -9, 7, -4, 8, -6,
+    6, -13, -5, -19, 3, 2, 4, -14, -2, 4, 21, 2, -2, -1, -17, 0,
+    2, 4, -12, -21, 13, 2, 8, -10, -2, -12, 11, -3, -12, 6, -1, -15,
+    -16, 40, 0, 2, 1, 2, 3, 0, -2, 3, 9, 4, -6, -9, -7, -8,
+    12, 6, -9, 3, 4, -13, -12, 2, -1, 10, -3, -5, 6, 0, 11, 3,
+    7, 23, -5, -16, 7, 5, 17, 19, 12, -18, 7, -4, 2, 5, 6, -17,
+    -8, -18, -5, -17, 6, 16, -15, -2, 0, 4, 8, 12, 7, 4, 1,
+  },
+  {
+    -1, -1, -1, -3, 2, -2, -1, -6, -2, -2, -1, -3, -2, -5, -4, -8,
+    -8, -5, 5, 3, 1, 2, 3, -4, -1, -3, -5, 1, 0, -6, -1, -10,
+    3, 7, -4, -11, -8, -5, 8, -1, -3, -4, -3, -1, 1, -11, 9, 4,
+    -6, 3, -2, -1, -4, 2, 0, -11, -8, -7, -3, -10, -2, 4, 2, -16,
+    -9, -5, -3, -2, 18, 1, -3, -22, 1, -7, -9, -4, -2, 2, -10, -4,
+    -3, -4, 8, -6, 1, -1, -2, 13, 2, -11, -1, -6, 3, -2, 4, -3,
+    -11, -5, 5, -4, 7, -4, -8, 1, -5, -8, -6, -3, -6, -2, -7, -1,
+    7, -8, -11, -3, 1, 0, 1, 8, 0, -7, 7, -2, 1, -4, 1, -22,
+    -5, -18, 2, -15, -10, -8, 2, -7, 6, -4, 22, 5, 7, 6, 0, -16,
+    -2, 7, -4, 3, -24, -6, -2, -16, 16, 1, -3, 12, 3, 0, 2, -4,
+    -12, -14, 5, -7, 4, -3, -10, 2, 12, 17, 3, 3, -3, -4, -9, 7,
+    3, 14, 5, -1, -7, 3, 10, -7, 6, 1, 6, -4, -12, -10, -2, -4,
+    3, 23, -14, -2, 13, -6, -1, 2, 7, 0, 9, 1, 1, 0, 0, -18,
+    -1, -8, 2, -10, -3, -3, 3, 9, 14, 11, -9, -7, 8, -5, 7, -4,
+    -13, 7, -4, -23, -4, -3, -13, -4, 7, 15, -5, 17, 1, 14, -11, -14,
+    -24, -12, 1, -9, -9, 4, 4, -1, -3, 6, -3, -3, -12, 6, 17,
+  },
+  {
+    -1, -2, 2, 1, 2, -1, -2, -2, 4, 1, -3, 1, -3, 7, 2, -4,
+    0, 5, 12, -2, -1, -5, 2, 3, -2, -2, -3, 3, -6, 2, -4, -14,
+    -1, 4, -4, -1, -2, 1, -15, -1, -3, -13, 7, 6, 4, -2, -7, -3,
+    2, 1, -4, -1, 0, -2, -2, 3, 3, -9, -8, 7, 3, 4, 8, -17,
+    -5, -3, -7, 9, -3, 1, -6, -2, 1, -9, 7, 0, -13, 13, -5, -2,
+    -2, -3, 0, -10, 1, -6, -3, 5, -16, -4, -12, -2, -16, -2, 0, 1,
+    -4, -1, -6, -2, -12, 5, 4, -1, -3, -12, -12, 4, 2, 5, 0, 1,
+    8, -7, -6, -24, 1, 8, 0, -5, -4, -3, 12, 0, -11, -6, -5, -24,
+    -4, -8, 7, -14, -21, -4, 2, -5, -6, -1, 9, 10, 6, 3, -9, -3,
+    9, -7, -2, -16, -25, -4, 13, -7, 1, -6, 0, -14, -28, -13, 2, -5,
+    3, -1, -3, -14, -2, 5, 3, -26, -11, 3, -6, -7, 6, -3, 16, 1,
+    19, 17, 7, -18, 9, 7, 0, 11, 2, -3, -3, -3, 3, -8, -5, 2,
+    2, -12, -4, 3, 5, 21, -5, -10, -3, -22, -4, 2, 9, -1, 2, -1,
+    5, -6, 16, -2, 4, 9, 3, -4, -6, 5, 1, 9, -11, -2, 4, -12,
+    -2, -6, -8, -14, -3, -4, 13, -27, -13, 9, 13, -10, 18, -3, -5, 6,
+    3, -1, 7, -10, 3, 5, 7, -5, 9, -23, 4, -4, 7, 10, 10,
+  },
+  {
+    0, 0, -1, -1, -1, 3, 4, -5, 3, 0, 1, 2, 1, 1, 4, 0,
+    -2, 0, 2, -2, -3, 1, 1, -2, -3, 5, 0, 4, 1, 0, 4, -7,
+    -12, 3, -1, 5, -4, 3, 5, -5, -5, -5, -4, 1, -9, 4, 4, 0,
+    -1, -9, 4, 1, 4, -9, 3, 0, -5, -2, 1, -2, -5, 3, -13, -12,
+    -9, 5, -2, -1, 0, 4, 2, -3, -5, -9, -3, -4, -10, 1, -6, 4,
+    -5, -2, -2, -11, -1, -5, -3, -6, 2, -5, 4, 3, -3, -7, 2, -7,
+    -4, -9, 5, 7, -5, 2, 7, -4, -6, -10, -8, -5, -1, -12, 11, 2,
+    4, -8, 4, -6, 12, 1, -3, 0, 3, 10, -1, -7, 2, 17, 6, -21,
+    -2, -3, -10, -9, -4, 9, -8, 5, -1, 3, -1, 0, -4, -4, 0, 3,
+    -2, 10, -4, -14, -12, 6, 0, -10, -18, 17, 5, 10, 7, 21, 10, -1,
+    6, 4, -5, -11, -2, 2, -1, -9, -4, -11, 4, -7, 4, -16, -7, 4,
+    -7, -7, -3, -13, 6, 4, 2, -12, 0, -1, 1, 4, -1, -2, -2, -10,
+    1, -4, -14, -14, 5, -7, 0, -9, -13, 3, 9, -2, -1, -7, 12, -2,
+    3, -6, -5, -4, -15, -18, 10, 20, -13, -4, -8, -12, -5, -9, 8, -19,
+    9, 4, -4, -19, 3, 1, -8, 20, 12, -8, -2, 5, 6, 8, -3, -6,
+    -13, 7, 11, -7, -16, 0, -3, 4, 1, -4, -15, 7, -25, -2, 4,
+  },
+  {
+    -2, -1, -1, -2, 1, 1, -1, -10, -5, 0, 5, -1, -4, 2, 2, -7,
+    -5, 1, 3, -2, -4, -7, -6, 1, 3, -6, -7, 3, 4, 1, 1, -17,
+    -8, -1, 1, -14, 5, -5, 3, -7, -1, -5, -4, -8, -2, 11, -6, 3,
+    -4, -5, -2, -12, 0, 5, -1, -2, -4, -4, 2, 2, -9, -4, 0, -28,
+    6, -9, -13, -3, -3, -3, 2, -21, -2, -9, -14, 2, 6, -9, 0, -12,
+    -2, -9, 1, 4, -4, -7, -6, -7, 1, -11, -5, -8, 4, -14, -4, -3,
+    8, 5, 0, 3, -2, 4, -9, 13, -3, -6, 4, -3, -2, 7, 10, -9,
+    5, -2, -1, -3, -4, -1, 12, 6, 8, -4, 0, -6, 2, -11, -1, -31,
+    -3, -17, -6, -4, -8, 5, 6, 9, -2, 11, -7, -6, 6, 4, -7, -24,
+    0, 1, 5, 1, -9, -2, 3, -6, 0, -1, 5, -2, -9, -7, -10, -19,
+    -4, -3, -3, -4, -3, -10, 0, -4, -10, -20, -13, 15, 6, 18, -2, 14,
+    6, -7, 2, -5, 3, -2, -11, -3, 6, -8, -5, -17, 9, -12, 18, -3,
+    -2, 7, -16, -4, 15, 10, -3, -8, -4, 1, -1, -13, 11, -3, -4, 0,
+    29, -7, 4, -10, 3, 1, -4, 2, 14, 8, -4, -1, 11, -5, 7, -8,
+    0, 8, -2, -19, -13, 0, -2, 9, -6, 3, -2, -1, 10, 0, -21, -13,
+    5, -7, 10, -13, 2, -2, 0, 13, -7, 6, -2, -22, 0, -18, 13,
+  },
+  {
+    -1, -1, -1, 1, -3, 0, 1, -5, -5, -1, -1, -6, -1, 1, -3, -7,
+    4, 4, 1, -2, 0, 4, -3, 2, 2, -3, 3, 1, 2, 3, 0, -11,
+    -3, -3, -3, 6, 7, 3, 5, -3, 6, 3, 2, -3, -4, -7, -5, 3,
+    -8, 4, 6, -8, -2, 4, 2, 0, -8, 4, 4, -2, -2, -2, 2, -19,
+    0, -5, 4, 1, 6, -5, 2, -3, 6, -4, 15, 5, 8, 9, 0, -11,
+    -1, -2, -3, 3, -4, 3, -5, 5, 4, -5, -2, -12, -3, -4, 1, -2,
+    -6, 7, 0, 2, -12, 2, -12, -4, -2, 0, -8, 3, 1, 4, -8, -11,
+    5, 3, -2, 0, 6, 6, -9, 1, -10, -6, -6, 0, -5, -4, -8, -21,
+    -4, -7, -3, -9, -20, 0, -3, 0, -12, 4, -4, -1, -7, -2, -6, -11,
+    0, 4, 18, -7, 8, 3, -8, 13, -9, -5, 1, -4, 6, 17, 7, -8,
+    2, -5, -1, -6, -1, -1, -6, -8, -2, 5, 4, -12, 2, 8, -7, -5,
+    13, 6, 1, -8, 2, -2, -2, -9, -4, 1, 0, -11, 16, -9, -1, -6,
+    -3, -4, 6, -13, -17, 0, -6, -5, 9, 7, 6, -9, -1, 5, -9, -6,
+    -10, 7, 6, -5, 1, 2, 5, 1, 2, 3, 3, -9, 3, -15, -6, -4,
+    7, 2, 5, -13, -10, 0, 0, -8, 3, -7, 3, -7, -6, -9, 5, -13,
+    17, 20, 5, -5, -7, -11, -2, -4, -3, -10, 2, -2, 12, -21, -1,
+  },
+  {
+    0, -4, -2, 0, -2, -2, 2, -9, -1, -3, -1, 4, -2, -3, 3, -4,
+    6, -2, 10, -5, 3, 2, -1, 3, 3, 3, 2, 0, -6, 1, 1, -13,
+    -6, -5, 0, -11, 7, -2, 14, -12, 1, -3, 2, 4, -7, -4, 1, -8,
+    -4, -3, 12, 1, 4, 10, 1, -5, -4, -1, 3, -1, -12, -4, -11, -15,
+    -4, -16, 2, 1, -7, -14, -4, 18, 7, -8, 9, -3, -3, -9, -18, -4,
+    -1, -10, -9, 2, 1, 1, 0, -3, 2, -7, 8, 4, 4, 9, 1, -4,
+    0, 1, 6, -12, 6, -1, -20, 2, -3, -5, 7, -9, 0, 8, -2, -13,
+    4, -12, 3, 10, 9, 7, 8, -5, 0, -1, 12, -10, 6, -3, 9, -26,
+    14, 7, -4, -14, 5, -5, -2, -6, -2, 7, 19, -19, -1, 7, -7, -10,
+    27, 0, -6, -1, -9, -4, -13, -9, -5, 9, 1, -3, -10, 17, -8, 3,
+    -2, 3, 1, -3, 20, 5, 1, -12, -5, -1, 12, 0, -8, 0, -1, -6,
+    -12, -8, 3, 4, -6, -1, 1, 6, -1, -4, -7, 1, -8, -5, -5, -10,
+    -5, -5, -5, -5, -29, 2, 11, -8, 0, -1, -13, -8, -1, -22, -5, 2,
+    -1, 11, -8, -12, -21, -1, -18, -5, -3, -4, 16, 10, -8, 5, 1, -3,
+    -16, -8, 5, -14, 8, 3, 3, 1, 19, 3, -11, 2, -18, 9, 11, 9,
+    -1, 2, 11, -16, -9, -6, -8, 3, 11, -3, -4, 13, -10, -3, 3,
+  },
+  {
+    -1, -1, 0, -2, -1, -3, 2, 3, -7, 0, -1, -4, 3, 0, -3, -5,
+    -8, 0, 0, 2, -10, -3, -2, -5, -4, 0, -6, 5, 9, 9, 5, -14,
+    -2, 1, -4, 4, -18, 3, -2, -3, 2, -1, 1, 11, -3, -2, -4, 9,
+    6, -2, -2, -3, -1, -4, -4, -9, -7, -1, 2, -1, 3, -7, 2, -15,
+    1, -12, -1, -2, 16, 12, 2, 6, -1, -21, 14, -4, 4, 5, -6, -10,
+    8, 2, -1, -7, -13, -7, 11, -9, -1, 4, -2, 13, 0, -2, -2, -2,
+    -7, 1, -8, 6, -1, 1, 5, 1, 1, 6, 2, -8, -1, 4, -3, -8,
+    1, 1, 0, 3, 6, 6, -8, -2, 3, -16, -7, -1, -2, -8, -3, -21,
+    -7, -12, 8, -12, -11, -9, -6, -19, 5, 6, -24, -7, 6, -10, 13, -7,
+    -5, 5, -2, -32, -5, 0, -2, 6, 15, 1, -8, 4, 10, 3, 0, -13,
+    -2, 3, -12, -15, -4, 3, -9, 24, 7, -4, 11, -1, 4, 0, 5, 5,
+    3, -10, 14, -3, -9, 2, 0, 1, -4, -8, -6, 6, 0, 3, 1, -5,
+    10, -12, -16, -6, 4, 9, 6, -3, 12, 1, -6, 4, 0, 0, 3, 0,
+    4, -10, -2, -13, 6, 9, -2, 19, -16, 10, 5, 6, 1, 7, 5, -6,
+    -7, 9, -13, -4, -1, -4, 1, -2, 3, -1, -9, -5, 7, -2, 1, 5,
+    -13, -6, -3, -9, -3, -19, -4, 2, -1, 4, -9, -8, 1, -5, 8,
+  },
+  {
+    0, -5, 0, -4, 0, 2, 2, -7, 0, 2, -1, -1, 2, -1, -2, -11,
+    -5, 5, 3, -2, 3, 1, 0, -4, 2, 2, 5, 3, -2, 1, -1, -9,
+    5, -4, -2, -6, 2, -2, 6, -5, -1, -1, -3, 3, 6, -1, 1, -5,
+    -1, 0, -3, -3, -1, 5, -3, -2, 0, -3, 3, -1, -4, 1, -4, -17,
+    10, 0, 9, -12, 5, -9, -3, -3, 2, -6, 4, -4, -4, -5, 4, -4,
+    -5, -2, 1, -8, 3, 9, 3, -1, 1, -14, -13, 2, 2, 6, 2, -6,
+    2, -13, -10, 1, 6, -7, 0, -7, 0, 3, 8, 2, -2, -14, 9, -2,
+    -8, -5, -5, -8, 3, -2, 5, 5, 5, -7, 2, -6, 5, -10, 4, -27,
+    -9, -11, -10, -8, 2, -7, -9, 8, 10, 7, 8, 2, -1, -3, 1, 0,
+    -3, 2, 6, -15, -8, 1, -18, 0, -4, 4, 4, 3, 9, -4, 6, -24,
+    -4, -6, 9, -6, -6, 8, -9, -1, 7, -9, -6, 5, -20, 5, 6, -2,
+    -3, 2, -5, -14, -5, -8, 10, 2, -8, 6, 9, 0, 7, 4, 1, -18,
+    -6, -8, 6, -11, -7, 0, -13, -7, 6, 7, 3, 7, 6, 7, -2, -3,
+    6, -2, -3, -5, 7, 3, -4, 3, 5, -5, -11, -22, -4, -11, 16, 17,
+    6, 5, -3, -13, 2, -13, -4, -2, -1, 10, 3, -2, -1, 4, 2, 3,
+    -1, 2, 1, -16, 2, 14, 4, -8, -1, -7, 2, 6, 2, 5, -14,
+  },
+  {
+    -1, -2, -1, -5, 1, -1, -1, -8, -5, 1, 0, -1, -3, 2, -1, -3,
+    0, -2, -3, -2, -2, 3, 0, -3, -2, -6, 3, 0, -1, 3, 2, -14,
+    -1, -1, 2, 4, -4, -3, 2, -9, -6, 2, -1, 0, 7, 0, -11, 3,
+    -2, 3, -3, 11, -5, 3, 1, -2, 2, -4, 4, 2, 3, 2, -7, -15,
+    6, -6, -5, -1, 6, -5, -7, 0, 4, -11, 16, -11, -1, 8, -8, 4,
+    -4, 0, -2, 2, 4, -3, 5, 0, 9, 3, 12, 2, -11, -10, -9, -3,
+    -11, -3, -3, -5, 0, 0, -5, 13, -14, -2, 7, 2, -5, 7, -2, -8,
+    3, -5, -4, -10, -6, 4, -1, 5, -4, 0, -9, -1, 2, 11, 13, -25,
+    1, -3, -6, -6, 8, -26, -16, -3, 6, -10, -7, 13, 8, -11, 3, 9,
+    10, 0, 7, 4, -7, -18, -7, -9, 4, -3, 2, -2, 7, 16, 14, -2,
+    -6, 1, -4, -7, -3, 15, 24, 3, -6, -3, -18, -11, -1, -3, 1, 4,
+    -4, -4, 4, -12, -1, -6, -19, -12, 3, 9, 5, -18, 1, -3, 15, -5,
+    2, -11, 16, -9, 2, -7, 4, -2, 16, -3, 3, 2, 2, 14, -6, -16,
+    -23, -32, 1, -13, -6, 1, -7, 1, -3, -2, 1, -8, -2, -4, -2, 7,
+    -10, -7, 3, -19, 19, -9, 7, -3, -3, -5, -8, -13, 9, -13, 2, 4,
+    -4, -5, 3, -7, -3, 0, 6, 3, -9, 16, -5, -1, 15, -4, 15,
+  },
+  {
+    0, -4, -4, -1, -3, -1, 1, -2, -7, -7, 0, -1, -5, 1, 1, -5,
+    -2, 0, -1, -1, -1, 2, -1, -10, -6, -7, -2, 0, 2, 0, -1, -14,
+    -3, -6, -2, 9, -8, 1, -2, -5, 7, -1, 1, -3, -1, 5, 3, -3,
+    1, -11, 4, 16, -1, 6, 6, -3, -3, 0, -2, -3, -2, -1, -7, -16,
+    -1, -21, 7, 1, -4, 3, -5, -6, -16, 3, -2, 1, -1, -2, 0, -9,
+    0, -2, 9, 1, -2, 1, -2, 3, -1, -8, 1, -15, 8, 3, -4, -21,
+    11, -9, 3, -2, 3, 7, 5, -2, -30, -11, 3, 4, 2, -2, -7, 4,
+    -2, 1, 3, 6, -4, -1, -5, 8, -8, -5, -2, -4, -6, 1, 1, -24,
+    -9, -6, 7, -7, 7, 5, -12, -4, 2, -4, 4, -12, 13, -2, -15, -9,
+    -6, -42, -3, -15, 13, -11, -3, -6, -4, -6, -9, -11, 6, 0, 11, -11,
+    -5, -2, 4, -5, 1, -2, 11, -7, 0, -9, 8, 7, 2, -9, 1, -18,
+    -3, -27, 5, -14, -6, -10, 2, -13, 2, -12, 9, 2, -1, -2, 2, -20,
+    8, -14, -19, -10, 4, -2, -3, -18, -14, 3, 2, 3, 10, 3, 1, -9,
+    -9, 35, 1, -9, 7, -5, -7, -6, 7, 6, 10, -2, -9, -3, 9, -16,
+    6, -7, 2, -12, 2, 7, 0, -5, 9, 3, -4, 1, -1, -4, 17, 9,
+    -2, 3, 0, -16, 16, 1, 2, 0, -2, 1, 1, 4, -5, 13, -2,
+  },
+  {
+    -2, 2, 2, -2, -8, 0, -1, -4, -3, 9, -3, 1, 2, 1, 1, -7,
+    -3, 8, -1, -3, -16, -4, -3, 3, 3, -1, 6, 4, -8, 1, 5, -11,
+    -4, -6, -7, 2, -5, 1, 1, 1, 3, 26, -4, -9, -4, 1, -1, -1,
+    -10, 8, 2, -2, -2, -5, -6, 0, -1, -4, 1, -5, -2, 5, 2, -18,
+    -5, -2, -6, 3, 0, -10, 2, 1, -5, 3, 9, 1, 1, -5, 3, -9,
+    -4, -10, 4, -2, 37, -3, -11, -13, -5, -10, 2, -2, -2, -1, 5, -3,
+    -9, -1, 2, 1, 8, 1, -7, 3, 2, -6, 2, -1, -1, -15, 8, 8,
+    3, -5, -5, -1, -2, 1, 2, 8, 2, -1, -4, 5, 9, -5, 7, -21,
+    2, -11, 4, -12, 1, -3, -7, 4, -14, -18, 6, 9, 3, 9, -10, 17,
+    8, 2, -7, -10, 6, -2, 7, 2, 4, -2, 1, -4, 3, 7, 16, -10,
+    -8, -1, 24, -10, -1, 2, 5, 0, 4, 3, -50, -7, -6, -4, 0, 16,
+    -3, -6, 2, -11, -7, 0, 0, 2, -3, -5, 7, 4, -2, -7, -6, 7,
+    2, 1, 0, -8, 8, 3, 9, -6, 5, -1, 1, 2, 5, 7, -1, -13,
+    10, -1, -12, 8, 2, 2, 2, -8, 3, 0, -5, 20, 4, -3, 9, -2,
+    12, -5, 3, -9, -2, -4, 5, -5, -13, -12, 11, 3, 12, 4, 2, -1,
+    13, -3, -3, 6, 11, 3, -3, -3, 10, 8, 8, -5, 3, -2, 8,
+  },
+  {
+    -11, -14, 0, -23, 2, 1, 0, -20, 1, 0, 3, 2, -4, -8, -3, -29,
+    -2, -3, 1, 0, -11, -5, -11, 0, -5, -9, 1, -8, 1, 7, -7, -30,
+    -4, -9, -10, -7, -8, 8, 13, -12, -1, 9, -1, -3, -7, -19, 2, -2,
+    -8, 9, 5, -21, -2, -6, 3, -21, -5, -4, 0, 1, 5, -11, -2, -50,
+    13, -11, -10, -17, -8, -24, -3, -8, -3, -4, -3, -1, 26, -5, 14, -18,
+    0, -3, -3, -11, -20, 1, 2, -7, 4, 1, -8, 5, 8, -8, 9, -3,
+    -5, -15, 8, -6, 1, 9, -7, -27, -5, -3, 4, 7, 2, -5, 2, -21,
+    -5, -10, 3, -2, 4, 2, 1, -3, 2, -3, -7, -13, -7, -1, -4, -64,
+    -5, -13, -20, -1, 2, -11, 4, -16, -5, -5, -13, -30, 10, 2, 5, -16,
+    -6, 1, -6, -17, 4, 4, 13, -5, -4, -15, 18, -5, -1, 5, -20, -28,
+    -4, -8, -4, -4, -5, -26, -1, -10, 1, 19, -16, 5, 13, 9, 12, -12,
+    5, -4, 1, -8, -11, -4, 3, -27, -7, 4, -7, -10, 3, -12, -10, -9,
+    -11, -1, 1, -24, 5, -8, -5, 0, 19, -13, -8, 3, -7, -7, 6, -21,
+    -6, 2, 11, -7, 13, -3, -11, 9, -7, -2, -8, 13, 1, -5, 1, -30,
+    10, -5, 12, -21, 6, -1, 12, 1, -7, 4, 2, -8, -7, -4, -3, -6,
+    -10, 2, 14, -3, 1, 6, 1, 15, 6, -5, 16, 0, -11, 7, 1,
+  },
+  {
+    -2, -2, 1, -3, 1, 1, 1, -9, 0, -4, 3, -3, -5, -2, -1, -14,
+    3, 3, 5, 1, -1, -5, 0, -1, 3, -1, 4, 0, 2, 6, -5, -14,
+    6, 7, 0, -7, -4, 0, 9, -4, -4, -5, -1, -4, 1, -3, 9, 4,
+    -3, -2, -4, -5, -2, -1, 1, -6, 3, 4, 1, 5, 0, 4, -2, -11,
+    -5, -5, 0, -1, 9, 4, -5, -9, 3, -11, 3, -3, -9, 0, 4, -9,
+    -5, -4, -4, -3, 3, 2, -3, -3, 10, -2, 5, -1, -6, -1, -10, -3,
+    0, -1, -1, 1, 2, -6, 5, 1, 4, -11, 1, -3, -3, 2, -1, 2,
+    -9, -8, 11, 3, -6, 3, 0, 3, -2, -5, -14, 7, -4, -2, -4, -8,
+    -1, -16, -4, -10, 3, 4, 1, -9, -4, -15, -5, -6, -6, 1, -10, -22,
+    10, 1, 3, -19, -10, 0, 1, -11, -6, 0, -1, -7, -6, 7, -5, -17,
+    7, -1, 3, -11, -7, -3, -11, -10, -1, -9, -10, -11, 1, -6, -9, -6,
+    1, 11, 8, -2, -1, 8, 10, -7, 15, -2, 2, 5, 7, 6, -4, -19,
+    2, 9, -16, -4, 7, 3, 0, 12, -1, -5, -6, -5, -12, 4, 6, -13,
+    -16, 8, -1, -3, 3, 13, 1, 7, 6, -21, 10, -6, 5, -19, -6, -14,
+    -5, 3, 5, -9, -4, -5, -13, -10, -7, -5, 0, 3, -14, 11, 2, 11,
+    5, 8, -2, -19, -4, 19, 10, -3, -15, -15, -1, 6, 1, 6, -6,
+  },
+  {
+    -7, -9, -1, -5, 2, 1, 0, 5, 7, -4, 0, -2, 4, 0, 5, -2,
+    -20, 0, 7, 3, 1, -3, 0, -4, 0, 4, 4, -2, 2, -2, -3, -18,
+    -12, -17, -7, -1, 2, 2, -22, -4, 2, -1, 1, 0, 2, 5, -3, -5,
+    0, 0, -4, -6, -6, -14, -8, 10, -3, 0, -5, 4, 2, -9, -3, -15,
+    0, -15, -12, -34, -3, 0, -6, -14, 3, -7, -1, -10, -20, -30, 4, -8,
+    -1, -1, -11, -5, 1, -4, 0, -12, -6, -4, -4, 3, 3, 8, 6, -11,
+    4, -7, 0, 4, -1, 9, 7, -10, 2, 1, 6, -10, -7, 22, -1, -11,
+    -6, -13, -2, 4, -9, -8, 3, 1, 3, 1, 0, -20, -2, 0, -5, -8,
+    2, 5, 1, -23, -12, 1, -9, -51, 9, -18, -14, -4, 12, 5, 0, -17,
+    4, 8, -10, -8, -3, -18, -5, -12, -2, 21, -14, -29, 7, 0, 1, -11,
+    -1, -3, -4, -15, -3, 13, -7, -6, 8, 9, -9, 1, -2, 3, -3, 8,
+    -6, -16, 11, -9, 13, -2, -3, -8, -2, -12, -5, 7, 17, -3, 3, 6,
+    12, 5, 11, -7, 7, -17, -1, 0, 6, 1, 1, -20, -1, 3, -14, -9,
+    -2, 8, -1, -8, -6, -2, -2, -18, -10, -15, -12, -4, 32, 6, 2, -4,
+    3, -1, -8, -18, -10, -9, 2, 5, -1, -6, -1, 9, 10, -6, 3, 4,
+    2, 11, 6, -15, -3, 3, -7, -15, 6, -10, -2, -16, 5, -5, 4,
+  },
+  {
+    -3, -3, 0, -3, -5, 1, 2, -7, 4, 1, 2, 2, 0, -2, -4, 1,
+    2, 2, 8, -4, 4, 0, -5, -2, 0, -7, 5, 1, 1, -4, 2, -5,
+    8, -9, 1, -1, -7, 4, -17, -5, -4, 1, 3, -2, -7, 6, -2, 4,
+    0, -5, -7, -2, 0, 1, 0, -7, -4, 3, -2, 10, -6, 0, -10, -21,
+    17, -12, -24, 8, 1, -3, -4, -1, 5, -9, -1, 7, -6, 4, 2, -3,
+    -5, 0, -3, -4, -4, 5, -18, -1, 6, -11, -1, -2, -8, -5, 2, 9,
+    -1, -14, -9, 2, -6, -1, 0, -3, 4, -4, -1, -10, 1, 5, 7, 3,
+    4, -2, -3, 0, -4, -6, 13, -6, 19, -12, -3, 3, 11, -12, 4, -29,
+    8, 0, -2, -26, -8, 32, 6, -1, 15, 1, -3, -2, 0, -5, -1, -2,
+    -8, 2, -6, -11, -2, -14, -5, -10, 4, 5, -1, 14, -26, -2, 10, -20,
+    -9, -4, 2, -5, 10, -5, -9, -1, 3, 8, 2, -3, -5, 4, 4, -5,
+    -4, -13, 3, -1, -5, -7, -1, 3, 0, -6, 6, 0, 8, 4, 3, -11,
+    -5, -8, -12, -9, -3, 1, 3, -11, 6, 3, -5, 2, 4, 4, 15, 2,
+    -4, -2, -4, -12, -1, -4, 2, 6, -4, 0, -5, 1, 0, -1, 5, -2,
+    -3, -3, 2, -7, -3, -10, 0, -13, -4, -6, 8, 2, -8, 6, -2, -1,
+    5, 8, 26, -1, 0, -8, 7, -2, -1, -4, 13, -28, 10, -3, -5,
+  },
+  {
+    -2, -2, 4, -7, -3, -2, -4, -13, 1, -11, -1, -2, 3, -11, -5, -10,
+    1, 1, -4, -17, -3, -1, 6, -2, -3, 0, 10, 17, 4, -6, 0, -12,
+    2, -4, 6, -6, -6, 0, 8, -2, 4, -4, -1, 8, 2, -1, -9, -8,
+    6, 5, -2, -3, 3, -11, -6, -3, 27, -1, 2, 7, -4, -2, 3, -28,
+    -14, -5, -4, 1, 14, 5, 2, -7, 0, -7, 2, -2, -6, 3, -4, -23,
+    -36, -1, 6, -10, -5, -6, 5, -1, 15, -6, 0, 3, -5, 13, 5, -10,
+    -1, -3, 0, -1, 9, 3, 5, -1, 2, -3, -4, 13, 7, -21, -2, -5,
+    8, 2, 40, 4, 0, -1, 3, 6, -4, -11, 7, -5, -8, -7, 8, -14,
+    -3, -7, 5, -11, -3, 15, 4, 5, 6, 14, -4, -15, -2, 5, -16, -17,
+    -11, -9, 0, -1, -2, 0, 10, 7, -9, 13, -14, 6, 4, -22, 10, -38,
+    1, -46, 16, 0, -5, -7, 7, 1, 7, -5, 3, 9, 14, -8, 3, -7,
+    -3, 4, -1, -5, -6, 1, 1, 0, 0, -6, 3, 11, -16, -6, 13, -20,
+    -1, -11, -6, -10, -1, -9, 7, 4, -1, -4, 13, 5, -4, 3, 15, -4,
+    -4, 16, 3, -12, 5, 4, 2, -1, -5, 6, -4, 28, -6, -14, -5, -10,
+    8, -1, 2, -6, -2, -4, -53, -3, -9, -7, -6, -7, 1, 1, -1, -12,
+    -3, 24, 23, 12, 9, -3, 13, 1, -9, -9, -1, -2, -13, 3, 9,
+  },
+  {
+    -1, -4, -4, 0, 1, -7, 0, -7, -6, -1, -2, -5, 1, 0, 1, -10,
+    1, 13, 4, -1, -8, -7, -2, 13, -4, 0, -4, 0, 1, 1, 4, -12,
+    0, -2, 5, 1, -19, 1, 10, -12, -3, -6, 7, -6, -10, 5, 2, 0,
+    21, -6, -5, -6, 1, -2, 2, -1, -3, 7, 3, -2, -5, -6, 4, -17,
+    2, -6, 8, 0, 1, -8, 2, -4, -3, 20, -2, -3, -1, -7, 9, -15,
+    9, -10, -1, -8, 7, 1, 0, -8, 1, -7, 1, -3, -12, 1, -3, 3,
+    6, -6, 22, -6, 8, -6, -1, 5, 2, -7, 0, 12, -4, -1, 5, -9,
+    -4, -2, 1, -1, -3, 5, -5, -2, 4, -7, 1, 6, 1, -5, -2, -12,
+    -6, -25, -1, -16, 12, -5, 15, 6, 3, -9, 14, 1, 10, -1, -7, 0,
+    3, 14, -8, -9, 35, 27, 0, -10, -3, 9, -7, 0, 15, -4, 13, -7,
+    6, -16, -1, -9, 3, 3, -5, 6, 2, 1, -7, -4, 1, 12, -7, 2,
+    5, -11, -18, -12, -4, 0, -7, -2, 2, 0, -4, -2, 4, -5, 0, -4,
+    9, 4, -6, 4, -4, -2, -28, -27, -4, 0, 10, 5, -1, -3, 16, -14,
+    4, 8, -3, 1, -3, -5, -5, 5, -2, -3, 4, 3, 0, 13, -3, -7,
+    -8, -1, -3, -11, 13, -1, -3, 1, -1, -3, 6, -8, -8, 3, -2, -6,
+    -13, 1, -1, -9, 4, 10, -1, -16, 0, -6, -1, 0, -7, -9, 6,
+  },
+  {
+    -1, -3, 2, -7, -1, 1, 3, -6, 0, -3, 2, 3, -2, -3, 1, -10,
+    8, 2, 1, -5, 2, 2, 0, -1, 6, 4, 0, 3, 2, -1, -5, 5,
+    0, 5, -1, 0, -1, 6, -1, -7, -3, -6, -8, -2, 4, 5, 4, 1,
+    3, -4, -10, -3, -2, 5, -2, 4, 7, -8, 4, -3, -5, -13, 0, -12,
+    -27, -18, 0, -19, 0, -21, 12, -8, 3, -10, -2, -6, -14, -4, 3, -13,
+    2, -6, 1, -8, -2, 11, -7, 0, 0, 3, -6, 10, -9, 5, -3, -7,
+    -3, -7, -9, 14, 3, -7, 0, -15, -2, -9, 4, 3, -6, -6, 4, -11,
+    5, 3, 15, -2, -1, -6, 2, -1, -1, -2, 5, -9, -7, -11, -6, -26,
+    -2, -34, 4, -20, 0, 4, 12, -5, -4, -10, -8, -20, 7, 2, 6, -4,
+    2, -6, 0, -18, -1, -2, 4, -3, 5, -19, -4, 5, -7, 7, -6, -22,
+    15, -1, -1, -8, 8, -1, -2, -7, 1, -4, 1, 0, -11, -5, -5, -15,
+    -2, 6, 1, -3, 10, 29, -4, 8, 12, 4, -11, 0, -2, 2, 8, 10,
+    10, 1, 4, -8, 7, -22, -7, 11, 1, 1, -16, -3, -9, 6, 24, -1,
+    -12, -2, -2, -6, 7, -9, 5, -8, -6, -4, -6, 9, -11, -14, 2, 8,
+    1, 10, -16, -9, 1, 3, -14, 1, -4, -2, 1, 1, 5, 2, 1, -2,
+    -17, 13, 16, -1, -7, 11, 0, -3, -3, -2, -1, -4, 10, 10, -1,
+  },
+  {
+    -1, -2, -2, -4, 0, -2, 0, -4, 0, -1, 1, 5, -2, 1, -1, -9,
+    0, -2, -1, -1, 1, 1, 1, 0, 8, 4, -5, -1, 2, 1, 0, -13,
+    -3, 1, -12, 1, -6, -1, 2, -1, 4, -4, -1, 11, 2, 1, 5, -2,
+    2, 0, 9, -1, -3, 1, 0, -8, -9, 1, 11, 2, -8, 0, -1, -20,
+    16, 1, 4, -2, 2, -10, 5, -12, 0, -2, 1, 0, 3, -5, 10, 3,
+    -8, -7, -10, 1, 5, -5, -5, -8, 9, -1, 1, -7, 0, -9, -11, -4,
+    -1, -14, -10, -6, -3, -1, -16, -8, -4, -4, -5, 0, -3, 5, 4, 8,
+    2, -5, -3, -2, -1, 8, -7, 5, -2, -17, -4, -1, 0, 7, -2, -23,
+    3, 10, 8, -4, -13, 8, 13, -6, -7, 10, 4, -13, -2, 1, 17, 14,
+    3, 4, -6, -4, 5, -9, 1, -5, -4, -4, -1, 2, 5, -16, 0, 7,
+    13, 4, 5, -9, 3, 9, 2, -8, 7, 10, -3, -9, 2, -3, 5, -4,
+    0, -6, -9, -14, -12, 3, 3, -4, 5, 10, -11, -11, -22, -18, 5, -4,
+    7, -6, -4, -16, -8, -5, -10, 3, 4, 5, 5, -1, 5, -31, -3, 3,
+    -9, 5, 2, -10, -12, 3, 2, -7, -1, 10, -6, -4, -12, 15, -3, -2,
+    -6, 10, 3, -8, -15, -3, 4, -3, 1, -19, -9, 0, -5, 21, 2, -5,
+    7, -11, 2, -22, -1, 2, 1, 1, -4, -1, -2, -3, -4, 6, 4,
+  },
+  {
+    -3, -6, 2, -10, 2, -1, -3, -14, -3, -1, 4, -1, 0, -1, -1, -19,
+    -4, 5, -1, 0, -2, 4, -5, -2, -4, -1, 1, 7, 1, -4, -3, -31,
+    -10, -4, -3, -2, 1, -4, -2, -8, -1, 6, -2, 2, -6, 15, -6, 2,
+    -3, -9, 4, 0, 2, -1, 0, -9, 13, 5, -2, 7, -2, -8, 3, -32,
+    -2, -10, 2, -7, -12, -5, -8, 4, -10, -15, 4, 7, 1, -3, 4, -7,
+    1, -10, -2, -5, 1, 9, -3, -11, 3, -11, 6, 3, 19, -4, -1, -2,
+    -1, 5, 13, 7, -2, 1, 2, 0, 8, 0, -5, 9, 7, -3, 5, -9,
+    -2, -3, 25, -6, 12, -7, 6, 0, -3, -3, 5, 8, 8, -6, 7, -18,
+    16, 4, -4, 3, -13, 16, 7, 7, 11, 2, -3, 1, -3, -3, 8, -1,
+    -5, -5, 1, -7, -7, 3, -14, -6, -17, -3, 10, 1, 2, -12, -3, -15,
+    -2, 1, 16, -7, 9, -6, -5, -16, 11, -3, -9, -9, 3, 11, 8, -7,
+    14, -10, 2, 4, -8, 1, 2, -10, -10, 4, 22, 11, 1, 3, 3, -8,
+    -2, 7, -2, -3, 3, 15, 3, 3, 5, -7, -3, -9, -2, -3, -3, -5,
+    -5, -9, 16, -11, -4, -14, 11, 5, 10, 1, 3, -5, 2, 0, 11, -5,
+    -3, -3, -1, -8, -6, 5, -27, 15, -2, -7, -10, 14, -2, -10, -10, -10,
+    1, 16, -5, -10, -8, 13, -2, -3, 1, 5, -11, -1, 15, -6, 12,
+  },
+  {
+    0, -2, 0, -4, -1, -3, -6, -10, 1, 0, 0, 4, -3, 5, -1, -3,
+    -2, -2, 6, 1, 9, 5, -6, -1, 8, 0, 4, -2, -9, -1, 4, -12,
+    -2, -6, -5, -5, -4, -4, -10, -6, -3, -3, -7, 2, -7, 2, -1, -1,
+    -3, 3, 9, -6, -6, 2, 1, 4, -6, -9, 7, -4, 0, 2, -10, -18,
+    4, -8, -2, -3, 10, -1, -3, -7, -3, -8, 0, -5, -4, -13, -1, -6,
+    0, 0, 4, -3, -1, -12, -2, 5, -2, -2, -3, -1, 1, 0, -2, 4,
+    -1, -3, 3, -2, -3, 6, 22, -9, 3, 9, 3, -3, 7, 3, 1, 5,
+    5, -1, -6, 13, 15, 10, 8, 10, 0, -7, 3, -3, -3, 3, -5, -14,
+    -3, -8, 12, -4, -6, -4, 9, 4, 6, -6, 4, -8, -16, 1, -6, -4,
+    -14, 7, -3, -14, 9, 5, -9, -8, 0, 2, 0, -18, -9, -4, -7, -2,
+    -2, 10, 5, -18, -9, 1, -18, -11, 1, 2, 0, 11, -5, -6, -10, -1,
+    6, -6, 0, -7, 6, 0, 10, 6, -1, 5, -5, 9, 3, 6, -5, -11,
+    5, -6, 6, -14, 10, -7, 0, -4, 3, -11, -8, -2, 5, 2, -23, 23,
+    10, 0, 4, -15, 6, 6, 3, -9, 1, -1, 5, 11, -8, 6, 1, 1,
+    11, -10, -4, -1, 11, 1, -6, -12, -20, 1, -11, 7, 6, 11, -14, -5,
+    11, -5, 2, -9, 3, -4, 3, -2, -6, 6, 0, -9, 10, -6, 6,
+  },
+  {
+    -1, -3, 1, -6, 2, -1, 3, -11, 2, -2, 7, 3, -1, -3, 0, -13,
+    3, 2, 5, -4, -5, 6, 9, 3, -6, 0, 3, 2, -1, 6, 6, -23,
+    0, -4, 3, 2, 0, -1, 1, -7, -5, 0, -1, 7, -2, -1, 24, 2,
+    -4, -11, -4, 5, -4, -4, -4, -3, -4, 6, 0, -2, 7, -4, 1, 2,
+    -12, -9, 10, -7, -2, -7, 10, -1, -1, 0, 6, -5, 3, 0, -3, -7,
+    -6, -3, 6, 4, 5, -3, -4, -5, -5, -3, -1, 0, -5, 0, 22, -11,
+    1, -7, -5, -17, -3, 8, -3, -2, 5, 1, -14, -1, 5, -9, 6, -4,
+    5, -13, 8, -3, 5, 7, -4, -1, -7, -3, 23, -2, 5, -9, -9, -25,
+    39, -7, -9, -23, -7, -1, -11, 9, 3, 5, -7, -2, 2, 2, 20, 0,
+    -4, 4, 7, -6, -2, 0, 11, -7, -2, -9, -8, -10, -3, 1, -1, -6,
+    3, 9, -2, -12, -4, -1, -3, -4, -11, 7, 11, -6, -5, -9, 5, -4,
+    3, -8, 6, -12, 3, 12, -10, 4, -11, 2, 9, 0, -8, -3, -26, -2,
+    13, -3, 3, -9, -1, 7, 3, -3, -2, -2, -2, -7, -11, -12, -3, 6,
+    4, 12, -2, -17, -14, 3, -6, 3, 7, -8, -5, 9, -5, -2, -10, -17,
+    -6, -10, -8, -3, 9, -3, -13, 8, 0, 3, -23, -6, 11, -3, -11, -6,
+    2, -6, -3, -7, -3, 0, 8, -16, 2, 13, 11, -23, 13, -12, 5,
+  },
+  {
+    -1, -1, 2, 2, -6, -3, -5, -4, 5, 0, 1, 0, -3, 0, 0, -12,
+    -2, 1, -5, 10, -2, 1, -5, 2, -1, 4, -2, 8, -11, 2, -4, -12,
+    -5, -3, 0, 3, 6, -17, -9, -3, -19, 0, 4, -12, 0, -9, -5, 3,
+    -2, 4, -9, -1, 1, 1, -4, -3, 0, 13, -7, -1, -2, -1, -1, -19,
+    -6, -9, 3, 1, -2, 2, -4, -2, 12, -11, -9, -21, -8, -1, -10, -9,
+    -4, -31, -4, -8, -4, 0, 3, -8, -1, 0, -9, -5, 2, -6, -3, -3,
+    -2, -13, -3, -3, -4, -13, 2, -1, 2, -4, -16, 4, -5, 6, 5, -2,
+    1, -8, -18, 2, 6, -2, 4, 0, -1, -7, -15, -12, -5, 3, -5, -15,
+    5, -1, 2, -8, -12, 10, 7, 2, 7, 4, -5, 0, 1, 8, -2, 0,
+    2, 9, -6, -4, -6, 6, -2, 42, 2, -7, 8, 2, -8, -5, -9, -7,
+    0, 12, 0, 28, 4, -5, -7, 16, 10, -15, -5, -2, -6, 7, 26, 4,
+    -8, -14, 3, -12, 12, 6, -3, -20, -8, -9, 2, -3, 1, 3, -3, -12,
+    -9, -15, 5, -14, -4, -7, -8, -5, 9, 2, 6, 10, -12, 1, -2, -6,
+    5, 2, 2, -10, 7, -11, 3, 0, -1, -9, 2, -2, 1, 7, 4, 11,
+    -3, -12, 7, -22, 8, -30, -1, -3, 9, -2, -19, -1, -6, 3, 4, -16,
+    3, -2, -7, -12, -2, 3, -8, -5, 4, 2, 8, -9, -2, 10, -1,
+  },
+  {
+    -2, 0, -1, -4, -6, 1, 2, 0, -4, 8, 0, 0, 3, -3, 2, -8,
+    -3, 2, 1, -2, -12, -1, -4, -1, -4, -2, -4, 5, -3, -6, -2, -9,
+    -5, 1, -2, -7, 2, -1, 1, -4, -4, 17, 1, 1, 3, 1, 3, 5,
+    -3, -2, 5, 1, -1, 0, -3, -4, 7, 2, -2, -4, 2, 2, -9, -20,
+    -3, -6, 0, -1, 3, -2, 5, 7, -1, -14, -5, -3, 6, -4, -4, 0,
+    0, -1, -6, 0, -27, 4, -9, 1, -2, -4, -2, -3, -1, 6, -7, 6,
+    4, -6, -2, 5, 8, -1, 1, 1, 5, -3, 3, -12, 13, 2, -3, 0,
+    9, -2, 15, -5, -2, 0, 7, 10, 5, -6, -20, -7, 11, 6, 2, -22,
+    14, -7, -18, -16, -13, -3, 1, -4, 8, 11, -11, -9, 7, 0, -1, -2,
+    5, 4, -10, -13, -7, 6, 4, -2, -6, -1, 4, -6, -2, -8, -3, -14,
+    3, -1, 0, -7, 6, -15, 6, 9, 3, 42, -1, 7, 2, -12, -1, -4,
+    -7, -1, 2, -10, -3, 4, -3, -8, 1, 1, -4, 14, -2, -6, 1, -2,
+    -2, -20, -13, -7, 4, -4, 13, -18, -1, -3, 5, 6, -1, -10, -16, -6,
+    0, -11, -23, -12, 6, -4, -2, -12, 5, -4, -24, -2, -5, 6, -8, -10,
+    8, -6, -5, 7, 0, -6, -23, 4, -10, -9, -10, -1, 13, 7, 3, -3,
+    -7, 0, 0, -9, -3, 2, -2, 3, 3, -12, 5, -7, -3, -7, 3,
+  },
+  {
+    -3, 2, -2, 1, 2, -2, 0, -9, 4, -9, 2, -1, 1, 1, -3, -2,
+    1, -1, 7, -10, 6, 2, -2, 1, -5, -3, 2, 4, -3, 3, 0, -16,
+    -2, -5, -3, -8, 0, -2, 5, 18, 1, 2, -3, -1, -2, 9, -8, 5,
+    0, -3, 3, 9, -5, -1, -4, 2, -3, 5, -1, -1, -5, -4, -5, -15,
+    -5, -4, 12, -2, -6, 5, 1, -15, -2, -2, 0, -4, 0, 5, -4, 1,
+    -23, -12, -10, 2, -7, 1, 1, -1, 4, -9, -12, -4, 16, -4, -3, 5,
+    -12, -5, 16, -10, -15, 1, 5, -4, -9, -6, -5, 4, 6, 1, 5, -8,
+    -4, -1, -3, -4, -5, -5, -2, 2, -3, -3, -7, 0, -2, 7, 0, -14,
+    -4, -6, -8, -11, -2, 8, 1, 3, 7, 8, 10, 0, -5, 1, -10, -3,
+    -9, -5, -9, -13, -12, 3, -2, -22, 0, 1, -2, -1, -2, -11, 22, -9,
+    -2, 38, -4, -18, -1, 2, 12, 0, 8, -6, -4, -2, 8, 3, -6, -8,
+    -4, -11, 16, -4, -10, -12, -9, -2, -1, 15, -30, -12, -12, -2, -1, 4,
+    4, 16, -15, -9, -1, -14, 13, 20, -11, 14, 7, 3, 8, -2, -2, 3,
+    -6, -10, -3, -9, 4, -7, 1, 0, 3, 2, -3, -1, 3, 5, 10, -13,
+    -6, -10, 3, -12, 0, -21, 3, 3, 6, 6, -2, 2, 9, -8, 5, 1,
+    -14, 4, -3, -13, 6, 10, -7, -8, 7, 4, 6, 1, 12, -17, -14,
+  },
+  {
+    -2, -1, -2, -4, -3, 2, 2, -2, -2, -10, 5, -3, -2, 0, -2, -6,
+    -6, 0, 2, -12, 0, 0, -2, 0, 4, 0, -1, 3, -4, 4, -7, -5,
+    -7, -7, -1, 4, -1, -4, -6, -18, 1, 0, 4, 5, -6, 2, -9, -1,
+    4, 7, 6, -2, 0, 2, -4, -3, -2, 5, -1, -4, -9, 2, -2, -18,
+    -4, -15, -8, -14, -1, 3, 7, -8, 1, 2, -4, 0, 4, -9, -5, 25,
+    0, 0, -1, -5, -8, 8, -11, -6, 8, -8, 5, 1, -18, -3, 0, -2,
+    -19, -9, -1, 3, -11, 1, -3, -10, 4, -7, 0, 7, -1, 13, -4, -4,
+    5, -10, -3, -2, -8, -3, 3, -6, 4, 8, 7, -4, 2, 3, 1, -14,
+    12, -8, -3, -22, 9, -6, 4, 28, 2, -5, 2, -16, -12, -6, 10, 8,
+    5, 11, -9, -11, -3, 9, -3, 7, 5, -5, -2, 18, -17, 8, -3, -1,
+    34, -2, -5, -13, 11, -10, -5, 6, -10, 14, -10, -3, -13, -2, 1, 0,
+    -7, -9, 3, -12, 2, -17, -5, 1, 3, 20, 7, 5, -7, 9, 14, -2,
+    -1, -4, -17, -5, -6, -4, 7, -6, -5, 6, -4, -7, 0, -1, -10, -15,
+    -6, -5, 6, -8, 2, -9, -11, 0, -9, -8, -15, -9, -17, -7, 0, -16,
+    -1, 4, -15, -4, -3, 7, -6, -4, 21, 7, 0, 5, -8, 0, -7, -1,
+    -9, 17, 10, -13, 9, 0, 5, -8, -4, -14, -6, 7, -7, -2, -3,
+  },
+  {
+    -2, 0, -2, -3, -3, 1, 0, -9, -1, -2, -3, -3, -3, -1, -1, 3,
+    0, -3, -2, -1, -1, 4, 1, -1, -1, 4, 0, -2, 2, -1, 1, -9,
+    5, 0, 4, 6, -2, -1, 6, 6, -8, 9, 6, -3, -10, 2, 9, 1,
+    2, 8, 0, -2, -2, 1, 2, -2, -3, 0, -5, 2, -9, -1, -6, -25,
+    -3, -2, 6, 0, 5, 3, 0, -8, 10, -10, -5, -3, -12, -4, -1, 2,
+    -7, -15, 0, 0, -9, 7, 10, 8, -6, 0, 0, -9, -2, -2, -6, -1,
+    2, -7, 2, 7, 11, -5, -3, -1, 3, -7, 13, -5, -1, -3, -8, -12,
+    -5, 0, -1, -9, -5, 2, 1, -12, -5, -7, 10, 4, 3, 8, -3, -19,
+    -1, 1, -3, -15, -28, -2, -16, -9, 10, 2, 4, -5, 3, 10, 10, -6,
+    -3, 10, 15, -18, 8, -10, 10, -11, 7, -1, 5, 3, -14, 6, 8, -17,
+    -14, 18, 3, -18, 5, -14, -9, 0, 13, 9, 1, -1, 2, 12, 8, 0,
+    7, -8, -6, -9, -9, -6, 9, -7, 16, 5, -7, -8, -3, -7, -14, -5,
+    -3, 0, 13, -16, 1, -2, -13, -4, 2, -15, 10, -15, -4, -4, -2, -6,
+    -2, -6, -15, -6, 11, -9, 24, 7, -6, 2, -5, 5, -3, -5, -8, -13,
+    0, -5, -9, -18, 0, -1, 9, -6, -7, 3, 1, -12, 1, -9, 3, 4,
+    3, -1, -7, -6, -13, 7, -20, 6, 3, 1, -7, 0, 3, 3, 15,
+  },
+  {
+    -3, -10, -4, -5, -2, 2, 1, -13, 0, -5, 0, -3, -11, -7, -3, -16,
+    3, 2, 0, -6, 0, 1, -3, -8, -9, -17, -3, -3, 0, -1, -3, -19,
+    1, 1, 2, -12, -15, 6, 7, -4, 1, -3, -1, 0, -3, -5, 3, -3,
+    0, 12, 2, 10, 2, 0, -7, -9, -1, 1, -4, -5, -3, -5, -7, -29,
+    5, 0, -9, 3, 3, -8, 7, -1, 0, -5, 0, -4, -6, -2, 20, 4,
+    1, -5, -10, -6, 0, 1, -6, 0, 4, -10, 4, -9, 6, 5, -9, -18,
+    8, -11, 3, -1, 18, -1, 1, -12, -27, -6, 13, -1, -12, 4, 2, -9,
+    6, -6, 8, 1, 10, 0, -6, -3, 5, 9, -2, -2, 0, -4, -3, -37,
+    -14, 7, 16, -10, 6, -13, -2, -19, 15, -5, -7, -12, -5, -1, 12, 1,
+    19, -4, -8, 2, 7, -4, 6, -7, 6, 7, 8, -7, 0, -6, -21, -15,
+    26, 16, 6, -10, -9, -7, -7, 1, -2, -2, 11, 0, -7, -11, 10, -14,
+    5, 6, -4, -15, 1, 4, 1, -1, -2, 2, -5, -8, -2, 2, -7, -11,
+    -4, 7, -18, -14, 15, -6, 10, -12, -7, -3, 33, 1, 4, -2, -4, -17,
+    -6, 37, -8, -10, 0, 8, -26, 1, -9, 4, 11, -11, 5, 1, 0, 11,
+    -1, 11, 7, -19, 2, 7, -14, 2, 0, -9, 18, -4, -16, -8, -12, -1,
+    -4, -1, 6, -19, 13, -9, -7, -5, -8, 3, 2, 1, -2, 0, 1,
+  },
+  {
+    -2, -3, 0, -2, 0, -2, 1, -6, 4, 0, 5, 3, -3, 1, -1, -11,
+    -3, -2, -5, -3, 0, 5, -8, -1, 2, -2, 2, 0, 5, 0, -2, -13,
+    -3, 0, -4, 1, -4, -6, -9, 2, -5, -7, -9, -1, -1, -7, 1, 3,
+    -1, 6, 6, 9, -5, 0, 0, -1, -4, 1, -4, 4, 2, -3, -1, -21,
+    -2, -5, -6, -2, -5, 1, -2, -5, 12, 5, -15, -4, 1, 8, 0, -8,
+    1, -5, -2, 5, 4, 5, 2, 14, -4, 0, -5, -5, -2, -2, -5, 6,
+    -2, 0, 1, 0, -8, -3, 16, -3, 3, -4, -7, -3, 3, -8, -6, 2,
+    3, 2, 2, 3, -3, -9, 0, 5, 2, -7, -6, 10, -4, 8, 1, -20,
+    8, -5, 6, -2, 16, -6, 9, 2, -6, -1, -8, 0, 7, 6, 5, -3,
+    4, 19, 8, -11, 14, 14, -5, -14, -2, -11, 1, -7, -4, -3, 5, 1,
+    1, -3, -10, -6, 1, -1, -1, -3, 2, 2, 7, 2, 23, -10, 8, 8,
+    6, -9, 1, -11, 0, 7, -2, 11, -13, 16, 6, -3, -11, 10, -4, -6,
+    11, 1, 18, -17, 1, -14, -3, -10, 3, 0, -4, 6, -8, -11, -17, -7,
+    5, 6, 2, -15, 6, -3, -10, 0, -3, -1, -2, -7, -1, -2, -2, -2,
+    -2, -1, -5, -2, 5, 3, 7, 0, 4, 5, -17, -9, -3, -4, -3, 5,
+    -13, 2, 1, 2, -3, 8, 6, 9, 7, -13, 8, 2, 0, 2, 6,
+  },
+  {
+    -2, -1, 2, 0, 0, -1, 2, -3, 3, 1, 2, -2, -3, -2, 4, -7,
+    -3, 5, -4, -1, 9, 2, -1, 3, -2, 2, 0, -1, 0, 0, 1, -8,
+    -1, -1, 0, -6, 0, 0, 0, -3, -4, 2, 2, -5, -1, -4, 7, -2,
+    -10, -7, -1, 0, -3, -4, -6, -10, -1, -6, 1, 3, -7, 0, -1, -21,
+    -1, 3, -5, -10, 3, 0, -12, -9, -1, -12, -14, -5, -11, -4, -4, 4,
+    7, -4, 2, -4, -2, 14, 13, -1, 3, 0, -4, -4, 7, -2, 9, -7,
+    2, 1, -6, -6, 0, 2, 2, -4, -2, -2, 3, 2, 2, 3, -7, 1,
+    2, -12, 4, -2, 1, -6, -4, 4, -4, -2, -13, 5, -2, -7, 5, -33,
+    9, 11, -8, -10, -2, 3, -2, -19, -2, -4, -4, 2, 3, 5, 0, 3,
+    2, -16, -5, -11, 9, -11, 18, -9, -6, -15, -12, 1, 12, 6, 4, -10,
+    12, 2, 0, -2, 1, 5, -6, 4, 15, -10, 2, 6, 13, -7, 24, -1,
+    -5, 0, -3, -15, -4, -3, -1, 11, -1, -9, 1, -6, -4, -10, -7, -14,
+    -1, 2, -8, -9, 4, 1, 11, 11, -2, 1, 18, -5, -13, -3, 4, -5,
+    6, -12, -5, -7, 2, -6, -3, 7, -4, 1, 0, 9, -7, 2, -5, 1,
+    5, 2, 2, -5, -1, 3, 2, -4, -7, -3, 18, -2, -7, -10, -1, -9,
+    3, 3, -7, -12, 13, 2, -9, 6, 3, 5, 2, -12, -5, -2, 9,
+  },
+  {
+    -2, 2, 0, -2, -7, 1, 0, -5, -1, -10, -1, -1, -1, 2, -1, -6,
+    -1, -2, -2, -13, -8, 4, 1, -7, 2, 2, 1, 6, -2, 0, -3, -8,
+    -2, 0, 2, -10, 6, 2, 3, -19, 1, -2, -5, -3, -7, -1, -4, 3,
+    -6, -6, -1, 1, 0, -5, 4, -1, -8, -3, 5, -2, -1, 2, -3, -22,
+    -6, 0, -1, 2, -3, 7, 4, -18, 8, 2, -2, -5, -17, 2, 6, -30,
+    -5, -6, -11, 9, -9, 2, 7, 4, 3, -7, -7, 2, -2, -7, -2, -1,
+    -2, -6, 8, -1, -7, -2, 0, -1, 4, -8, 5, 0, 1, -5, -14, -9,
+    -2, 7, -3, -2, 8, -5, 7, 4, 4, -8, -7, 5, 0, 1, 7, -20,
+    3, 12, -1, -1, 1, -2, -3, -22, -10, 1, 9, -6, 15, -3, 1, -17,
+    6, -6, 3, -12, 15, -1, -8, -1, 4, -4, 7, 5, 11, 9, 3, -42,
+    4, 21, -3, -9, -1, 3, -11, -8, 19, 2, -1, -9, 11, 2, 13, 2,
+    4, 12, 5, 0, 6, 10, 13, -13, 6, -12, -9, 15, -8, 4, 13, 9,
+    12, 4, -1, -7, -4, -8, 2, -7, -6, -4, -9, -1, -1, -7, 4, -2,
+    3, -8, 9, -9, -4, -7, 5, 2, 15, 4, -12, 6, -3, 15, 1, 5,
+    3, -4, -2, -11, -9, -16, 9, -1, 4, 0, 9, -2, -6, 9, -6, 3,
+    3, 0, 2, -10, 4, -4, 13, -3, 2, -1, 1, 16, -11, 1, -5,
+  },
+  {
+    -3, -2, -1, -1, -3, 0, -1, -9, 4, 4, 0, -4, -2, -4, 0, -11,
+    -3, -1, -3, 1, 1, 1, 0, -1, 1, 0, 4, 4, 0, -1, 0, -19,
+    1, 3, 2, -6, -6, -9, -1, -5, -7, 11, 3, -3, -4, 6, 4, -3,
+    2, -1, 1, -8, 2, -4, -7, -5, 4, -3, -1, 2, -4, -8, 0, -25,
+    13, 4, -5, -10, 3, 1, 11, -9, -2, -12, -3, -14, 3, 9, -1, -6,
+    6, -7, 5, 4, -4, -6, 3, -10, -1, -6, 1, 7, 8, -2, 0, 9,
+    -1, -20, 2, 5, 4, 1, 2, 4, 1, -11, 6, 3, 7, 4, -9, 2,
+    -1, -6, 7, 4, -11, -4, 1, 3, -2, 1, -3, -3, 1, -3, 1, -20,
+    7, -16, 6, -15, -1, 6, -9, -6, 0, 3, 7, 1, -8, 4, -20, 0,
+    -2, -1, 5, -17, 13, 2, -1, 11, -5, -3, -2, -4, 5, 1, -15, -21,
+    -3, 20, -3, -11, -5, 4, 8, 6, 10, -19, 3, -9, 11, -6, -2, -9,
+    12, -10, 11, -21, -7, -1, 2, -12, 4, -1, 6, -11, -8, 6, -11, 2,
+    4, -2, -8, -8, 2, -11, 8, 5, 11, -10, 7, 9, -1, -7, 11, -9,
+    -21, 0, 2, -20, -8, -4, -6, -25, 5, 3, -17, 1, 13, 6, 1, -10,
+    -1, -9, 12, -13, 16, -8, -5, -3, -10, -3, 2, 3, 2, 1, -13, -10,
+    -12, -2, -4, -18, 7, -10, 5, -5, -3, -4, 15, -1, -5, 9, 8,
+  },
+  {
+    0, -1, 0, -2, -1, 1, 0, -4, 0, 3, 1, -2, 4, -3, -2, -6,
+    -7, 2, -4, -2, -9, 1, -6, 5, 3, 8, 6, 3, 0, 0, 0, -11,
+    -3, -10, 2, -3, -5, -1, 0, 1, 1, -8, 2, -4, 2, -2, -1, -3,
+    0, -1, 8, -4, 5, -6, -11, -8, -6, -7, -2, -1, -2, 5, 5, -24,
+    5, -9, 4, -16, -1, -1, 8, -3, -2, -3, 0, -9, -5, -3, 5, 0,
+    9, 0, -1, 0, -5, 5, 7, 1, -10, -8, 16, -5, 2, -7, 2, 0,
+    3, -11, 4, 5, -3, -4, -5, -1, -5, 2, 4, 8, -3, -18, -5, 4,
+    0, -2, -8, 3, 5, 0, 4, -13, 5, -7, 7, -3, 0, 5, -2, -26,
+    -7, 11, 5, -8, 2, -5, -2, -6, -8, 3, 12, 8, -2, -9, 1, 6,
+    -11, -17, 8, 3, -5, -12, -6, -10, -8, 11, 2, 4, -7, -5, -3, -9,
+    -4, -7, -15, -29, 9, -6, -7, 1, -17, 6, -1, 5, 4, -5, -7, -3,
+    -8, 7, 2, -11, -10, -5, 4, -1, 6, 2, -5, 0, 4, 7, 0, -13,
+    4, 6, 5, -6, 9, -6, 2, 1, 3, 5, -4, -1, -5, 10, 13, -18,
+    14, 2, -5, -3, -8, -6, -5, -12, 5, -2, -5, -24, 3, -6, 14, -3,
+    -12, -2, -9, -13, 10, -9, 1, -7, -2, 7, -2, 7, 0, 2, 8, 4,
+    12, 1, 1, -7, 3, -12, -9, 2, 3, 2, -12, 4, 8, 3, -8,
+  },
+  {
+    1, -2, 0, 0, 0, -2, 1, -5, 0, 0, -2, -6, -2, -3, -6, -5,
+    -1, 0, -6, 1, 4, -3, -4, -2, 1, 2, 1, -1, -2, 8, -2, -14,
+    0, -1, -1, -5, -3, -8, -5, 3, 2, 4, -9, -6, -2, 3, -9, -7,
+    -11, 1, 0, 1, 3, -1, -3, 4, -1, -9, 3, -6, 4, 3, 0, -19,
+    -5, -8, -6, 11, 1, -4, -3, -8, 2, -6, -2, 9, -1, -4, 3, -4,
+    3, 2, -3, -3, -6, 4, -4, -11, -4, 1, -17, 0, 0, 5, -5, -11,
+    -2, -18, -6, -1, 0, -4, -2, -3, -4, 1, -10, 0, 6, 8, 4, 1,
+    11, -4, 2, 10, -1, -2, 2, -3, -4, 2, -21, -7, -2, -1, 4, -11,
+    -6, -3, 7, -9, 3, 4, 21, 0, 17, 6, 2, -15, 11, 7, -10, -10,
+    -8, 1, -17, 0, 6, -6, 7, 4, 4, -9, 7, -9, 11, 1, -2, -3,
+    -9, 0, -3, -16, -10, 0, -1, 6, 9, 10, 7, -9, -18, 4, 6, 6,
+    -3, 3, -1, 2, -2, 1, -4, -16, -6, -6, 2, 6, 5, 3, 0, -22,
+    -3, -4, 1, -5, -9, 1, 10, -6, 0, -1, 5, -2, 12, 5, 13, 7,
+    -4, -9, 0, -17, 10, -13, -2, -17, -9, -11, -2, 4, -22, -7, 1, -6,
+    -9, 6, -11, -7, -13, -6, -13, -12, 12, -2, -4, -5, 1, -6, -5, -6,
+    -14, 5, 7, -12, 1, 30, 9, -2, -14, -3, 1, 6, -12, -2, 3,
+  },
+  {
+    0, -1, 1, -1, 1, 1, 1, -2, -4, -1, 6, 2, 4, 4, 5, -9,
+    -1, -7, -4, 0, -1, 7, 8, 2, -7, -4, -3, 0, -3, -2, -8, -7,
+    -5, 1, 3, -15, -2, -5, 0, 0, -5, -5, 6, 1, 3, 1, -17, -2,
+    0, 10, -3, -1, -3, 14, 0, -4, -2, 10, -2, -10, -2, 13, 4, -9,
+    3, -16, -6, 9, -8, -2, -6, 15, -2, 4, 12, -9, 8, -8, 1, 2,
+    -6, 1, 16, 4, -5, -1, 9, -2, -3, 0, 8, -1, -9, -18, 1, 1,
+    -6, -5, -11, 2, 23, 3, 8, 2, 16, -10, 2, -2, -24, 9, -2, -5,
+    2, -4, -3, -1, 20, 5, 5, -4, 6, -6, -8, 8, -22, -5, -10, -27,
+    -8, 7, -1, -6, -3, 5, -5, -2, 17, 20, -16, -21, 3, 7, 1, -8,
+    25, -9, -9, -3, 12, 3, -5, -11, 0, 4, 6, 1, -11, 22, 8, -4,
+    6, -8, 2, -14, 4, -5, 8, -5, 22, -4, 5, -13, 3, -12, -24, 1,
+    0, 2, -15, -20, -4, 4, 5, 2, 1, 10, 11, -32, -1, -9, 5, -14,
+    8, 8, 2, -17, 0, 8, 5, -8, 1, -6, 30, 1, -5, 3, -7, -1,
+    -2, -1, 9, -4, 1, -2, 4, 2, 10, -37, -2, 6, -9, 0, 10, 7,
+    4, -2, -3, -10, -11, 10, -7, -13, 6, -3, -22, -4, 10, 4, -17, 3,
+    7, -12, 5, -6, -12, -19, -7, 2, -1, -25, 11, -1, -4, 8, -11,
+  },
+  {
+    -1, -1, 0, -2, 0, 0, -1, -5, -1, -2, -3, 0, 1, -3, 2, -12,
+    3, 4, 0, 4, -1, -1, -2, -1, 1, 1, 3, 4, 3, -2, 6, -16,
+    -6, 3, 3, -3, 2, -3, -6, -6, -8, 0, -1, 1, -2, 2, -2, -9,
+    -2, 3, -6, -2, -1, -2, -11, 9, 3, -1, 2, 1, 2, 2, -2, -31,
+    2, -2, 11, -1, 2, -5, 7, -9, -8, -12, -6, 1, -1, -6, 2, -5,
+    -2, -15, -1, -6, 2, -2, -7, -6, 0, 5, -7, -6, 3, 3, 3, -9,
+    -6, -7, -7, 2, 13, 2, 1, -5, 8, 2, 8, 3, 2, 7, -2, -12,
+    4, -10, 10, 4, -5, 2, 1, 2, 0, -2, 4, 1, 9, -5, -1, -31,
+    13, 3, -21, -4, -2, -8, 7, -12, 10, 0, 3, -5, -2, -1, 2, -13,
+    -10, -9, -4, -13, 0, 3, 10, 1, 5, -9, 7, -3, 2, -12, -5, -12,
+    -10, 0, 7, 9, 2, 4, -18, -4, 3, -6, 0, 3, -9, -4, 1, -16,
+    2, 0, -18, -15, -8, -6, -2, 5, 4, -1, 6, 2, -4, 1, 7, -3,
+    19, 8, 14, 0, 0, 1, -7, -9, -10, 12, -5, 6, -4, 4, 4, -9,
+    -2, 5, -12, -1, -11, 15, 16, 0, 5, 6, 6, 4, -15, 1, 0, 2,
+    7, -10, 6, -8, -1, 4, -18, -9, -6, 8, -6, -1, 5, -13, -7, 3,
+    9, 3, 7, -11, 4, 3, -1, -3, 5, -12, 2, -3, -3, -13, -6,
+  },
+  {
+    2, -2, -6, -1, 0, -4, 1, -8, 6, 4, -1, 15, 0, -2, 1, -11,
+    4, -1, 10, 1, 1, -3, -3, -1, 19, -3, 6, -2, -3, 2, 6, -7,
+    0, 1, -1, 0, -6, 0, -14, 0, -6, -5, 10, 5, -2, -2, 3, 6,
+    1, -8, -31, -5, 0, -6, -8, -9, 5, 5, -9, -3, -2, 2, 0, -5,
+    3, -4, 0, 9, 8, 0, 6, 0, -4, -7, -5, 0, -4, 25, -3, -5,
+    -3, 3, 2, -10, -4, 0, 0, 3, -11, -2, 7, -8, -1, -1, -3, 2,
+    -7, -7, 7, -5, 1, -42, -8, 1, -6, -1, 5, 6, -1, -25, -2, -11,
+    -10, -7, 0, -11, -1, -6, -5, 1, 0, 0, -4, 2, 4, -18, 7, -23,
+    -26, -6, 8, 7, -1, 4, 2, -4, -8, -1, -20, 7, 3, -4, -8, 9,
+    2, 10, 10, -23, 10, 1, -22, 15, 4, 3, -5, 9, 32, 12, -5, -3,
+    -3, -7, -7, -21, 8, -6, -4, 16, 6, -7, 2, 3, -12, -11, -2, -6,
+    8, 9, 0, -2, -1, 6, 3, -1, -1, 2, 2, -3, -4, 6, 16, -7,
+    -5, 3, -8, 0, -15, 22, -6, -1, 9, 1, -4, 39, 12, -5, -11, 20,
+    -17, -2, 2, -5, 8, -6, -1, 2, -12, -7, -5, 28, -1, 2, -4, -20,
+    -1, 1, 0, -14, 4, -10, 9, 9, -3, 23, -11, -3, -2, 6, 0, -6,
+    15, 1, -1, -19, 19, -7, -9, 9, -8, 1, 4, 7, -12, 6, -14,
+  },
+  {
+    0, -2, -1, 0, -1, 0, -3, -4, -2, -2, -3, -2, -4, -8, 1, -8,
+    -2, 6, -5, 0, -1, 2, -2, 3, 5, 4, 1, 8, 1, 6, 2, -9,
+    1, 1, 0, -3, -13, 4, 2, -3, -1, -2, 3, 1, -9, -1, -3, 1,
+    -5, -2, -4, -3, -8, -2, 2, -2, -14, -2, -7, -6, -4, -1, -1, -23,
+    -4, -2, -5, -2, 2, -4, 4, -2, -8, -17, 7, 1, -9, -10, -2, -9,
+    2, -15, 0, 3, -9, -8, -6, -1, 8, 2, 4, -3, 4, 0, 1, -4,
+    -12, -1, -2, -6, -4, 12, 6, -9, 1, -11, 0, -6, -3, -4, 22, -9,
+    -2, 3, 16, -1, 8, -3, -4, -8, -3, -5, 1, -1, -2, -3, 9, -26,
+    5, 0, -7, 2, -3, -8, -1, 2, -3, -3, -3, 1, -4, -5, 2, -1,
+    -3, 1, 4, -24, 4, 3, 3, -5, -10, -16, 1, -2, -9, -5, -1, -10,
+    4, -16, 4, -8, 5, 16, 1, -5, -11, 4, 1, -11, -5, -7, -12, 7,
+    -1, 0, -16, -4, -5, 7, -5, -1, -2, -2, 7, 0, 11, -6, 2, -2,
+    -2, -4, 5, -7, -12, 21, 2, -4, 2, -5, 7, 4, -16, 1, 1, -4,
+    1, 9, -15, -11, -3, 4, 1, -3, -1, 1, 15, 1, 2, 2, 13, 0,
+    -6, -8, 2, 7, -23, 13, 1, -12, -6, -6, 10, -8, 9, 1, -7, -6,
+    -5, 5, 0, -16, 11, 3, -12, -7, 1, -1, 3, 2, 4, 2, -8,
+  },
+  {
+    0, -1, 2, 2, -1, -1, -3, -4, -5, -4, -2, 0, -3, 1, 1, -4,
+    4, 2, -2, 1, -3, -1, 0, -3, 0, -2, 3, 1, 5, 2, 2, -15,
+    3, -2, -3, -1, -3, -9, 0, -4, -4, 1, 7, -1, -3, 0, 1, 6,
+    -12, 1, 1, 6, 0, 2, 2, 6, -2, 1, 2, -2, -6, 0, 0, -21,
+    5, -10, -8, 7, -6, 4, 4, 1, 5, -8, -8, -11, 0, 0, 6, -19,
+    0, 10, -4, -11, -11, 6, 4, -12, 0, -5, 9, 1, -1, 2, -1, -9,
+    -8, -6, 1, 6, -1, -1, -4, -5, 2, -2, -6, 1, -2, -1, 4, -2,
+    10, -11, 0, -4, -9, -3, -10, -6, 2, -2, 5, 3, 0, -13, 1, -32,
+    -7, -3, 0, -6, -5, -6, 9, 3, -16, -3, -9, -4, -1, -8, -3, -3,
+    -3, 8, 9, -14, 2, 18, 12, 16, 4, -2, -2, 4, 4, -8, 1, -19,
+    -1, 2, 4, -3, 10, 12, 2, 5, -8, 5, 1, -12, -2, 6, 5, 13,
+    -23, 0, -10, -3, 2, 9, 8, 3, 7, 0, -12, -11, 4, 11, 4, -3,
+    14, -18, 17, 4, -2, 6, -14, -3, 10, 10, 4, -4, -4, 5, 1, -2,
+    8, 0, -16, -20, 1, -4, 7, -2, 11, -5, 0, 2, 12, -1, -15, -4,
+    12, -9, 24, -11, 2, -7, -5, -27, 5, 3, 8, -5, 4, -18, -8, -16,
+    4, -4, 6, -11, -5, -10, 11, 1, -7, -3, -7, -20, -5, 5, 3,
+  },
+  {
+    -2, -4, 2, -1, -2, -6, -4, -7, 1, -1, -1, -3, 1, -2, -1, -14,
+    -1, 8, 7, -5, 8, 2, 1, -9, 4, -3, 0, 4, 14, 1, 2, -20,
+    -1, 1, 2, -5, 2, -1, 10, -8, -5, -2, 7, -7, -1, 2, -2, 11,
+    -7, -5, -10, -5, -1, -6, 0, 0, 7, -3, -19, -9, -5, -2, -1, -34,
+    11, -8, -10, 7, 0, -5, -2, -3, 3, -12, -16, -2, -9, -6, 9, -12,
+    -2, -5, -1, -2, -9, 12, -26, -16, -8, -13, -4, 5, -2, -6, 3, -6,
+    -7, -10, 7, 1, 5, 10, 1, 6, 1, -5, 2, 6, -5, 5, -1, -7,
+    2, 1, -17, -4, 6, -22, -1, -3, 1, -4, 4, -11, 0, -4, -2, -28,
+    -2, -5, -5, -4, 1, 1, 6, -12, 7, 2, -3, 3, 4, -1, 11, -19,
+    -2, 4, -5, -14, 8, 30, 6, 1, 5, 24, 3, -2, 2, -8, -21, -24,
+    3, -10, 2, -10, -8, -10, -3, -1, 0, -4, 14, 6, -14, -25, -3, -10,
+    -7, 1, 1, -2, 2, -8, -9, -6, 3, 4, -4, -7, -5, -10, -3, -1,
+    -4, -25, -2, -8, -9, 9, 7, -2, 11, 10, -1, 1, -9, 9, -7, -4,
+    -1, 1, -1, -11, 0, -8, 0, 7, 1, 3, -4, 3, -14, 6, 1, -15,
+    -1, -1, 12, -13, -13, 28, -10, -7, 7, 0, 9, 34, 8, 2, 1, -14,
+    2, 0, -8, -10, 2, 0, 13, 9, -1, -7, 0, 4, 7, -3, 6,
+  },
+  {
+    0, -2, -1, -4, 0, 4, -4, -5, 4, -2, 0, 0, 0, 3, -2, -5,
+    1, 3, 2, -1, -2, -4, -1, 1, 0, 1, -7, 3, 6, 0, 1, -20,
+    -1, -4, 0, -5, 0, 5, 2, 1, -3, 3, 2, 1, 2, -5, -7, -4,
+    -4, -8, -2, -5, -9, -1, 2, -3, -7, -2, -11, -3, -5, -3, -1, -24,
+    -1, -2, 10, -8, -8, -3, 9, -8, -2, -8, 2, 2, -2, 1, -2, 2,
+    6, -16, 5, -2, 3, -12, 5, 4, -3, -6, -4, 0, -3, -8, 5, 7,
+    -1, 1, 4, -9, -6, -5, -7, -16, 8, 1, -2, 8, 0, 6, 1, 12,
+    -2, 1, -3, -5, -1, 12, 0, 2, -2, -5, -8, -5, 7, -5, 5, -23,
+    -7, 1, -10, -9, -3, -6, -2, -7, 4, -2, 5, 3, -10, -3, 3, -5,
+    -9, -19, 1, -3, 0, 0, 3, -1, 13, 5, -3, 3, 0, -4, 4, 2,
+    8, -5, 3, -16, -3, -2, -7, -3, -2, -7, 1, 5, 12, 3, 2, -2,
+    -4, 8, -5, -11, 4, 0, 9, -13, -3, 7, -9, 8, 6, -8, 4, -10,
+    11, -4, 4, -9, 1, 1, 14, -18, -6, -8, 3, 3, 1, -3, -1, 14,
+    -16, -3, -2, -13, 17, 7, 9, 6, -8, -12, -10, -1, -8, 19, -10, -1,
+    -9, -2, -1, -14, -6, -4, 1, 4, -3, -6, 5, 5, -29, 3, 2, -10,
+    -1, -1, 10, -12, 4, 9, 23, -7, -11, -4, 0, -10, 13, -5, 3,
+  },
+  {
+    2, -2, -1, -2, -4, 1, -5, -2, 5, 1, -5, -6, -5, -4, -3, -2,
+    2, 3, 3, 1, 4, 0, 1, -2, 2, -10, -1, 8, -6, 4, 2, -12,
+    -1, -6, -7, -1, -5, 1, 8, 1, -9, 3, -2, -2, -5, 2, -6, 5,
+    -12, -4, -2, 14, -4, -6, 4, 4, -12, -5, -1, -4, 6, 0, -6, -19,
+    -3, 0, -1, -3, 4, -11, -7, -4, -8, -5, 1, 0, 1, -9, 2, 3,
+    5, -6, 1, 4, 3, 10, 3, -7, 0, -13, -17, -2, 5, -7, -6, 7,
+    2, 0, -8, 7, -7, -2, -6, 2, 13, -12, 0, -9, -11, -5, -1, -2,
+    -2, 6, -2, 2, 4, -4, -5, 3, -1, -5, -4, 12, -4, 4, -5, -21,
+    5, -3, 17, -13, -7, 1, 4, -2, 5, -1, 1, 17, -4, 8, -2, -14,
+    3, 7, -6, 3, 1, -2, 1, 3, -7, 6, 4, -10, -10, -9, -21, 2,
+    -6, 6, 5, -9, 5, -3, -4, 4, -6, 6, -2, -3, -2, -2, 8, 14,
+    1, 1, 5, -11, 0, 5, 2, 0, 4, -4, -4, -1, -6, -1, 3, -6,
+    -8, 2, -14, -9, 5, 5, 10, -3, -1, -9, 3, 1, -10, -3, -5, -4,
+    -4, 11, 24, -28, -1, -2, -9, 13, -12, -8, -4, -8, 23, -7, -13, 5,
+    -4, -6, 1, 1, -23, 6, -10, 2, 13, 7, -3, -2, -1, 8, 0, 0,
+    -5, 9, 3, -14, -3, -10, 2, -2, -10, 7, -8, 1, 2, -4, 5,
+  },
+  {
+    1, -1, 0, -2, 1, -3, -2, -3, -1, -3, -2, -5, -3, 2, -3, -3,
+    1, -1, -3, 3, 2, -4, 0, 6, 5, 4, 0, 0, -8, 3, -2, -19,
+    2, 0, 0, 0, -3, -3, -2, 3, -5, 5, -11, -11, -7, -3, 1, -2,
+    -8, -5, 5, -2, 1, -2, 2, -1, -9, 14, 11, -1, -1, 2, -6, -16,
+    -8, 3, -1, 6, -9, 6, -1, 2, 2, 2, -4, -4, 1, 6, -3, 1,
+    12, -5, 1, 3, 0, 8, 3, -17, 6, -2, 2, -3, -1, 6, 4, 5,
+    -7, -14, 5, 0, 3, -3, 6, -5, -3, -9, 0, 5, 0, 4, 2, -4,
+    0, -13, -2, 1, -22, 0, 10, 8, 9, -11, 5, 9, -11, 0, -10, -18,
+    5, 7, -2, 0, -7, -8, -2, -1, 2, 11, 5, -13, -9, -11, 3, -7,
+    -4, -2, -7, -1, -1, -15, 0, 13, 5, 0, -3, -8, -24, -8, -2, -22,
+    -4, -3, 10, -20, 3, -4, 3, -3, 1, 5, -7, 1, 8, 10, 5, 0,
+    -3, -6, -6, -11, 0, 1, 8, -2, -4, -1, -5, -1, 13, -2, 0, -22,
+    -6, 1, 0, 15, -5, -5, -27, -12, -5, -5, 18, -8, -1, 6, -2, -9,
+    1, -11, -3, 4, -9, 5, -12, 7, -13, -9, -4, -13, 1, 4, -4, -3,
+    6, 8, -5, -3, -2, 2, -7, 6, 10, 32, 2, -3, -6, -1, -2, -3,
+    10, -12, 2, -8, 0, 6, -7, 1, 8, 11, 5, 15, -2, 6, -2,
+  },
+  {
+    -6, -4, -4, 0, -3, 2, -2, -13, -1, 0, -3, -4, -11, -3, -2, -23,
+    2, -1, 0, -1, 1, -8, -4, -3, 4, -3, 3, -6, -1, 0, 3, -31,
+    -4, 1, -1, -2, 3, -2, 2, -1, 5, -3, -4, -9, -9, -9, 1, -3,
+    -1, -6, 6, -22, 14, -5, 6, -17, -1, 2, -5, -5, 1, 3, -2, -37,
+    -4, -6, 3, 7, -8, -14, -13, -1, 1, -5, 6, 4, -2, 4, -11, -5,
+    0, -1, -4, -7, 3, 4, 6, -16, 1, 0, 0, 5, -1, -3, -6, -3,
+    -13, -5, -2, -7, 4, -3, -5, -31, 2, 2, -26, -7, 0, -2, -10, -21,
+    2, 3, 4, 0, -1, 0, -2, -8, 4, 0, 1, -3, 2, -10, -2, -34,
+    -1, -11, -6, -20, 8, 7, 10, -6, 9, 4, -2, -10, -3, -18, -14, -2,
+    -2, 0, -1, -9, -3, -10, 5, 2, 1, 6, -6, 4, 7, -13, 2, 3,
+    -7, 2, 4, -6, -9, -13, 7, 8, 1, 6, -2, 1, 0, -5, 16, 21,
+    -3, 1, -1, -7, -1, 2, -4, -1, 23, -1, 3, -1, 0, -15, -11, -6,
+    -6, -6, 3, -7, 1, -3, 2, -1, 4, -7, 5, -6, -4, -9, -9, -33,
+    6, 2, 1, -6, -7, -31, 6, 14, -10, -1, 4, 10, 1, -17, -3, -20,
+    -1, -8, 13, -1, -7, -2, -12, -10, 5, -6, 11, -2, -1, -7, -1, -4,
+    -11, 2, 5, -3, -1, 6, -3, -12, -11, 5, -6, 4, 1, -10, 7,
+  },
+  {
+    0, -1, -2, -2, -2, -5, 1, -6, -3, 2, -2, -6, -2, -2, 3, -6,
+    -4, -16, 2, -2, 1, -1, 3, -8, -6, -1, -1, -6, 0, -7, 0, -13,
+    -4, -1, 4, -2, -6, 0, 1, 3, -3, -3, 2, -9, -5, -4, -3, 9,
+    -2, -5, 6, 1, -5, -4, -4, -2, -5, -3, 3, -1, -2, -2, -8, -26,
+    -6, 4, -2, 2, -7, 7, 2, -14, -2, -12, 6, -5, 11, 1, 6, -10,
+    8, -4, -5, -5, -8, -6, -7, -12, 3, 1, -3, 1, 1, -2, -2, 8,
+    23, 3, 3, 6, 1, -2, 5, -1, 8, -10, 6, 0, 0, -4, 6, -4,
+    5, -6, -2, 6, -1, -5, -3, -3, 2, -3, 4, -5, 2, -11, 0, -8,
+    3, 2, 0, -1, 4, 4, 5, -6, -3, -11, 6, -6, 12, 4, 6, -14,
+    -4, -16, -2, -13, 17, 7, -5, 12, 7, -5, -5, -2, -11, -7, -1, -3,
+    2, -8, 9, -2, -1, 6, -5, 12, -8, -7, 1, 5, 1, 14, 1, -11,
+    4, 2, -9, -12, -11, 21, -1, 1, 4, 13, 1, -5, -1, 2, -6, -3,
+    -21, -2, -32, -11, -5, -8, -8, -7, -3, -18, 3, -7, -1, 7, -4, -7,
+    7, -2, -12, -4, 11, 2, 4, -7, -3, 1, -2, -14, -3, 0, -12, -3,
+    12, 6, -23, -7, -2, -9, 1, -3, -10, -1, 0, -3, -4, -2, -2, -3,
+    12, 1, -10, -15, -1, 7, 7, -8, -3, -7, -5, -18, -10, -1, 0,
+  },
+  {
+    -2, 0, 2, -4, 4, 0, -1, -6, -3, -2, -2, -2, 3, -9, -2, -4,
+    4, 6, -3, -2, 0, 8, -1, -2, 0, -4, 5, -8, 0, 3, -6, -10,
+    -1, -3, 2, 1, 7, -1, -5, -2, 1, -7, -6, 4, -16, -12, -12, 3,
+    0, 8, -2, 1, 1, -6, 8, 15, -3, -3, -4, -7, -3, 9, -1, -18,
+    -16, -6, -9, -3, -4, 2, 2, -8, -1, -13, -6, -6, -7, 0, 3, -13,
+    -5, -4, -4, 4, -2, 9, -4, 0, 5, 12, -3, -8, -8, -6, 2, -18,
+    10, -14, 6, -2, -1, 1, -3, 4, -10, -4, 5, -10, 3, -4, 11, -7,
+    0, -5, 4, -11, -2, -2, -1, -12, -3, -5, -10, -3, -17, 4, 7, -27,
+    -5, -18, 3, -3, -18, -8, -1, -9, 1, 14, 1, -6, -11, 0, 0, -10,
+    -5, 11, 1, -8, -8, -11, 10, 6, -3, 12, 6, 5, 2, -1, -2, -1,
+    -3, -4, -2, -15, -6, -16, 1, 2, 8, 2, 1, 0, -12, -9, 0, -3,
+    8, -10, 17, -21, -25, 8, 0, 22, 8, 1, 0, -5, 3, -8, 12, -1,
+    3, -3, 9, -5, -7, 0, 3, -18, 8, -6, -16, 0, -7, 1, -3, 9,
+    -6, -11, 3, -4, -2, 0, 4, 8, -12, -4, -4, 10, 5, -13, -18, -9,
+    9, 29, 30, -8, 7, 7, -11, 7, -9, -5, -12, -5, -5, 12, 1, -12,
+    8, 5, -11, -7, 1, 18, 3, 14, 2, 16, -6, -11, 3, -5, 0,
+  },
+  {
+    -4, -3, -1, -9, -7, 2, 0, 6, 1, 8, 1, -5, -3, 4, -3, 1,
+    -20, -2, 3, 1, 19, 1, 0, -5, 5, 4, 3, 2, 1, -3, 0, -10,
+    9, 25, 5, -1, 0, 4, -2, 1, 1, 2, 24, 5, 1, -6, 3, -5,
+    -5, -1, -7, -2, 7, -1, 0, 5, -4, -2, 12, 4, 6, -7, -5, -20,
+    0, -2, -6, -2, 18, -4, -5, -10, -2, -9, -1, -10, 3, -6, 5, -3,
+    -9, -10, 13, -4, 3, -5, -31, 9, 0, -7, -4, -3, 7, 3, 3, -15,
+    3, -12, -4, -5, -5, -6, 2, -7, -1, -3, -17, 3, -2, 13, -4, -1,
+    7, 2, 11, 4, 5, -1, -19, -3, -13, -10, 4, -5, 2, -4, 10, -17,
+    0, -8, -5, -6, 8, 11, 4, -1, 6, 27, 42, 6, 2, 4, 2, -11,
+    -2, 4, 6, -3, 2, 1, -3, -1, -5, 4, -2, -16, 3, 3, -4, -8,
+    0, 1, -2, -15, -6, -12, 5, 4, -2, -3, 2, 11, -7, 37, -1, -1,
+    0, 9, -8, -5, 1, -1, -3, -11, -8, 9, -5, 8, 2, 1, 0, -4,
+    2, 9, -9, -3, 3, 0, 4, 0, -8, -2, -5, 9, 13, -3, 0, 2,
+    4, 5, 0, -9, -1, 28, 5, -7, 23, -5, -4, -2, -21, -3, -2, -5,
+    -12, -16, -3, -5, 7, 3, 3, -14, -6, -4, -3, -1, 15, -22, 4, 9,
+    5, 25, -12, -9, 5, -5, -3, 3, 5, -6, 5, -14, 3, 3, -2,
+  },
+  {
+    -3, -2, 2, -5, -1, -1, -1, -3, -2, -7, -2, 1, -2, -2, -2, -11,
+    -8, 3, -2, 6, -5, 5, 1, 3, 2, -1, -5, 4, -4, 3, -4, -14,
+    -3, -6, 1, 3, -9, 4, -2, -7, 3, -4, 2, 4, 7, 6, -3, 0,
+    -2, -9, 0, 0, 0, 2, 2, -5, -9, -2, 2, -2, -3, 0, 3, -24,
+    -5, -8, 7, 8, 8, -1, -1, -4, -8, -8, -3, 2, -2, 0, 0, -10,
+    7, -19, 19, -3, 1, 9, 0, -3, 9, -3, -8, -5, 0, 1, -1, 2,
+    3, -2, -2, -8, -2, 12, 0, 13, -3, 1, 2, 1, 3, -4, -5, 1,
+    -4, -15, 2, -4, 2, 3, -5, -6, 13, -5, 4, 8, -6, 1, 0, -6,
+    4, -2, -5, -17, 10, 5, 10, -2, 23, -4, -13, -1, 0, 0, 0, -19,
+    1, -13, -2, -13, 3, -19, 2, 3, -8, 16, -1, 3, -13, -3, 9, -5,
+    5, -3, -9, 9, -8, 4, -28, 3, -10, -12, 2, -6, 1, -8, 6, 6,
+    -11, -4, 26, -8, 2, 19, 1, -8, -6, -10, -6, 9, 5, -2, 0, 4,
+    -1, 7, -1, -10, 0, 5, 7, -8, -2, -10, -4, -1, 8, -6, -6, 1,
+    -23, 0, 1, -13, -11, 0, 6, -23, 3, -7, -7, 6, -1, 5, 0, 1,
+    -10, -7, -9, -7, 1, -5, 5, -2, 5, -3, -4, -11, -11, 9, -6, 5,
+    2, 23, 14, -11, 6, 1, -8, 10, -21, 8, -6, 4, 3, -1, -6,
+  },
+  {
+    -2, 0, 0, -3, 3, 0, -3, -11, -7, -2, -10, -2, -3, 2, 0, -8,
+    1, 0, 0, 2, 2, 10, -2, 2, 2, 0, -5, -3, -3, 7, 2, -23,
+    -4, -9, 2, -4, 5, 0, -9, -6, -5, 7, 4, -6, 15, -1, -1, -6,
+    8, 1, 1, -7, -5, -2, -1, 2, -2, -2, -2, 2, -6, 4, -4, -29,
+    3, -14, -6, 2, -4, 2, 4, 13, -4, 1, 11, -4, 1, -2, -1, 1,
+    -4, 2, -3, 0, -5, -3, -10, 6, 0, -7, 20, 1, -2, -8, -6, -3,
+    6, -6, -2, 0, -1, 4, 11, 7, 3, -10, -5, -3, -7, -1, 1, -8,
+    -2, -3, -13, -12, -11, -20, 5, -5, -10, -8, 7, 2, -3, -1, -2, -34,
+    -3, -6, 3, -15, 3, -16, 6, 8, 3, 5, -6, -5, -1, -1, 8, 8,
+    16, 9, -6, -5, -9, 2, 2, 1, -3, 12, 0, 3, 2, 5, -10, -11,
+    -6, -7, -12, -3, -24, -5, 2, -3, 1, -3, 8, -2, -6, -3, 1, -9,
+    -4, 5, -3, -17, 0, -15, -10, 1, -2, 6, -9, -3, -18, -10, -10, -8,
+    2, -10, -8, -7, 1, -13, -1, -2, 1, 3, 3, -13, -6, 8, -3, 10,
+    -11, 8, 2, 5, 18, -18, 1, 17, -3, 7, 6, 13, -5, 2, 8, -11,
+    -2, 9, 3, -10, 2, 19, 7, 7, 1, 9, 0, 15, 12, 9, -13, -1,
+    -12, -6, 1, -19, 9, -8, 5, -2, -7, 4, -2, 4, 5, 0, 0,
+  },
+  {
+    0, 0, 3, 1, 0, 0, 2, -3, -3, 4, 1, 3, -1, 1, 3, -3,
+    -2, -1, 1, 1, -5, 1, -4, 1, 0, 1, -3, 1, -4, 1, 1, -3,
+    -1, -1, 2, -6, -3, 3, 2, -7, -5, -16, 7, -7, -6, -1, 3, -4,
+    -2, -1, -3, 0, 2, 5, 0, -4, -1, 5, 2, -4, -7, 0, -3, -15,
+    7, -3, 1, 0, 4, 0, 6, -10, 2, 3, -2, 0, 4, -13, 3, -6,
+    3, -3, -2, 19, 5, 1, 5, -4, -1, -9, -6, 1, -5, 4, 4, 0,
+    -4, 0, 8, -9, 6, 5, 4, 2, -1, -5, -5, -1, -6, 2, -8, -7,
+    -2, -7, 5, -1, -7, -3, 3, -4, -3, -4, 0, -3, 2, -1, 5, -25,
+    3, 17, 16, -6, 4, -6, -4, -4, 8, -7, 5, 1, -1, -4, -2, -18,
+    6, -8, -1, -10, 7, 0, -20, 6, 14, 6, -7, 1, -3, -11, -7, -6,
+    5, 12, 7, -9, -6, -12, 0, 2, -37, -8, -13, -5, 3, -16, 3, -11,
+    8, 4, 9, 11, 0, 5, 5, -8, -9, -5, -4, -4, -7, -2, 6, -9,
+    -7, 5, 5, -7, 15, -5, 5, -8, 1, 0, 1, 6, 15, 6, -2, -6,
+    -2, -6, -8, -3, 7, 4, 0, 1, 7, 1, 2, -10, 0, 1, 1, -1,
+    -6, 3, 15, -8, -7, 3, -6, -20, 15, 3, 0, -2, 1, 3, -6, 7,
+    -2, -4, -4, -5, -4, 6, -1, -11, -2, -2, -13, -2, 3, 2, 3,
+  },
+  {
+    -4, -3, 1, 3, -3, 0, 0, -4, -6, 0, -1, -1, 3, -3, 3, -5,
+    0, -7, 2, 4, -1, -1, -3, -3, -4, 1, 0, 2, -5, -1, -6, -9,
+    -2, 0, -3, -10, -6, -7, -3, 0, -4, 3, 2, 1, -8, 8, 0, 0,
+    -4, -7, 1, 1, -9, -6, -3, 4, -6, -5, -3, -4, 2, 12, 2, -18,
+    6, -8, 1, 2, 3, -1, -3, -19, 2, -3, 5, 10, -1, -7, 11, 4,
+    -7, -6, 7, 3, 0, 7, -4, -8, -10, -6, -7, 5, 4, 11, 7, -6,
+    -2, -4, 3, 4, 6, 3, -12, -12, 5, 0, 1, 14, -7, 1, 5, -1,
+    -6, -1, -5, 3, 0, 3, 7, 4, 3, -3, -2, -3, -7, 7, -9, -25,
+    -7, -4, 1, -6, -7, 1, -4, 7, 1, -7, 1, -6, -5, -3, -2, 22,
+    -3, 5, -1, 0, 5, 3, -18, -8, -8, -4, -6, 3, -7, -3, -21, -3,
+    -2, -3, -3, -6, 12, 6, -3, -2, -3, -7, 10, -7, -10, 20, -13, -6,
+    -1, -15, -1, -6, -7, -13, -4, -5, -4, -11, 1, -10, 0, -1, 9, 6,
+    -6, -9, -11, -19, -4, -7, 6, 4, -10, -7, -4, 11, 3, -5, 3, 3,
+    -17, -4, 23, -1, 8, -5, -9, -3, -21, -2, 7, -10, 0, 15, 6, 5,
+    2, 7, -1, -6, -14, 0, -5, -1, -6, -1, -12, -8, -13, -1, 1, 4,
+    -18, 5, 7, -12, -10, -10, 7, -8, 5, 26, 14, -1, 1, -6, -7,
+  },
+  {
+    -1, -5, -2, 1, 1, 3, -2, -8, -7, 1, -1, -6, 9, -4, -1, -10,
+    0, -12, 5, -6, 2, -2, 3, -2, 2, 4, 15, 2, -2, 2, 5, -15,
+    -5, 1, -5, -15, 3, 3, 6, -4, 0, 5, -5, -5, -7, -2, 4, 1,
+    -5, 10, 5, 3, 2, -1, 24, -4, -1, -1, -5, -1, -5, 0, -2, -27,
+    2, -1, -5, 9, -3, -5, 2, -30, 8, -14, 4, -5, -8, 2, 8, -6,
+    6, -5, -4, 0, -3, 6, 0, -1, 3, 1, 4, 5, -6, -2, -8, -2,
+    -6, -14, -2, -5, 0, 1, 1, 2, 3, -7, 0, -2, -4, 0, -31, -3,
+    0, -8, 12, 12, -2, -9, -4, 0, -2, -4, -9, 3, -1, -12, -3, -22,
+    10, 10, -6, -3, -4, -2, -2, 5, 19, -16, -2, -13, 13, 2, 7, 22,
+    4, 6, -1, -14, -7, -7, 12, 3, -1, -7, -6, -3, 17, -5, -27, -6,
+    -8, -6, 7, -2, 11, 6, -4, -12, 3, -14, 13, -15, -10, -3, -4, -9,
+    8, 0, 3, -10, 1, 2, -13, 6, -20, 4, -4, 3, 4, 6, 7, -2,
+    -4, -17, 1, -10, -5, -11, 0, -11, -9, 0, -7, 20, -3, 16, -6, -4,
+    -3, -10, 1, -13, 16, -5, 7, 3, -2, 3, 4, 1, -7, 24, -9, -6,
+    6, 5, 4, -2, -1, 4, -6, 4, 6, 8, -8, 5, -6, -3, -3, -7,
+    -2, 6, 0, -6, 10, -2, 1, -2, -4, -8, 0, 3, -3, -19, -11,
+  },
+  {
+    2, -1, -5, -4, 0, 4, -1, -8, 4, 0, -2, -8, -14, -6, -3, -5,
+    -3, 5, -3, -3, -1, 0, 1, -9, 1, -16, 0, 6, -2, 4, -2, -12,
+    -2, 3, -6, 0, -2, -5, 1, -3, -10, -1, -5, 8, -12, 1, -3, 28,
+    -9, -9, 4, -27, -2, 4, 1, 0, 0, -2, -5, 1, 1, 3, -4, -25,
+    -10, -11, 2, -2, -4, 0, -8, 1, -8, -10, 5, 5, 0, -5, 5, 5,
+    -6, -4, -11, -7, -2, 6, -1, 7, -9, -12, 6, -8, 13, -3, 2, 8,
+    -13, -10, 1, 4, 0, -8, 2, 32, 3, -7, -3, 6, -8, -2, 3, -3,
+    -2, -10, -1, -2, 3, 0, 3, 0, 0, -1, -9, -1, 0, -6, 2, -29,
+    -2, -19, 2, -6, 9, -10, -6, -18, 11, -1, 8, -9, 2, 3, 3, 5,
+    -1, 11, -13, -11, -11, -3, 22, 6, -12, 7, -6, -6, 4, -8, 1, -10,
+    -15, -8, 7, -2, 4, 8, -4, -20, -9, -3, 7, 3, 4, -6, -1, -15,
+    8, -1, 1, -25, -2, 11, 1, -1, -13, 9, -9, -3, 1, -4, -5, -12,
+    -7, -34, 0, -7, 3, 3, 4, -6, -9, -3, 0, 4, 3, -7, 2, -25,
+    43, 4, 1, -1, -3, -3, -4, -8, -8, -7, -10, 2, -3, 5, 0, -2,
+    4, 10, 0, 6, 3, 1, 2, 5, 2, -5, 17, 2, -7, -7, 1, -1,
+    0, -5, -1, -10, -11, -4, 11, 2, 6, -11, 12, 16, -2, 9, -3,
+  },
+  {
+    2, -4, -5, -3, 0, 7, -1, -6, -1, 2, 3, -3, -14, -2, 2, -5,
+    -1, -5, -5, 7, 1, 3, -1, 8, 5, 27, 3, 3, 0, 5, 4, -15,
+    -11, 6, -1, 8, -8, -5, -2, 2, -4, -1, -4, -5, -8, 9, 2, 0,
+    -14, 2, 2, -1, -32, 1, 3, -6, -13, -6, 3, -4, -5, 0, 6, -26,
+    2, 19, 2, 0, 16, -9, 6, -5, 21, -7, 1, 1, -3, -7, 7, 3,
+    0, 3, -7, -2, -5, -4, 6, 5, 6, 1, -3, 2, 6, 1, -14, 0,
+    -8, -23, -2, -4, 2, 8, 8, -6, -8, 31, 3, 8, -7, -2, 6, -1,
+    2, -6, -2, -13, -5, 0, 3, -7, 1, -5, -4, -4, -5, 7, 6, -27,
+    7, -5, 7, -10, 25, -9, -8, -10, -3, 7, 12, -17, -9, -2, 3, -9,
+    6, -1, 31, -14, 6, -6, 8, 1, -16, 7, -17, -20, -4, 0, -1, -6,
+    7, 4, 4, -1, 4, 3, 8, -1, -4, -5, 3, 10, -11, -12, 11, -6,
+    5, -11, 6, -4, 0, 2, 12, -5, 0, -13, -14, 4, -10, -1, 0, -3,
+    2, 9, 13, 15, -10, 5, -7, -6, -13, 5, 3, -8, 9, 3, 16, -5,
+    1, -4, 15, -9, -35, 7, -7, 5, 7, 10, 6, -3, 13, -4, 7, 1,
+    1, -2, 5, 5, -8, -2, -8, -15, 5, -11, 23, -6, -3, -5, -11, -5,
+    6, 1, -6, -10, 6, 8, 5, -8, 4, -7, 8, -12, -11, 1, 16,
+  },
+  {
+    -1, -2, -2, -2, -2, -5, 2, -9, 1, -1, 1, 2, -1, 1, -1, -10,
+    -3, 4, -3, -5, 2, 0, -1, -2, -9, -3, 2, 0, -8, 3, 1, -16,
+    -6, 0, 2, -5, 1, -5, -4, 7, -3, 4, 1, -3, 4, 2, -1, -6,
+    5, 9, -2, 1, -4, 1, -1, 2, -2, 4, -2, 5, -3, -4, -2, -22,
+    7, -13, -7, -3, -4, -5, -10, -3, 9, -3, 13, -2, -7, -3, 6, 1,
+    19, -5, 1, -4, -12, -2, 8, -6, 10, -5, -7, 4, 11, 2, -1, -5,
+    -1, -6, 9, 0, 21, -2, -1, 0, 6, -3, 3, 8, -5, -4, -14, 1,
+    4, -6, -3, -6, -3, -2, 1, -1, 3, 10, 4, -5, -6, -2, -9, -28,
+    -22, 6, 4, -6, 18, 2, -22, -1, 1, -11, -6, 3, -3, -13, 13, 5,
+    0, -18, 4, -13, -6, 3, -5, 7, 5, 2, 1, 3, -4, -5, 11, -2,
+    10, 2, -10, 4, 2, 6, -2, -4, -1, -9, -22, 15, 11, 0, -27, 4,
+    9, -1, -9, -9, 4, -4, 8, -3, -4, -1, 13, -4, -4, 10, 4, -11,
+    -13, -5, 3, -17, 6, 4, -13, -9, 7, -1, 28, -1, 0, 8, 8, -1,
+    -5, 3, 6, -16, 4, -4, -16, 0, 6, 3, 11, -10, 2, -1, 0, -5,
+    -1, 0, -3, -6, 1, -13, 6, -20, -1, 4, -1, 1, 5, 11, 4, 10,
+    2, 3, -5, -10, 21, -5, 3, -2, -2, -13, 3, 4, -13, 8, -9,
+  },
+  {
+    -3, -6, 0, 3, -2, -1, 0, -6, -8, 1, -1, -7, -3, -2, -2, 2,
+    -4, 14, -2, 6, 5, 4, -4, 3, 5, -1, 2, -4, 6, -1, 1, -13,
+    -3, -2, 0, -5, -18, -5, -1, 1, -5, 3, 4, 0, -1, -6, 0, 0,
+    -1, -1, -2, -3, 8, -5, -3, 2, -2, -1, -2, -11, -9, 1, 7, -22,
+    -5, -19, 11, -6, 4, 1, -5, -13, -13, -33, -14, 1, 2, 5, 14, -11,
+    2, -3, 9, 0, 6, 4, -15, 4, 13, -3, -5, 0, -5, -5, -10, -5,
+    5, 1, -7, -11, 2, -3, 7, -21, 7, -3, 0, 1, 3, -2, 5, -7,
+    -6, -5, -1, 3, -5, 9, -3, -1, 3, -4, -2, 5, -7, 1, -3, -27,
+    8, 2, 11, 4, 5, 0, -19, -5, 10, -5, -8, 4, -12, -2, 0, -15,
+    7, -8, 8, 25, -7, -22, -4, -6, 19, 6, 4, -4, -6, -1, 19, -10,
+    11, -3, 8, -7, -4, -3, -11, -15, 5, -7, -1, -7, -4, -9, -10, -12,
+    -2, 1, 8, -5, -3, -4, -2, -1, -9, 4, -2, -5, -1, 0, 4, -10,
+    -11, 5, -22, -1, -13, -5, 3, -1, 3, 15, -20, -9, -4, 3, 9, -21,
+    0, -9, 1, -2, -10, 1, -6, 3, 4, -6, 6, 5, 11, 18, 4, 8,
+    2, 20, 8, -12, 3, -7, -7, 5, -14, -9, 0, -3, -12, -11, 1, -11,
+    0, -5, -8, 9, 1, 8, -14, -8, -1, 6, -1, -2, 5, -6, 2,
+  },
+  {
+    -2, 3, 2, -3, -10, -3, -1, 2, 1, -5, -1, 0, -2, 0, -6, -7,
+    6, 3, -2, -19, -11, 1, 1, 0, -3, 1, -2, 4, -2, 5, 1, -11,
+    -5, -6, -11, -3, -2, -7, 1, -32, 0, 9, -7, 3, -2, 1, -10, -8,
+    3, 7, -1, -3, -9, 0, -4, -4, -7, 11, 1, 0, 14, 4, -5, -7,
+    -9, -2, 0, -5, -11, -8, -5, -4, -1, -8, 6, 10, -1, -7, 6, -38,
+    7, -12, -4, 8, -14, 12, -1, -3, 8, -3, -1, -6, -8, -2, 2, -5,
+    5, -8, -1, -2, -1, -4, -7, -9, 0, 0, -4, -1, -1, -6, -1, -9,
+    5, -8, 1, -13, 17, -4, 6, 0, 2, -2, 8, 1, -1, -2, -2, -22,
+    2, -2, -4, -7, 2, -14, -7, -1, 7, -1, 1, -13, 14, -5, -15, -10,
+    6, 16, 4, 6, 7, -2, 1, 10, -10, 2, -1, -4, 1, 11, 4, -44,
+    0, 11, -3, -8, -4, 1, -9, 2, 2, 18, -10, -9, 12, -1, 0, -18,
+    8, 7, -12, -13, -6, 7, 7, 0, -7, -4, -13, 7, 7, 4, 2, -5,
+    -7, 15, -8, -14, -3, 7, -5, 20, -3, -13, -8, -4, -5, 6, 12, -6,
+    0, -2, 9, -6, -5, -2, 5, 2, 11, -17, 2, -7, 7, -12, -8, -9,
+    -12, 2, 0, -24, 13, -2, -9, -2, 0, -1, -23, -4, -1, 3, -7, -1,
+    -11, -2, -6, -13, -10, 20, -27, 3, 0, -5, 4, 6, 5, 5, 7,
+  },
+  {
+    -1, 1, 0, -3, -2, 0, -3, -2, 1, 2, -1, -1, 4, 2, 0, -4,
+    -4, -5, -1, -6, 6, -1, 2, -1, 2, 5, -2, 1, 6, 0, -4, -14,
+    -3, -7, -8, 4, 1, -3, -4, 0, -3, -7, 15, -2, -1, -4, -1, -7,
+    -5, -5, -1, -2, 1, 11, 5, 4, -10, 6, 1, 3, -7, -2, -4, -18,
+    -2, 1, -3, -7, -3, -5, -11, -8, -3, -12, -8, -4, -5, 5, 1, -6,
+    2, -13, -2, 2, -1, 1, 14, -7, -7, -3, 13, -4, -5, -9, 12, 1,
+    -6, -9, -2, 9, -2, 5, 5, 4, 5, 0, 0, 11, 5, -3, -4, -5,
+    7, -11, -3, 4, -5, 7, 6, -1, 7, -2, -5, -5, -7, 1, 4, -16,
+    -5, -15, -5, -10, 8, -5, 3, -6, -14, 5, 18, -9, -13, -5, -11, 4,
+    2, 0, 18, -5, -11, -8, -16, -13, 2, 3, -9, -9, -15, -3, -9, -2,
+    -8, -3, 2, -10, 16, -5, -2, -25, 1, -6, 1, -3, 2, 16, -28, -12,
+    -3, -14, 7, -12, 5, 20, -12, -11, -3, 2, 2, -12, -9, -10, -6, -10,
+    -8, -6, -2, -8, 7, 2, 9, -3, 6, 2, -2, -12, -1, 4, -5, 7,
+    6, -3, 5, -3, -7, -2, -7, -4, 2, 3, -19, 6, -7, -8, -6, -3,
+    2, 1, 19, -19, -4, 0, 10, -2, 1, 11, 1, -8, -26, -7, -13, 4,
+    -1, 2, 7, -2, 2, -2, 13, -3, -3, -1, 3, 13, -2, 5, -2,
+  },
+  {
+    -1, -1, 0, -3, -3, 0, 3, -6, 1, -1, 2, -3, -3, -3, -3, 2,
+    -1, 0, 0, -5, -6, 0, -4, 0, 7, 0, -1, 1, -1, -1, -2, -13,
+    -14, 0, 0, -12, -9, -6, 2, -12, -6, -6, 0, 4, -3, -1, 0, -8,
+    2, -2, -4, 2, -2, -5, -10, 1, -5, 4, 7, -12, 2, -7, -6, -13,
+    10, -5, 4, 10, -1, 0, -11, -2, 5, 1, 2, 1, -3, -3, -5, 1,
+    -5, -8, 4, -17, -4, 10, -4, -1, 0, -4, 7, 4, 7, 1, -11, -12,
+    -4, -6, -12, -3, 10, 1, 1, -13, -1, 0, 5, 12, 6, -7, 12, 11,
+    2, -5, -2, 3, 4, -6, 4, 8, 3, -10, -15, -8, 2, 5, 3, -19,
+    5, 7, 3, -29, -20, -2, -2, 9, -19, -6, -19, 5, 1, 9, 1, -6,
+    -5, -10, 7, -11, 4, 11, 0, -1, 1, 12, -18, -10, 1, -3, 6, -6,
+    8, -1, 3, -1, 3, -1, 9, -16, 0, -9, 6, 5, -3, -8, -8, 2,
+    3, -7, 12, -9, 0, -5, 5, -11, -8, -4, -7, 6, 12, -6, -1, -13,
+    -15, 0, -8, -8, -6, -18, -13, 8, 3, 0, -3, 2, -16, -10, 8, -16,
+    -3, -8, 1, -12, 7, -4, -9, -6, 1, -12, -3, -9, -4, -2, 8, -1,
+    -1, 4, 6, -14, 11, -9, 7, -4, 5, 2, -8, -3, 6, 7, 1, 11,
+    -17, -2, -9, -6, -5, 10, 10, -19, -3, -9, 7, 7, -16, -19, 8,
+  },
+  {
+    -1, -4, -2, -5, -1, 5, 2, -12, 1, -1, -2, -3, -7, -2, 0, -15,
+    -1, 1, 1, 0, -6, 4, -1, -1, -2, -11, -1, 2, 0, 3, 0, -26,
+    6, 1, -5, -8, 0, 1, 0, -15, -8, 6, -2, 1, -5, 0, -4, -10,
+    6, -1, 1, -9, 8, -4, 10, -4, 3, 3, 2, -6, -8, -9, 7, -26,
+    5, -6, -7, -2, -5, -7, 2, -3, -16, -13, -6, -10, -4, 3, -8, -10,
+    -2, -6, -1, -4, 18, -1, 8, -4, 0, -15, 2, -6, 2, 8, 3, -11,
+    -9, -5, 2, 10, 0, -5, 2, -29, 12, -1, -18, -8, -2, -5, -4, -6,
+    -4, 2, 12, -5, -6, 4, 1, -9, -3, -17, -3, 17, -4, -5, -7, -34,
+    -9, -4, -13, -7, -9, -11, -10, -7, -1, 5, 1, -16, -2, 11, -4, -7,
+    -4, 5, 0, -22, -15, 0, -10, -20, -4, 9, -5, 13, -8, -9, -12, -9,
+    2, 11, 0, 0, 3, -14, -7, -6, 6, 2, 24, -13, -14, -8, -7, -15,
+    -6, -8, 2, -12, 3, -8, 1, -8, -3, 5, -14, -16, 16, -2, 2, -1,
+    2, 3, 6, -5, -2, 6, -6, 2, -16, 2, 1, -8, 0, 11, -16, -45,
+    4, -7, 26, -13, -7, -32, -2, 6, 10, -1, 15, -20, -11, 19, 12, -11,
+    -9, -3, 6, -7, 3, -7, -4, -2, -7, 6, -6, 1, 0, 6, -2, -20,
+    -4, -12, -1, -15, -4, 6, -6, 0, -16, 7, 6, 3, -9, 14, -12,
+  },
+  {
+    1, -3, 2, -1, -1, 4, 2, -4, -2, -3, 2, -3, 0, 3, -6, -5,
+    -3, -3, 1, -1, 0, 2, 2, 2, 3, 1, -10, -1, 7, -9, -4, -17,
+    -3, 0, 2, 3, -3, -4, -1, 1, 2, -2, -2, 2, 5, -5, 0, -3,
+    -3, -2, 4, -4, 4, -9, 1, -9, -4, 1, -14, -12, -5, -6, -1, -21,
+    0, -2, 4, 5, 4, 6, 1, -11, 16, -5, 12, -4, -3, -6, 4, -1,
+    1, -11, 3, 3, -3, -9, -4, -10, -2, -8, -2, 2, 5, -6, -1, -7,
+    -5, -2, 3, -5, -1, 2, 5, 2, 2, -4, -10, -16, 4, 6, -2, -16,
+    11, -1, 0, 4, 2, -18, -6, -18, -4, 2, 9, 5, -4, -7, 0, -19,
+    -12, -9, 9, -16, -1, -4, -4, -9, -16, 0, -1, -2, -3, -2, -8, -20,
+    1, -9, -19, -17, 6, -7, -14, -7, 14, -10, 9, -4, -1, -2, -2, -12,
+    7, -2, 1, 3, -7, 9, -9, 6, -1, -5, -3, 12, -3, -3, 1, -9,
+    1, 0, 1, -15, -9, 0, 19, -3, -2, -11, 0, 5, -7, -4, -3, -2,
+    5, -1, -1, -8, 12, 7, 1, 19, 13, 7, -6, -9, -1, 14, 11, -2,
+    -20, -4, -20, -3, 10, -14, 6, -13, 4, 0, -10, 4, 3, 2, -5, -7,
+    -7, 6, -11, -3, 0, -4, 6, 0, 10, 4, -5, 30, -3, 2, -3, 24,
+    6, -10, 9, -15, -17, -5, 11, 8, -1, 10, 6, -23, 3, 0, 5,
+  },
+  {
+    -1, -4, -2, -3, 1, -1, -1, -6, -4, 1, -4, -3, -5, -1, -6, -8,
+    1, 9, -3, 2, 1, 1, 3, -2, 2, -7, 6, 3, 1, 8, 2, -16,
+    -6, -8, -4, -6, -3, -10, 3, 2, -6, -1, 3, -4, 4, -5, -2, -6,
+    -7, 4, -2, -10, -3, -2, -4, -3, 7, -5, -7, -4, -8, 0, 1, -31,
+    6, -11, 5, -23, 0, -1, -4, -6, -2, 10, -9, 17, -6, 4, 8, -2,
+    3, -6, 4, 7, 6, -14, -9, -6, -2, 0, -6, 8, -1, 5, -4, -10,
+    -2, 6, -2, -4, 2, 6, 1, -18, 4, -14, 4, 1, -6, -14, -3, -1,
+    -3, 5, 5, -13, 3, 8, -2, -4, 1, 1, -1, 3, -5, -7, -3, -26,
+    11, -1, 0, -17, 3, -9, -8, 17, -6, -7, -12, -5, 1, -12, 4, 3,
+    1, -1, 4, -10, 11, 0, -2, 0, -18, -7, -8, 5, 10, 6, -14, -14,
+    -2, 3, 0, -14, -6, 3, -4, 0, -3, 8, -14, 3, -1, -7, 7, -10,
+    -10, 0, 3, -7, -5, -18, 10, -7, 11, 4, 0, 2, 9, 6, 6, 2,
+    -1, -8, -9, -22, -14, -16, -5, -13, -5, 2, 2, 3, 2, 8, 11, -20,
+    7, 2, -14, -6, 3, 3, -7, -6, 0, 2, 9, -5, -6, -5, -13, -28,
+    -4, 4, 7, -6, 8, -16, 20, 2, -1, -15, -7, -14, -26, -1, 5, -1,
+    -7, -10, -11, -10, -19, 4, -1, -15, 0, -12, 4, -2, -20, 13, 0,
+  },
+  {
+    -1, -3, 0, -1, 0, 1, -1, 1, 1, -5, -1, 0, 0, -2, 0, -7,
+    5, 4, -8, 2, 2, 1, -2, 6, -3, -3, -1, 1, 1, 1, 1, -17,
+    -7, -2, -4, -2, -7, -10, -5, 0, -7, -2, 3, -3, -5, -6, -2, 1,
+    -4, 0, -2, 0, -5, -8, -1, 5, 0, 0, -1, -1, 2, -1, 0, -20,
+    -10, -5, 1, -5, -1, -8, -16, -12, -10, 1, -6, 12, -8, -5, -3, -5,
+    1, 2, 5, -6, 5, 3, -4, -2, -4, -1, -1, 3, -7, 3, 4, 5,
+    -3, -19, 0, -3, -12, 2, -6, -1, 5, -8, -8, 3, 2, -5, -10, 3,
+    -11, -6, -2, 2, 7, 8, -19, -3, -3, 0, 1, -3, -1, 1, -2, -29,
+    4, -1, 0, -13, 3, 0, 8, 5, 4, 3, 1, -32, 10, -11, -6, -7,
+    8, 1, 13, -4, -19, -5, -2, 4, -24, -12, -2, -12, -3, 0, 1, 5,
+    0, 0, -3, -10, -7, -1, -2, -2, 0, 6, -7, 0, 3, 1, -4, 9,
+    -2, 3, 7, -11, -6, 2, -16, 4, 0, 8, 10, -1, 0, 8, 6, -14,
+    1, 5, 1, -10, -6, 9, -13, 4, -10, 6, -1, 0, 4, 0, 0, -17,
+    7, 1, 20, -4, -5, -5, 9, -5, 4, 1, -14, 11, -6, 4, 17, -1,
+    -12, 11, 4, -5, 2, -4, 3, -3, 0, -10, 0, 0, 2, 2, 12, 1,
+    4, -3, 4, -16, 13, 5, -5, -2, 2, -6, 3, -7, -15, -7, -18,
+  },
+  {
+    -3, 1, -2, -5, 3, 1, -2, -11, 0, 1, -9, 3, -4, -2, 2, -4,
+    -4, 0, 2, -3, 4, -13, 0, -1, 4, -11, 1, 5, -6, 4, 2, -17,
+    0, 3, -2, -2, -13, -3, -1, -5, -3, 6, -17, -15, -2, -4, -3, -2,
+    2, -2, -11, 15, 2, -2, -2, 5, 0, 3, -1, 6, 5, 0, 2, -7,
+    3, -5, -13, -5, 5, -4, 5, -8, 5, -15, 4, 6, 3, -13, 7, -12,
+    -10, -1, -3, -1, 12, -17, -5, -17, -6, -9, 5, 7, 2, -4, 1, -7,
+    -10, -8, -3, 2, 1, -1, -3, -3, -21, -13, 1, -3, 1, 0, 12, -8,
+    3, 0, 8, -6, -3, 4, -2, -6, -9, -7, -6, 1, -3, -1, -3, -28,
+    -30, -4, -9, 6, -4, 2, 1, -19, -4, -10, 6, 2, -9, -5, 16, -4,
+    -5, 2, 5, -18, -3, 7, -8, -6, -3, -5, -8, -6, -4, -2, 16, -13,
+    3, -5, -2, -1, 2, 6, 5, 1, 5, 6, 8, -25, -2, -2, 12, -20,
+    -15, -2, -10, -9, -1, 2, 8, 6, 5, -2, 13, -1, -1, 7, -3, -10,
+    9, 2, 0, -7, 1, 7, 1, 5, 5, -5, -11, 13, -17, 6, -5, 1,
+    2, 28, -4, -5, -13, 2, 7, -5, 7, 0, -4, -1, 3, -3, 14, -3,
+    6, -2, 8, -11, -20, 2, 4, 0, 5, -8, 10, -3, 4, -11, 7, 0,
+    -3, -3, -1, 1, 10, 4, 4, -8, -8, 4, -25, -4, 3, -12, 0,
+  },
+  {
+    -2, 0, 0, -1, -2, -2, 0, -4, -1, -2, 0, 1, -2, -2, 1, -10,
+    -3, 5, -5, -4, 1, -2, 3, 3, -2, 3, -5, -1, -6, 2, 1, -16,
+    -4, -3, 1, -3, -3, 1, -1, 1, 1, -2, -7, -5, 3, 3, 13, -6,
+    2, 2, -2, 4, -11, 1, 2, 2, -11, 6, -3, -3, 0, -8, 11, -28,
+    -1, -6, 1, -4, -1, 1, -4, -3, -3, -2, -7, -7, 5, -8, -1, -6,
+    15, -7, 0, 2, 0, -11, -6, -9, 8, -4, -10, -2, -5, 7, -4, -8,
+    -4, -10, -4, -6, -4, 5, -4, -1, 1, -6, 8, -3, 0, 1, -9, -4,
+    1, -13, -4, 4, 2, 1, 7, 4, 1, -11, 2, -2, -7, -11, 4, -26,
+    -4, 2, -1, 3, -2, -2, -8, -9, 7, 10, -10, -1, 7, 7, 12, 1,
+    -7, 5, -12, -10, -11, 6, -4, 6, 6, -3, -3, 13, -5, -7, 4, -5,
+    8, 1, -17, -11, 13, -6, 12, -1, 11, 5, -14, 13, -6, 8, -13, -18,
+    -12, 3, 2, -14, -3, -2, 0, -6, -2, -13, -9, -8, -2, 14, -19, -4,
+    -5, -10, -10, -13, -7, -10, -8, -7, -1, 14, -10, 0, 5, 1, -8, -1,
+    4, 3, 6, -11, 11, -5, -6, 0, 0, -3, 8, -10, 6, 6, 0, -7,
+    -9, -11, -1, -13, 5, -8, 18, 2, 6, 6, 4, 0, 4, -5, -3, 6,
+    -1, -1, -3, -5, -14, 5, 3, 4, -7, 5, -6, 4, -4, 14, 12,
+  },
+  {
+    0, 1, -2, 0, 2, 1, 1, -5, 3, -2, -3, 1, -1, -3, 1, -5,
+    1, 2, -5, -2, -4, -3, 3, 5, -2, -3, -3, -3, -3, 0, 3, -14,
+    -6, 1, 1, 6, -2, 11, 0, -5, -8, -8, 0, -10, 5, 10, -4, -1,
+    -3, -3, 7, 10, -5, -6, -1, -7, -3, 3, 6, 1, -5, -5, 0, -23,
+    0, -10, 4, -11, 11, 1, 14, -2, 3, -9, -2, 12, -17, -7, 1, -9,
+    2, -5, -9, -6, -7, 3, -3, -5, 5, -3, 7, 8, -11, -4, 1, 0,
+    -1, -10, 2, 2, 2, 5, -4, 11, 5, -5, 8, -2, -2, -4, 0, -5,
+    -1, -6, 3, 1, 0, 1, 5, -2, 1, -7, 8, 1, 0, 5, 2, -15,
+    -19, -4, 7, -3, -3, -5, 7, -7, 2, 13, -5, -12, -9, -5, -12, -4,
+    5, 1, -1, -3, -2, 1, 14, 3, -11, -17, 4, -1, -1, 6, 6, -2,
+    6, -9, 6, -7, -7, -9, 13, -13, -3, -1, 10, -5, 1, 4, 2, -13,
+    -2, -5, -6, -10, 2, -18, 12, 9, 15, -4, -2, 4, 2, -5, 4, -1,
+    13, -1, -2, -15, -2, 3, -10, -10, -18, -2, 6, 17, 9, 1, 2, 6,
+    -5, -8, -16, -1, 1, -5, 9, 4, 26, 9, 3, -2, -2, -10, 2, -3,
+    -8, -6, 5, -14, -9, 3, 4, 4, 5, -6, -8, 4, -1, -2, 3, 7,
+    -7, 6, 10, -6, 5, -3, 5, -8, -4, 8, -5, -4, 1, -3, -5,
+  },
+  {
+    0, 1, -2, -2, 2, 0, -2, -6, -1, 0, 1, -3, -4, 2, -1, -7,
+    0, 6, 0, -3, -2, 3, -7, -4, 0, 1, -1, -6, -3, 4, 4, -13,
+    -5, -1, 5, -1, 3, -5, -3, 3, -8, 2, 0, 2, 3, -7, 0, -5,
+    -6, -1, 2, -3, -3, -1, -4, -5, -3, -5, 12, 2, -2, 2, -5, -18,
+    -4, -11, -1, 1, 1, -6, -1, 0, 2, -2, 12, 1, 0, 6, 5, -6,
+    -3, -10, -8, -1, 2, 1, -9, 0, 0, -8, -2, -10, 7, -2, 0, -13,
+    -4, -2, 1, 1, 0, 4, -4, 13, 4, -5, 2, 7, 3, 6, 2, -5,
+    5, -2, 5, -9, -14, 8, -1, -6, -4, -6, -1, -3, 2, -7, -1, -23,
+    -1, 4, 2, -13, -2, 12, -4, -3, 14, 0, 10, 9, 9, 4, 2, 2,
+    0, -8, 2, -9, 13, -9, -1, 1, -11, 2, 0, 0, -3, -5, -9, 1,
+    -2, -8, 15, -2, -3, 7, 12, -2, 3, -9, 1, 0, 3, 2, -4, 1,
+    -1, 8, 6, -2, 9, 11, -12, -23, 6, -1, 0, 3, -3, 5, -12, -36,
+    6, 5, 5, -3, -1, 0, 4, -3, -14, -6, -12, -2, -8, -7, -2, -2,
+    8, -6, -3, -7, -3, 4, 12, -1, -10, 1, 1, -6, 8, 2, 0, -6,
+    -4, -6, -1, -11, 1, 6, -2, 1, -15, 13, -6, 11, -9, 17, -20, -2,
+    -19, 0, -6, -12, 5, 10, 17, 4, 4, 4, 3, -11, -7, 14, -1,
+  },
+  {
+    1, -3, -1, -6, -3, 4, -2, -5, -1, 0, 3, -1, 3, -8, -1, -15,
+    1, 1, 1, 3, -3, -4, -6, -7, 0, -6, -14, -9, -2, 0, 2, -19,
+    2, 3, -4, 0, -2, -4, -3, -3, -4, 0, 2, -4, 3, -2, 1, 5,
+    -5, -3, 3, -15, -5, -9, 3, 10, -9, 7, -7, -2, 5, 2, 5, -29,
+    8, -5, 2, -6, 4, 0, 6, -2, 3, -8, 9, 4, -3, -3, 2, -5,
+    -8, -12, 13, 4, 4, -3, 2, 7, -3, 8, 6, 4, 4, -5, 8, 6,
+    20, -10, 0, -2, -3, -4, -5, -19, 0, -2, 0, -7, -19, 4, -2, 0,
+    -7, 2, -3, 0, -9, -7, -3, -2, -15, -10, 10, -5, 4, 2, -3, -41,
+    2, -5, 4, -12, 10, 3, 9, -10, 6, -10, 1, -1, 6, -6, 10, 2,
+    9, -6, -7, -25, 15, -8, 3, 3, 4, 12, 4, 1, -2, 1, -11, -7,
+    3, -15, -13, -13, 7, 1, -13, -2, 10, -14, 3, 8, 9, -6, 10, 3,
+    -3, 7, -6, -13, -5, 7, -8, -11, -6, 11, -6, -7, 0, -11, 3, -1,
+    9, 6, 5, -13, -7, -4, 17, -6, -9, -2, 2, 2, 8, 10, -5, -25,
+    14, -2, -1, -6, 6, 12, 18, -19, 17, -29, -11, 12, 1, 10, -10, -7,
+    -15, 24, 25, -5, -11, -2, 2, -8, -3, 4, 2, -4, -2, -3, 10, -14,
+    -6, -9, 9, -3, -15, 0, -14, 4, 7, -4, 6, 2, -6, 4, 7,
+  },
+  {
+    -2, -4, -1, -6, 3, 1, 1, -2, 1, -2, -5, 4, 4, -7, -5, -12,
+    -2, 0, 1, 4, -1, 7, -2, 2, 0, 2, -7, 1, -3, 8, 4, -3,
+    2, -9, 11, -3, -7, -2, 2, -8, 2, 6, 6, 2, 1, 0, -6, -1,
+    -6, -5, 0, -3, 2, 7, 0, -7, 9, 1, 3, -9, 15, -5, 5, -29,
+    -19, -9, 10, -10, -1, -4, -12, -6, 2, -7, 0, -1, 2, -7, 5, 0,
+    6, -5, 3, 3, -1, 3, 6, 2, 0, 2, 9, -3, -8, -3, -6, -7,
+    4, -12, 3, -8, 0, -12, -3, -5, 8, -6, -12, 0, -20, 6, -2, 5,
+    3, 0, -19, -5, 2, 3, -6, 1, 7, 2, -21, -1, -2, -3, -4, -24,
+    1, 25, 6, -6, 4, 6, 12, -5, 6, 1, 4, -1, -3, -39, -2, 4,
+    -11, 7, 3, 1, 8, 1, 2, -13, -1, -6, 6, 13, 12, 5, -1, -7,
+    -1, -6, 17, -13, -9, -15, 9, 2, 5, -1, 0, 13, 1, 4, 9, -3,
+    -4, 6, -1, -11, -7, -5, -24, -14, -8, 0, -3, 3, 15, -1, -1, 0,
+    0, 5, 2, -10, 1, -8, -2, 6, 3, 9, 5, -12, 9, 7, -2, -10,
+    7, 2, -9, -9, -13, -15, -9, 4, -1, -25, -7, -1, -10, -1, 1, -12,
+    -23, 13, 4, -11, 4, 27, 2, 3, 0, -9, 8, -1, 1, 17, -15, 8,
+    9, -4, 7, -23, -1, -52, -4, 1, -19, 3, 0, -2, 4, 1, -13,
+  },
+  {
+    1, -7, 0, 0, 1, -7, -1, -7, 6, 1, -1, -5, -3, -6, 6, -3,
+    -3, 1, -10, 1, -3, -1, -3, 6, -5, -1, -1, -7, 5, -3, -11, -5,
+    -11, -7, 2, -4, -9, 16, 5, 1, 3, 9, 5, 1, 2, -4, 4, -12,
+    -5, 3, 5, 3, 2, -10, -11, -15, -9, 0, -6, 6, -6, -18, -3, -19,
+    16, 7, 0, -2, 0, -4, -9, -6, -3, -4, 2, -3, -19, 10, 12, -9,
+    -3, -8, -2, -4, 11, 2, 5, -2, 4, -5, 3, 1, 0, 2, -9, 17,
+    -2, 18, 10, -1, -2, 2, -3, 2, 5, -9, 0, 1, 4, 5, 5, 14,
+    9, -5, -9, 2, -2, -4, 5, 7, 7, -7, -5, 8, 6, -4, -4, -27,
+    10, 7, -30, -1, -28, -11, 7, -17, -4, 1, -4, -2, 2, 1, 3, 18,
+    6, -11, -3, -10, 9, 3, -1, -14, -2, 26, 12, -13, -5, 8, -26, -6,
+    -3, -5, -2, -8, -10, -19, -14, -11, 5, -6, -21, 15, 7, -5, 5, -5,
+    9, -7, 2, -8, -1, 4, 16, 6, -4, -11, 4, 1, 5, 1, -12, 2,
+    -24, 0, -5, -3, 24, 2, -20, -10, -10, -11, 3, -1, 13, -21, -5, -1,
+    -9, 15, 15, -13, -5, -2, -1, 5, -2, 0, -4, -15, 10, -3, 3, -8,
+    -36, -10, 8, -16, 1, -8, -3, -19, -5, 6, -3, -19, -10, 4, -2, 1,
+    4, 16, 14, -5, -9, -9, -15, 0, -26, 2, 6, -1, -1, -5, -17,
+  },
+  {
+    -2, -2, 1, -2, 0, 0, 0, 3, 2, -1, 1, 0, 0, -8, 4, -5,
+    6, 5, 7, 1, 3, 1, 2, 3, 9, -4, -4, -2, -4, 1, -5, -14,
+    1, 7, 20, 6, -2, -2, -12, 3, -17, 0, -2, -1, 4, -9, -17, -3,
+    -10, 1, 9, -5, 3, -8, -3, 9, -8, -3, -2, -2, 0, -9, -2, -23,
+    0, 3, 2, -1, 17, -9, -7, -1, -3, -2, 1, -11, 5, 7, 3, -6,
+    7, 7, -3, 0, -7, 15, -2, 2, 11, 0, -2, 9, 3, 17, 9, 3,
+    -11, 7, -1, -1, -1, 0, 19, -6, -6, -1, 8, -10, -3, -4, 2, 2,
+    -14, -22, -5, -2, -4, -3, 8, 0, 13, -5, 3, 3, 0, -2, 3, -25,
+    -4, -16, -2, -13, 1, 13, -4, 6, 11, -10, -2, -3, -18, 21, -22, 4,
+    -9, -12, -3, 1, 19, 2, -11, 15, -1, 8, 4, 24, -31, 0, -1, -11,
+    3, -5, 2, -2, -25, -2, 7, 0, 3, -5, 0, 2, 14, 9, 4, -4,
+    9, -5, -6, -10, -8, 17, -7, -1, -24, 1, 1, 0, -18, -13, 16, -6,
+    2, -5, -1, -4, 10, 5, -3, -18, 16, -5, 1, -6, 0, -1, -29, -13,
+    6, -1, 4, -16, -4, 2, -7, -6, -1, 3, -2, -11, -10, 0, -2, 2,
+    10, 28, 8, 6, 14, 1, 9, -19, 6, 3, -19, -4, 5, 16, -1, 1,
+    3, -8, 4, -1, -4, -10, 1, 10, -24, -8, 4, -13, 10, 8, -5,
+  },
+  {
+    0, -4, 0, -2, 0, -3, -1, -9, -7, -1, -1, 5, 3, -4, 4, -12,
+    -4, 0, 4, 1, 0, 6, -3, 1, -5, 2, 9, 10, 0, 3, -11, -20,
+    -8, -6, 2, -17, -3, -5, -3, -3, -6, -10, -1, -1, 1, 4, 0, 6,
+    -3, 17, 9, 4, -3, 6, -14, -5, -14, 4, -4, 1, -1, -15, -6, -3,
+    11, -6, -7, -15, 7, -15, 0, -7, 3, -12, -7, -4, 4, 6, 2, -10,
+    -7, -12, 0, 2, 8, 5, 0, 5, -2, 1, 10, -6, -8, -7, 7, -11,
+    5, -5, -10, -5, 13, 0, -2, -3, 0, -10, 2, -1, 4, 15, 3, -2,
+    -5, 23, -1, 0, 9, 0, 1, -5, 0, -4, -2, 16, -7, -4, 1, -30,
+    -15, 0, 4, -18, -11, 7, 4, -14, 9, 2, -10, -3, 23, 4, -7, -25,
+    13, 0, 2, -22, 7, -14, -17, -2, -5, 8, 9, 2, 8, -5, 0, -16,
+    -13, -1, -1, -13, 9, -1, 4, -10, -2, 5, -12, 0, -7, 3, 23, 9,
+    3, 5, -5, -8, -3, 12, 10, -2, -7, 14, 7, 13, -7, -3, 7, -5,
+    3, 0, 10, -17, 13, -16, 0, -23, 1, 2, 17, -6, 6, -7, -1, -2,
+    2, -5, -6, -8, 7, -2, 1, 3, -1, 3, 6, -9, 18, 11, -13, -10,
+    -3, 6, 6, -14, 26, 9, -13, -7, 9, 3, -18, 1, -2, -4, 4, 8,
+    3, -4, -1, -4, -11, -2, -13, -3, -22, 2, -6, -5, -15, 12, 7,
+  },
+  {
+    0, 0, 0, -4, -2, 1, -2, -6, 1, -3, -3, 0, -7, -3, -1, -7,
+    3, 1, 1, 0, -2, -2, 4, 2, -3, -4, -5, -2, -2, 4, 4, -15,
+    1, 2, 10, 0, -7, -2, 1, 5, -5, -2, -4, -4, -6, -2, -1, 0,
+    -5, -2, -1, -7, -1, 0, 7, 4, -5, 1, 0, -3, 1, -1, -2, -17,
+    -4, 3, -2, -5, -8, 4, 7, 1, -7, -3, -8, 8, 5, -12, 3, 0,
+    7, 13, 10, 9, 7, 5, 11, -11, -6, -7, 5, 0, 11, -3, -5, -12,
+    4, -8, 4, -6, -3, 1, -3, 8, -4, 3, 2, -3, 10, 2, 4, -6,
+    -4, -10, -4, -4, -2, 2, -6, 2, 0, 0, 6, 3, -4, -6, -10, -21,
+    -2, -8, 4, -1, 3, 1, -8, 2, -3, -7, 24, -1, -7, 8, -14, 9,
+    -5, -7, 11, -13, 8, -2, 4, -1, 4, 7, -8, 24, -6, -6, -6, 2,
+    -3, -8, 29, -17, 23, 2, -3, 3, 12, 13, -10, 2, -7, -4, -8, -25,
+    8, -9, 1, 1, 11, 2, 0, -10, 3, 11, 3, -5, 10, -20, 4, 2,
+    3, 15, 0, -13, -5, -7, 11, -10, 3, -7, 10, 2, 1, 8, -8, -7,
+    22, 3, -10, 1, 17, -8, -11, -1, 7, 4, 1, -4, 2, -10, -5, -8,
+    1, -13, -1, 3, -2, 11, -5, -1, 6, 1, -3, 0, 1, -1, -5, -8,
+    2, -7, 1, -12, -2, -1, 5, -4, 0, 5, 2, 4, 3, -21, -16,
+  },
+  {
+    -1, -1, -3, -4, -1, -2, 1, -4, 2, 3, -2, -2, 2, 0, -1, -8,
+    -1, 0, -3, 2, 1, -2, -1, 3, -4, 0, 4, -3, 3, -2, 0, -10,
+    0, 0, -1, -1, -3, -2, 0, -4, -6, -1, 3, 4, 0, 4, -1, -3,
+    9, -2, -1, 1, 2, 3, 5, -6, 3, -4, 5, -5, -2, -8, 0, -14,
+    2, -2, 6, 1, -3, 4, -1, 6, 4, 1, 8, -10, -1, 4, 2, -4,
+    -5, -7, -3, 11, 1, 0, -1, -3, 5, -5, -1, 4, -2, -4, -5, -4,
+    -10, -5, 5, 5, -6, 3, 1, 2, 2, -9, 5, -10, 15, -2, -9, 13,
+    0, -5, -9, 2, -4, 0, -3, 5, 10, -6, 4, -1, -4, -2, -3, -20,
+    15, -2, 3, -11, 2, -4, -5, 5, 7, -1, 11, 3, 9, 0, -3, -5,
+    1, 4, 3, 1, 3, -13, 4, -14, -6, -10, 1, -4, 7, 12, -1, -10,
+    -3, -4, -1, -6, 2, -3, 4, 10, -2, 8, 2, 5, -5, -10, 11, 7,
+    -4, 1, 25, -10, 1, -3, -4, 6, 0, -3, -6, 0, -10, -7, -11, -20,
+    2, -21, 2, -7, -8, 0, -22, -6, -9, 10, 2, 3, 6, -1, -4, 3,
+    2, 2, -6, -10, -4, -2, 1, 1, -9, 5, 16, -7, -3, -24, 2, -9,
+    -15, 3, 2, -1, -1, 2, 2, -3, 4, -4, -2, 13, 6, -1, 0, -5,
+    7, 5, -15, -18, 19, -4, -9, -5, -14, 1, 0, 7, 5, 9, 13,
+  },
+  {
+    0, -1, 3, -4, 1, 1, -1, -3, -4, -3, 0, -3, -1, -2, 3, -3,
+    2, 1, -1, 0, -2, 1, -1, -1, 1, 2, -1, -4, -2, 6, 11, -13,
+    -1, 2, 7, -2, -9, -4, 5, 4, -5, 0, -6, 3, 4, -4, -1, -4,
+    3, 10, -9, 0, -9, -3, -3, -3, 1, 4, 1, 3, -7, 0, 19, -12,
+    -4, -2, 2, 2, -4, 4, 5, 12, 0, 6, 4, -3, 3, 1, 5, -2,
+    -4, -10, 0, -3, -6, -3, 4, 0, 0, -11, 6, 6, -5, 11, -7, -3,
+    -1, -1, -7, -6, -5, 4, 3, -5, 3, 3, -3, -6, -4, 2, -2, 12,
+    -3, -4, 0, 1, 12, 4, -8, -1, 4, -14, 4, -8, 4, 11, 8, -28,
+    0, -4, 4, -14, -5, 5, -11, 1, -7, -1, -6, -7, 1, 0, -17, 4,
+    13, -4, 2, -4, 14, 1, -6, -5, -11, -1, 7, -9, 10, -2, 1, -2,
+    -4, 12, 5, -1, -12, -2, -14, 4, -7, 1, -5, -9, -6, -4, -1, -10,
+    8, -11, 6, -10, -1, -6, 0, -9, -8, -5, 1, -16, -4, 9, -5, 3,
+    1, -3, 0, -9, 2, -13, -2, 5, 0, 16, 13, 1, 14, -7, -19, 8,
+    12, 7, 1, -8, 18, -2, 1, -26, -3, 0, -3, -1, 10, -3, 9, 0,
+    3, 13, 9, -10, -8, 7, 3, -2, 12, -7, 5, -1, -2, -7, 6, 10,
+    0, -1, -2, -24, -11, -8, -12, 2, 3, -2, -3, -12, 4, -20, 33,
+  },
+  {
+    -7, -8, -2, -5, -2, 1, -3, -29, -1, -5, -2, -3, -7, -10, -2, -15,
+    4, 0, -2, 2, 0, 0, 0, -4, 1, -11, 3, -5, 0, -2, 6, -14,
+    7, 1, -7, 0, -8, -8, -2, -3, 4, 3, -1, -2, -2, -6, 1, -3,
+    0, 5, 4, -12, 9, -2, -1, -14, -5, 2, 2, -5, -3, 0, 8, -30,
+    3, -8, -2, -11, -4, -4, -1, -5, -4, -2, 2, -4, 2, -3, 3, -4,
+    -2, 0, 1, -6, 1, 1, -5, -2, -4, -7, -5, 0, 0, 7, 10, -2,
+    8, 0, 3, -2, 0, 0, 4, -22, -10, -7, 1, 5, -8, -4, 3, -12,
+    5, -6, -14, -1, -9, 1, -6, -6, -2, -3, -3, 10, -2, -1, 4, -30,
+    -7, -2, -10, -16, -1, -5, 6, -16, -4, -9, -12, -7, 6, 2, 5, -2,
+    -2, -8, -5, 0, 1, -7, 3, 3, -2, -1, 0, 0, 12, -7, 7, 1,
+    -4, -4, 9, -8, -6, -6, -4, -5, 6, 1, 3, 1, 0, -2, -4, -11,
+    -2, 2, -13, -13, -12, 0, -3, 12, -3, -12, -17, -4, -8, -1, -4, -9,
+    3, -2, -1, -7, 8, 7, 0, -1, 11, 3, -15, -1, 5, -3, 4, -26,
+    -3, -9, 2, -1, -3, 6, 3, -2, -10, 7, -1, -1, -4, 7, -1, -30,
+    -1, 6, 9, 5, -2, -11, -15, -8, -8, -10, 10, -5, 0, 8, -2, -4,
+    6, 1, 10, -4, -7, 2, -6, -3, -1, -1, -1, -2, 8, -12, -9,
+  },
+  {
+    -2, -2, -3, 0, -2, -3, -2, -5, -3, 0, -3, -6, -2, -2, -2, -11,
+    -1, -2, 5, -6, -1, 2, 3, 10, -1, 2, 3, -2, 5, 2, 0, -5,
+    0, 4, 5, 2, -5, 6, -11, -3, -11, 7, -1, 0, 3, 2, 5, -5,
+    13, 3, 0, 0, -4, -1, -2, 5, -1, 3, -2, -2, 0, 0, 0, -13,
+    -11, 2, 0, -1, 3, -4, -4, -13, 8, -14, 11, 6, 13, 10, -2, -12,
+    6, -12, 3, -6, -2, 5, 6, -2, -2, 0, 1, -4, -1, -4, -6, 7,
+    4, -4, 24, -10, 8, -8, -3, 3, 12, 4, 2, 3, 4, -3, -2, 4,
+    -4, -3, 6, 0, -4, 4, 1, -6, 3, -6, 0, -3, 2, 5, 2, -22,
+    -4, -23, 3, -11, -14, 12, 1, 5, 4, 10, -12, -8, -12, -8, 9, 1,
+    8, 16, -8, -11, 7, -11, 1, -3, -1, -19, 9, -16, 18, -8, -3, -15,
+    9, -20, -6, 6, -1, 2, -1, -4, -1, -4, -9, -8, 2, 4, 4, -7,
+    -1, -4, -10, -10, 13, 3, 2, -9, 4, -7, 5, 2, -14, -18, -1, -8,
+    8, 4, -5, -8, 6, -9, -24, 3, 13, 15, -13, -8, -6, -1, 9, -5,
+    -2, 9, -6, -18, -12, 8, -12, -2, 3, 8, 9, -12, -3, -12, -7, -16,
+    11, 14, -14, -4, -10, 9, 6, 5, 9, -1, 3, -12, 3, 5, 9, -9,
+    8, 4, -9, -20, -3, -6, 13, 4, -5, -4, 8, 5, -1, -1, 2,
+  },
+  {
+    0, -5, -1, -5, 1, -1, 0, -10, 1, -4, 2, 2, 4, -1, 1, -12,
+    4, 0, -3, 2, -2, 2, -2, -3, 6, 0, -6, 4, 3, 1, -1, -17,
+    -2, -3, -4, -3, -3, 0, -10, -10, -8, -1, 1, 3, -2, 0, -2, -2,
+    6, -4, 11, 0, -3, -9, 1, 0, -1, 3, -6, 5, 1, 5, 6, -21,
+    0, -12, -3, 3, 4, -6, -4, -6, -9, -9, -13, -6, -2, -1, -2, -9,
+    -10, -5, 3, -14, 4, 2, 1, -10, 2, -7, 0, -12, -10, -2, -3, -1,
+    -2, -9, 10, -3, -4, -2, 25, 0, 0, -3, -4, -21, 4, -12, 2, -11,
+    5, 1, -6, 7, -4, 9, 8, -1, 7, -2, 8, -1, -2, 10, 14, -35,
+    -14, -5, 2, -20, -3, 3, 1, 1, -3, 1, -2, 0, -6, 3, 2, -15,
+    2, 1, 1, -12, 3, -9, 0, -16, -2, -5, 3, 6, -10, 16, 0, -14,
+    -5, -4, 10, -6, 12, 17, -4, 3, -6, 5, 5, -6, 0, -8, 1, -4,
+    -11, -17, 14, -3, 1, 6, -7, -5, 6, 8, -2, -5, 6, -7, 3, -8,
+    13, 6, -11, -7, -5, 4, -2, -8, 4, 4, 4, -9, 2, -13, 17, -2,
+    2, -1, 5, 3, -5, -4, 3, 19, 8, -2, -2, 1, -7, 7, -7, -3,
+    -10, 2, 2, -19, -1, 3, 10, 4, 9, -15, -8, 7, -12, 1, 21, -8,
+    -11, 1, -3, -7, -2, 9, -8, 1, 7, 15, 5, 0, -3, 9, 10,
+  },
+  {
+    -2, -3, 0, 1, -4, -1, 0, -6, 4, 1, -1, -4, -1, -5, -1, -8,
+    1, -2, 6, 3, -3, -6, -2, -4, 2, -1, -4, 12, -2, -1, -5, -12,
+    1, -5, 4, 4, -7, -5, -13, -3, 0, -12, -2, -6, 2, -2, 2, -1,
+    -6, 2, 6, -6, -6, -11, -1, 2, -13, 1, 5, -1, -10, 4, -4, -16,
+    0, -8, -2, 1, -4, 15, 4, 6, 11, -4, 1, -10, -1, 9, 8, -14,
+    5, -8, -8, -28, -9, 0, -3, -5, 1, -1, 0, -4, -6, -2, -7, -4,
+    5, -5, -4, 2, 1, 1, 5, -11, -8, -6, 7, 12, -1, 2, -3, -10,
+    -1, -13, -10, -4, 5, -1, -5, -9, -2, -7, 7, -6, -23, 16, -1, -13,
+    -12, -4, -7, -21, -10, -5, 2, -1, -2, -5, 7, -6, -9, 4, -6, -8,
+    -7, -7, -9, -5, 6, 9, 1, 16, 2, 3, -4, 12, -18, 1, -13, -12,
+    1, 10, 6, -3, 4, -2, -1, -24, -11, -11, 1, 1, 1, 4, -5, -16,
+    -1, 3, -3, -6, 4, -7, 10, -10, -2, -3, 1, 7, 12, -7, -9, -12,
+    10, 2, 12, -11, 13, 1, -4, -11, -1, 1, 10, 3, -9, 4, -1, -19,
+    -1, 3, -1, -14, -2, 5, -16, -11, 24, -6, -9, -7, 3, 3, -1, 7,
+    -7, 7, -23, -24, 11, 5, 2, -5, -4, -1, -4, 2, -2, 4, 15, 6,
+    7, -8, -1, -5, -14, -4, 8, 0, 0, -25, 0, 3, -1, -9, -2,
+  },
+  {
+    -1, -2, -1, -4, -1, 2, -2, -9, 2, -4, 5, -3, 1, -5, 2, -8,
+    -4, 3, 1, 7, -2, 1, 2, -8, 2, 2, 1, -1, 2, 1, -2, -15,
+    -5, -10, -3, -2, -5, -1, -1, -8, 9, 2, 4, 5, 4, -5, 6, 3,
+    -7, 2, 0, -4, 3, -1, -4, -4, -2, 6, 0, 6, -2, 4, -7, -22,
+    -9, -7, -5, 12, 9, -1, 5, -4, 1, 1, 5, 0, -3, 4, -2, -4,
+    3, -13, 17, -10, 0, -4, 2, -11, 7, -1, -2, 3, 10, -13, 0, -7,
+    -3, -2, 3, 2, 3, -2, -2, 2, -2, -13, -6, 5, -7, 7, -2, 2,
+    1, -1, 0, -1, -7, 0, 4, 5, 8, -5, 0, 0, 3, 1, -3, -30,
+    -24, -14, 1, -9, -17, -3, -6, -6, -28, -1, -8, -7, -2, 3, -2, 3,
+    -11, -13, 5, -10, -1, -9, 4, -5, 13, 8, 4, -2, 24, -11, -6, -6,
+    13, -9, 1, -3, 15, 7, -29, -10, 6, -5, 3, -4, 0, -1, 0, 1,
+    -7, -1, 4, -25, -5, 2, -3, -2, 1, -4, -1, 12, 10, -20, -11, -9,
+    3, -7, 6, -8, -19, 12, -6, -15, -4, 1, 12, -10, -5, 2, -3, -2,
+    -8, 3, 2, -16, -9, -11, 6, -1, -14, -14, 1, -9, -10, -6, -3, 4,
+    -14, 10, -1, -2, -6, -10, -11, -9, 0, 12, -4, -3, 3, 2, 11, 4,
+    6, 5, -1, -9, 0, -1, -1, -1, 5, -18, 5, 1, 16, 12, -5,
+  },
+  {
+    -1, -2, -3, -6, -2, 1, -3, 1, -4, 2, -1, 2, -1, 1, -4, -12,
+    12, 1, -5, 5, 1, 1, -2, -2, 5, -3, -4, 1, -1, 1, 3, -16,
+    0, -1, -19, -2, -8, 5, -4, 5, 5, -5, 11, 6, 3, -10, -3, -15,
+    -2, 4, 9, -5, -7, -7, 3, 0, -3, -5, -3, 2, -5, 4, -2, -24,
+    -3, -3, 1, -6, 1, 1, -2, 0, 2, -8, -2, -1, 5, -2, -1, 2,
+    5, -6, -3, -1, -14, -1, -24, -4, -5, 3, -7, -3, -6, 4, -3, -13,
+    -2, 1, 0, -2, -1, -6, -4, 12, -10, -6, -7, 10, -2, -1, 2, 2,
+    0, 0, 1, -12, 0, -2, 3, 3, -8, -5, -1, 2, 4, -5, -1, -8,
+    -6, -12, -3, -11, -9, 3, 6, 1, -4, 0, 7, -23, 25, 10, 7, -1,
+    -11, 4, 0, 4, 5, -3, 2, -2, 2, 7, 3, -10, -8, 9, 13, -11,
+    -11, 6, -5, -19, 7, -5, -14, -12, 5, 12, 1, -8, 16, -17, 3, 4,
+    0, -6, 4, -12, 7, 1, -3, 4, -4, 4, 0, -6, 6, -13, -3, -18,
+    -2, -12, 6, -15, -12, -4, 11, -12, -6, 0, -1, -9, -5, -19, -7, -8,
+    29, -14, -1, -16, -8, -6, -5, -1, 4, -2, -2, 0, 9, 11, -3, -1,
+    9, -1, -5, -15, 4, -3, -15, -20, -4, 1, 0, 0, -10, -2, 3, -1,
+    -10, -5, 11, -12, 2, -7, -6, 6, -1, 3, -1, -13, 1, -3, -2,
+  },
+  {
+    -1, -2, 0, -1, 2, -2, 0, -1, -4, 1, 4, -4, -2, -5, -4, -4,
+    4, -2, -6, 0, -4, 1, 9, -3, 4, 0, -3, -2, 3, 0, 7, -14,
+    -2, 1, -17, -4, -8, -2, -1, -5, -5, 1, -2, 4, -4, 8, 4, -6,
+    -8, -6, 5, -2, -3, -3, 5, -5, 0, 0, 0, 1, -6, -1, -1, -16,
+    -6, -9, -4, -8, -3, -12, -5, -3, 2, 8, -9, -1, 16, -1, 5, 1,
+    -5, 1, -2, 4, 6, -1, 2, -2, -4, -3, 3, -1, -1, 8, -19, -9,
+    2, -5, -10, 1, 2, -4, 2, -4, -7, -3, -8, -8, 8, 4, 3, -1,
+    6, 0, -10, -4, 1, 0, 7, -3, -1, 3, -10, 8, -10, -9, -2, -25,
+    -5, 17, 1, -12, 2, -2, -7, 6, -2, -16, 5, -17, -9, 9, -12, -10,
+    -6, 4, -18, -4, -19, 7, 4, -3, 10, -7, 24, 1, -8, 2, 2, 1,
+    6, -3, -13, -9, 8, -3, -18, 6, 10, 2, -9, -7, 3, -6, -3, 3,
+    2, 8, 11, -6, -6, -9, 0, -8, -13, -15, -4, -7, -1, 19, 4, 5,
+    1, 6, 12, -15, -6, 0, -4, 1, 9, -6, 5, -3, -7, 6, -20, 3,
+    -3, -16, -9, 2, -5, 3, -3, 14, 2, -10, 3, 3, 9, -1, -8, -11,
+    -14, -7, 9, -2, -19, -8, 2, -3, 7, -9, 6, 7, 2, -4, -1, 2,
+    4, -7, -14, -25, -7, -19, -4, -1, -4, 6, 0, -18, -1, 4, -2,
+  },
+  {
+    -1, -1, 1, -4, 0, 2, -1, -9, 0, 8, -5, -2, -2, -3, -4, -18,
+    4, 1, 2, 0, 7, -6, -6, 1, 0, 7, -5, 1, -3, -3, -3, 2,
+    -1, -5, -5, 0, 1, -4, -8, -6, -5, 6, 14, 6, -3, 3, 1, 2,
+    -9, 3, 1, -3, -2, -2, 1, 5, 0, -3, 2, -4, -8, 2, -3, -25,
+    -19, -2, -8, 1, -20, 3, -7, -4, 0, -6, 2, 3, -7, -3, -4, 4,
+    -1, -3, -2, 4, 7, 5, 15, -16, -23, -1, -7, -1, -3, 0, 4, -2,
+    10, -7, 1, 9, -1, -7, -7, 1, 3, -3, 10, -1, -3, -7, 2, -4,
+    -4, -3, -2, -7, 6, -4, -1, -9, -12, -7, -2, 3, -3, -3, -1, -31,
+    -4, 25, -6, -5, 0, 10, -10, 3, -8, 3, -5, -7, 9, -6, -3, -7,
+    -2, -2, 7, 1, 0, 0, -10, -1, 9, -13, 4, -10, -8, -3, 1, 5,
+    -3, 5, -18, -11, -9, -8, -6, -18, 0, 11, 10, 0, -4, -3, -26, -4,
+    -5, -30, 1, -10, 0, 9, -6, 1, 3, 6, 2, 14, 7, -5, -2, 2,
+    0, -9, 17, -5, -8, 0, -18, -6, 6, -2, 10, -4, -3, 5, 2, -5,
+    14, 4, -2, 7, -11, 0, 20, 1, -3, -7, -1, 15, 4, 2, 3, 8,
+    -2, -11, 0, -2, 11, 4, 2, -16, 7, 5, 20, 5, 5, 0, -3, -5,
+    1, -2, 12, -15, 9, 2, 2, -5, -2, -3, -3, 6, 1, 2, -2,
+  },
+  {
+    -1, -3, 2, -6, 1, -4, -6, -8, -3, -2, -5, -4, 0, -15, -1, -3,
+    -4, -1, -4, -1, -8, 6, 1, -7, -5, 0, -1, 18, 0, 0, 5, -21,
+    -1, -1, 0, 3, -8, 2, -4, -3, 3, -7, -3, -5, 9, 3, -6, -10,
+    -1, 5, -6, -1, 1, 4, 1, -2, -28, -1, 3, -7, -2, 3, -6, -26,
+    5, 4, -4, 4, 0, -5, -6, -7, 8, -7, 0, 2, 2, -10, 5, -2,
+    11, 0, -3, -3, -7, -3, -2, -5, -3, -2, -22, 4, -5, -7, 8, -5,
+    1, 0, 3, -1, 6, 2, -2, 10, -4, 9, 5, 0, 12, -8, -2, -5,
+    2, 38, 3, 9, 3, 0, -3, -12, -4, -12, -2, -1, 0, -2, 0, -23,
+    -5, -3, -6, -3, 22, 12, -10, -6, 7, 16, -10, -11, -2, 1, 8, -6,
+    -5, 12, -13, -11, -15, 6, -15, -8, -5, -12, -9, 10, 7, 17, 5, -3,
+    3, -3, 9, -10, 5, -3, 7, -38, 2, 3, 4, -16, -3, 0, -5, -8,
+    4, -11, -4, -16, -2, 17, 0, -12, 1, 1, 7, -8, 7, 3, -4, -22,
+    -24, -3, 3, 1, -1, -7, -6, -7, 9, -6, -11, 0, -8, 2, -2, -7,
+    -10, 0, 3, -12, 1, 15, -10, -6, 0, -11, 11, 17, -5, -15, 2, -7,
+    13, -3, -1, -7, 32, 2, -1, 3, 7, 8, 6, -1, -1, -10, -3, -13,
+    6, -6, -3, -11, 6, 4, 0, -12, -1, -24, -18, -3, 15, -3, 1,
+  },
+  {
+    3, 0, -4, -3, -1, -8, 1, -6, -3, -2, 8, -19, -3, -1, -4, -10,
+    -4, -1, -2, 2, 2, 0, -8, -8, 2, 0, -4, 5, -6, 12, 5, -18,
+    -7, -4, 2, -10, 0, 3, -8, 6, 1, -3, -1, -4, 2, -13, -1, -7,
+    -13, -2, 5, -9, -2, -4, -1, 4, -4, -8, -6, 2, 14, -1, 4, -12,
+    6, -9, 9, 3, -5, -5, 5, -24, -11, -10, 0, -5, 8, 3, -1, -7,
+    -8, -9, 7, -6, -4, 8, 2, 3, -2, -6, 0, -4, 2, 1, 11, 6,
+    -7, -23, -4, -4, 0, -1, 3, -10, 0, -7, -3, -8, 0, -8, -1, 8,
+    6, -25, 11, -13, 2, -5, -7, 3, 1, -5, -18, 2, 4, -5, -13, -12,
+    5, 4, 3, -16, 4, -12, -2, -21, 2, -4, 3, -15, -3, -6, 1, 9,
+    3, -6, 10, -5, -1, -1, 6, 4, 5, -4, -18, -6, -1, -10, 4, -1,
+    3, 16, 15, -1, 6, 2, -18, -10, 4, -4, 5, 0, -12, 2, 1, -2,
+    4, -16, -5, -5, 5, 6, -7, 3, -13, 13, -10, 13, -10, -12, 6, -18,
+    29, 8, 7, -2, -1, 13, 16, 0, 1, -2, -6, -5, 10, -1, -3, -17,
+    1, -4, 3, 5, 10, -6, 2, -16, 8, -7, 6, -4, 0, 5, 7, -6,
+    14, -12, 16, -21, 1, -2, -19, -18, 7, -13, 8, -4, 9, -6, -3, -3,
+    2, -8, -3, -14, 6, 33, -7, 0, 7, 7, 6, 7, -8, -12, -11,
+  },
+  {
+    -1, -3, 0, -4, -3, 0, 1, -12, -4, 0, -2, -1, -3, -6, 1, -13,
+    3, 4, 6, 2, -2, 2, -2, 5, 5, -1, 5, 1, 0, 1, 5, -11,
+    -5, 3, 1, -4, -9, -2, -14, -3, 2, 8, -5, -7, -5, -4, 6, -6,
+    -11, 1, -5, 6, -1, -7, -6, -7, -5, 1, 0, -1, 1, -6, -3, -26,
+    5, -3, 5, -7, -2, -2, -6, -4, 2, 7, 1, -2, 5, -11, 9, -9,
+    -5, -10, 7, 4, 6, -12, 1, -5, 7, 1, -7, 2, 5, 8, 2, -14,
+    3, -10, 10, -1, -3, -2, -2, 6, 0, -6, -8, -6, -5, 7, -2, -4,
+    -2, -14, -14, -3, 2, -3, -8, 3, -6, -5, -6, -2, 5, 13, 2, -36,
+    2, 6, 22, -10, 1, 2, 10, -8, 7, 1, -5, -8, 11, 2, 4, -7,
+    4, 3, 6, -9, -26, -5, 2, -5, -1, 4, -1, 19, 12, -18, 16, 1,
+    1, -6, 0, -17, -5, 8, -18, 0, -7, 4, -8, -8, -1, 6, 14, 3,
+    2, -4, -7, -17, -4, -5, 5, 3, 2, 4, 6, 5, 1, 4, 7, -12,
+    -5, 1, 12, -8, -4, 0, 5, 4, 1, 8, 0, -6, -4, -5, 2, 11,
+    8, -1, 1, 7, -3, -7, 2, 1, 6, 7, -3, 2, -5, -13, 3, -15,
+    0, -2, 3, 4, 9, 5, -7, -3, 3, 0, 1, 9, 13, 0, -4, 6,
+    -1, 2, -11, -8, 0, -5, 6, -2, -7, -5, 2, -2, 0, 7, 25,
+  },
+  {
+    -5, -6, 0, -7, 3, -2, 0, -6, 2, 3, -4, 0, -3, 1, 2, -20,
+    16, 10, 8, -5, -4, 9, -1, -2, 3, -2, 2, 2, -3, 3, 10, -8,
+    -2, -2, 21, 0, 14, 4, 21, -6, -5, 4, 1, 2, -16, 0, 1, -6,
+    -3, 0, -4, 4, -5, 2, 4, -7, -7, -5, -9, -7, 1, 1, 16, -1,
+    -27, -14, 5, -6, -6, 18, 33, -8, 2, -5, 23, 5, 1, -1, 30, -11,
+    -2, -3, 2, -9, 5, 10, -1, -2, 1, 21, -2, -4, -8, 0, -1, -2,
+    4, 9, 5, -5, 10, 9, 9, 1, -6, -10, 9, -1, 5, 1, -9, 4,
+    1, -3, 6, 9, -3, 13, 4, -10, -1, -12, 0, -5, 8, 8, 11, -8,
+    5, 38, 4, -7, -15, -13, 18, -5, 4, 2, 13, -5, -5, 7, 45, -1,
+    9, 11, 8, -8, -10, 8, 20, -2, -2, 0, -6, 1, 1, -4, 32, -6,
+    2, 10, 4, 2, 7, 3, -6, 6, -2, 2, -3, -5, 7, -1, 1, 1,
+    6, -2, 0, -9, -22, -3, 4, -4, 5, 12, -15, -8, -4, -2, -6, -14,
+    19, -9, 2, -13, -6, -5, 4, 2, -1, 1, -19, 6, 12, 0, -3, -5,
+    12, -5, -1, -3, -10, 1, -5, 3, -6, -6, 16, -21, 5, -12, -2, -12,
+    -10, -4, -5, -5, 9, 10, -11, -10, 0, -13, 1, -13, -9, 3, 8, -1,
+    4, 6, 2, -17, -4, -8, -7, 9, -3, 0, -2, 6, -6, -7, 40,
+  },
+  {
+    -1, -1, 3, -1, 0, -1, -8, -4, -1, -1, 1, 0, -4, -10, -1, -8,
+    -3, -3, 6, 4, -1, 5, 2, -2, 0, 11, -1, 13, -1, 1, 3, -9,
+    -2, -1, -4, 3, -4, 5, -2, 2, -9, 3, 2, -1, 2, -7, -7, 3,
+    0, -4, 6, 1, -9, -4, 1, -6, 2, -3, -1, -9, 0, -12, -3, -18,
+    9, -17, 8, -3, 4, 2, 1, 3, 4, -9, 0, 3, -7, 14, 3, -9,
+    -14, 0, -5, 3, 0, 4, -3, 3, -1, -1, -4, -22, 2, -11, 2, 1,
+    -2, -16, 3, 8, 0, 2, 1, -2, 0, -10, 7, 4, 1, 2, -1, -9,
+    6, -21, -27, -3, 4, -5, 0, -3, 5, 1, -8, -4, 1, -5, 2, -28,
+    5, -9, -16, 2, 1, -13, 1, -14, -8, -12, -9, -4, 2, 0, -2, -14,
+    9, 2, 9, -20, -14, -5, -4, 11, -10, 2, -8, -2, 1, 16, 0, -5,
+    15, -11, -5, -21, -3, -13, -2, -8, -12, -7, 11, -3, 11, 1, 1, -9,
+    -9, 4, -9, -16, 4, -8, -7, 10, 14, 9, 4, -16, 1, -2, -7, 0,
+    5, 15, -8, 3, 0, 18, 2, 3, 14, -7, -10, -10, -3, -1, -10, -18,
+    9, 2, -2, -19, -23, 6, -5, 3, -6, 2, -2, 2, -7, 5, -16, -20,
+    3, -5, -7, 28, 13, -37, 1, -9, -10, -6, -3, 1, 12, 8, 5, -9,
+    9, -14, 5, 0, 3, 9, -6, 8, -2, -8, 0, -3, -10, 7, 19,
+  },
+  {
+    1, -1, 0, -5, 0, 3, -3, -3, -2, 0, -3, 6, -6, -1, -4, -3,
+    1, -1, -8, 2, -1, -3, 2, 2, -8, -4, 1, 10, -4, -3, -1, -16,
+    4, 1, 4, -6, -3, 2, 0, -4, 2, -3, -2, -1, -6, 2, 6, 3,
+    -1, 2, -1, -11, -4, -9, 0, 2, 5, 9, -12, -9, -1, 6, 2, -3,
+    5, -2, 3, -5, -10, 9, -2, -15, -3, 4, -7, 0, 4, 4, 1, 2,
+    -4, -4, -7, -7, -4, 1, 6, 5, -1, -12, 2, 2, 11, 4, -1, 0,
+    12, -19, -7, 9, -13, 2, -4, 14, 1, -15, 2, -7, -5, 0, 0, -4,
+    8, -7, -22, 5, 6, -6, 6, -14, -12, -7, 0, 5, -3, -2, -4, -32,
+    -3, -4, -4, -9, 8, -4, -19, 0, -7, -8, -3, 11, -12, -5, -12, 1,
+    14, -6, -10, -6, 14, 3, -17, -6, 6, -1, 0, 0, -7, 6, 7, -1,
+    -16, 6, -6, -10, 10, -18, -5, -6, -11, 0, -5, 3, 0, -9, -6, 0,
+    -7, 15, -18, -2, 0, 15, 5, -7, -14, 0, 13, 5, -3, 7, 16, 1,
+    9, -8, 5, -17, -6, 1, 0, 9, 10, -24, -9, -11, 1, 0, -1, -7,
+    -27, 7, 4, -8, 9, 7, -7, 1, -3, -17, -1, 10, -2, 7, -3, 7,
+    -5, -4, 0, -5, 2, 25, -3, -6, -5, 16, -12, 11, -10, -2, 2, 4,
+    -1, -9, -3, -7, -5, 1, -5, 13, 2, -2, -10, -2, 6, -3, 4,
+  },
+  {
+    1, 0, -9, -3, 8, -9, -1, -5, 1, -3, -1, -3, -7, -2, 0, -8,
+    -8, 4, 0, 2, -4, -12, 3, -6, -6, -6, 2, -2, 4, 2, 0, -7,
+    -11, -2, 4, 2, 0, -1, 6, -1, 3, -2, -3, -21, 0, -6, -6, 4,
+    -14, -24, -3, 9, -4, -6, -7, -5, -1, -1, 2, -4, -1, 4, -3, -19,
+    -3, -15, -3, 6, -5, -14, 0, 12, 10, 0, 2, 2, 0, 5, -4, 9,
+    -11, -4, 3, -12, -1, -5, 1, 11, -2, -2, -10, -1, 6, 24, -4, -21,
+    -27, 21, 1, -30, 0, 1, -9, -1, -6, -5, -14, 10, 0, -7, -6, -3,
+    1, 0, 2, -2, 2, -5, -8, -13, -8, -6, -6, -6, -2, 2, -10, -29,
+    17, -13, -3, 1, -6, -5, -5, -12, 13, 0, -5, -2, -4, 4, 0, 7,
+    1, -5, 19, -7, -11, -3, -1, -10, -11, 3, -6, 5, 7, 4, 4, 12,
+    -3, -7, -3, -15, 4, -4, 10, -20, -4, 9, 1, -6, -6, 5, -13, -25,
+    -5, -4, -12, -13, 10, -9, -1, -1, -18, -5, -2, 5, 9, -1, -6, -25,
+    -5, -26, -5, -14, -3, 11, 3, -36, -3, 6, 6, -19, -14, -21, 1, -9,
+    1, -23, 11, -9, -6, 3, 3, 2, -14, 6, -1, -25, 0, 2, -1, -16,
+    -1, -2, -2, -7, -15, 0, -9, -5, 10, -8, -3, 12, 0, -5, -6, -2,
+    1, -1, -17, 2, -3, -2, 9, -2, 0, 2, 10, 2, 0, 1, 1,
+  },
+  {
+    -4, -5, 2, -14, 0, -2, 2, 13, 0, 1, -5, 2, -3, -2, 0, -11,
+    -25, 5, 1, 0, -8, -5, -2, -3, 3, 2, 1, 3, -3, -2, -3, -9,
+    0, 38, 0, 2, 2, 1, 0, -10, -3, -13, -2, 9, -5, -2, 0, -4,
+    -4, -1, -4, -1, -6, -3, -4, -8, -5, 5, 9, -5, -10, -1, 10, -19,
+    3, 0, 0, -3, 51, -1, -2, 4, 2, -4, -8, 7, 1, -9, -3, -11,
+    1, -7, -2, 15, -4, 5, 4, 10, -21, -9, 0, 2, 7, 5, 0, -5,
+    -4, -8, 1, 1, -5, -9, 6, -13, -8, 1, 5, 5, -3, -5, 7, -8,
+    -5, -8, -7, 0, -1, -5, 9, 12, -7, -5, 1, 9, 4, -5, 14, -15,
+    2, -1, 4, 1, 7, -5, -3, 1, -1, -6, -46, 1, -2, 1, 5, -8,
+    -4, 7, 6, -5, -1, -10, -2, 4, -3, -1, -28, -4, -6, -29, 4, -13,
+    21, 1, -2, -12, 0, -21, 4, 3, 28, 1, 4, 3, 6, 1, 9, 6,
+    -3, 12, -10, -21, 8, 5, 7, 10, -10, -1, 2, -9, 11, -3, -6, -13,
+    3, 6, 8, -4, -2, 1, 0, -3, -1, 0, -2, -12, -5, -1, 4, 13,
+    -12, 2, 1, -11, 3, 0, 0, -3, -3, 2, -4, 4, -8, 7, -2, -31,
+    -4, 5, -16, -9, -10, -14, 2, 11, -2, -7, -7, 1, 6, 5, 15, 5,
+    -22, -1, -1, -13, 0, -1, 2, 4, 19, 6, 0, 3, -3, 2, -19,
+  },
+  {
+    -2, -8, -1, -8, -2, -4, -5, -10, 0, -2, 2, 4, -6, -2, -4, -18,
+    -5, 3, 1, -2, -7, 2, -2, -4, 4, -11, -5, 9, -9, -6, -1, -21,
+    -5, 4, -2, -3, 1, -1, -6, -4, -4, -1, -3, -2, -3, -2, 2, -7,
+    0, -10, 16, -13, -4, -10, 6, -3, -11, -12, 1, -9, -6, 1, 2, -29,
+    7, 0, -2, -3, 10, 3, -6, 1, 8, 0, 3, 2, 6, 11, -5, 0,
+    5, -16, 13, -13, 15, -9, -1, -4, -2, -7, 3, 4, -3, 4, 14, -14,
+    -11, -15, 8, -3, 2, 0, -21, -26, 5, -10, -7, -16, -1, 6, 6, -6,
+    6, -21, -5, 20, 5, 6, -8, -4, -8, 2, 2, 3, -1, 13, 2, -32,
+    -16, -18, 4, -14, 12, -17, -9, -5, 5, -13, 10, -12, 5, -5, 8, -16,
+    1, -16, 3, -14, 2, -1, 5, -9, 1, 2, -5, 13, 5, -4, -16, -8,
+    14, 7, 1, -11, -10, 5, -2, -6, -4, 7, -7, -5, -1, 2, -2, -6,
+    -9, -3, 4, -12, 2, 11, 4, 0, 3, -3, 23, -16, 13, -10, 10, -7,
+    7, -2, 2, -6, 0, 26, 10, -20, 0, 2, -2, 2, -9, -30, -8, -33,
+    4, 5, -4, -3, -2, -3, -7, -4, 4, -5, -16, -3, 8, -5, -13, 8,
+    10, -2, 5, -29, -3, -4, -11, 2, 19, -8, 4, -1, 8, 3, -6, -8,
+    5, -6, -1, -5, 5, 6, -9, -2, 1, -1, 4, -15, -14, 2, 3,
+  },
+  {
+    1, -1, -2, -4, -2, 0, 3, -5, 2, 1, 2, -4, -7, -2, -3, -13,
+    0, -3, -5, -3, -1, 1, -7, -2, -4, 4, 6, 2, 1, 8, -4, -12,
+    3, -7, -12, -3, -7, -8, 0, -6, -11, -16, 1, -8, 2, -9, -8, 8,
+    -3, -3, -1, -2, 6, 5, 6, -3, 5, 0, 6, 3, -18, -3, 3, -28,
+    11, -7, -9, -6, 3, 8, -2, -6, 12, -8, -8, 13, -4, 0, -8, -30,
+    5, 1, -3, -9, 3, 3, -4, -9, -2, -6, 4, 4, -1, 1, 8, 6,
+    -20, -2, 0, -10, -2, -1, 0, 5, -1, 5, 20, -2, 6, -4, -6, -11,
+    1, -4, 3, -5, 0, -11, 3, 2, -4, -24, -1, -4, 2, 1, -5, -16,
+    -3, 6, -4, -3, -1, 6, -5, 8, -6, 5, -4, 2, -16, 1, 25, -14,
+    -4, 0, -11, -15, -12, -3, -5, 4, 19, 3, 24, 2, 5, -3, 1, -7,
+    4, -4, 11, -13, 4, 14, -1, 15, -1, -1, 13, -4, 6, -8, -27, -6,
+    -6, -1, 5, -7, -3, 2, -10, -27, 19, 7, -7, -10, 10, -11, 6, -4,
+    6, -19, -5, -18, 4, -6, -6, -7, -3, -1, 2, -6, -1, -9, -7, -9,
+    5, -10, 8, -10, -27, -7, -34, -10, 1, -8, 2, 1, 6, 11, 1, -8,
+    -15, 1, -2, -6, -9, -11, 16, 7, 6, 1, -11, 6, 2, 4, -4, 6,
+    -8, -7, -8, 18, -12, 2, -12, 3, -16, -3, -13, -3, -8, 1, -10,
+  },
+  {
+    -3, -1, 1, -4, 1, 1, 2, -11, -7, -5, -7, 1, 0, -2, -2, -10,
+    -6, -3, 4, 2, -1, -1, 2, 4, -7, -2, -7, -2, -1, -6, 2, -6,
+    -2, 4, 2, 15, -1, 3, -5, -1, 1, 6, -3, 3, -13, -1, -2, -1,
+    5, 2, -2, -1, 3, 5, -1, 8, -8, -2, 2, -3, -7, 7, 0, -24,
+    15, -12, 2, 6, 13, -2, -1, -10, 21, 4, -10, 3, 7, -5, -9, -9,
+    3, -8, -1, -9, 2, -1, -3, -2, 5, -17, 7, 3, -2, 8, -4, -1,
+    12, -11, -1, -5, 6, -3, -1, -10, -3, -9, 3, 8, 2, -6, -2, 5,
+    4, -9, -5, -1, -2, -7, 0, -6, 5, -4, 6, -4, 0, -3, -16, -18,
+    22, -7, 7, -3, -7, -2, 1, -1, -2, -5, -10, -7, 7, 1, 3, -10,
+    -10, -8, 32, -7, -2, -19, 9, 0, -6, -13, 5, -6, -18, -12, -3, -6,
+    -4, 3, -3, -20, -6, -12, 14, -1, 13, -9, 16, -6, -9, -2, -5, -11,
+    8, 8, 11, -28, -3, 5, -1, -16, 3, 2, 5, 12, 7, 1, 1, -11,
+    8, 15, -6, -15, 1, -15, -2, 2, 5, 1, 8, -4, 7, 7, 1, -4,
+    3, -7, 0, -15, -3, -3, -5, -4, -14, 7, 14, -8, 0, -8, -1, 6,
+    4, 5, -7, -12, -9, -3, -11, -15, 7, -6, 3, 4, -1, -6, -17, -5,
+    0, 1, 8, -6, 14, -1, -4, 2, -5, -14, 10, -5, 14, -19, 4,
+  },
+  {
+    -4, -1, 0, -7, -5, 0, 0, 1, 2, -6, 0, 2, 0, 3, 2, -8,
+    12, 6, 7, -14, -1, -1, -7, 3, -4, 1, -3, 1, 2, 1, -1, -11,
+    -2, -1, 21, -6, -4, 2, 5, -19, 1, -3, 6, -9, -1, -2, 4, -2,
+    -7, -7, 1, 9, -5, 4, 5, -8, -6, 4, 1, 3, -3, -5, 10, -5,
+    7, -4, -2, -6, -4, -2, 31, -4, 6, -3, -3, -1, 6, 4, 19, -30,
+    7, 0, -6, 5, 6, -4, -3, 0, -4, -13, 5, -4, 1, 1, 0, 0,
+    -5, 0, -6, 1, 0, 8, 2, 8, -1, -6, -1, 3, -6, 4, 9, 0,
+    -1, -2, -2, -7, -8, -10, 1, -3, 6, -4, 5, -6, -2, -7, 13, -23,
+    27, -3, 16, -30, 3, -10, 7, -9, -9, -1, -3, -4, -7, -10, 37, -3,
+    1, -8, 17, -12, 1, 2, -3, -10, -7, 7, -2, -11, -8, -13, 27, -48,
+    3, 3, -9, -5, -8, 6, 2, 7, -5, 4, -9, -11, 0, -6, -1, -7,
+    -1, -3, 8, -11, -13, -1, -1, -15, -20, -8, -13, -3, -2, 1, -3, -13,
+    4, 15, 5, -6, -6, 3, 4, 5, 2, -4, -7, -11, -3, -6, 11, 2,
+    1, 2, 2, -23, -6, 19, -2, 1, -1, -8, -7, -4, -2, 3, -14, -7,
+    -2, -8, -10, -7, 10, -4, -1, -1, 1, 7, 1, -14, 12, 10, 7, -4,
+    7, 8, 3, -1, 12, -5, -1, 12, 18, -3, -5, 0, 13, -10, 12,
+  },
+  {
+    -2, -2, 1, -5, -2, 0, 1, -7, 1, 1, -2, -3, 0, 1, -1, -6,
+    -6, -2, -6, 5, 7, 0, 4, -3, 4, -2, 0, -4, -7, -3, -7, -13,
+    -14, -12, -6, 0, -4, -6, -6, -5, -11, -2, 11, -3, 2, 0, -4, -1,
+    2, -4, 2, -1, -5, 1, -4, -1, 0, -6, -7, 10, 4, -3, 0, -11,
+    5, -22, 4, -8, 6, 2, 2, -8, -10, -3, 5, -14, -5, -6, -10, -3,
+    2, 6, -3, 0, -4, 0, 5, 3, 4, -3, -8, 1, -4, 0, -4, -2,
+    5, -8, 0, 6, 0, -1, -7, 2, 0, -12, 1, 4, 2, 8, 0, 6,
+    -7, -8, 0, -15, -5, 8, 5, 7, -4, -11, 6, -4, 7, 10, -6, -28,
+    -8, 2, 8, 17, -4, -3, 6, -13, -2, 0, -6, -8, -7, -2, 1, -11,
+    0, -12, 0, -23, 15, -1, -1, -27, -4, 15, 12, 3, -5, -6, -8, -3,
+    3, -2, -1, -10, -22, 17, -8, -11, 16, -4, 5, 1, -10, -9, -36, -2,
+    -9, 1, -11, -1, 4, -6, -13, 1, -10, -14, -1, 8, 2, -11, -9, -16,
+    -11, 3, 8, -20, -10, 2, 4, -11, -1, -5, 0, 2, -5, -8, -6, -1,
+    0, 3, -7, 8, -4, 7, -5, -6, -3, -8, -3, -2, -13, -4, 2, 3,
+    9, -16, 2, -10, -5, 1, 1, -15, 0, -4, 10, 2, -6, -11, -7, 1,
+    -7, -13, -11, -16, -10, 15, 14, 15, 5, -1, -14, -7, -5, -15, -1,
+  },
+  {
+    1, -2, -2, -1, 0, 2, -1, -5, 3, -5, 1, -6, 0, -4, 2, -11,
+    -2, 7, 0, 1, 4, 3, 3, 0, -2, -4, 3, -4, -1, 3, -1, -6,
+    -4, -5, -4, -1, -3, -3, -2, -8, 1, 2, -2, -3, -6, 7, -6, 0,
+    0, -3, -3, -10, -5, -1, 5, -5, 1, 2, -6, -2, -4, -2, 0, -23,
+    -7, -9, 2, 2, 1, -4, 2, -1, -6, -4, 3, 13, -2, 7, 8, -5,
+    5, -5, -4, -3, -5, 0, -1, 1, 5, -2, -9, -1, -9, 12, -6, 7,
+    -2, -6, -5, 1, 10, -13, -15, 18, 1, -3, 11, 3, 2, 0, 0, -5,
+    -6, -8, 0, 3, -4, -8, 7, 4, 5, -8, 2, 7, 1, 12, 6, -28,
+    -2, 17, 5, -15, 0, 2, -5, -2, -6, -12, -5, -6, 4, 6, -9, 0,
+    -2, 2, 0, -7, -16, 4, 5, 5, -16, 6, -3, 21, -5, 3, -3, -7,
+    5, -4, 1, -10, -9, -15, 15, -6, 4, 6, 0, 0, -3, -2, -2, -6,
+    15, 0, -2, -11, -4, -2, -9, 1, -10, 10, -8, -4, -20, 7, 19, -14,
+    29, -13, 3, -7, -7, -11, -22, -4, 2, 0, 1, -7, 7, 8, 0, -6,
+    35, 3, -2, -16, -6, 1, 13, -5, -3, 6, 1, 5, -3, 17, -20, -9,
+    -7, -13, -2, -5, 1, 7, 3, 2, -9, 2, 9, -3, 9, 6, -9, -2,
+    8, 5, 4, -12, -11, 8, -1, -21, 8, 8, -2, -6, -12, -7, -27,
+  },
+  {
+    -2, -1, 1, -4, -4, -3, 1, -3, -1, -2, -1, 1, -2, -1, 1, -8,
+    -6, 1, -4, -10, -7, -1, -5, -3, 6, 4, -2, 1, -2, -4, 1, -5,
+    0, 9, -3, 2, -1, -8, 1, -9, -2, 8, -4, 0, -1, -6, 5, -8,
+    -3, 0, 12, -2, -7, -3, -4, -4, -2, 2, 1, 3, -5, -2, -3, -19,
+    -8, -11, -6, -7, -16, -19, 0, 0, 9, -7, -6, -4, 0, -11, 2, -12,
+    -7, -4, 6, 1, 23, 0, -8, 7, 8, -15, 5, -6, -12, 10, -5, -2,
+    2, 0, -5, 0, 5, 2, 10, -4, 2, 1, -3, 0, -2, 5, 4, -6,
+    -3, 4, -3, 0, -8, -6, 4, 2, -1, -11, 1, -1, 4, 14, -6, -22,
+    -3, -14, 4, -8, 14, 5, 3, 0, 1, -22, -10, 9, -7, -4, 2, -8,
+    -9, -3, -2, -5, 0, -2, 1, 18, 6, 13, 0, -4, -7, 3, -2, -26,
+    -19, 13, -8, -16, 6, -5, 5, -18, 10, 4, -24, 1, -17, -8, 12, -6,
+    -10, 2, -1, -9, 13, -9, -11, 2, 11, -6, -4, -5, 0, -17, 1, -8,
+    -10, -3, 5, -16, 3, -2, 11, -2, -1, 7, 5, -5, -7, 15, 28, -6,
+    4, -2, -9, 1, -1, 7, -1, -3, -2, 1, -4, 7, 2, 9, 2, -16,
+    -6, -3, -6, -1, 3, -14, -4, -3, 12, -15, -9, -11, 19, -5, 3, 3,
+    -11, -8, -5, -13, 0, 6, -8, 19, 0, -8, 9, 3, -29, 6, 12,
+  },
+  {
+    -3, 0, -1, -2, 3, -4, 0, -6, -1, -7, -13, -5, -4, -2, 6, 6,
+    3, -3, 5, 7, 3, 15, 1, -2, 4, -3, 0, -3, 1, 2, 2, -9,
+    -15, -11, -7, -14, 2, -12, 5, 4, -9, 0, -2, 0, 13, 3, 3, 9,
+    -3, -8, 1, -2, -2, 0, -1, -6, 2, -1, -1, -3, 0, -5, -13, -17,
+    3, 14, -6, -3, 5, -11, -4, -8, 2, -2, -7, 3, -3, 0, 16, 8,
+    -9, 5, -1, -2, -7, 6, -4, 1, -2, 4, 13, 5, 3, -1, -1, -6,
+    -22, -5, -4, 4, 1, 9, 5, 8, -2, -6, -2, -9, -2, 7, -8, -3,
+    -13, 5, -8, -6, -2, -3, -2, -2, -3, -6, 4, 1, 0, -14, 2, -21,
+    -11, -3, -5, -7, 8, -18, 0, -15, -19, -3, -7, -18, 8, 5, 0, 18,
+    6, -1, -3, -16, 10, -18, 0, 1, 9, 9, 7, 14, -4, 6, 15, -10,
+    3, -15, -7, 10, -16, -9, -12, 5, 7, 1, 1, 2, -9, 5, -16, -11,
+    -11, 6, -3, -19, -21, -2, 33, -4, -3, -8, -8, -16, 20, 6, 1, 6,
+    -5, -29, 3, -13, 6, -4, -8, -6, -2, 1, -3, -20, -8, -4, -8, 3,
+    -6, 10, -8, -10, 0, -6, 0, 3, -9, -2, 12, 1, 9, 4, -6, -1,
+    -2, -1, 1, 1, 0, -7, 4, -5, -7, -7, 2, 2, 23, 2, -6, 15,
+    12, 1, 3, -3, -18, 1, -4, -7, 6, 4, 9, 2, -10, 10, 5,
+  },
+  {
+    -1, 0, 1, -4, -1, 2, 0, -7, -3, 2, -3, -1, 1, 8, -4, -7,
+    -1, -1, -1, -2, 6, -3, 4, -3, 0, 1, -2, -2, -12, 7, -2, -15,
+    -7, 0, 3, 0, -4, -4, -6, -8, -1, -4, 0, -6, -3, -5, 9, -3,
+    -9, -2, -1, 1, -4, 8, 2, -4, 1, -19, 1, 1, -14, -12, -3, -28,
+    2, -13, 3, -9, 6, -7, 2, -2, 2, -6, 0, -2, -3, 2, 4, -18,
+    -8, -11, -9, -3, 2, -10, 6, -12, 8, 0, -8, -5, 1, 1, 5, -1,
+    -1, -5, -1, -9, -8, -7, 1, -10, 2, -5, -1, 1, 6, -1, 0, -7,
+    4, 0, -6, -22, 1, 3, -2, -6, -5, 10, 9, 2, -6, -8, -1, -22,
+    9, -13, -16, 5, 2, -6, -9, 6, 2, -1, -2, -6, -3, -2, -2, -9,
+    -1, -11, -9, -9, -4, 1, 1, -5, 1, 2, 0, 0, 6, -6, -1, -17,
+    -12, 0, -3, -4, -1, -1, 0, -11, 3, 4, -10, 18, 2, 10, 4, -20,
+    -13, 3, -3, -3, 4, 8, 14, -6, -9, -26, 9, -2, 2, 1, 8, 4,
+    -8, 0, 7, -17, -3, -6, 16, 6, -7, -7, 13, 1, -3, -4, -2, -4,
+    9, -15, 6, -7, -10, -10, 7, -3, 4, 3, 26, 8, -16, 12, -1, 3,
+    2, -12, 7, -9, -7, 17, 0, -26, -5, -5, -15, -2, 9, 17, -9, -5,
+    -4, 6, -16, -10, -21, 5, -5, -15, -16, 4, -2, -1, -11, 2, 0,
+  },
+  {
+    -2, -2, -1, -1, -5, 1, 0, -9, 0, -8, -2, -1, 2, -4, -2, 3,
+    1, 5, -9, -5, 6, 4, -6, 3, -3, 4, -2, 3, -1, 7, 3, -14,
+    11, 1, -3, 5, 5, -5, 3, -2, -1, -1, 0, -3, -1, -1, 3, 3,
+    -5, -3, -4, 0, -3, -4, 7, 1, -7, -5, 3, -2, 3, -7, -4, -18,
+    1, -10, 21, 5, -2, -7, 5, -2, -4, -10, 16, -4, 10, 5, -3, -15,
+    1, 2, 5, 2, -1, 5, 0, -10, -1, -9, -8, -5, 2, -1, 4, 1,
+    -3, -14, 4, 5, -7, -2, -2, 2, 6, 7, -8, -4, -13, -13, 9, 5,
+    -2, -8, -1, 5, -2, -5, -2, -2, -2, -5, 4, -7, 3, -4, -6, -31,
+    -4, -2, -3, -4, 0, -9, 20, 2, 3, 9, 4, 1, 12, -4, -2, -2,
+    -2, -7, -7, -2, -8, 9, -27, -16, -16, 9, -8, 8, -3, 29, -1, -16,
+    7, 12, 17, -1, 11, 0, 1, -6, 9, -1, 6, -4, -13, -15, 8, 2,
+    -1, 5, -8, -4, 0, -3, -17, -21, 4, 9, -10, -4, -3, 14, 7, 5,
+    -8, -2, -5, -9, 0, -3, 1, -4, -19, 13, 3, 6, -2, 6, 1, -4,
+    9, -2, -3, -7, -8, -6, 4, -19, 11, 1, -14, 5, -2, -2, 11, -4,
+    1, -4, 2, -20, -2, 7, 0, 0, -3, -5, 0, 2, 3, 5, 6, 9,
+    18, 10, -4, -6, -6, 2, 20, 4, 1, 0, 11, 6, -3, 7, -10,
+  },
+  {
+    0, 0, -2, -3, 0, 1, -1, -4, 1, -4, -3, -3, 1, -7, 0, -4,
+    2, -2, 2, -6, -8, 3, -3, 12, -2, 2, -1, -3, 0, 1, 1, -12,
+    1, -1, -6, -3, -6, 0, -6, -12, -2, 5, 1, -3, -4, 1, -2, -9,
+    -10, 2, -3, -2, 8, -9, 5, -3, -8, 1, 0, 0, -6, -9, -2, -16,
+    1, -10, -1, -4, -8, -1, 4, 3, -2, -7, -4, -10, -5, -18, -5, -10,
+    3, -7, -3, 7, 2, 4, 1, 4, 2, 5, -5, 7, 12, 5, 3, -1,
+    -5, -19, 4, 4, -5, 4, 4, -1, -5, 0, -16, 20, 0, -3, 12, 4,
+    -7, 2, 1, -3, -7, 3, -3, 2, 4, -6, 2, 4, 3, -3, -2, -25,
+    11, 0, 2, 5, -1, 4, 1, 1, 0, -3, 0, 3, 9, -4, 11, -1,
+    -8, -11, -16, -1, -2, -1, -1, -13, -5, -16, 2, 9, 6, -5, -1, -28,
+    -14, -3, 6, -10, -3, 9, 10, 12, -15, -22, 2, 1, 23, 1, -13, 7,
+    3, 8, -3, -11, -25, -17, 1, -1, -20, 2, -12, 2, 5, -11, 0, -11,
+    -9, 1, 5, 19, -1, 2, 3, 0, 7, 1, 0, -15, -5, -7, -2, -25,
+    -4, 9, -1, -15, -11, -17, 0, -5, 16, -4, -6, 1, -2, -3, -6, -2,
+    7, 15, 1, -19, -3, 6, 0, -5, -1, 11, 0, 1, 15, -8, -7, 2,
+    -1, 8, -3, -9, -1, 0, 0, -11, -21, 1, -10, -4, 1, 3, -11,
+  },
+  {
+    -2, -4, 1, 2, -2, 1, -4, -6, 6, 1, 1, 2, -3, -1, 1, -6,
+    4, -2, 11, 2, -2, 5, 1, 5, -7, 0, -1, -2, -5, 3, 3, -14,
+    -9, 4, -3, -8, -10, -3, 17, -2, -3, -1, 2, 1, -6, 1, 2, -5,
+    -4, -4, -5, -4, -5, -3, -1, -9, -5, -14, 4, 2, -4, -6, -1, -23,
+    -7, -9, 3, -2, 6, -1, -4, -13, -1, -3, 2, -7, 4, 9, -37, -12,
+    2, -3, -5, 1, 2, 9, -4, -4, -6, -5, 9, -7, -3, -8, 0, -5,
+    0, -7, -7, -1, -7, 1, -4, 5, -3, -5, 2, -2, -7, 1, 2, -8,
+    4, -4, -5, -21, 1, 0, -10, -7, 3, -5, 2, 1, -4, 4, -9, -8,
+    -8, -14, 0, -4, 21, -7, 11, -6, 3, -5, -4, 6, -6, 6, -12, -20,
+    6, -2, -3, -9, 10, -3, 13, 12, 0, 5, -15, 12, -2, -39, 0, -14,
+    -4, -15, -7, -4, -3, 6, -5, -8, 11, 3, 6, -1, -1, -6, 7, 4,
+    -1, -1, 1, -3, 12, 9, 5, -6, 4, 2, 12, -3, 7, 5, 5, -3,
+    10, -4, -4, -5, 2, -6, 6, -5, -3, 2, 9, 3, 1, -1, -7, 1,
+    2, -10, -7, -8, -6, -10, -11, 0, -15, -4, -3, 8, -18, 1, -1, -5,
+    2, -2, -6, -11, -5, -1, -2, 30, 10, -7, 0, 12, 5, -12, 3, 0,
+    7, -4, 11, -4, -5, 8, -3, -2, 6, -10, 1, -7, 5, 0, 5,
+  },
+  {
+    -1, -3, 0, 0, -1, 2, -2, -1, -7, -3, -1, 0, 0, -2, 0, -5,
+    -4, 9, 1, -1, 0, 1, 4, -3, 1, -2, 1, 8, -1, 2, -4, -12,
+    -9, -5, 2, -2, 5, 7, -3, -4, -4, -8, -1, -3, 1, -3, 1, 2,
+    -9, 0, 0, 1, 7, -1, 0, -2, 1, -8, -2, -1, -4, 5, 4, -26,
+    -4, 0, -3, -5, 2, -2, -4, -7, -2, -1, 22, 2, 0, -1, 3, -10,
+    0, 4, -5, 0, 0, -3, -4, -4, 7, 4, -7, -4, 1, 4, 3, 1,
+    -12, -18, -3, -6, 2, 6, 6, -7, -4, -6, 7, 5, 0, -1, -11, -3,
+    2, -15, -10, -4, 3, -10, -3, -2, 7, -2, -2, 7, 9, -5, 0, -24,
+    -12, -13, -2, -9, 6, 6, 6, -12, 1, -8, -13, 2, -4, -5, 4, -3,
+    -7, -1, -12, -13, 11, -4, 29, -16, -5, -1, -19, -8, -4, -3, -2, -13,
+    7, 6, 2, -13, -11, 10, 0, -8, -2, 9, -12, -8, -6, 7, -4, -11,
+    6, 8, 8, -14, 6, 7, 16, 8, -7, 0, 1, 6, -6, 6, -1, -23,
+    -4, -13, -5, -13, 16, 0, 0, -1, -5, -12, 6, 4, 20, -1, -5, 10,
+    6, -10, 3, -7, 0, 4, 25, 14, -11, 0, -3, -5, -10, 2, -4, -12,
+    12, -3, -1, -21, 7, 11, 3, -11, 2, -1, -2, 3, -6, -3, -1, -16,
+    4, 0, -8, -13, 6, 0, 5, -1, -2, -9, -28, 6, -6, -12, 1,
+  },
+  {
+    -1, -2, 0, -3, 1, -1, -1, -3, -1, -2, 0, -3, -2, 2, 4, -8,
+    -3, -6, 0, 0, -1, 3, -1, -1, -6, 4, 1, -1, -3, 4, -2, -7,
+    -3, 3, -2, 0, -11, -2, -2, -8, 2, 0, 1, 6, -4, -3, -2, 0,
+    7, -4, -2, 6, -1, 5, -1, -6, -5, -8, 0, 2, -4, 8, 4, -20,
+    -14, -12, -4, 1, -14, 7, -1, -6, 19, 2, -2, -6, 0, 3, 0, 2,
+    4, -5, -4, 1, -8, 2, -3, 1, -6, -8, 5, 4, 3, 6, -1, 0,
+    -9, -2, 2, 3, 12, 2, 4, 9, 2, -8, -15, 1, 5, 0, -2, -9,
+    3, -1, -3, -6, 2, -16, -3, 1, -9, -10, 1, 2, 10, 0, -2, -35,
+    -2, -8, -1, -10, -4, -7, -9, -23, -2, 21, 9, -15, 3, 7, -3, -18,
+    9, 3, 15, -12, -3, 4, 5, 7, -3, 11, 0, -2, -4, -5, 1, -6,
+    -3, -14, 5, -19, -12, -8, -7, 3, -3, -4, -6, 5, 0, 0, 12, -8,
+    9, -5, 3, 1, 2, 6, 13, 3, 8, 2, 4, 9, 0, 7, 5, -9,
+    9, -5, -9, -18, 13, 14, -3, -3, 2, 3, 9, -6, 11, -12, -2, -2,
+    -4, -15, -2, -12, -1, -16, -4, -13, -2, 5, -1, 7, -3, -9, -7, -9,
+    11, 0, 0, -10, 3, -22, -9, -4, -1, -18, -7, -22, 8, -7, -5, -14,
+    -4, -6, 17, -11, 6, -3, 6, -9, -6, -3, -16, -16, 12, 5, 2,
+  },
+  {
+    -1, -1, 2, -1, 1, -3, -3, -6, -6, -3, 0, -5, 0, -2, 0, -9,
+    -4, 6, -3, 3, -1, 2, -4, 3, -2, 6, -3, -9, -3, -1, 4, -17,
+    -4, 2, -5, -18, -14, -2, -4, -5, -14, -4, -5, -10, 1, -4, 6, 0,
+    5, 1, 2, 2, -1, -4, -7, -1, -3, 1, -3, -4, 0, 7, 4, -20,
+    0, -1, -2, -10, -6, 3, -3, -15, -6, 6, 4, 2, 1, -1, 3, -13,
+    4, -7, 7, -2, 5, 2, 13, 13, 7, -2, 5, -8, 7, -7, -8, -11,
+    -9, -6, 7, -6, -8, 5, 1, 5, 2, -14, 0, -8, 7, -8, -5, -15,
+    -2, 5, 1, -4, -18, -6, 1, -3, 2, -7, -4, 3, -4, 6, -8, -6,
+    -5, 1, -5, -9, 11, -15, 3, 1, -6, 11, -7, 14, -5, 13, -13, -1,
+    7, 4, -4, -10, -18, 1, 6, 4, 10, -3, -3, -1, -4, -10, 4, -8,
+    3, -20, -6, 0, 4, -4, 4, -10, -1, 5, 15, -1, -8, 2, 7, 2,
+    -15, 10, -12, -15, -1, -9, 28, -8, 4, -2, -1, -8, 0, 8, 3, -1,
+    6, -27, -2, 1, -9, 1, 15, -6, 1, 1, -1, 3, 4, -16, 3, -17,
+    -6, -6, -2, 0, -9, 6, 9, -8, 1, 7, 2, -3, 7, -6, 0, -14,
+    -7, -20, 19, -18, 10, -2, -3, -11, -14, 22, -3, 8, -2, 2, -16, -6,
+    -4, -1, -5, -4, 3, -11, -6, -9, -15, 1, 1, -4, 2, -12, 1,
+  },
+  {
+    0, -1, 0, -4, 1, 0, 0, -9, 1, -2, 0, -4, 0, 1, -1, -3,
+    3, -1, -2, -1, -4, 3, 3, 0, 0, 2, -2, -2, 4, 1, 1, -10,
+    -6, -3, -7, -1, 2, 0, 4, 5, -7, 1, 3, 3, -3, 4, -5, -3,
+    -7, -2, 1, 8, -7, -3, 0, -6, 5, 0, -3, -4, -6, 2, -1, -23,
+    -6, 8, 3, -2, -1, 4, 14, 1, 4, -11, -2, 8, 18, -6, -5, -5,
+    11, -7, 1, 1, -15, 7, 4, -5, 10, -8, 1, 1, -6, -12, -4, -6,
+    -4, 1, 10, 9, -6, -3, 7, -12, 5, -2, 2, -10, 2, 0, -4, -9,
+    7, -6, 1, -3, 2, -7, -5, -3, 4, 4, 3, 0, -5, -9, -4, -31,
+    -9, -5, -7, -8, 9, 2, -1, -9, -7, 9, -3, 12, 1, 2, -3, -4,
+    14, -8, 14, -13, 0, 4, -4, -10, 5, 9, 1, -5, -7, 3, -2, -12,
+    19, -3, 4, 3, -9, 0, -2, -4, -10, -2, 0, -8, 0, -2, -1, 5,
+    -3, -1, -19, -9, 7, 3, -5, -1, -3, 2, 9, 13, -5, -6, -9, 14,
+    1, -5, -8, -10, -14, -1, -6, -10, -14, 0, -13, -4, 15, 4, -5, 4,
+    -8, -14, 7, -13, -3, -4, -7, -5, 2, -9, -10, 1, -12, -3, -7, 4,
+    -7, 13, 2, -15, -3, 12, 12, -2, -5, 4, -4, -4, 9, 6, 0, -7,
+    6, 6, 3, -7, -7, 0, -3, -3, -1, 1, 6, -2, 11, 8, -3,
+  },
+  {
+    -4, -5, 0, 2, -2, -1, -6, -11, -4, -5, -2, -3, -1, -5, -3, -20,
+    1, -5, -8, 1, 1, 1, 2, -4, -3, -4, -3, -13, -4, 4, -5, -27,
+    1, 6, 3, -4, -5, -3, -2, -2, 1, -1, -1, 0, -1, -3, -2, -2,
+    0, -9, -3, -6, -1, 4, 2, -19, -5, 5, 4, -2, 1, 3, -8, -27,
+    -3, -9, -12, -3, -2, -10, -17, -6, -18, -4, 3, -5, 0, 5, -4, -13,
+    10, -9, -5, -8, 1, 5, 5, -6, -2, -4, 4, -9, 4, 6, -18, -4,
+    -12, -2, -2, 7, 0, 5, -2, -15, -12, 0, -3, -1, 12, 0, 10, -24,
+    -4, -7, 10, 1, 5, -1, -1, -2, 0, -5, -11, -1, -10, -1, -6, -33,
+    3, -8, -11, -9, -9, 7, 2, 6, -7, 16, -10, -1, 2, -11, 6, 10,
+    -8, 1, 1, -11, -15, -3, 8, -4, 9, -12, -12, 4, 12, 1, 4, -11,
+    -1, -8, 12, 5, 2, -16, -2, -14, -7, -1, -7, -3, -5, -1, 5, 13,
+    9, 5, -3, -11, -13, 5, 1, -13, 3, -11, 3, 12, 23, -1, -1, -1,
+    -2, -6, -3, -13, -3, -5, -2, 8, 16, 4, 3, 2, -8, 5, 5, -24,
+    -3, -6, 2, -6, -5, -3, 1, 5, 1, -11, -13, 8, 6, 4, 2, -43,
+    -3, -3, 3, -9, 6, -4, 3, -14, -2, -2, -5, 8, -8, 5, 10, -10,
+    5, 0, -4, -20, 10, 4, -1, 2, -2, 13, -20, 6, 1, 0, -5,
+  },
+  {
+    -1, -1, 1, -4, 0, -1, -3, -3, -4, -2, -1, -4, 0, -1, -6, -7,
+    4, -7, 3, 2, 4, 2, -1, -3, 0, 3, -2, -8, -3, -5, 3, -16,
+    0, 3, 6, -2, -5, -1, 3, -7, -1, -4, -1, 4, 4, -5, 0, 0,
+    -3, -10, -2, -1, -4, 9, -3, -15, -5, 1, -1, 4, -2, -6, 2, -22,
+    1, -6, 3, -6, 4, -7, 8, 0, 2, -11, 0, -4, 6, 1, 7, -11,
+    6, -4, -5, 2, -2, -3, -9, -6, -15, -3, -12, -9, 1, 4, 4, -9,
+    12, 0, 6, -6, 8, -2, 8, -6, -1, 3, -7, -2, -11, -3, -10, 13,
+    -4, 4, 7, -6, -5, -5, 11, -3, -2, -9, 6, 13, 1, 3, 4, -18,
+    0, -4, -3, -10, -1, -2, 10, -12, -1, -1, -2, -5, -8, -3, 11, -17,
+    -4, -5, -2, -12, 1, 2, -2, 3, -1, 9, -8, 6, 0, -2, 2, -4,
+    -13, -4, -5, -6, -15, -4, -2, -5, 5, -7, -6, 4, -11, 14, 8, -13,
+    2, 4, 3, -1, -3, 5, 9, 8, 23, -11, -2, 3, -8, -3, 13, -2,
+    3, -13, 14, -14, -7, 11, 1, 6, -19, 5, -1, 6, 13, -14, -5, -8,
+    7, -4, -10, -18, -13, 11, -2, 4, -7, 11, -6, -14, -4, -3, 12, -15,
+    -27, 1, -10, -6, 3, 1, -10, -6, 0, -2, 23, 11, -12, -2, 17, 13,
+    -4, -22, -8, -11, 4, 4, 3, 11, -1, -10, -8, 5, 2, -2, 8,
+  },
+  {
+    3, 0, 2, -2, -1, -4, -3, -8, -3, -2, 0, -8, 1, -1, 1, -7,
+    -2, -2, -1, -1, -3, 2, -2, -11, -3, 1, -3, 9, -14, -7, 9, -10,
+    -10, -5, -3, -3, -1, 1, 7, -12, 5, -7, -4, 3, -1, -12, 3, -12,
+    0, -1, 6, -3, -2, 6, 9, 0, 5, -5, -4, 16, -2, 2, 16, -21,
+    4, -8, -2, -5, -9, 2, 1, -5, -4, -8, -9, -6, 6, -3, 2, -4,
+    -1, -3, 8, -3, 7, -5, -6, -3, 5, -12, -2, -6, 8, 3, 2, -22,
+    -10, -5, -1, -4, -8, 3, 5, 2, -3, -6, -9, 0, -13, 4, -2, 2,
+    -2, -9, -21, 25, 13, -5, -4, -4, -9, -1, -4, 3, 3, -7, 0, -19,
+    5, 10, -8, -2, 3, -3, 6, 1, 9, -23, 12, -2, -9, 0, 13, 2,
+    -6, -1, 3, -14, -2, -2, -4, -6, 3, -2, -16, 4, 1, 4, -4, -1,
+    -6, -7, -4, -17, -5, 7, -21, -17, -3, 3, -4, 1, -1, 7, 7, 4,
+    11, 4, -1, -4, -11, 5, 7, -10, -14, 6, -12, 5, -13, 8, -15, -33,
+    -9, -13, -5, -10, -6, 4, 5, 8, -6, -2, -12, 2, -2, -3, 8, -12,
+    1, 5, 7, -4, -10, 1, 0, 1, -1, -3, -4, -5, 7, -6, 1, 0,
+    6, 9, -18, -8, 15, -17, -8, 3, -38, 1, -1, 5, 12, 2, 6, -17,
+    -9, -33, -11, -6, -8, -2, 3, -11, 0, 12, 1, -10, 10, 1, 19,
+  },
+  {
+    -3, -3, 0, -7, 2, 1, -1, -2, -2, 0, -1, 0, -1, -3, 0, -3,
+    -6, 0, -9, 2, 1, -2, 6, 1, -4, 5, -2, -1, -2, 0, 1, -13,
+    9, 16, -7, -9, -5, -2, -12, 2, 3, -2, 0, 1, 1, -3, 0, -2,
+    3, 1, 7, 0, -9, 1, 1, 4, -2, 5, 1, -7, -5, -6, 3, -15,
+    -8, -5, -10, 0, -23, 9, -8, -4, 2, -5, 1, 4, 8, 7, 1, -4,
+    0, -1, 16, -2, 6, 0, -1, -2, 9, -1, 0, -1, -6, -6, 6, -9,
+    -2, -10, 0, -2, 5, -9, -9, -4, 12, 0, -1, -4, -2, -2, -3, 3,
+    -2, 10, -4, 7, 6, 3, -5, 9, 2, -4, -8, -7, 10, 0, 3, -27,
+    -7, -8, -11, -4, 11, 12, -12, 1, -1, 27, 0, -8, 20, -1, 11, -2,
+    -6, -5, 2, -7, 1, 2, -17, -1, -9, 3, -17, 6, 11, -4, -2, -9,
+    -7, -4, -2, -5, -2, -10, -1, 10, -2, 0, 1, -7, 14, 0, -8, 3,
+    10, 9, 8, -17, -5, -1, -3, -13, -4, 2, 1, 21, -16, -8, 8, 3,
+    10, -3, 5, -13, -6, -2, 2, 13, 2, -2, 4, -7, -13, 5, 3, -10,
+    -4, 33, 7, -18, 17, 12, 9, -2, -2, 15, 6, -5, -3, -1, 1, -30,
+    -2, -22, -3, 5, -15, -9, -7, -29, -11, 11, 16, 0, -7, 9, 3, -3,
+    14, 7, 8, -7, 8, -2, 3, 6, 8, 6, 7, 3, -7, -3, 1,
+  },
+  {
+    -2, -3, 2, -5, 0, 3, 2, 1, -1, -3, -3, -3, 1, -1, -1, -10,
+    -7, -2, -4, -1, -1, -1, 0, 5, 0, 3, 2, 1, -5, 5, -6, -13,
+    -2, 4, -6, 0, -5, -7, -3, 5, -2, -2, -4, -4, 0, -1, -5, 0,
+    -3, -1, -2, -4, -2, -9, -4, -1, -5, 9, -1, 2, 2, 9, -7, -22,
+    0, -15, 8, 5, -17, -11, 1, 2, -13, -5, -11, -17, 4, 4, 1, -1,
+    -4, -15, -2, -4, -6, 8, 1, -5, -1, -6, -7, -16, -4, 5, 1, 1,
+    5, -3, -8, 1, -3, -2, 8, 3, 3, -7, -5, -4, 12, -13, -2, -10,
+    0, 6, -2, -8, -16, 2, -5, -8, -5, -4, 6, -1, -4, -4, -2, -14,
+    2, -5, -10, -1, -3, -1, -18, -1, 2, 24, 1, 7, -15, 5, 1, -4,
+    -15, 4, 2, -1, 8, 11, 6, -13, -3, -12, -4, -8, 0, 3, 5, -15,
+    -1, 9, 1, 2, -1, 15, 3, 4, 7, 2, -6, 12, 1, -1, -11, 6,
+    -2, -1, -3, -8, 4, 14, -1, -8, -2, 3, -3, -8, -3, 1, 2, 0,
+    -7, 2, 10, -1, 0, 18, -2, 0, -15, 7, 5, -22, 4, -4, -4, -4,
+    -5, 3, 9, -12, -6, -6, -8, -14, -6, -7, 2, 1, 1, 7, 4, -9,
+    10, -2, 7, -7, 4, 5, -3, -3, -13, -13, -5, 6, -4, -3, -4, 14,
+    0, -6, 2, -10, 3, 1, 15, -3, 7, -8, 16, -4, 22, -2, 5,
+  },
+  {
+    1, -2, -1, -3, -1, 3, -1, -10, 0, -1, 0, -4, -1, 0, -3, -11,
+    -1, 0, -3, -2, 4, 3, -1, 5, 0, 3, 7, -3, 3, 2, 4, -19,
+    -11, -2, 7, -5, -6, -10, 0, -1, 1, 4, 4, -2, -3, 4, 1, -8,
+    -12, -6, -2, -5, -7, -7, -10, -10, -1, 0, 1, 2, 0, -4, -2, -3,
+    -7, 4, -4, 5, -4, 2, -1, 6, -9, -7, -5, -6, 8, -12, 4, 1,
+    5, -3, -1, -2, -1, -1, -4, 1, 3, 7, 2, 4, -10, 5, -1, -11,
+    0, -14, 5, -2, 5, -9, 3, -2, 9, 3, 3, -7, -5, 18, -3, -5,
+    1, -5, 2, -6, -12, 2, 9, -2, -7, 0, -7, 2, 9, -6, -2, -23,
+    16, 10, -4, -17, 11, 3, 1, 5, -11, -20, -5, 0, 1, -3, 2, -18,
+    -1, 1, 3, -14, -1, -3, -1, -6, 10, 10, 4, -11, 6, 7, 15, -2,
+    6, 0, -4, -13, 4, 10, -4, 15, -6, 4, -3, -11, 2, -1, -9, 8,
+    0, 0, -12, -15, -12, 1, -17, -7, 6, -5, -8, -8, -2, 8, 10, -18,
+    1, -5, -2, -25, 7, -6, 2, -18, -3, -3, -1, -5, 3, -1, -18, -6,
+    -6, 1, -11, -15, -6, -1, -1, -2, 7, 5, -11, -10, 28, -2, 3, -7,
+    -1, -5, -1, -13, -3, -8, 11, -2, 4, -17, -4, 1, 11, 7, -18, -13,
+    1, 6, 4, -5, -1, 10, 10, 3, 9, 2, 4, 7, 3, 8, 1,
+  },
+  {
+    -2, 3, 1, -2, 5, 2, -1, -6, 1, 2, 4, -2, -1, -6, -3, -4,
+    -2, -4, -6, -3, 5, 2, -14, 3, -2, 3, -6, 8, 4, 1, -1, -13,
+    1, -9, 1, 4, 1, 1, 4, -3, -2, 0, 8, -7, 3, -1, -1, 3,
+    -4, -1, -5, -3, 2, -8, 5, -1, -13, 0, 5, 7, -2, 1, -2, -13,
+    -3, -3, 12, -1, -5, 4, 0, -1, -7, -4, -2, 2, 7, 2, 8, -1,
+    -14, -11, -5, 11, -1, 3, 4, -12, -8, -12, 4, -14, 21, 2, -2, -2,
+    1, -2, -14, -3, -3, 1, 5, 1, 4, 6, -8, 2, -7, -9, 7, 4,
+    6, -1, -1, 1, -1, 0, 5, -7, -7, -14, -2, -3, -2, 3, 4, -19,
+    5, 0, -5, -23, 4, 12, 6, 6, -6, -4, -3, -1, -17, -4, 3, 0,
+    -18, 10, -3, -9, -10, -5, -13, 9, 6, -1, -1, -3, -3, -4, 4, -22,
+    -6, -9, -9, -11, -3, 11, -6, 4, -15, 3, 20, 12, 4, 13, -15, 10,
+    -7, -5, 1, -18, 4, -9, -19, -38, 6, -11, -39, -15, 11, -3, 1, -1,
+    32, -5, -8, -7, 10, 5, -6, -6, -3, -4, -8, -4, 4, -6, -2, -3,
+    5, 4, 4, -25, 1, 8, 7, -10, -15, -6, 2, -8, -11, 1, 2, -4,
+    6, -4, -3, 12, -25, 13, -11, 0, -2, 1, -10, 3, -3, -6, 27, -11,
+    24, -9, 10, -8, 1, -5, 4, 4, -1, -3, -1, -4, -3, -5, 2,
+  },
+  {
+    -2, -5, 1, -2, 3, 1, -3, -7, 7, 0, 6, -1, 3, -1, 0, 0,
+    4, 10, -9, 0, 2, 3, 0, 5, 0, 3, -4, 5, 3, 0, -4, -15,
+    -11, 6, -8, 1, -6, 15, 6, -1, 3, -3, -1, 3, -7, 1, -3, -2,
+    -5, 4, 4, 2, -2, -2, -5, 2, -5, 1, -6, -3, -4, -3, -3, -8,
+    -2, 8, 2, -2, 8, 1, -13, -5, 3, -4, 4, -5, 25, -5, -5, -4,
+    0, 0, -1, 7, 3, -5, -8, -1, 3, -2, -12, 8, 1, 2, -13, -7,
+    -4, -6, -3, 0, 14, -3, -13, -8, 1, -5, -5, 3, 3, 9, -3, -2,
+    2, 4, -10, 8, 0, -12, 4, -2, -7, -8, 4, 3, -2, 2, -5, -20,
+    14, 12, -7, -7, 28, -6, 4, 3, -1, 3, 17, -8, 11, -6, 3, 4,
+    13, 1, 7, -9, -8, -6, 9, 9, -2, 6, -36, 0, 1, -8, 9, 2,
+    9, -3, -22, -4, 0, 3, 11, -2, 11, -5, -1, 3, 11, -9, 6, -8,
+    -4, 2, 2, -15, -5, -1, -5, -7, 14, -3, -15, 3, -4, -20, -15, -15,
+    15, -1, -6, 2, -6, 2, -10, -8, 1, -3, -15, 4, 10, -6, -7, -3,
+    -6, -1, -7, -3, -27, -5, 2, 4, -13, -5, -1, 11, -12, 1, -1, -1,
+    1, 5, -13, -12, 3, -9, -10, -26, -7, 4, -5, -23, -10, -3, -2, -18,
+    -6, -5, -9, -14, 3, -7, 14, -2, -6, 0, 7, 4, 6, 9, -4,
+  },
+  {
+    -1, -6, 5, -4, 0, 1, -3, -6, -11, -6, 2, -3, 0, 12, 5, -12,
+    2, 9, -1, 2, -4, 2, 0, -5, 7, 3, 3, 4, -17, -1, -2, -21,
+    0, 6, -20, -1, -22, -3, 1, -10, -11, -3, -1, 2, 3, 6, -9, -4,
+    -6, 2, 3, -1, 11, -6, 0, -10, -3, 20, 10, -11, -4, 17, -9, -31,
+    -2, -12, 5, -1, 0, -13, 1, -11, 12, 17, 6, -2, -3, 4, 5, -2,
+    -1, -6, -3, -1, 7, 1, 3, -9, -10, 2, -1, -13, 0, -8, 6, 1,
+    -15, 8, -9, 1, 0, 0, -7, 3, 0, -8, -4, 0, -2, -10, 3, -1,
+    6, -13, 5, -13, 35, -12, 3, -8, 7, -12, 3, -3, -27, -16, -6, -33,
+    10, -3, 0, -11, 3, 6, 2, -13, -7, 7, -8, -30, -5, -3, -9, 3,
+    -6, -10, 13, -18, 33, -1, 11, 2, -18, 3, -10, 2, 8, -1, -2, -20,
+    11, 2, -11, -22, -6, -4, -11, 3, 2, -6, 14, -4, 5, -1, 4, 1,
+    8, -7, 7, -24, 2, -8, -1, -5, 1, -3, 4, -9, 5, 9, 1, -22,
+    5, 9, -7, -18, 1, 12, -12, -11, -4, -4, 2, 3, -2, -2, -7, 5,
+    -3, 6, -12, -15, 11, 18, -16, -9, 0, -3, 1, 7, -4, -9, -13, -11,
+    -3, -3, 1, -11, -9, 4, -3, 24, 4, 11, 41, 2, -3, 7, -33, -25,
+    -18, 0, -1, 3, -9, 6, 13, -13, -3, -33, 3, 13, -15, 4, 12,
+  },
+  {
+    0, -4, 1, -8, -4, 1, -1, -6, -3, 0, -1, -5, -2, 2, -3, -10,
+    -7, -2, -2, 1, 0, -1, -1, 4, 2, 1, 0, 3, 0, 0, 3, -17,
+    -3, -13, 0, 3, -8, 0, -4, -6, -2, -4, -6, 2, 1, -1, -3, -5,
+    1, -2, -3, -4, -5, 2, -5, 0, 1, -7, -6, -2, -5, 7, 3, -8,
+    -3, -9, -12, 16, -3, 4, -7, 4, -1, -3, -2, -2, 1, -4, -9, -4,
+    -4, -8, -8, 3, 1, -7, -2, -5, -2, -1, -1, 1, -6, 2, 9, 2,
+    2, -12, 6, -6, -12, 0, 0, -4, -8, -8, 8, -3, 5, 12, -4, 1,
+    1, -5, 12, 3, 0, -6, -7, 6, -4, -4, 0, -7, -5, -1, -6, -28,
+    28, 1, -4, 3, -2, 7, -4, 7, 28, 2, 0, 2, 2, 2, 0, -3,
+    21, -8, 0, -10, 1, 6, -5, 2, -6, 3, 6, 0, -2, -1, 0, -2,
+    -1, -13, 13, -6, -11, 14, -1, -13, -8, -1, -6, 20, 3, 3, -4, 3,
+    0, -12, -9, -17, 10, -6, 10, -10, 16, -5, 4, 12, -4, 11, 6, -4,
+    -2, -6, -2, -6, -17, -15, 6, -1, 0, -2, -13, -14, -8, -2, 4, -4,
+    -1, 3, 13, 6, 4, 10, -4, 4, -1, -1, 5, 5, -1, -9, -8, 0,
+    0, 2, 2, -7, -6, -7, 7, -1, -8, 12, -11, 14, 2, -2, -3, 4,
+    1, -4, 6, -7, 6, 3, -3, 1, 3, -8, -1, -21, 5, 5, -17,
+  },
+  {
+    -2, -4, 4, -1, -2, 2, -2, -12, -12, 2, 0, 2, 2, 6, 6, 5,
+    1, 13, 1, -4, 5, 0, -2, 2, -1, -2, 0, -2, -13, 1, -10, -14,
+    -20, 0, -3, -5, 12, -5, 7, -5, -3, 0, -7, 0, 0, -1, -1, -3,
+    3, -2, -4, -1, -6, 3, -4, 0, -1, -20, -4, 1, -5, -1, -2, -23,
+    7, -26, 5, -7, -3, -3, 2, 6, -8, 0, 26, -4, 6, -6, -1, -1,
+    11, -4, -7, -4, -3, -7, -12, -7, -9, -2, 4, 3, -3, -2, 2, -5,
+    -4, -9, -1, 4, 0, -9, 1, -2, 3, 3, 2, 0, 8, 12, 6, -2,
+    -1, -8, -3, -32, -10, 3, 0, 2, 11, -7, -2, 17, -4, -2, 2, -22,
+    -9, 1, -18, -38, 4, 0, -2, -10, -9, -7, 2, -4, -1, -5, 5, -12,
+    -6, -7, 5, -1, -3, -3, 33, -4, 12, -21, 1, -3, 0, -9, 1, -1,
+    9, 14, 12, -1, 9, -20, -8, -1, 4, -13, 6, 0, -3, -5, -10, 12,
+    -12, -9, -6, 6, -10, 12, 5, -2, 8, -9, 0, -3, -2, 1, 11, -15,
+    13, 4, 12, -8, -11, -13, 6, -9, -5, 9, -6, -2, -3, -7, 6, -4,
+    8, -9, 0, -10, -9, 1, -3, -5, -6, 6, 17, -3, -12, 9, -18, 1,
+    -6, -16, -21, -6, -3, -3, 10, 37, 2, 4, -3, 6, 2, 2, -6, 2,
+    9, -1, -1, 5, -3, 12, 3, 12, 31, -5, 6, 3, -3, -4, 2,
+  },
+  {
+    -3, -4, 1, -11, 3, -3, -2, -16, 1, -2, 2, -1, -1, -7, -1, 12,
+    -3, 4, -1, 2, 0, -3, -5, -3, 1, 3, 4, -10, 1, 1, -2, -11,
+    -32, -3, 2, -1, -2, -7, -4, 3, 2, 0, -4, -4, -7, -18, -4, 5,
+    0, -3, -4, 2, 3, 0, 6, -8, 8, 3, -8, -7, -6, -1, 4, -18,
+    7, 33, -6, -4, 5, -1, 7, -2, 2, -3, 6, -6, 1, -7, -6, 0,
+    3, -3, 10, -7, 1, -3, 4, 11, 0, 5, 3, 19, 3, 4, 11, -3,
+    -14, -12, -11, -2, 8, -4, 0, -2, 0, -1, 0, 3, 6, 3, -4, 16,
+    -1, 2, -7, -2, 8, 2, 7, -14, 1, -3, 6, -4, -4, 0, -2, -27,
+    2, -6, 11, 2, -54, -4, 3, 3, -3, -11, -9, -14, 0, 3, 7, -8,
+    2, 8, 14, -11, -7, 2, 3, -19, 3, -4, 1, 2, -9, -2, 6, -1,
+    5, -6, 0, -1, -2, 1, 18, -7, -6, -1, 0, -1, 4, -9, -4, -3,
+    15, -7, -4, -16, -26, -1, -5, 19, -21, -13, -4, 6, 11, -12, 1, -8,
+    16, 5, 0, -4, -25, -8, 0, -13, 2, -10, -3, -7, 4, -7, 3, -7,
+    13, -9, -5, -11, 5, 8, 13, -18, 3, -4, -2, -11, -9, -9, 8, -13,
+    -8, 7, -20, -20, -8, -7, -3, 6, 6, 0, 1, -3, 4, 5, 0, -2,
+    1, 1, 5, -6, 1, 3, -13, 15, 0, -3, -1, -12, 0, -7, 1,
+  },
+  {
+    0, 0, -3, -3, 2, -1, -4, -6, 1, 1, 4, -3, -1, -5, -2, -2,
+    -2, 2, 7, 0, 3, 7, 5, -4, -4, 2, 0, -1, 4, 0, -2, -6,
+    -4, 2, 5, -1, -4, -3, 7, -5, -5, 4, 1, 1, -3, 0, -12, 8,
+    0, -6, -2, -1, 4, 0, -7, 8, -4, -5, -6, -1, -5, -5, 2, -20,
+    0, -13, 6, 3, 0, -2, -2, -12, 4, -9, 2, 4, 3, -2, 6, -5,
+    -1, 0, -6, 3, -5, 17, -9, 2, 5, -11, -2, 1, -2, -22, -5, 1,
+    16, -5, -18, -14, -9, -5, -5, 3, -5, -6, 10, -6, -9, 10, 12, -1,
+    12, -10, 0, -6, -2, 4, -1, -4, -4, -4, 0, 4, -2, -2, 6, -26,
+    -21, 1, -5, -3, 12, 3, 7, 8, -1, -8, -11, -2, -3, -1, 4, -5,
+    13, -5, -4, -22, 5, 7, -1, -2, 3, -8, -1, 8, -12, 11, -15, -5,
+    5, 2, -9, -6, 1, -3, 1, -13, -1, -4, -1, -11, 20, -10, -4, 8,
+    6, 2, 8, 7, 0, 14, 12, -7, -9, 1, 9, -27, 0, -3, -1, 2,
+    13, -10, 41, -3, 10, -22, -7, -13, 6, -16, 16, -4, 5, 7, 9, -6,
+    11, 3, -8, -15, 3, -5, 15, -6, -3, -9, -10, -12, -16, 0, -1, 5,
+    -10, -6, -20, -3, -6, -9, -9, 4, -12, -16, -5, -13, -1, -10, 2, 2,
+    0, 1, -4, -14, -19, 0, 4, -19, -3, -1, 3, -3, 3, -13, 7,
+  },
+  {
+    -2, 1, -1, -2, -6, 2, 4, -8, -5, 0, -1, 1, 2, -1, -6, -10,
+    4, 13, 0, -14, -9, 2, -1, 7, -2, 2, -4, 5, -3, 8, 4, -13,
+    -1, -6, -2, 1, -19, -1, -3, 17, -4, 11, -4, -1, 5, 4, 2, -3,
+    2, -8, 8, -10, -9, 4, 5, -1, -4, -2, -1, -10, -7, -5, -5, -23,
+    -6, -1, -10, 0, -4, 2, 0, -4, -1, -28, -6, -12, 6, -1, -4, -6,
+    -18, -1, 2, 0, -30, -3, 8, -6, -1, -5, 9, -4, -9, 0, 2, -1,
+    -2, -4, -5, -18, 5, 2, -13, 13, -2, 7, -3, 0, -4, 8, 1, -9,
+    5, -7, 2, -2, 5, 2, 3, -14, 3, -24, 2, -2, 4, 6, 16, -24,
+    -2, -4, -8, 5, 5, -3, 3, 6, -16, 15, -12, -11, -10, -1, 5, 2,
+    6, -6, -5, 19, 9, -9, 12, -6, -4, 16, 6, 2, -9, -1, -3, 7,
+    -2, -38, 14, -23, -1, 13, -2, -5, -4, -27, -4, 10, 2, 1, 14, 10,
+    1, 6, -2, -10, -5, -3, -23, -3, -9, 25, -13, 4, -3, -6, -3, 4,
+    -2, -7, -11, -11, 7, 18, -4, -22, 0, 8, 3, -10, -16, 13, -16, 4,
+    -17, 0, 9, -5, 16, 3, -7, -6, 5, -13, 16, 12, 13, -8, 5, 4,
+    0, 4, 6, -6, -17, 3, 0, -2, -2, 3, -8, 0, 10, -2, -9, -21,
+    13, 4, -2, -41, 7, -22, -7, -3, 2, 7, 1, 11, 22, 0, 0,
+  },
+  {
+    -1, 0, 1, -4, 1, 0, 0, -6, -3, -2, 5, -1, -1, -4, 0, -7,
+    -4, 2, 2, -7, -5, 0, 13, 0, -1, -1, -3, -3, -4, 3, -5, -6,
+    -4, 7, -5, 2, -11, -2, -4, -11, -7, -5, -1, 6, -7, -3, -19, -5,
+    0, -2, -3, -5, -2, -1, 1, -1, -3, 1, 0, 6, 1, 1, -3, -16,
+    -2, -12, -1, -8, 11, 14, -11, -4, -15, -7, 8, -4, -1, -8, 2, -11,
+    -4, -11, -3, -8, -6, -3, 2, 3, -4, 1, -4, 5, 0, 30, 6, 3,
+    -4, -7, 1, 0, -4, -8, 6, 0, 0, -7, 0, -7, -3, -2, -4, -2,
+    11, -6, -3, -2, 12, -8, -3, 3, 6, -6, 2, 10, 3, 2, 4, -28,
+    1, -3, -6, 7, 3, -2, 3, -3, -15, -12, 9, -1, 2, -6, 2, -2,
+    0, -2, -14, -1, -14, 6, 1, -7, -2, -1, -6, -7, -2, 1, 9, -16,
+    15, -7, -2, -11, 0, 3, 10, -18, 2, 1, -2, 2, -14, 3, -3, 6,
+    -1, -15, -5, 2, 12, -12, 12, -3, 6, 7, 0, 7, 28, 5, -5, -7,
+    -5, -10, -2, -1, -1, 6, 2, -5, 4, -7, -2, -7, -7, 1, 5, 5,
+    4, 9, -2, 2, 3, 2, 4, -10, 0, 10, 12, 1, 1, -8, 1, -8,
+    -6, 2, 10, 5, -6, 2, -2, -8, 15, -9, -1, 5, 3, 10, 23, 1,
+    -19, 0, -6, -3, 3, -1, -4, -3, -21, -8, -2, 9, 1, -1, 7,
+  },
+  {
+    -3, -3, -1, -2, 0, 1, 0, -6, -3, 4, 0, -2, -1, 1, -5, -8,
+    8, -4, 2, 3, -4, 5, -1, 3, 0, 0, -4, 1, -1, 1, 0, -3,
+    -6, -7, -12, 13, -1, 3, -3, 2, -5, 9, 1, -3, -10, 0, -1, -1,
+    -9, -4, -1, 0, -6, -8, -2, 2, -1, -2, -6, -5, 0, -2, 8, -24,
+    -4, 3, -12, -4, 1, -13, -2, -6, -16, -10, 8, -5, 4, 21, 5, -2,
+    -8, -2, 8, -2, 1, -1, 11, -2, -8, 6, -7, -3, 1, -2, -8, -5,
+    2, 3, 3, -10, 5, 0, -3, 3, -2, 2, -6, -9, 8, 1, -6, -1,
+    -3, -11, -11, -3, -1, 7, 6, 7, -8, -7, 4, -2, 8, 4, 3, -22,
+    -12, -13, -5, -17, 4, -7, -1, -3, -5, -1, -5, -9, -1, 7, -6, -4,
+    -8, 20, 8, 6, -11, 1, -14, 2, -2, -9, -8, 2, 21, -1, 1, 2,
+    2, 10, -3, -17, -6, 8, -4, -2, 12, 13, -16, 1, 6, 15, -1, -2,
+    4, 1, -6, -10, -22, -5, 5, 2, 2, -16, -11, -2, -5, 6, -3, -5,
+    -11, -12, -3, -9, 16, 13, -3, -3, 5, -1, -1, 3, 4, -2, 1, -10,
+    4, 4, -7, -5, 0, -5, 5, -20, 2, -1, 2, 2, -1, -9, 8, 12,
+    -1, 1, 2, -5, 11, 9, 16, -1, 6, 5, 4, -15, -7, 1, 3, -7,
+    6, -11, 6, -3, -4, -15, -12, 0, -2, 3, -5, 0, 6, -16, 2,
+  },
+  {
+    -2, -6, -2, -6, -1, 1, -1, -13, -1, -5, -2, -3, -2, -6, -3, -16,
+    2, 3, 3, -1, 1, 2, 0, -1, -1, -2, 3, 5, 1, 1, -2, -25,
+    -4, 0, 6, -1, -6, 5, 6, 0, -5, 8, 3, 1, -7, 3, -3, -6,
+    -5, -8, -1, -5, -9, -5, 3, 5, -4, -1, -8, -3, 1, 1, -4, -24,
+    2, -7, -1, 2, 2, 4, 6, -3, 6, -9, -2, 5, -2, -3, 1, 1,
+    8, -9, -3, 1, -4, -9, 3, -14, -1, -6, -2, -4, -2, 0, -6, -11,
+    9, -4, 4, -2, -1, 7, 8, -16, -2, -10, -1, -5, 2, 4, 7, -3,
+    5, -14, -15, 3, 7, 4, 2, -3, 5, -16, -7, 3, -3, -1, -7, -33,
+    -3, -2, 1, -15, -18, 11, 3, -9, -8, -1, -9, -1, -12, -11, -4, -15,
+    1, 2, 1, -16, 5, 5, -6, 7, 0, -10, 2, -5, -7, 6, 2, -4,
+    10, -8, -5, -6, -8, -11, -7, 7, 0, 3, 6, -9, 3, -3, 24, 2,
+    3, -3, 5, -16, 6, -2, -10, 4, -8, -1, -18, 7, 15, 1, 1, -29,
+    -4, 6, 7, -13, -7, -16, -8, -6, 2, -5, 7, 0, 8, 7, 13, -34,
+    8, -4, 16, -9, 7, 7, 1, -4, -3, -1, -8, -7, 6, -5, 17, -3,
+    -5, -8, -22, -19, -2, -17, -9, -12, -1, 1, -1, -4, -11, 15, -6, 1,
+    2, 4, 11, -1, -4, 2, 9, 6, 3, -6, 1, 3, 6, -10, -4,
+  },
+  {
+    0, 0, -2, 0, -3, 0, 1, -2, -4, -5, -1, 1, 4, -1, -3, -5,
+    -3, 3, -7, -10, 1, 0, -7, 1, 2, 0, -8, -1, -3, 1, -1, -15,
+    -6, 0, -1, -5, -10, -2, -5, 10, -5, -1, -3, 0, -1, 0, -1, -4,
+    -4, 2, 2, 3, -2, -6, -8, -1, -7, -2, 5, -3, -5, 0, -9, -13,
+    -4, -1, -10, -3, -10, 4, 12, -15, -5, -9, -2, -9, -3, -2, -7, -13,
+    23, -4, 8, -10, 0, 10, 0, -4, 6, -11, -5, -14, 17, -2, -2, -6,
+    -5, -3, 1, -1, -6, 1, -14, 2, -11, -6, -7, -17, 1, -10, 0, -18,
+    2, 0, 5, -7, 3, 0, 2, -2, 3, -7, 1, 10, -9, -3, 1, -23,
+    0, -9, -3, -4, 0, 8, -10, -8, -5, 11, -2, -9, 9, 11, 1, -11,
+    -7, 2, 9, 16, 20, -7, -2, -23, 9, -15, 6, -3, -2, 0, 11, -23,
+    -3, 10, -28, -17, 0, 9, 3, -3, 6, -6, -1, 4, -7, -11, 7, -13,
+    -17, 4, 4, -14, 1, -13, -2, -9, -4, -1, 2, -3, 0, -9, -3, -7,
+    -6, -8, 4, -6, -5, 3, 0, 1, 9, 0, -4, 11, -8, 11, -12, -9,
+    14, -8, 2, -4, 5, 18, -1, -20, 12, 4, 1, 22, 2, 2, 10, 3,
+    2, 1, 3, -13, 9, 9, -1, -1, 15, 12, -2, 2, 0, -1, 0, -6,
+    -9, -1, -3, -7, 0, -9, -6, 3, -12, 18, -9, -5, -8, 1, 8,
+  },
+  {
+    2, -1, 5, -2, 2, 1, 5, -4, -1, 0, 1, 0, -4, -1, -4, -7,
+    -2, 6, 2, -4, 5, -3, -2, -3, -2, -4, 1, 1, -6, -16, -1, -13,
+    0, 5, 3, -3, 4, -6, -2, 0, -1, 1, 2, -3, -12, 2, -8, -6,
+    1, 0, 1, -10, 1, -12, 0, -4, -9, -14, -2, -26, -10, 1, 7, -19,
+    5, -3, -9, -3, -13, -6, -6, -2, -8, -4, -8, -4, -4, -2, 6, -9,
+    -2, -1, -7, 3, 2, 1, -7, 1, 5, 6, 1, -8, -9, 4, 2, 5,
+    -6, -7, 8, -11, -7, -4, 12, 7, 0, -1, 10, -18, 9, -7, 0, -20,
+    -3, -20, -2, -8, 3, -7, 7, -9, -2, -6, 10, -9, 3, 6, 15, -20,
+    1, 12, -1, -1, 17, -10, -2, -4, -2, -18, -1, -13, -2, -6, 5, -15,
+    -3, 1, 3, -8, 8, -16, 7, 3, -9, 6, -4, -8, 6, 2, 0, -4,
+    -8, 1, 23, -15, -5, -3, 10, -1, -3, 13, 1, -29, 10, -11, -2, -17,
+    7, -1, -11, -11, -2, -4, 3, -7, 0, -17, 12, 10, 8, -5, 0, 5,
+    9, -17, 7, 1, -6, 5, 1, -8, -6, 11, -1, -3, 5, -6, 0, 8,
+    -5, -5, 5, -15, 1, 23, 7, -5, -9, -2, 11, 5, -12, 6, -2, -6,
+    15, -9, -4, -22, -3, -7, 7, -19, -7, 6, -9, 0, -6, -13, -3, -19,
+    -22, 0, 3, -12, 9, 13, 5, -12, -5, -8, 14, 8, 9, -8, 16,
+  },
+  {
+    -1, -1, -1, 1, -2, -2, -1, -3, -6, 3, 0, -3, 2, -4, 1, -5,
+    1, 9, 0, -1, -2, 0, 1, -3, -2, -3, 3, -1, 2, 1, 1, -6,
+    -5, 2, -5, 1, 13, -1, 0, 3, -10, 6, -1, 2, -3, 0, -6, -7,
+    -2, 1, -1, -1, -1, 6, 1, 6, -4, 8, -5, 1, -3, 1, 1, -22,
+    -2, -7, -6, -1, -12, -13, -3, 0, -2, -3, -8, 1, 14, 6, 3, 0,
+    4, -2, 3, 3, 5, -6, 3, 9, -2, -9, -2, -3, 7, 5, 2, 5,
+    -3, -5, 3, 2, 2, -2, -6, 1, 6, -5, 2, -5, -9, -10, 4, 0,
+    -4, -1, 3, -1, 0, 5, -5, 0, -5, -4, 13, -6, -2, -6, -4, -21,
+    -14, 9, 14, -12, 2, 2, -9, 4, -6, 1, 11, 9, 5, -2, 1, -10,
+    -5, -11, 2, -8, -8, -28, 18, 2, 10, 5, -11, -18, 3, -1, -2, 1,
+    18, -7, 5, -4, 0, 3, 1, -4, -7, -6, 11, -8, 0, 1, -4, 5,
+    0, -12, -3, -14, -7, -6, 0, -4, -6, 1, -6, -4, -9, -2, -2, 3,
+    17, -5, 13, -9, 9, -9, -6, -3, 15, -4, -2, -5, 1, -2, 5, -6,
+    -4, 11, -1, 2, -12, 10, 8, 10, -1, -6, -9, 3, -1, 14, 3, 6,
+    -10, 26, 7, -10, -1, -9, -6, -5, -6, -6, 2, -1, -7, -4, -9, -3,
+    9, 11, -12, 3, -4, 2, -15, -6, 0, 7, -10, -3, -12, 6, -8,
+  },
+  {
+    -2, -7, -3, -8, 1, -3, -2, -11, 2, -1, 0, -2, -2, -1, 1, -15,
+    -8, 2, -7, 0, 2, -4, 2, -11, -3, -5, 5, 6, -1, 3, 0, -19,
+    -10, -11, -1, -2, -13, -8, -4, -1, -5, -3, -5, 5, 3, -1, -12, -5,
+    -4, -6, 3, 14, 2, 4, 11, 2, 3, -2, 0, -1, -3, 8, 1, -34,
+    -15, -10, 1, -14, 0, -7, 8, -2, -5, -5, -10, 9, 10, 9, 4, -6,
+    -4, -6, -6, 3, 1, 0, -1, 4, 8, -8, 4, -2, -12, 15, 1, -10,
+    -9, -6, 0, -2, 8, 2, 1, 9, -8, -10, -6, 1, -4, 0, -22, 1,
+    2, -12, 7, -2, -3, 0, 3, -5, -7, -9, 0, -8, -6, 1, 1, -19,
+    3, -10, 6, -12, 4, 0, -11, 8, -8, -10, 4, -8, 1, 5, -11, -8,
+    10, -10, 3, -9, 11, 18, 0, -9, -18, -12, 12, -21, -8, 1, 6, -5,
+    15, 4, -9, -16, -5, -3, -1, 5, 4, 7, 0, 6, 12, -16, -1, -11,
+    3, -3, 18, -17, -9, -7, 7, -7, 3, -3, 0, 2, -25, -1, -2, 21,
+    5, -21, 4, -12, -11, -3, -3, 9, 4, -5, 10, -4, 11, -5, -5, 0,
+    1, -26, -3, -17, 20, 1, 4, 13, 2, -5, 4, -8, -1, -10, -1, 1,
+    -4, -6, -3, -13, -3, -9, 8, 6, 3, 2, 6, -9, 6, -7, -9, -1,
+    -5, 8, 0, -3, 4, 8, 2, 4, 12, -3, 5, 1, -5, 6, 6,
+  },
+  {
+    0, -2, -1, -3, 2, -1, 1, -7, 0, 0, -1, -5, 4, -3, 0, -5,
+    -5, 1, 2, 3, 1, 6, 3, -4, 2, 0, 5, 1, -3, 3, -3, -18,
+    -7, -4, 0, -6, -1, 6, -2, 2, -1, 3, -2, -2, -8, -3, -1, -11,
+    -1, -6, 5, 10, 0, 6, -12, -3, -2, 6, 2, -9, -1, 1, 9, -22,
+    -5, -16, -3, -5, -11, -7, -5, -7, -5, -16, -8, -5, 2, -2, -14, -2,
+    3, 7, -5, -4, -3, 2, -3, -6, -1, -11, -3, -1, -2, 4, 6, -15,
+    -4, -8, -3, -2, 1, 2, 7, -5, 7, -9, -6, 0, -11, -17, -5, 7,
+    -5, -7, 6, -3, 3, -4, 13, 2, 4, -5, -7, -8, 2, -3, 3, -19,
+    0, -10, -6, -3, -1, 0, 2, -2, -10, 15, -1, -4, 4, 3, -8, 6,
+    4, -6, -3, -9, 0, -6, 0, 2, 1, -6, 1, 2, -8, 0, 0, -3,
+    -1, -1, 1, -17, -10, -17, 3, 4, -9, 13, -1, 5, -6, -2, 3, 2,
+    -2, -5, -6, -21, -3, 3, 9, -6, 20, -1, -1, -6, 6, 7, 3, 11,
+    2, 13, -9, -13, -9, 2, -2, -2, 0, 5, 14, -4, -5, -2, -1, 6,
+    3, -7, 10, -7, -17, -17, -3, 2, 4, 16, 0, 30, -2, -2, -7, -11,
+    6, -1, -1, -13, 11, -7, -4, -1, -6, 2, 8, 1, 3, 5, 4, 2,
+    -6, 1, 8, -6, 2, -10, -3, -13, 0, 6, 5, -1, -3, -3, -4,
+  },
+  {
+    0, -2, 0, -1, -1, -2, 1, -4, -3, 2, -1, -5, -3, -1, 0, -8,
+    -1, -2, 4, -1, -5, 2, -6, 4, 5, -1, -1, 1, 5, 3, 0, -6,
+    -8, 9, 6, -6, -4, 2, -4, 1, 1, -4, -3, -1, -2, 2, -3, 2,
+    8, 1, 6, -6, -5, -6, 3, -6, 1, -4, 4, -5, 1, -4, 8, -20,
+    2, -5, 2, -4, 16, 3, 5, -6, -7, -3, -8, -8, 8, 2, 8, -4,
+    -4, -6, -1, 0, 1, -11, 1, 1, 7, -11, -5, -2, -3, 7, -5, 2,
+    5, -6, -14, 2, -2, -6, 1, 14, 2, -12, -2, -6, -5, 5, -2, 7,
+    -7, 0, 8, 9, -4, 4, 0, 0, -6, -17, 3, -2, -4, -1, -8, -25,
+    -1, 7, 6, -14, -1, 11, 2, -25, 13, -12, 8, -9, -2, 12, 12, -6,
+    8, -7, -4, -10, -22, -1, -1, 7, -7, 4, -16, -1, 3, -11, -1, 0,
+    0, 2, -7, -4, -1, -10, 12, 4, -1, 2, -1, -10, 3, 8, 3, 4,
+    -12, 3, -8, -15, -1, -11, 4, 0, 6, -7, 5, 3, -4, 0, -10, -6,
+    11, -1, 3, -3, 2, -28, -3, -11, 7, 11, 0, -4, 5, -5, -13, -9,
+    -18, -9, 6, -9, -15, -12, -13, -2, 0, 7, 11, -6, -3, -10, -13, 0,
+    18, -24, 12, -12, 15, -2, -9, -11, 1, 7, -6, 4, -4, -4, 4, -7,
+    -9, 9, -7, -17, 0, 3, -8, 0, 2, 3, 3, 3, 3, 18, 5,
+  },
+  {
+    -1, -1, -2, -5, 0, -1, 1, -4, -1, -3, 0, 2, 0, -1, 1, -5,
+    -6, -2, -3, -4, 3, -1, 8, -4, -2, 0, -1, -2, 1, 2, 0, -11,
+    -10, -8, -1, 3, 1, 8, 1, -9, -3, 2, 2, -1, -6, 7, -2, -3,
+    -3, -5, 9, -1, -2, 5, 7, -2, 0, 3, 6, -6, 7, 0, 3, -13,
+    4, -4, -7, -3, -5, 3, -2, -1, 0, -6, 1, 3, 12, 2, -7, -10,
+    -13, -7, 3, -5, 3, -4, 2, 7, -13, -2, 1, -5, -3, 15, 7, -2,
+    -11, -6, -7, 8, 0, 3, -7, -4, -1, -2, 2, 2, -10, -5, 1, -3,
+    0, -7, -7, 3, -11, -2, -7, -7, 3, -5, -5, -9, -2, 4, 9, -23,
+    16, -4, -1, -8, -6, 4, -9, -18, -12, -3, 1, 1, 3, 4, 9, 1,
+    -4, 8, -14, -21, -7, 4, 0, -12, 3, -15, 2, -1, 3, -8, 3, -1,
+    1, 8, -7, -14, -6, -6, 1, 6, 6, 2, 4, 1, 2, 1, -1, -2,
+    34, 4, 0, -13, -2, -6, 3, -1, -6, -24, 5, -5, 8, -6, 11, -2,
+    23, -7, -2, -15, 9, 8, -5, 3, -6, -9, -4, -7, -2, -14, -5, 4,
+    -11, 0, -4, 5, 13, -17, 11, 5, -4, -9, 2, -2, -3, -1, -4, 1,
+    -4, -8, -3, -15, 5, -1, 4, 6, 1, -5, -13, 3, -5, 13, -3, -22,
+    1, -8, -5, -14, 1, -1, 7, 23, -2, 5, -6, 1, -1, 8, -1,
+  },
+  {
+    -6, 1, 0, 0, -5, -1, -2, -10, -2, -6, -3, -3, -4, -3, -1, -10,
+    -5, 4, -3, -2, -7, 2, 0, 3, -2, 2, -1, 1, 1, -1, -3, -16,
+    7, 0, 4, -11, -8, 8, -5, -1, 3, -10, -1, 2, 3, -5, 1, -12,
+    -11, -1, 1, -5, 1, -2, 5, -8, -2, -5, -12, 1, -1, 1, 0, -32,
+    2, 2, 12, -2, 5, -6, -4, 7, 5, -4, 3, -5, 20, -7, -3, -3,
+    -4, -7, -3, 4, -3, 3, 4, -2, 12, -4, -5, 1, 3, 1, -2, 1,
+    3, 6, 5, -5, 2, -17, 6, -5, 2, -7, -2, -4, 3, -7, 0, 3,
+    6, -2, -2, -2, -2, -8, -5, -1, -3, -11, 0, 3, 9, -9, 0, -31,
+    -7, 9, 7, -10, -6, 1, 12, 2, 3, -6, 1, -11, -3, -4, 10, -1,
+    22, 3, 10, -21, -6, 10, 11, 9, -6, -7, -6, 7, -13, -14, 2, 5,
+    -8, -7, 12, 2, 5, -2, 6, -19, 8, -2, -11, -12, 9, 2, -4, 12,
+    12, -6, -16, -14, -5, -5, 4, -14, -5, 0, -4, -3, -5, 1, -17, -4,
+    -6, 4, 18, -12, 10, 15, -4, -21, -2, 9, 8, -1, -4, 1, -2, -4,
+    1, -4, 5, -3, 2, 6, 11, 9, -11, 1, -1, -8, 1, -5, 1, 1,
+    -20, 9, 9, -11, -3, -1, -7, -4, 3, -6, -6, 7, 13, 1, 3, -3,
+    4, 2, -2, -3, -3, 13, 4, 1, 4, -7, 3, -3, -4, -2, 9,
+  },
+  {
+    -2, -2, 0, -5, -1, 3, 0, -7, -2, -1, 1, 2, -2, -1, -1, -10,
+    -3, 2, -3, 3, 0, 4, -2, -2, 3, 7, 0, -2, 4, 4, -6, -20,
+    3, -5, -4, -8, -7, 4, -4, -7, -3, 6, 0, -2, -7, -10, 1, -4,
+    -3, -2, 5, -4, -7, 4, -1, 1, -4, -9, 5, -2, -4, -7, 10, -21,
+    5, -8, 1, -18, -6, -3, 6, -11, 2, -4, -8, 1, -1, 5, -1, -2,
+    -4, 1, -8, -1, 3, -8, 9, -3, 5, -10, -6, -12, -5, 0, -6, -8,
+    -7, -12, 1, -1, 4, 1, 16, 0, 2, -8, 6, 1, -2, 1, -1, 0,
+    8, -9, 6, -3, -5, 5, 20, 0, 5, 1, 7, 12, 3, -6, 3, -16,
+    1, 1, 9, -13, 1, 3, 10, -15, -4, -4, 12, -3, 14, -3, -12, -17,
+    -15, -4, -1, -3, -3, -3, -4, 5, -9, 7, 8, 12, 3, -2, 10, -1,
+    4, -6, -4, -9, -20, -1, 6, -9, 10, 13, -2, -24, -9, 6, 10, -15,
+    -1, 8, 5, -8, 6, -5, -1, 0, 5, 0, -1, -1, 7, 10, -2, -4,
+    0, 2, 9, -6, -10, -5, 10, -3, -3, 9, -2, -9, -7, 4, -12, -12,
+    1, 12, 0, 7, 8, 5, 11, -9, 11, -5, -2, 6, 2, -3, 5, -12,
+    -23, -13, -3, -12, -1, -3, -4, -10, 2, 5, -7, 3, -3, 5, 9, -7,
+    -16, 6, -6, -4, 1, -1, 1, 9, -20, -4, 4, 1, 0, 1, -9,
+  },
+  {
+    -6, -6, -2, -12, -8, 2, 2, -16, -2, -12, -1, -2, 5, 2, 1, -28,
+    1, -8, -4, -13, 0, -2, 3, -1, -2, 2, -7, 1, 6, -1, -6, -34,
+    -3, -7, -5, 15, -6, 7, 0, -13, -8, -3, 2, 3, 2, 4, 4, -3,
+    -3, 2, -3, 1, -3, 23, -2, -3, 0, 4, 4, 6, -10, -5, -1, 5,
+    -11, 0, -1, -4, 5, -13, 7, 10, 22, 0, 4, -8, 3, -2, -3, -35,
+    -16, -9, -5, -4, 3, -1, 6, 0, 0, -9, 0, 10, -3, -3, 0, -4,
+    8, -8, -5, 0, 9, -3, 7, 10, 5, -3, -4, -3, -24, 8, -5, 0,
+    8, -7, -2, 0, 10, 5, -13, -5, 9, -6, -2, -11, -4, -7, 4, -43,
+    -52, -13, -13, -14, -7, 0, 0, 7, -26, -3, -9, 16, 4, 3, 0, -11,
+    0, 3, -19, -6, 15, 10, -13, -5, 0, -23, 28, -7, 4, -11, 2, -45,
+    -3, -16, -7, -13, 2, -6, 5, 0, 9, 0, -11, -2, 1, 3, -11, -1,
+    0, -3, -1, -15, 12, 2, 7, 0, -3, 1, -1, 4, 0, -18, 5, -12,
+    2, 4, -1, -13, 5, 1, 8, -4, 9, 0, 3, -1, 1, 6, -1, -3,
+    27, -3, 3, -6, 1, 4, 2, 0, -3, -44, 0, -5, 25, 5, 8, -9,
+    12, -16, 3, -16, 3, 2, 8, -17, -3, 1, 0, 1, -10, -3, -1, -13,
+    -5, -2, -18, -18, 3, 1, 9, -20, -7, -19, 3, 5, 1, 1, 6,
+  },
+  {
+    -2, -4, -1, -5, -2, 0, -1, -16, 5, -3, 0, -2, -2, 3, -1, -16,
+    -2, -2, -7, -4, -5, 2, -4, -7, -2, 1, 2, -3, -3, 4, 1, -28,
+    3, -1, 1, -6, -1, 9, -1, -6, -7, -1, -4, -2, 1, -3, -1, -6,
+    -6, 11, 1, -5, 1, 5, 8, 1, 0, 3, -2, -2, -3, 0, -4, -23,
+    -7, 3, 20, -9, 10, -6, -14, 0, -7, -8, 3, 3, 23, -1, -2, -9,
+    -6, 3, 6, -24, 6, -6, -1, 0, -2, 5, 0, 2, 3, -2, -1, -10,
+    -8, -6, -4, -1, 7, -5, 2, 2, 0, -5, -4, 4, -5, 2, 5, -3,
+    3, -8, 10, 12, -10, 6, 9, 7, 8, -6, -7, 0, 7, 3, 3, -41,
+    -16, -5, 7, -14, 2, 3, 16, 0, -4, 0, -4, 2, -11, -2, 8, 1,
+    -13, 4, 0, 5, -14, 4, -2, -10, -1, -3, 19, 7, 12, -2, 1, 8,
+    4, -8, 13, -3, -15, -9, 1, 5, -2, 3, -12, -2, 5, -1, -5, -3,
+    -4, 2, -6, -7, 1, 3, -4, 7, -13, 2, 7, -12, 2, -4, -3, 11,
+    0, -23, 3, -9, 6, 9, -6, 2, 6, -9, -19, -10, 3, 10, -10, -18,
+    -8, 0, -11, -9, 2, -1, 6, 15, 1, 2, -4, -11, -9, -1, 2, 7,
+    4, -21, -2, -8, -1, 4, -11, 4, 6, 18, -4, -4, -7, 8, 13, -2,
+    -6, 11, -11, 3, -6, 0, 0, 6, -3, 1, 3, 4, 8, 9, -2,
+  },
+  {
+    -2, -3, -1, -2, -1, 1, -2, -5, -2, -2, 0, -5, 0, 2, 0, -10,
+    1, 7, -1, 0, -4, 1, 3, -4, 2, 4, 7, -1, -6, -4, 2, -12,
+    -7, -2, 6, -2, -3, -4, -6, -6, -4, -3, 1, 14, 0, 0, -9, -5,
+    -5, 1, 1, -3, 1, 0, 2, 0, -9, 1, 1, -6, -4, 1, 0, -16,
+    4, -2, -7, -1, 0, -6, -8, -5, -9, -5, -6, 8, 1, 4, 7, -13,
+    -2, -19, -1, -12, 6, -7, 13, 5, 2, -10, -6, 3, 8, 11, -3, 1,
+    3, -5, 12, -3, 9, 0, -8, 3, -1, -9, 3, 7, -4, -11, -16, 0,
+    3, -5, -3, 0, -10, -1, 1, 7, -6, -3, -3, 2, -1, -5, 6, -25,
+    -3, -1, -5, -13, -13, -12, 1, -24, 3, 10, -2, -2, 10, 4, -2, -8,
+    1, -2, -4, -18, -3, 8, 3, 2, -3, -9, 5, -3, -10, 11, 6, 0,
+    -5, -3, 6, -4, -7, 1, -3, -10, -1, -13, -6, -3, 3, 2, 14, 2,
+    4, -3, 32, -9, -6, 1, -1, -21, -3, 10, -9, -14, -11, -6, 15, 19,
+    -19, -14, 4, -16, -5, 2, 2, -7, 2, -3, 5, -12, -2, 1, 5, -4,
+    1, 4, 6, -6, -4, -8, -9, 1, -5, 1, 8, -9, 1, 11, 3, -3,
+    -7, -11, -2, -3, 6, 1, 3, -5, -8, 5, 2, 20, -4, -2, 6, -1,
+    8, 0, 9, 0, 1, -2, -4, -2, -12, 12, 7, 0, 3, 2, -10,
+  },
+  {
+    -1, 0, 0, -4, 1, -1, -2, -5, -1, 1, 0, -6, -3, -1, 1, -6,
+    0, -2, -4, -1, 5, 0, -5, -3, 3, -4, -4, -2, 4, 1, 0, -18,
+    4, 0, -1, 3, 3, 2, -8, -1, -3, 0, -9, 4, -6, 2, -1, 1,
+    4, -3, 0, -4, -14, 1, 0, -7, -5, -1, 8, 3, 6, 1, 0, -23,
+    3, -9, -10, -3, -3, 1, 5, -8, -3, -2, 2, 4, 4, 3, 5, -4,
+    3, -3, 1, 5, -4, 16, 4, -2, -4, -4, -8, -3, -4, -6, -1, -14,
+    3, -9, 2, -3, -4, -11, -6, -9, -8, 0, -1, -1, 3, -12, -2, -11,
+    7, -1, 4, 9, -2, -11, 13, -3, 0, -1, -4, -4, -5, -1, 0, -16,
+    2, 1, 0, -6, -25, -18, -5, -4, 3, 7, 1, -5, 5, -3, 5, 6,
+    1, -23, 6, -6, 10, 17, 10, 3, 6, 8, -5, 5, -11, 18, -13, -19,
+    -2, -4, -5, -11, 3, -2, -13, -15, 3, 1, -2, 7, -13, -7, -6, 3,
+    9, -7, -3, -6, -7, 6, 3, 3, -2, -8, -3, -6, -3, -4, 1, 15,
+    1, 7, 2, -14, 6, 3, -11, -6, 3, 6, 7, 11, -12, 0, -3, 6,
+    2, 0, 11, -10, 8, -8, -3, 8, 4, 1, -6, 7, 18, 3, -12, -20,
+    8, -10, 5, -11, 14, 1, 4, -3, 2, 5, 8, -5, -22, 11, -9, -12,
+    -2, -4, -10, -17, 11, -7, 6, -19, -9, -3, 2, 1, 9, 12, -2,
+  },
+  {
+    0, -3, -3, -3, 1, 1, 1, -2, -1, 0, -3, -5, -2, -3, -5, -4,
+    -2, -1, -1, 1, 3, 9, -3, -7, -1, 6, 2, -1, -2, -4, 0, -9,
+    -8, 8, -6, -1, -4, 1, 3, -6, -4, -2, 5, -1, -4, -4, 4, -16,
+    -2, 1, -8, -2, 3, 3, -4, -2, 0, -3, -1, 6, -6, -3, -2, -20,
+    -7, -4, -5, -6, -7, -10, 1, -5, 1, -9, -5, -4, -3, 12, -6, -5,
+    1, 0, -2, -2, -5, -5, 0, -15, 10, -3, 3, -16, 3, 5, -3, -28,
+    -2, -7, 1, -4, -2, -11, -4, -8, -3, -6, -13, -10, -8, -9, 0, 8,
+    -3, -11, 7, -3, 3, -4, -5, 0, -13, -6, 1, -10, 10, -1, -2, -23,
+    -1, 0, -5, -11, 2, 6, 15, -8, 0, -25, -20, 4, 1, -1, -3, -1,
+    -8, 0, -1, -16, 1, 11, 6, -4, -12, -1, 3, 8, -5, 2, -18, -7,
+    7, -8, 7, -8, -1, 5, 9, -15, -2, -7, 0, 4, -3, -2, -6, -2,
+    -12, -2, 3, -1, -9, -19, -3, 5, -18, 3, 15, 11, 3, -4, 8, -21,
+    -11, -3, -4, 0, -4, -5, 9, -8, -5, 10, 2, 2, -6, -3, -1, -18,
+    -4, -12, 1, -6, 3, 32, -6, -9, -3, 16, 2, 20, -3, 5, 8, -10,
+    16, 2, 8, -9, -8, 9, -2, -1, 2, 9, 4, 2, 12, 14, 4, -13,
+    -4, 4, 15, -6, 1, 2, 9, 0, -4, 11, -4, -5, -4, -5, 10,
+  },
+  {
+    5, -4, 8, -5, 2, 1, 12, -3, 0, 0, -1, -9, -1, -5, 22, -8,
+    -10, -2, -1, 2, -4, 3, 1, 10, -3, 0, 5, 1, 0, -1, 28, -20,
+    -3, -9, -3, 3, -1, 5, -5, -10, 0, -5, -2, 8, -6, -3, 2, 2,
+    -16, 8, -6, -5, -4, 2, -2, -2, -17, -6, -4, -3, -3, -8, 37, -25,
+    2, 7, -15, -18, 5, -7, 3, 6, 4, -2, 11, -4, -12, 12, 0, -3,
+    -2, -5, -1, 9, -6, 11, 2, 0, 1, -13, -4, -17, -9, -9, 7, -12,
+    -6, -22, -14, 4, 7, 0, -1, -11, 0, -16, 2, -7, 4, 0, -7, -8,
+    -2, -27, 7, -4, 6, -1, 0, 1, 4, 1, 0, 8, 0, -6, 56, -34,
+    9, -4, -6, -2, 14, 4, 18, 25, 5, -5, 3, -3, -3, -7, -10, 3,
+    -6, -1, -9, -18, 8, -6, 1, -6, 4, -1, -1, -5, 24, -4, 0, -15,
+    7, -4, 3, -5, -1, -8, -3, -6, -2, -6, -4, 3, 1, 1, -2, -1,
+    6, -25, 1, -24, -16, -2, -3, -1, -2, -5, 10, 0, 9, 1, 2, 4,
+    0, -7, 3, -37, -9, -6, -12, -14, 8, 3, 13, -6, -6, -12, 14, -18,
+    0, -1, -2, 3, -5, 9, 1, 1, 4, -6, -10, -16, 2, -16, 12, -10,
+    -1, 5, -1, 10, 13, 6, -6, 5, 0, -1, 11, 4, 11, 13, -2, -2,
+    10, -18, -8, -14, -13, -4, -3, -5, -28, -11, 12, -18, 6, 2, 58,
+  },
+  {
+    -28, -28, -12, -53, 1, 26, -17, -65, -21, 0, 5, -36, 15, -14, -19, -53,
+    -71, -65, -19, -11, -57, 1, -21, -13, -7, -50, 53, -8, 29, -40, 12, -72,
+    48, -19, -27, -59, 4, 14, -13, -33, -67, -25, -16, 5, -24, -18, 9, -11,
+    -21, -20, -29, 8, 10, -12, 19, -65, -42, -6, 40, -61, 28, -9, 12, -93,
+    -42, -39, -19, -47, 22, -47, -20, -94, -4, -51, 5, -19, -70, 30, 17, -15,
+    -14, -48, -3, 10, 34, -37, 56, 8, 7, -67, -27, 35, 0, -1, -3, -21,
+    72, -50, 29, -20, 35, 30, 18, -48, 67, -43, 3, -7, 3, -55, 13, -43,
+    -10, -52, 4, -32, -51, 10, 25, -64, -54, 22, -52, -6, 17, -37, 42, -8,
+    -17, -35, -18, -41, -42, -31, 2, -30, -2, -51, 42, -47, 0, -20, 0, -73,
+    34, 60, 56, 51, 0, -42, -13, 5, -3, -64, -29, -24, 77, -44, -40, -43,
+    -2, -30, -9, -61, -33, -18, 14, -50, -22, -35, -57, -36, -9, 0, 18, -19,
+    -46, -21, -66, -64, -12, -36, -25, -6, -27, 5, -4, -7, -5, -6, -1, -41,
+    -87, 0, 0, -101, 3, -16, -24, -72, 20, 20, 55, -38, 38, -20, 0, -43,
+    5, -2, 3, 3, -20, 24, 34, -58, -14, -16, 13, 8, 5, 23, -24, -123,
+    -18, -52, -42, 50, -26, -18, 23, -10, 0, -31, 20, 4, 67, 52, 64, -114,
+    29, -54, 0, 20, -18, 72, 20, 11, -36, -42, 58, -6, -34, 6, 55,
+  },
+};
+
+#endif // MIXED_PRIORS_H
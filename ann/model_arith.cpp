@@ -4,8 +4,8 @@
  * Demonstrates:
  *   1) Loading a TorchScript LSTM model for bit prediction.
  *   2) A function to get P(bit=1) given a prefix of bits.
- *   3) Integer-based arithmetic coding (with partial renormalization)
- *      to compress and decompress up to 1024 bits (losslessly).
+ *   3) Binary range coding (arithcoder/RangeCoder.hpp) to compress
+ *      and decompress up to 1024 bits (losslessly).
  *
  * Usage:
  *   g++ model_arith_1024.cpp -I/path/to/libtorch/include \
@@ -22,53 +22,21 @@
 #include <cmath>
 #include <cstdint>
 #include <iostream>
+#include <map>
 #include <string>
 #include <torch/script.h> // For torch::jit::script::Module
 #include <torch/torch.h>
 #include <vector>
 
-#include "arithcoder/ArithmeticCoder.hpp"
+#include "arithcoder/RangeCoder.hpp"
 #include "model_arith.h"
 #include "td/utils/base64.h"
 
 const int CONTEXT_SIZE = 192;
 #define PAD
 
-/**************************************************************
- * 1) Utility: Convert raw bytes => bits, and bits => bytes
- **************************************************************/
-std::vector<int> stringToBits(const std::string &inputBytes) {
-  std::vector<int> bits;
-  bits.reserve(inputBytes.size() * 8);
-  for (unsigned char c : inputBytes) {
-    // Extract bits from MSB to LSB
-    for (int i = 7; i >= 0; --i) {
-      int bit = (c >> i) & 1;
-      bits.push_back(bit);
-    }
-  }
-  return bits;
-}
-
-std::string bitsToString(const std::vector<int> &bits) {
-  // Group bits into bytes
-  const size_t nBytes = bits.size() / 8;
-  std::string output;
-  output.resize(nBytes, '\0');
-
-  size_t idx = 0;
-  for (size_t b = 0; b < nBytes; ++b) {
-    unsigned char byteVal = 0;
-    for (int i = 0; i < 8; ++i) {
-      byteVal = (byteVal << 1) | (bits[idx++] & 1);
-    }
-    output[b] = static_cast<char>(byteVal);
-  }
-  return output;
-}
-
 /*********************************************************************
- * 2) nextBitProbability:
+ * 1) nextBitProbability:
  *    Given a prefix of bits, query the LSTM to get P(next_bit=1).
  *
  *    - We build a tensor [1, prefix_len, 1].
@@ -102,81 +70,103 @@ float nextBitProbability(torch::jit::script::Module &model,
   return p;
 }
 
-std::string compressBits(torch::jit::script::Module &model,
-                         const std::vector<int> &bits) {
-  std::string out;
-  std::stringstream sout;
-  BitOutputStream bout(sout);
+/*********************************************************************
+ * 2) StatefulBitPredictor:
+ *    The same prediction, one LSTM time step per bit.
+ *
+ *    - Pulls the LSTM and FC weights out of the TorchScript module.
+ *    - update(bit) advances every layer by one lstm_cell step.
+ *    - The context is no longer cut at CONTEXT_SIZE bits, the state
+ *      carries everything seen so far.
+ *********************************************************************/
+StatefulBitPredictor::StatefulBitPredictor(
+    torch::jit::script::Module &model) {
+  std::map<std::string, torch::Tensor> params;
+  for (const auto &param : model.named_parameters()) {
+    params[param.name] = param.value.detach();
+  }
 
-  try {
-    BinaryFrequencyTable freqs;
-    ArithmeticEncoder enc(32, bout);
+  for (int k = 0; params.count("lstm.weight_ih_l" + std::to_string(k)); ++k) {
+    std::string suffix = "_l" + std::to_string(k);
+    Layer layer;
+    layer.w_ih = params["lstm.weight_ih" + suffix];
+    layer.w_hh = params["lstm.weight_hh" + suffix];
+    layer.b_ih = params["lstm.bias_ih" + suffix];
+    layer.b_hh = params["lstm.bias_hh" + suffix];
+    int64_t hidden = layer.w_hh.size(1);
+    layer.h = torch::zeros({1, hidden}, torch::kFloat32);
+    layer.c = torch::zeros({1, hidden}, torch::kFloat32);
+    layers.push_back(layer);
+  }
+  if (layers.empty() || !params.count("fc.weight")) {
+    std::cerr << "Model is not a BitLSTM (lstm + fc)" << std::endl;
+    assert(false);
+  }
+  fc_weight = params["fc.weight"];
+  fc_bias = params["fc.bias"];
+}
 
-    std::deque<int> prefix;
-#ifdef PAD
-    for (int i = 0; i < CONTEXT_SIZE; i++) {
-      prefix.push_back(0);
-    }
-#endif
+void StatefulBitPredictor::update(int bit) {
+  torch::NoGradGuard no_grad;
+  torch::Tensor x = torch::full({1, 1}, (float)bit, torch::kFloat32);
+  for (auto &layer : layers) {
+    auto state = torch::lstm_cell(x, {layer.h, layer.c}, layer.w_ih,
+                                  layer.w_hh, layer.b_ih, layer.b_hh);
+    layer.h = std::get<0>(state);
+    layer.c = std::get<1>(state);
+    x = layer.h;
+  }
 
-    for (auto symbol : bits) {
-      float p = nextBitProbability(model, prefix);
-      freqs.set(1 - p);
-      enc.write(freqs, static_cast<uint32_t>(symbol));
-      prefix.push_back(symbol);
-      if (prefix.size() > CONTEXT_SIZE) {
-        prefix.pop_front();
-      }
-    }
+  float logit = torch::addmm(fc_bias, x, fc_weight.t()).item<float>();
+  p = 1.0f / (1.0f + std::exp(-logit));
+}
 
-    enc.finish(); // Flush remaining code bits
-    bout.finish();
+std::string compressBytes(torch::jit::script::Module &model,
+                          const std::string &data) {
+  std::string out(RangeEncoder::maxSize(data.size() * 8), '\0');
+  RangeEncoder enc((unsigned char *)&out[0], out.size());
 
-    out = sout.str();
+  StatefulBitPredictor predictor(model);
+#ifdef PAD
+  for (int i = 0; i < CONTEXT_SIZE; i++) {
+    predictor.update(0);
+  }
+#endif
 
-  } catch (const char *msg) {
-    std::cerr << msg << std::endl;
-    assert(false);
+  for (unsigned char c : data) {
+    for (int i = 7; i >= 0; --i) {
+      int symbol = (c >> i) & 1;
+      float p = predictor.probability();
+      enc.encode(rangeProbability(1 - p), symbol);
+      predictor.update(symbol);
+    }
   }
 
+  out.resize(enc.finish());
   return out;
 }
 
-std::vector<int> decompressBits(torch::jit::script::Module &model,
-                                const std::string &data, int size) {
-  std::vector<int> out;
-  std::stringstream sin(data);
-  BitInputStream bin(sin);
+std::string decompressBytes(torch::jit::script::Module &model,
+                            const std::string &data, size_t size) {
+  std::string out(size, '\0');
+  RangeDecoder dec((const unsigned char *)data.data(), data.size());
 
-  try {
-    BinaryFrequencyTable freqs;
-    ArithmeticDecoder dec(32, bin);
-
-    std::deque<int> prefix;
+  StatefulBitPredictor predictor(model);
 #ifdef PAD
-    for (int i = 0; i < CONTEXT_SIZE; i++) {
-      prefix.push_back(0);
-    }
+  for (int i = 0; i < CONTEXT_SIZE; i++) {
+    predictor.update(0);
+  }
 #endif
 
-    while (true) {
-      float p = nextBitProbability(model, prefix);
-      freqs.set(1 - p);
-
-      uint32_t symbol = dec.read(freqs);
-      out.push_back(symbol);
-      if (out.size() == size)
-        break;
-
-      prefix.push_back(symbol);
-      if (prefix.size() > CONTEXT_SIZE) {
-        prefix.pop_front();
-      }
+  for (auto &c : out) {
+    unsigned char byte = 0;
+    for (int i = 0; i < 8; i++) {
+      float p = predictor.probability();
+      int symbol = dec.decode(rangeProbability(1 - p));
+      byte = (unsigned char)(byte << 1 | symbol);
+      predictor.update(symbol);
     }
-
-  } catch (const char *msg) {
-    std::cerr << msg << std::endl;
-    assert(false);
+    c = (char)byte;
   }
 
   return out;
@@ -221,18 +211,7 @@ int main(int argc, char **argv) {
       continue;
     std::string data = td::base64_decode(base64_data).move_as_ok();
 
-    // auto bits = stringToBits(data);
-    // auto res_bits =
-    //     decompressBits(model, compressBits(model, bits), bits.size());
-    // for (int i = 0; i < bits.size(); i++)
-    //   if (bits[i] != res_bits[i]) {
-    //     std::cerr << "KIR KHAR" << std::endl;
-    //     return 1;
-    //   }
-    // std::cerr << "OK\n";
-
-    std::string res =
-        td::base64_encode(compressBits(model, stringToBits(data)));
+    std::string res = td::base64_encode(compressBytes(model, data));
     // std::cout << base64_data << " -> " << res << std::endl;
     std::cout << "number: " << (++cnt) << " ";
     std::cout << base64_data.size() << " -> " << res.size() << std::endl;
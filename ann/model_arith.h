@@ -8,13 +8,34 @@
 #include <string>
 #include <vector>
 
-std::vector<int> stringToBits(const std::string &inputBytes);
-std::string bitsToString(const std::vector<int> &bits);
 float nextBitProbability(torch::jit::script::Module &model,
                          const std::deque<int> &prefix);
-std::string compressBits(torch::jit::script::Module &model,
-                         const std::vector<int> &bits);
-std::vector<int> decompressBits(torch::jit::script::Module &model,
-                                const std::string &data, int size);
+
+// Runs the LSTM of a BitLSTM model one time step per bit, carrying (h, c)
+// across bits instead of re-running the model over the whole prefix.
+class StatefulBitPredictor {
+public:
+  explicit StatefulBitPredictor(torch::jit::script::Module &model);
+
+  // P(next_bit=1) given every bit passed to update() so far.
+  float probability() const { return p; }
+  void update(int bit);
+
+private:
+  struct Layer {
+    torch::Tensor w_ih, w_hh, b_ih, b_hh;
+    torch::Tensor h, c;
+  };
+  std::vector<Layer> layers;
+  torch::Tensor fc_weight, fc_bias;
+  float p = 0.5f;
+};
+
+// Codes the bits of each byte, MSB first.
+std::string compressBytes(torch::jit::script::Module &model,
+                          const std::string &data);
+// size is the number of bytes compressed.
+std::string decompressBytes(torch::jit::script::Module &model,
+                            const std::string &data, size_t size);
 torch::jit::script::Module loadModel(const std::string &modelPath);
 #endif // MODEL_ARITH_H
@@ -0,0 +1,223 @@
+/**************************************************************
+ * model_arith_batched.cpp
+ *
+ * model_arith_native.cpp for many blocks at once:
+ *   1) Loading the fixed-point weights of export_quantized.py.
+ *   2) One range coder per block, B blocks stepped in
+ *      lockstep by a single batched model, so the per-bit GEMVs
+ *      become GEMMs.
+ *   3) Every block checked by decoding it again, batched too,
+ *      and the bits/second for each batch size.
+ *
+ * Each block codes to exactly what model_arith_native writes for
+ * it, whatever B is.
+ *
+ * Usage:
+ *   ./model_arith_batched best_bit_lstm_model128.q.bin 8 < blocks.txt
+ *   ./model_arith_batched best_bit_lstm_model128.q.bin < blocks.txt
+ * The second form sweeps B = 1, 2, 4, ..., 32.
+ **************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arithcoder/RangeCoder.hpp"
+#include "quantized_model.h"
+#include "td/utils/base64.h"
+
+const int CONTEXT_SIZE = 192;
+#define PAD
+
+// Bit k of bytes, MSB first: the order the bytes are coded in.
+int bitAt(const std::string &bytes, size_t k) {
+  return ((unsigned char)bytes[k >> 3] >> (7 - (k & 7))) & 1;
+}
+
+// Steps the model over every block, model.sessions() blocks at a time.
+// A session whose block is done starts the next one right away, after
+// its own warm-up, so no session idles while blocks remain.
+//   start(i):      block i gets a session
+//   code(i, t, f): codes bit t of block i with P(0) * 2^30 = f, returns it
+//   finish(i):     block i is done
+template <class Start, class Code, class Finish>
+void lockstep(BatchedBitModel &model,
+              const std::vector<std::string> &blocks, Start start,
+              Code code, Finish finish) {
+#ifdef PAD
+  const long warm_up = CONTEXT_SIZE;
+#else
+  const long warm_up = 0;
+#endif
+  struct Slot {
+    long block = -1; // -1: idle
+    long t = 0;      // negative during the warm-up
+  };
+  std::vector<Slot> slots(model.sessions());
+  std::vector<int> bits(model.sessions(), 0);
+  size_t next = 0;
+  model.reset();
+  while (true) {
+    bool busy = false;
+    for (int s = 0; s < model.sessions(); s++) {
+      Slot &slot = slots[s];
+      if (slot.block >= 0 && slot.t == (long)blocks[slot.block].size() * 8) {
+        finish(slot.block);
+        slot.block = -1;
+      }
+      if (slot.block < 0 && next < blocks.size()) {
+        slot.block = next++;
+        slot.t = -warm_up;
+        model.reset(s);
+        start(slot.block);
+      }
+      if (slot.block < 0) {
+        bits[s] = 0;
+        continue;
+      }
+      busy = true;
+      if (slot.t < 0) {
+        bits[s] = 0;
+      } else {
+        bits[s] = code(slot.block, slot.t, model.zeroFrequency(s));
+      }
+      slot.t++;
+    }
+    if (!busy) {
+      break;
+    }
+    model.update(bits.data());
+  }
+}
+
+std::vector<std::string>
+compressAll(BatchedBitModel &model, const std::vector<std::string> &blocks) {
+  std::vector<std::string> out(blocks.size());
+  std::vector<std::unique_ptr<RangeEncoder>> enc(blocks.size());
+
+  lockstep(
+      model, blocks,
+      [&](size_t i) {
+        out[i].assign(RangeEncoder::maxSize(blocks[i].size() * 8), '\0');
+        enc[i].reset(new RangeEncoder((unsigned char *)&out[i][0],
+                                      out[i].size()));
+      },
+      [&](size_t i, size_t t, uint32_t zero_frequency) {
+        int symbol = bitAt(blocks[i], t);
+        enc[i]->encode(rangeProbability(zero_frequency), symbol);
+        return symbol;
+      },
+      [&](size_t i) {
+        out[i].resize(enc[i]->finish());
+        enc[i].reset();
+      });
+  return out;
+}
+
+// blocks only gives the size of each block
+std::vector<std::string>
+decompressAll(BatchedBitModel &model, const std::vector<std::string> &data,
+              const std::vector<std::string> &blocks) {
+  std::vector<std::string> out(blocks.size());
+  std::vector<std::unique_ptr<RangeDecoder>> dec(blocks.size());
+
+  lockstep(
+      model, blocks,
+      [&](size_t i) {
+        out[i].assign(blocks[i].size(), '\0');
+        dec[i].reset(new RangeDecoder((const unsigned char *)data[i].data(),
+                                      data[i].size()));
+      },
+      [&](size_t i, size_t t, uint32_t zero_frequency) {
+        int symbol = dec[i]->decode(rangeProbability(zero_frequency));
+        out[i][t >> 3] |= (char)(symbol << (7 - (t & 7)));
+        return symbol;
+      },
+      [&](size_t i) { dec[i].reset(); });
+  return out;
+}
+
+// Codes every block with the given number of sessions. Returns false if
+// a block does not decode back.
+bool codeAll(const std::string &weights, int batch,
+             const std::vector<std::string> &blocks,
+             std::vector<std::string> &compressed, double &seconds) {
+  auto model = BatchedBitModel::load(weights, batch);
+  if (!model) {
+    return false;
+  }
+  auto start_time = std::chrono::high_resolution_clock::now();
+  compressed = compressAll(*model, blocks);
+  seconds = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - start_time)
+                .count();
+
+  auto back = decompressAll(*model, compressed, blocks);
+  for (size_t i = 0; i < blocks.size(); i++) {
+    if (back[i] != blocks[i]) {
+      std::cerr << "Block " << (i + 1) << " does not decode back" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <weights_path> [batch]\n\n"
+              << "Example:\n"
+              << "  " << argv[0] << " best_bit_lstm_model128.q.bin 8\n";
+    return 1;
+  }
+
+  std::vector<int> batches = {1, 2, 4, 8, 16, 32};
+  if (argc > 2) {
+    batches = {std::atoi(argv[2])};
+  }
+
+  std::string base64_data;
+  std::vector<std::string> blocks;
+  long long x_int = 0, total_bits = 0;
+  while (std::getline(std::cin, base64_data)) {
+    if (base64_data.empty())
+      continue;
+    std::string data = td::base64_decode(base64_data).move_as_ok();
+    x_int += base64_data.size();
+    total_bits += data.size() * 8;
+    blocks.push_back(std::move(data));
+  }
+
+  std::vector<std::string> reference;
+  double base_seconds = 0;
+  for (int batch : batches) {
+    std::vector<std::string> compressed;
+    double seconds;
+    if (!codeAll(argv[1], batch, blocks, compressed, seconds)) {
+      return 1;
+    }
+    if (reference.empty()) {
+      reference = compressed;
+      base_seconds = seconds;
+      long long y_int = 0;
+      for (auto &c : compressed) {
+        y_int += td::base64_encode(c).size();
+      }
+      long double x = x_int, y = y_int;
+      std::cout << "Score: " << 2 * x / (x + y) << std::endl;
+      std::cout << "Reduction: " << y / x << std::endl;
+    } else if (compressed != reference) {
+      std::cerr << "Batch " << batch << " codes differently from batch "
+                << batches[0] << std::endl;
+      return 1;
+    }
+    std::cout << "batch " << batch << ": " << total_bits / seconds
+              << " bits/second, " << base_seconds / seconds << "x"
+              << std::endl;
+  }
+  return 0;
+}
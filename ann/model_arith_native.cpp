@@ -0,0 +1,139 @@
+/**************************************************************
+ * model_arith_native.cpp
+ *
+ * model_arith.cpp without libtorch:
+ *   1) Loading the flat weights written by export_weights.py, or
+ *      the fixed-point ones of export_quantized.py.
+ *   2) Native bit prediction (native_model.cpp, or the integer
+ *      only quantized_model.cpp), one step per bit, optionally
+ *      mixed with order-N and match models (mixed_model.cpp).
+ *   3) Range coding of the bits (arithcoder/RangeCoder.hpp),
+ *      checked by decoding every block again.
+ *
+ * Usage:
+ *   python export_weights.py --checkpoint models/best_bit_lstm_model128.pth \
+ *       --output best_bit_lstm_model128.bin
+ *   ./model_arith_native best_bit_lstm_model128.bin < blocks.txt
+ *
+ *   python export_quantized.py --checkpoint models/best_bit_lstm_model128.pth \
+ *       --output best_bit_lstm_model128.q.bin
+ *   ./model_arith_native best_bit_lstm_model128.q.bin < blocks.txt
+ *   ./model_arith_native best_bit_lstm_model128.q.bin --mix < blocks.txt
+ **************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "arithcoder/RangeCoder.hpp"
+#include "mixed_model.h"
+#include "native_model.h"
+#include "td/utils/base64.h"
+
+const int CONTEXT_SIZE = 192;
+#define PAD
+
+// Zero bits the model steps over before each block
+#ifdef PAD
+int warm_up = CONTEXT_SIZE;
+#else
+int warm_up = 0;
+#endif
+
+void warmUp(NativeBitModel &model) {
+  model.reset();
+  for (int i = 0; i < warm_up; i++) {
+    model.update(0);
+  }
+}
+
+// Codes the bits of each byte, MSB first.
+std::string compressBytes(NativeBitModel &model, const std::string &data) {
+  std::string out(RangeEncoder::maxSize(data.size() * 8), '\0');
+  RangeEncoder enc((unsigned char *)&out[0], out.size());
+
+  warmUp(model);
+  for (unsigned char c : data) {
+    for (int i = 7; i >= 0; --i) {
+      int symbol = (c >> i) & 1;
+      enc.encode(rangeProbability(model.zeroFrequency()), symbol);
+      model.update(symbol);
+    }
+  }
+
+  out.resize(enc.finish());
+  return out;
+}
+
+// size is the number of bytes compressed.
+std::string decompressBytes(NativeBitModel &model, const std::string &data,
+                            size_t size) {
+  std::string out(size, '\0');
+  RangeDecoder dec((const unsigned char *)data.data(), data.size());
+
+  warmUp(model);
+  for (auto &c : out) {
+    unsigned char byte = 0;
+    for (int i = 0; i < 8; i++) {
+      int symbol = dec.decode(rangeProbability(model.zeroFrequency()));
+      byte = (unsigned char)(byte << 1 | symbol);
+      model.update(symbol);
+    }
+    c = (char)byte;
+  }
+  return out;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <weights_path> [--mix]\n\n"
+              << "  --mix  mix the model with order-N and match models\n\n"
+              << "Example:\n"
+              << "  " << argv[0] << " best_bit_lstm_model128.bin\n";
+    return 1;
+  }
+
+  auto model = NativeBitModel::load(argv[1]);
+  if (!model) {
+    return 1;
+  }
+  if (argc > 2 && std::string(argv[2]) == "--mix") {
+    // only the wrapped model warms up, inside MixedBitModel::reset()
+    model.reset(new MixedBitModel(std::move(model), warm_up));
+    warm_up = 0;
+  }
+
+  std::string base64_data;
+  long long x_int = 0, y_int = 0;
+  auto start_time = std::chrono::high_resolution_clock::now();
+
+  int cnt = 0;
+  while (std::getline(std::cin, base64_data)) {
+    if (base64_data.empty())
+      continue;
+    std::string data = td::base64_decode(base64_data).move_as_ok();
+
+    std::string compressed = compressBytes(*model, data);
+    if (decompressBytes(*model, compressed, data.size()) != data) {
+      std::cerr << "Block " << (cnt + 1) << " does not decode back" << std::endl;
+      return 1;
+    }
+
+    std::string res = td::base64_encode(compressed);
+    std::cout << "number: " << (++cnt) << " ";
+    std::cout << base64_data.size() << " -> " << res.size() << std::endl;
+    x_int += base64_data.size();
+    y_int += res.size();
+  }
+
+  long double x = x_int, y = y_int;
+  std::cout << "Score: " << 2 * x / (x + y) << std::endl;
+  std::cout << "Reduction: " << y / x << std::endl;
+  std::cout << "Time in seconds: "
+            << std::chrono::duration<double>(
+                   std::chrono::high_resolution_clock::now() - start_time)
+                   .count()
+            << std::endl;
+  return 0;
+}
@@ -0,0 +1,321 @@
+/**************************************************************
+ * native_model.cpp
+ *
+ * Dependency-free inference for the bit models of lstm.py,
+ * lstm_fc.py and fc.py:
+ *   1) Loading the flat weights of export_weights.py.
+ *   2) GEMV kernels, AVX2 when the CPU has it, scalar otherwise.
+ *   3) BitLSTM, stepped one bit at a time, and BitFC over a window.
+ *
+ * Both kernels keep 8 partial sums, lane k of the row summing the
+ * columns j with j % 8 == k, and fold them in the same fixed order,
+ * so encoder and decoder get the same probabilities whichever kernel
+ * runs. Build without FMA contraction (-ffp-contract=off).
+ **************************************************************/
+
+#include "native_model.h"
+#include "quantized_model.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NATIVE_MODEL_X86
+#endif
+
+/**************************************************************
+ * 1) Weights
+ **************************************************************/
+void PaddedMatrix::resize(int r, int c) {
+  rows = r;
+  cols = c;
+  stride = (c + 7) / 8 * 8;
+  data.assign((size_t)rows * stride, 0.0f);
+}
+
+namespace {
+
+const uint32_t VERSION = 1;
+const uint32_t KIND_LSTM = 0;
+const uint32_t KIND_FC = 1;
+
+class WeightReader {
+public:
+  explicit WeightReader(const std::string &path)
+      : in(path, std::ios::binary) {}
+
+  bool ok() const { return (bool)in; }
+
+  uint32_t u32() {
+    unsigned char b[4] = {0, 0, 0, 0};
+    in.read((char *)b, 4);
+    return b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+  }
+
+  float f32() {
+    uint32_t bits = u32();
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  void matrix(PaddedMatrix &m, int rows, int cols) {
+    m.resize(rows, cols);
+    for (int r = 0; r < rows; r++) {
+      for (int c = 0; c < cols; c++) {
+        m.data[(size_t)r * m.stride + c] = f32();
+      }
+    }
+  }
+
+  void vector(std::vector<float> &v, int n) {
+    v.resize(n);
+    for (auto &x : v) {
+      x = f32();
+    }
+  }
+
+  bool atEnd() {
+    in.peek();
+    return in.eof();
+  }
+
+private:
+  std::ifstream in;
+};
+
+/**************************************************************
+ * 2) Kernels
+ **************************************************************/
+float foldLanes(const float *lane) {
+  return ((lane[0] + lane[1]) + (lane[2] + lane[3])) +
+         ((lane[4] + lane[5]) + (lane[6] + lane[7]));
+}
+
+void gemvScalar(const PaddedMatrix &w, const float *x, const float *b,
+                float *y) {
+  for (int r = 0; r < w.rows; r++) {
+    const float *row = &w.data[(size_t)r * w.stride];
+    float lane[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (int c = 0; c < w.stride; c += 8) {
+      for (int k = 0; k < 8; k++) {
+        float product = row[c + k] * x[c + k];
+        lane[k] = lane[k] + product;
+      }
+    }
+    y[r] = foldLanes(lane) + b[r];
+  }
+}
+
+#ifdef NATIVE_MODEL_X86
+__attribute__((target("avx2"))) void
+gemvAvx2(const PaddedMatrix &w, const float *x, const float *b, float *y) {
+  for (int r = 0; r < w.rows; r++) {
+    const float *row = &w.data[(size_t)r * w.stride];
+    __m256 acc = _mm256_setzero_ps();
+    for (int c = 0; c < w.stride; c += 8) {
+      __m256 product =
+          _mm256_mul_ps(_mm256_loadu_ps(row + c), _mm256_loadu_ps(x + c));
+      acc = _mm256_add_ps(acc, product);
+    }
+    float lane[8];
+    _mm256_storeu_ps(lane, acc);
+    y[r] = foldLanes(lane) + b[r];
+  }
+}
+
+bool hasAvx2() {
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+}
+#endif
+
+float sigmoid(float x) { return 1.0f / (1.0f + std::exp(-x)); }
+
+/**************************************************************
+ * 3) Models
+ **************************************************************/
+class NativeBitLstm final : public NativeBitModel {
+public:
+  bool read(WeightReader &in) {
+    int numLayers = (int)in.u32();
+    hidden = (int)in.u32();
+    if (!in.ok() || numLayers < 1 || numLayers > 16 || hidden < 1 ||
+        hidden > 4096) {
+      return false;
+    }
+    layers.resize(numLayers);
+    for (int k = 0; k < numLayers; k++) {
+      int inputs = k == 0 ? 1 : hidden;
+      in.matrix(layers[k].wIh, 4 * hidden, inputs);
+      in.matrix(layers[k].wHh, 4 * hidden, hidden);
+      in.vector(layers[k].bIh, 4 * hidden);
+      in.vector(layers[k].bHh, 4 * hidden);
+    }
+    in.matrix(fcWeight, 1, hidden);
+    in.vector(fcBias, 1);
+    stride = fcWeight.stride;
+    gatesIh.resize(4 * hidden);
+    gatesHh.resize(4 * hidden);
+    reset();
+    return in.ok();
+  }
+
+  float probability() const override { return p; }
+
+  void update(int bit) override {
+    // the input of the first layer is the bit, padded like a matrix row
+    std::vector<float> &input = scratch;
+    input.assign(stride, 0.0f);
+    input[0] = (float)bit;
+    const float *x = input.data();
+    for (auto &layer : layers) {
+      gemv(layer.wIh, x, layer.bIh.data(), gatesIh.data());
+      gemv(layer.wHh, layer.h.data(), layer.bHh.data(), gatesHh.data());
+      // PyTorch gate order: input, forget, cell, output
+      for (int j = 0; j < hidden; j++) {
+        float i = sigmoid(gatesIh[j] + gatesHh[j]);
+        float f = sigmoid(gatesIh[hidden + j] + gatesHh[hidden + j]);
+        float g = std::tanh(gatesIh[2 * hidden + j] + gatesHh[2 * hidden + j]);
+        float o = sigmoid(gatesIh[3 * hidden + j] + gatesHh[3 * hidden + j]);
+        layer.c[j] = f * layer.c[j] + i * g;
+        layer.h[j] = o * std::tanh(layer.c[j]);
+      }
+      x = layer.h.data();
+    }
+    float logit;
+    gemv(fcWeight, x, fcBias.data(), &logit);
+    p = sigmoid(logit);
+  }
+
+  void reset() override {
+    for (auto &layer : layers) {
+      layer.h.assign(stride, 0.0f);
+      layer.c.assign(hidden, 0.0f);
+    }
+    p = 0.5f;
+  }
+
+private:
+  struct Layer {
+    PaddedMatrix wIh, wHh;
+    std::vector<float> bIh, bHh;
+    std::vector<float> h, c; // h padded to stride for the next gemv
+  };
+
+  int hidden = 0, stride = 0;
+  std::vector<Layer> layers;
+  PaddedMatrix fcWeight;
+  std::vector<float> fcBias;
+  std::vector<float> gatesIh, gatesHh, scratch;
+  float p = 0.5f;
+};
+
+class NativeBitFc final : public NativeBitModel {
+public:
+  bool read(WeightReader &in) {
+    int window = (int)in.u32();
+    int hidden = (int)in.u32();
+    if (!in.ok() || window < 1 || window > 65536 || hidden < 1 ||
+        hidden > 4096) {
+      return false;
+    }
+    in.matrix(w0, hidden, window);
+    in.vector(b0, hidden);
+    in.matrix(w1, hidden, hidden);
+    in.vector(b1, hidden);
+    in.matrix(w2, 1, hidden);
+    in.vector(b2, 1);
+    h0.assign(w1.stride, 0.0f);
+    h1.assign(w2.stride, 0.0f);
+    reset();
+    return in.ok();
+  }
+
+  float probability() const override { return p; }
+
+  // the window holds the last bits, oldest first, like fc.py's samples
+  void update(int bit) override {
+    std::memmove(bits.data(), bits.data() + 1, (w0.cols - 1) * sizeof(float));
+    bits[w0.cols - 1] = (float)bit;
+    predict();
+  }
+
+  void reset() override {
+    bits.assign(w0.stride, 0.0f);
+    predict();
+  }
+
+private:
+  PaddedMatrix w0, w1, w2;
+  std::vector<float> b0, b1, b2;
+  std::vector<float> bits, h0, h1;
+  float p = 0.5f;
+
+  void predict() {
+    gemv(w0, bits.data(), b0.data(), h0.data());
+    for (int j = 0; j < w0.rows; j++) {
+      h0[j] = h0[j] > 0 ? h0[j] : 0.0f;
+    }
+    gemv(w1, h0.data(), b1.data(), h1.data());
+    for (int j = 0; j < w1.rows; j++) {
+      h1[j] = h1[j] > 0 ? h1[j] : 0.0f;
+    }
+    float logit;
+    gemv(w2, h1.data(), b2.data(), &logit);
+    p = sigmoid(logit);
+  }
+};
+
+} // namespace
+
+void gemv(const PaddedMatrix &w, const float *x, const float *b, float *y) {
+#ifdef NATIVE_MODEL_X86
+  if (hasAvx2()) {
+    gemvAvx2(w, x, b, y);
+    return;
+  }
+#endif
+  gemvScalar(w, x, b, y);
+}
+
+uint32_t NativeBitModel::zeroFrequency() const {
+  // what BinaryFrequencyTable::set(1 - probability()) stores
+  long double p0 = 1 - probability();
+  return (uint32_t)(p0 * (1u << 30));
+}
+
+std::unique_ptr<NativeBitModel> NativeBitModel::load(const std::string &path) {
+  WeightReader in(path);
+  // "BITM" read as a little-endian uint32
+  const uint32_t MAGIC = 0x4d544942;
+  uint32_t magic = in.u32();
+  if (magic == QUANTIZED_MAGIC) {
+    return loadQuantizedBitModel(path);
+  }
+  if (magic != MAGIC || in.u32() != VERSION) {
+    std::cerr << "Not a bit model weight file: " << path << std::endl;
+    return nullptr;
+  }
+  uint32_t kind = in.u32();
+  bool ok = false;
+  std::unique_ptr<NativeBitModel> model;
+  if (kind == KIND_LSTM) {
+    auto lstm = new NativeBitLstm();
+    model.reset(lstm);
+    ok = lstm->read(in);
+  } else if (kind == KIND_FC) {
+    auto fc = new NativeBitFc();
+    model.reset(fc);
+    ok = fc->read(in);
+  }
+  if (!ok || !in.atEnd()) {
+    std::cerr << "Malformed bit model weight file: " << path << std::endl;
+    return nullptr;
+  }
+  return model;
+}
@@ -0,0 +1,40 @@
+#ifndef NATIVE_MODEL_H
+#define NATIVE_MODEL_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Bit predictor running the weights written by export_weights.py (or the
+// fixed-point ones of export_quantized.py) without libtorch. Results depend
+// only on the weights and the bits seen: the AVX2 and the scalar kernels add
+// the products in the same order.
+class NativeBitModel {
+public:
+  virtual ~NativeBitModel() = default;
+
+  // P(next_bit=1) given every bit passed to update() since reset().
+  virtual float probability() const = 0;
+  // P(next_bit=0) * 2^30, ready for BinaryFrequencyTable::set(0, freq).
+  virtual uint32_t zeroFrequency() const;
+  virtual void update(int bit) = 0;
+  virtual void reset() = 0;
+
+  // Reads either weight format. Returns nullptr (and reports why) if the
+  // file can not be read.
+  static std::unique_ptr<NativeBitModel> load(const std::string &path);
+};
+
+// Row-major matrix with rows padded to a multiple of 8 floats.
+struct PaddedMatrix {
+  int rows = 0, cols = 0, stride = 0;
+  std::vector<float> data;
+
+  void resize(int r, int c);
+};
+
+// y = W x + b. x must hold stride floats, zero past cols.
+void gemv(const PaddedMatrix &w, const float *x, const float *b, float *y);
+
+#endif // NATIVE_MODEL_H
@@ -0,0 +1,511 @@
+/**************************************************************
+ * quantized_model.cpp
+ *
+ * Fixed-point inference for the bit models of lstm.py,
+ * lstm_fc.py and fc.py:
+ *   1) Loading the weights of export_quantized.py.
+ *   2) Integer GEMV/GEMM kernels, AVX2 when the CPU has it,
+ *      scalar otherwise.
+ *   3) BitLSTM and BitFC with table-driven activations, each
+ *      stepping a batch of independent sessions together.
+ *
+ * Formats: input bits are 0/1, LSTM hidden states Q15 (int16),
+ * LSTM cells Q12 (int32), FC hidden activations Q8 (int16),
+ * pre-activations Q8 (int32). Rows are at most 512 wide, so
+ * the int32 dot products can not overflow and both kernels give
+ * the same sums whatever order they add in.
+ **************************************************************/
+
+#include "quantized_model.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define QUANTIZED_MODEL_X86
+#endif
+
+/**************************************************************
+ * 1) Weights
+ **************************************************************/
+void QuantizedMatrix::resize(int r, int c) {
+  rows = r;
+  cols = c;
+  stride = (c + 15) / 16 * 16;
+  int padded = (r + 7) / 8 * 8;
+  data.assign((size_t)padded * stride, 0);
+  multiplier.assign(padded, 0);
+  shift.assign(padded, 0);
+  bias.assign(padded, 0);
+}
+
+namespace {
+
+const uint32_t VERSION = 1;
+const uint32_t KIND_LSTM = 0;
+const uint32_t KIND_FC = 1;
+
+const int MAX_COLS = 512;
+const int TABLE_SIZE = 4096;
+const int Q15_ONE = 1 << 15;
+
+class QuantizedReader {
+public:
+  explicit QuantizedReader(const std::string &path)
+      : in(path, std::ios::binary) {}
+
+  bool ok() const { return (bool)in; }
+
+  uint32_t u32() {
+    unsigned char b[4] = {0, 0, 0, 0};
+    in.read((char *)b, 4);
+    return b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+  }
+
+  int32_t i32() { return (int32_t)u32(); }
+
+  int16_t i16() {
+    unsigned char b[2] = {0, 0};
+    in.read((char *)b, 2);
+    return (int16_t)(b[0] | (b[1] << 8));
+  }
+
+  bool matrix(QuantizedMatrix &m, int rows, int cols) {
+    if (cols > MAX_COLS) {
+      return false;
+    }
+    m.resize(rows, cols);
+    for (int r = 0; r < rows; r++) {
+      m.multiplier[r] = i32();
+      m.shift[r] = i32();
+      if (m.multiplier[r] < 0 || m.shift[r] < 0 || m.shift[r] > 62) {
+        return false;
+      }
+      for (int c = 0; c < cols; c++) {
+        m.at(r, c) = (int8_t)in.get();
+      }
+    }
+    return ok();
+  }
+
+  void bias(QuantizedMatrix &m) {
+    for (int r = 0; r < m.rows; r++) {
+      m.bias[r] = i32();
+    }
+  }
+
+  void table(std::vector<int16_t> &t) {
+    t.resize(TABLE_SIZE);
+    for (auto &x : t) {
+      x = i16();
+    }
+  }
+
+  bool atEnd() {
+    in.peek();
+    return in.eof();
+  }
+
+private:
+  std::ifstream in;
+};
+
+/**************************************************************
+ * 2) Kernels
+ **************************************************************/
+int32_t requantize(const QuantizedMatrix &w, int r, int32_t acc) {
+  if (w.shift[r] == 0) {
+    return (int32_t)((int64_t)acc * w.multiplier[r]) + w.bias[r];
+  }
+  int64_t scaled = (int64_t)acc * w.multiplier[r];
+  // round half up; >> on negative values is an arithmetic shift here
+  scaled = (scaled + ((int64_t)1 << (w.shift[r] - 1))) >> w.shift[r];
+  return (int32_t)scaled + w.bias[r];
+}
+
+void gemmScalar(const QuantizedMatrix &w, const int16_t *x, int batch,
+                int32_t *y) {
+  int pairs = w.stride / 2;
+  for (int s = 0; s < batch; s++) {
+    const int16_t *xs = x + (size_t)s * w.stride;
+    for (int r = 0; r < w.rows; r++) {
+      const int16_t *block = &w.data[(size_t)(r / 8) * pairs * 16 + r % 8 * 2];
+      int32_t acc = 0;
+      for (int c = 0; c < pairs; c++) {
+        acc += block[c * 16] * xs[2 * c] + block[c * 16 + 1] * xs[2 * c + 1];
+      }
+      y[(size_t)s * w.rows + r] = requantize(w, r, acc);
+    }
+  }
+}
+
+#ifdef QUANTIZED_MODEL_X86
+// requantize() of rows r..r+7 at once. The 64-bit products are shifted
+// logically, with the bits flipped around the shift for negative values
+// to get the arithmetic shift AVX2 lacks.
+__attribute__((target("avx2"))) __m256i
+requantizeAvx2(const QuantizedMatrix &w, int r, __m256i acc) {
+  const __m256i low = _mm256_set1_epi64x(0xffffffff);
+  const __m256i one = _mm256_set1_epi64x(1);
+  __m256i m = _mm256_loadu_si256((const __m256i *)&w.multiplier[r]);
+  __m256i shift = _mm256_loadu_si256((const __m256i *)&w.shift[r]);
+  __m256i result[2];
+  for (int odd = 0; odd < 2; odd++) {
+    __m256i a = odd ? _mm256_srli_epi64(acc, 32) : acc;
+    __m256i b = odd ? _mm256_srli_epi64(m, 32) : m;
+    __m256i n =
+        odd ? _mm256_srli_epi64(shift, 32) : _mm256_and_si256(shift, low);
+    // a shift of 0 makes the count huge and the rounding term 0
+    __m256i round = _mm256_sllv_epi64(one, _mm256_sub_epi64(n, one));
+    __m256i v = _mm256_add_epi64(_mm256_mul_epi32(a, b), round);
+    __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), v);
+    v = _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(v, sign), n), sign);
+    result[odd] = v;
+  }
+  __m256i packed = _mm256_blend_epi32(
+      result[0], _mm256_slli_epi64(result[1], 32), 0xaa);
+  __m256i bias = _mm256_loadu_si256((const __m256i *)&w.bias[r]);
+  return _mm256_add_epi32(packed, bias);
+}
+
+// N vectors against 8 rows at a time: every weight load feeds N madds,
+// each against a broadcast pair of inputs
+template <int N>
+__attribute__((target("avx2"))) void
+gemmTileAvx2(const QuantizedMatrix &w, const int16_t *x, int32_t *y) {
+  int pairs = w.stride / 2;
+  for (int r = 0; r < w.rows; r += 8) {
+    const int16_t *block = &w.data[(size_t)(r / 8) * pairs * 16];
+    __m256i acc[N];
+    for (int k = 0; k < N; k++) {
+      acc[k] = _mm256_setzero_si256();
+    }
+    for (int c = 0; c < pairs; c++) {
+      __m256i a = _mm256_loadu_si256((const __m256i *)(block + c * 16));
+#pragma GCC unroll 4
+      for (int k = 0; k < N; k++) {
+        int32_t pair;
+        std::memcpy(&pair, x + (size_t)k * w.stride + 2 * c, sizeof(pair));
+        __m256i b = _mm256_set1_epi32(pair);
+        acc[k] = _mm256_add_epi32(acc[k], _mm256_madd_epi16(a, b));
+      }
+    }
+    for (int k = 0; k < N; k++) {
+      __m256i q = requantizeAvx2(w, r, acc[k]);
+      int32_t *out = y + (size_t)k * w.rows + r;
+      if (r + 8 <= w.rows) {
+        _mm256_storeu_si256((__m256i *)out, q);
+      } else {
+        int32_t lane[8];
+        _mm256_storeu_si256((__m256i *)lane, q);
+        std::memcpy(out, lane, (w.rows - r) * sizeof(int32_t));
+      }
+    }
+  }
+}
+
+__attribute__((target("avx2"))) void
+gemmAvx2(const QuantizedMatrix &w, const int16_t *x, int batch, int32_t *y) {
+  int s = 0;
+  for (; s + 4 <= batch; s += 4) {
+    gemmTileAvx2<4>(w, x + (size_t)s * w.stride, y + (size_t)s * w.rows);
+  }
+  for (; s < batch; s++) {
+    gemmTileAvx2<1>(w, x + (size_t)s * w.stride, y + (size_t)s * w.rows);
+  }
+}
+
+bool hasAvx2() {
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+}
+#endif
+
+// Activation tables over Q8 inputs in [-8, 8), Q15 outputs.
+struct Activations {
+  std::vector<int16_t> sigmoid, tanh;
+
+  static int index(int32_t q8) {
+    return std::min(std::max(q8, -TABLE_SIZE / 2), TABLE_SIZE / 2 - 1) +
+           TABLE_SIZE / 2;
+  }
+
+  int32_t sigmoidQ15(int32_t q8) const { return sigmoid[index(q8)]; }
+  int32_t tanhQ15(int32_t q8) const { return tanh[index(q8)]; }
+};
+
+// P(1) in Q15, kept inside (0, 1) so that both symbols stay codable
+int32_t clampProbability(int32_t p) {
+  return std::min(std::max(p, 1), Q15_ONE - 1);
+}
+
+/**************************************************************
+ * 3) Models
+ **************************************************************/
+class QuantizedBitLstm final : public BatchedBitModel {
+public:
+  bool read(QuantizedReader &in, int sessions) {
+    int numLayers = (int)in.u32();
+    hidden = (int)in.u32();
+    if (!in.ok() || numLayers < 1 || numLayers > 16 || hidden < 1 ||
+        hidden > MAX_COLS) {
+      return false;
+    }
+    layers.resize(numLayers);
+    for (int k = 0; k < numLayers; k++) {
+      int inputs = k == 0 ? 1 : hidden;
+      // the two biases come summed, added once with the input gates
+      if (!in.matrix(layers[k].wIh, 4 * hidden, inputs) ||
+          !in.matrix(layers[k].wHh, 4 * hidden, hidden)) {
+        return false;
+      }
+      in.bias(layers[k].wIh);
+    }
+    if (!in.matrix(fcWeight, 1, hidden)) {
+      return false;
+    }
+    in.bias(fcWeight);
+    in.table(act.sigmoid);
+    in.table(act.tanh);
+    count = sessions;
+    stride = fcWeight.stride;
+    input.assign((size_t)count * layers[0].wIh.stride, 0);
+    gatesIh.resize((size_t)count * 4 * hidden);
+    gatesHh.resize((size_t)count * 4 * hidden);
+    logits.resize(count);
+    reset();
+    return in.ok();
+  }
+
+  void update(const int *bits) override {
+    int inputStride = layers[0].wIh.stride;
+    for (int s = 0; s < count; s++) {
+      input[(size_t)s * inputStride] = (int16_t)bits[s];
+    }
+    const int16_t *x = input.data();
+    for (auto &layer : layers) {
+      gemmQ8(layer.wIh, x, count, gatesIh.data());
+      gemmQ8(layer.wHh, layer.h.data(), count, gatesHh.data());
+      for (int s = 0; s < count; s++) {
+        size_t gates = (size_t)s * 4 * hidden;
+        cell(&gatesIh[gates], &gatesHh[gates], &layer.c[(size_t)s * hidden],
+             &layer.h[(size_t)s * stride]);
+      }
+      x = layer.h.data();
+    }
+    gemmQ8(fcWeight, x, count, logits.data());
+    for (int s = 0; s < count; s++) {
+      p[s] = clampProbability(act.sigmoidQ15(logits[s]));
+    }
+  }
+
+  void reset() override {
+    for (auto &layer : layers) {
+      layer.h.assign((size_t)count * stride, 0);
+      layer.c.assign((size_t)count * hidden, 0);
+    }
+    p.assign(count, Q15_ONE / 2);
+  }
+
+  void reset(int s) override {
+    for (auto &layer : layers) {
+      std::fill_n(&layer.h[(size_t)s * stride], stride, 0);
+      std::fill_n(&layer.c[(size_t)s * hidden], hidden, 0);
+    }
+    p[s] = Q15_ONE / 2;
+  }
+
+private:
+  struct Layer {
+    QuantizedMatrix wIh, wHh;
+    std::vector<int16_t> h; // Q15, stride per session for the next gemm
+    std::vector<int32_t> c; // Q12, hidden per session
+  };
+
+  Activations act;
+  int hidden = 0, stride = 0;
+  std::vector<Layer> layers;
+  QuantizedMatrix fcWeight;
+  std::vector<int16_t> input;
+  std::vector<int32_t> gatesIh, gatesHh, logits;
+
+  void cell(const int32_t *gIh, const int32_t *gHh, int32_t *c, int16_t *h) {
+    // PyTorch gate order: input, forget, cell, output
+    for (int j = 0; j < hidden; j++) {
+      int64_t i = act.sigmoidQ15(gIh[j] + gHh[j]);
+      int64_t f = act.sigmoidQ15(gIh[hidden + j] + gHh[hidden + j]);
+      int64_t g = act.tanhQ15(gIh[2 * hidden + j] + gHh[2 * hidden + j]);
+      int32_t o = act.sigmoidQ15(gIh[3 * hidden + j] + gHh[3 * hidden + j]);
+      // c in Q12: Q15 * Q12 >> 15 and Q15 * Q15 >> 18
+      c[j] = (int32_t)((f * c[j]) >> 15) + (int32_t)((i * g) >> 18);
+      h[j] = (int16_t)((o * act.tanhQ15(c[j] >> 4)) >> 15);
+    }
+  }
+};
+
+class QuantizedBitFc final : public BatchedBitModel {
+public:
+  bool read(QuantizedReader &in, int sessions) {
+    int window = (int)in.u32();
+    int hidden = (int)in.u32();
+    if (!in.ok() || window < 1 || window > MAX_COLS || hidden < 1 ||
+        hidden > MAX_COLS) {
+      return false;
+    }
+    if (!in.matrix(w0, hidden, window)) {
+      return false;
+    }
+    in.bias(w0);
+    if (!in.matrix(w1, hidden, hidden)) {
+      return false;
+    }
+    in.bias(w1);
+    if (!in.matrix(w2, 1, hidden)) {
+      return false;
+    }
+    in.bias(w2);
+    in.table(act.sigmoid);
+    in.table(act.tanh);
+    count = sessions;
+    pre.resize((size_t)count * hidden);
+    h0.assign((size_t)count * w1.stride, 0);
+    h1.assign((size_t)count * w2.stride, 0);
+    logits.resize(count);
+    reset();
+    return in.ok();
+  }
+
+  // each window holds the last bits, oldest first, like fc.py's samples
+  void update(const int *bits) override {
+    for (int s = 0; s < count; s++) {
+      int16_t *window = &windows[(size_t)s * w0.stride];
+      std::memmove(window, window + 1, (w0.cols - 1) * sizeof(int16_t));
+      window[w0.cols - 1] = (int16_t)bits[s];
+    }
+    predict();
+  }
+
+  void reset() override {
+    windows.assign((size_t)count * w0.stride, 0);
+    p.resize(count);
+    predict();
+    empty = p[0];
+  }
+
+  void reset(int s) override {
+    std::fill_n(&windows[(size_t)s * w0.stride], w0.stride, 0);
+    p[s] = empty;
+  }
+
+private:
+  Activations act;
+  int32_t empty = 0; // P(1) after an all-zero window
+  QuantizedMatrix w0, w1, w2;
+  std::vector<int16_t> windows, h0, h1; // h0 and h1 in Q8
+  std::vector<int32_t> pre, logits;
+
+  static int16_t relu(int32_t q8) {
+    return (int16_t)std::min(std::max(q8, 0), 32767);
+  }
+
+  static void relu(const QuantizedMatrix &w, const std::vector<int32_t> &pre,
+                   int count, const QuantizedMatrix &next,
+                   std::vector<int16_t> &h) {
+    for (int s = 0; s < count; s++) {
+      for (int j = 0; j < w.rows; j++) {
+        h[(size_t)s * next.stride + j] = relu(pre[(size_t)s * w.rows + j]);
+      }
+    }
+  }
+
+  void predict() {
+    gemmQ8(w0, windows.data(), count, pre.data());
+    relu(w0, pre, count, w1, h0);
+    gemmQ8(w1, h0.data(), count, pre.data());
+    relu(w1, pre, count, w2, h1);
+    gemmQ8(w2, h1.data(), count, logits.data());
+    for (int s = 0; s < count; s++) {
+      p[s] = clampProbability(act.sigmoidQ15(logits[s]));
+    }
+  }
+};
+
+// NativeBitModel interface over a batch of one
+class QuantizedBitModel final : public NativeBitModel {
+public:
+  explicit QuantizedBitModel(std::unique_ptr<BatchedBitModel> model)
+      : model(std::move(model)) {}
+
+  float probability() const override {
+    // exact: P(1) is a multiple of 2^-15
+    return ((1u << 30) - zeroFrequency()) / (float)(1u << 30);
+  }
+
+  uint32_t zeroFrequency() const override { return model->zeroFrequency(0); }
+
+  void update(int bit) override { model->update(&bit); }
+
+  void reset() override { model->reset(); }
+
+private:
+  std::unique_ptr<BatchedBitModel> model;
+};
+
+} // namespace
+
+void gemmQ8(const QuantizedMatrix &w, const int16_t *x, int batch,
+            int32_t *y) {
+#ifdef QUANTIZED_MODEL_X86
+  if (hasAvx2()) {
+    gemmAvx2(w, x, batch, y);
+    return;
+  }
+#endif
+  gemmScalar(w, x, batch, y);
+}
+
+uint32_t BatchedBitModel::zeroFrequency(int s) const {
+  return (uint32_t)(Q15_ONE - p[s]) << 15;
+}
+
+std::unique_ptr<BatchedBitModel>
+BatchedBitModel::load(const std::string &path, int sessions) {
+  QuantizedReader in(path);
+  if (in.u32() != QUANTIZED_MAGIC || in.u32() != VERSION) {
+    std::cerr << "Not a quantized bit model file: " << path << std::endl;
+    return nullptr;
+  }
+  if (sessions < 1) {
+    std::cerr << "A batch needs at least one session" << std::endl;
+    return nullptr;
+  }
+  uint32_t kind = in.u32();
+  bool ok = false;
+  std::unique_ptr<BatchedBitModel> model;
+  if (kind == KIND_LSTM) {
+    auto lstm = new QuantizedBitLstm();
+    model.reset(lstm);
+    ok = lstm->read(in, sessions);
+  } else if (kind == KIND_FC) {
+    auto fc = new QuantizedBitFc();
+    model.reset(fc);
+    ok = fc->read(in, sessions);
+  }
+  if (!ok || !in.atEnd()) {
+    std::cerr << "Malformed quantized bit model file: " << path << std::endl;
+    return nullptr;
+  }
+  return model;
+}
+
+std::unique_ptr<NativeBitModel> loadQuantizedBitModel(const std::string &path) {
+  auto model = BatchedBitModel::load(path, 1);
+  if (!model) {
+    return nullptr;
+  }
+  return std::unique_ptr<NativeBitModel>(
+      new QuantizedBitModel(std::move(model)));
+}
@@ -0,0 +1,69 @@
+#ifndef QUANTIZED_MODEL_H
+#define QUANTIZED_MODEL_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "native_model.h"
+
+// "BITQ" read as a little-endian uint32
+const uint32_t QUANTIZED_MAGIC = 0x51544942;
+
+// Reads the fixed-point weights written by export_quantized.py. The model
+// only does integer arithmetic, so its probabilities are the same on every
+// machine and with every kernel. Returns nullptr (and reports why) if the
+// file can not be read.
+std::unique_ptr<NativeBitModel> loadQuantizedBitModel(const std::string &path);
+
+// A quantized model stepping independent sessions (blocks, streams) in
+// lockstep, so that every weight row loaded is used by all of them. Each
+// session predicts exactly what a model of its own would.
+class BatchedBitModel {
+public:
+  virtual ~BatchedBitModel() = default;
+
+  int sessions() const { return count; }
+
+  // P(next_bit=0) * 2^30 for session s, see NativeBitModel::zeroFrequency().
+  uint32_t zeroFrequency(int s) const;
+  // bits[s] is the bit session s has just coded.
+  virtual void update(const int *bits) = 0;
+  virtual void reset() = 0;
+  // Restarts session s alone, as for a new block.
+  virtual void reset(int s) = 0;
+
+  // Returns nullptr (and reports why) if the file can not be read.
+  static std::unique_ptr<BatchedBitModel> load(const std::string &path,
+                                               int sessions);
+
+protected:
+  int count = 0;
+  std::vector<int32_t> p; // P(1) in Q15, per session
+};
+
+// int8 weights widened to int16, in blocks of 8 rows by 2 columns: the 16
+// values one madd multiplies with a pair of inputs, giving 8 row sums at
+// once. Rows are padded to a multiple of 8, columns to 16. Each row has
+// its own requantization of the int32 dot product to Q8.
+struct QuantizedMatrix {
+  int rows = 0, cols = 0, stride = 0;
+  std::vector<int16_t> data;
+  std::vector<int32_t> multiplier, shift, bias; // padded like the rows
+
+  void resize(int r, int c);
+
+  int16_t &at(int r, int c) {
+    return data[((size_t)(r / 8) * (stride / 2) + c / 2) * 16 + r % 8 * 2 +
+                c % 2];
+  }
+};
+
+// y_s = W x_s + b in Q8 for each of the batch vectors. x holds them one
+// after another, stride values each, zero past cols; y gets rows values
+// per vector.
+void gemmQ8(const QuantizedMatrix &w, const int16_t *x, int batch,
+            int32_t *y);
+
+#endif // QUANTIZED_MODEL_H
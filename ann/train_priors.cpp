@@ -0,0 +1,94 @@
+/**************************************************************
+ * train_priors.cpp
+ *
+ * Offline trainer for the starting state of mixed_model.cpp:
+ *   1) Counting every bit of a corpus of base64 lines, by the
+ *      byte before it (order 1) and by none (order 0), and by
+ *      the bits of its own byte so far.
+ *   2) Writing the probabilities as mixed_priors.h, which
+ *      MixedBitModel loads into its order-0 and order-1 tables
+ *      at reset(), instead of starting them all at 1/2.
+ *
+ * Usage:
+ *   ./train_priors < contents_combined.txt > mixed_priors.h
+ **************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "td/utils/base64.h"
+
+// order-1 contexts: the previous byte, or none at the start of a line
+const int CONTEXTS = 257;
+const int NO_BYTE = 256;
+
+// P(1) as stored in the header: stretched, in units of 16/256 of a nat,
+// so that MixedBitModel restores it with its own squash().
+int stretched(uint64_t n0, uint64_t n1) {
+  double p = (n1 + 0.4) / (n0 + n1 + 0.8);
+  double d = std::log(p / (1 - p)) * 256 / 16;
+  return (int)std::lround(std::min(127.0, std::max(-127.0, d)));
+}
+
+void writeTable(const std::vector<uint64_t> &n0,
+                const std::vector<uint64_t> &n1, size_t offset) {
+  for (int partial = 1; partial < 256; partial++) {
+    if (partial % 16 == 1) {
+      std::cout << "\n   ";
+    }
+    std::cout << " " << stretched(n0[offset + partial], n1[offset + partial])
+              << ",";
+  }
+}
+
+int main() {
+  // bit counts by context and partial byte (1 followed by the bits so far)
+  std::vector<uint64_t> n0(CONTEXTS * 256), n1(CONTEXTS * 256);
+  std::vector<uint64_t> order0_n0(256), order0_n1(256);
+
+  std::string base64_data;
+  long long lines = 0, bytes = 0;
+  while (std::getline(std::cin, base64_data)) {
+    if (base64_data.empty())
+      continue;
+    std::string data = td::base64_decode(base64_data).move_as_ok();
+    int context = NO_BYTE;
+    for (unsigned char c : data) {
+      unsigned partial = 1;
+      for (int i = 7; i >= 0; i--) {
+        int bit = (c >> i) & 1;
+        (bit ? n1 : n0)[context * 256 + partial]++;
+        (bit ? order0_n1 : order0_n0)[partial]++;
+        partial = partial * 2 + bit;
+      }
+      context = c;
+    }
+    lines++;
+    bytes += data.size();
+  }
+
+  std::cout << "// Generated by train_priors from " << lines << " lines, "
+            << bytes << " bytes.\n"
+            << "// Stretched P(1) / 16 of each bit of a byte, by the bits\n"
+            << "// before it (1 followed by them, the index + 1) and, for\n"
+            << "// MIXED_PRIOR1, by the previous byte (256: none).\n\n"
+            << "#ifndef MIXED_PRIORS_H\n"
+            << "#define MIXED_PRIORS_H\n\n"
+            << "#include <cstdint>\n\n"
+            << "const int8_t MIXED_PRIOR0[255] = {";
+  writeTable(order0_n0, order0_n1, 0);
+  std::cout << "\n};\n\n"
+            << "const int8_t MIXED_PRIOR1[" << CONTEXTS << "][255] = {";
+  for (int context = 0; context < CONTEXTS; context++) {
+    std::cout << "\n  {";
+    writeTable(n0, n1, context * 256);
+    std::cout << "\n  },";
+  }
+  std::cout << "\n};\n\n"
+            << "#endif // MIXED_PRIORS_H\n";
+  return 0;
+}
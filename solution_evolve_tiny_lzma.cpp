@@ -1195,7 +1195,12 @@ int tinyLzmaDecompress(const uint8_t *p_src, size_t src_len, uint8_t *p_dst,
 }
 
 #include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <cmath>
 #include <iostream>
+#include <memory>
 #include <queue>
 #include <random>
 #include <vector>
@@ -1999,24 +2004,115 @@ private:
   }
 };
 
-td::Result<td::BufferSlice>
-my_std_boc_serialize(const Gene &gene, td::Ref<vm::Cell> root, int mode = 0) {
-  if (root.is_null()) {
-    return td::Status::Error();
+// Imports the block once and keeps every cell's serialized bytes and refs, so
+// that any cell order can be emitted with plain memcpy instead of building a
+// new bag of cells per evaluation. The output is byte-identical to
+// serializing the permuted bag of cells with the same mode (modes without
+// index, hashes and cache bits).
+class OrderingWorkspace {
+public:
+  td::Status import(td::Ref<vm::Cell> root, int mode) {
+    vm::BagOfCells boc;
+    boc.add_root(std::move(root));
+    TRY_STATUS(boc.import_cells());
+    auto myBoc = reinterpret_cast<MyBagOfCells *>(&boc);
+    TRY_RESULT(baseline, boc.serialize_to_slice(mode));
+
+    this->mode = mode;
+    cell_count = myBoc->cell_count;
+    ref_byte_size = myBoc->info.ref_byte_size;
+    root_idx = myBoc->roots[0].idx;
+    std::size_t roots_offset =
+        6 + 3 * ref_byte_size + myBoc->info.offset_byte_size;
+    header = baseline.as_slice().substr(0, roots_offset).str();
+    total_size = baseline.size();
+    Gene::number_of_cells = cell_count;
+
+    meta.resize(2 * cell_count);
+    data_offset.assign(1, 0);
+    data.clear();
+    refs.resize(cell_count);
+    ref_num.resize(cell_count);
+    for (int i = 0; i < cell_count; i++) {
+      const auto &cell_info = myBoc->cell_list_[i];
+      unsigned char buf[256];
+      int len = cell_info.dc_ref->serialize(buf, 256, false);
+      meta[2 * i] = buf[0];
+      meta[2 * i + 1] = buf[1];
+      data.append(reinterpret_cast<const char *>(buf + 2), len - 2);
+      data_offset.push_back(data.size());
+      refs[i] = cell_info.ref_idx;
+      ref_num[i] = cell_info.ref_num;
+    }
+    return td::Status::OK();
   }
-  vm::BagOfCells boc;
-  boc.add_root(std::move(root));
-  auto res = boc.import_cells();
 
-  auto myBoc = reinterpret_cast<MyBagOfCells *>(&boc);
-  myBoc->permute(gene);
-  Gene::number_of_cells = myBoc->cell_count;
+  td::BufferSlice serialize(const Gene &gene) const {
+    std::vector<int> perm(cell_count);
+    for (int i = 0; i < cell_count; i++) {
+      perm[i] = i;
+    }
+    gene.apply(perm);
+    // order[k] is the cell written k-th, cells are written from the last
+    // index to the first one
+    std::vector<int> order(cell_count);
+    for (int i = 0; i < cell_count; i++) {
+      order[cell_count - 1 - perm[i]] = i;
+    }
 
-  if (res.is_error()) {
-    return res.move_as_error();
+    td::BufferSlice res(total_size);
+    auto ptr = reinterpret_cast<unsigned char *>(res.data());
+    auto store_bytes = [&](const char *src, std::size_t len) {
+      std::memcpy(ptr, src, len);
+      ptr += len;
+    };
+    auto store_ref = [&](unsigned long long value) {
+      for (int b = ref_byte_size - 1; b >= 0; b--) {
+        *ptr++ = static_cast<unsigned char>(value >> (8 * b));
+      }
+    };
+
+    store_bytes(header.data(), header.size());
+    store_ref(cell_count - 1 - perm[root_idx]);
+    for (int i : order) {
+      store_bytes(meta.data() + 2 * i, 2);
+      store_bytes(data.data() + data_offset[i],
+                  data_offset[i + 1] - data_offset[i]);
+      for (int j = 0; j < ref_num[i]; j++) {
+        store_ref(cell_count - 1 - perm[refs[i][j]]);
+      }
+    }
+    if (mode & 2) {
+      auto crc = td::crc32c(td::Slice(res.data(), total_size - 4));
+      for (int b = 0; b < 4; b++) {
+        *ptr++ = static_cast<unsigned char>(crc >> (8 * b));
+      }
+    }
+    DCHECK(ptr == reinterpret_cast<unsigned char *>(res.data()) + total_size);
+    return res;
   }
-  return boc.serialize_to_slice(mode);
-}
+
+  std::vector<std::vector<int>> children() const {
+    std::vector<std::vector<int>> res(cell_count);
+    for (int i = 0; i < cell_count; i++) {
+      res[i].assign(refs[i].begin(), refs[i].begin() + ref_num[i]);
+    }
+    return res;
+  }
+
+private:
+  int mode{0};
+  int cell_count{0};
+  int ref_byte_size{0};
+  int root_idx{0};
+  std::size_t total_size{0};
+  std::string header;
+  std::string meta;
+  std::string data;
+  std::vector<std::size_t> data_offset;
+  std::vector<std::array<int, 4>> refs;
+  std::vector<unsigned char> ref_num;
+};
 
 td::Result<td::Ref<vm::Cell>>
 my_std_boc_deserialize(td::Slice data, bool can_be_empty = false,
@@ -2043,52 +2139,220 @@ my_std_boc_deserialize(td::Slice data, bool can_be_empty = false,
   return std::move(root);
 }
 
-td::BufferSlice compress(td::Slice data) {
-  const auto start_time = std::chrono::steady_clock::now();
+// Deterministic mode: the RNG is seeded from the root hash, the budget is a
+// number of evaluations derived from the block size, and each generation is
+// evaluated on THREADS threads with a fixed split. The same block always
+// compresses to the same bytes, regardless of machine load.
+const bool DETERMINISTIC = false;
+// Each tiny LZMA call allocates its own 128 MB hash table.
+const int THREADS = 2;
+
+const double TIME_BUDGET = 1.85;
+// Count CPU-seconds of the whole process (all threads) instead of wall-clock.
+const bool BUDGET_IN_CPU_TIME = false;
+// Prior for the cost of one evaluation, used until the first one is measured.
+const double EVAL_FIXED_SECONDS = 0.03;
+const double EVAL_SECONDS_PER_BYTE = 5e-7;
+
+// Anytime search budget. Every evaluation is timed and a new one is started
+// only if its predicted cost still fits before the deadline, so the search
+// stops with the best-so-far result in time even if a single evaluation is
+// slow. The GA shape is derived from how many evaluations are affordable.
+class SearchScheduler {
+public:
+  SearchScheduler(double budget, bool cpu_time)
+      : budget(budget), cpu_time(cpu_time), start(now()) {}
 
-  const auto is_timeout = [&start_time](int timeout = 1900) {
-    auto MAX_DURATION = std::chrono::milliseconds(timeout);
+  // Iteration budget: exactly max_evals evaluations, independent of timing.
+  explicit SearchScheduler(int max_evals)
+      : budget(0), cpu_time(false), start(now()), max_evals(max_evals) {}
 
-    auto now = std::chrono::steady_clock::now();
-    return (now - start_time) >= MAX_DURATION;
-  };
+  // The number of evaluations the size-based prior predicts to fit into
+  // TIME_BUDGET on THREADS threads. Depends on nothing but the block size.
+  static int evals_for_size(std::size_t bytes) {
+    return static_cast<int>(
+        TIME_BUDGET * THREADS /
+        (SAFETY * (EVAL_FIXED_SECONDS + bytes * EVAL_SECONDS_PER_BYTE)));
+  }
 
-  td::Ref<vm::Cell> root = vm::std_boc_deserialize(data).move_as_ok();
+  void predict_from_size(std::size_t bytes) {
+    eval_cost = EVAL_FIXED_SECONDS + bytes * EVAL_SECONDS_PER_BYTE;
+  }
 
-  td::BufferSlice best =
-      lzma_compress(my_std_boc_serialize(Gene(false), root, 0).move_as_ok());
-  int normal_len = best.length();
-  int attempts = 0;
+  double elapsed() const { return now() - start; }
 
-  auto evalGene = [&](Gene &gene) {
-    if (is_timeout(1800)) {
-      gene.unfitness = -1;
-      return;
+  int evaluations() const { return done; }
+
+  // Fraction of the budget used so far, from 0 to 1.
+  double progress() const {
+    if (max_evals >= 0) {
+      return max_evals ? std::min(1.0, static_cast<double>(done) / max_evals)
+                       : 1.0;
     }
-    auto ser = my_std_boc_serialize(gene, root, 0).move_as_ok();
-    auto compressed = lzma_compress(ser);
-    gene.unfitness = compressed.length();
+    return std::min(1.0, elapsed() / budget);
+  }
 
-    if (compressed.length() < best.length()) {
-      best = std::move(compressed);
+  int affordable_evals() const {
+    if (max_evals >= 0) {
+      return std::max(0, max_evals - done);
     }
-  };
+    double left = budget - elapsed();
+    if (left <= 0) {
+      return 0;
+    }
+    return static_cast<int>(left / (eval_cost * SAFETY));
+  }
 
-  std::vector<Gene> population;
-  for (int i = 0; i < POPULATION; i++) {
-    population.push_back(Gene());
-    evalGene(population.back());
+  // Runs f only if one more evaluation fits into the budget.
+  template <class F> bool run(F &&f) {
+    if (affordable_evals() < 1) {
+      return false;
+    }
+    measure(f);
+    return true;
+  }
+
+  // Reserves up to n evaluations that will be run outside of run/measure.
+  int take(int n) {
+    n = std::min(n, affordable_evals());
+    done += n;
+    return n;
+  }
+
+  // Runs f unconditionally and refines the cost prediction with its duration.
+  // A slow evaluation raises the estimate at once, a fast one lowers it slowly.
+  template <class F> void measure(F &&f) {
+    double begin = now();
+    f();
+    double cost = now() - begin;
+    eval_cost = measured ? std::max(cost, eval_cost + (cost - eval_cost) * 0.3)
+                         : cost;
+    measured = true;
+    done++;
+  }
+
+  // Children per generation, small enough for MIN_GENERATIONS more rounds.
+  int children_count(int max_children) const {
+    return std::max(1, std::min(max_children,
+                                affordable_evals() / MIN_GENERATIONS));
+  }
+
+  int population_size(int max_population, int max_children) const {
+    return std::max(2, std::min(max_population,
+                                max_population *
+                                    children_count(max_children) /
+                                    max_children));
+  }
+
+private:
+  static constexpr double SAFETY = 1.25;
+  static constexpr int MIN_GENERATIONS = 4;
 
-    if (is_timeout()) {
-      return best;
+  double budget;
+  bool cpu_time;
+  double start;
+  int max_evals{-1};
+  int done{0};
+  double eval_cost{0};
+  bool measured{false};
+
+  double now() const {
+    if (cpu_time) {
+      return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
     }
+    return std::chrono::duration<double>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
   }
-  std::sort(population.begin(), population.end());
+};
 
-  while (true) {
-    attempts++;
+void seed_rng(const vm::Cell::Hash &hash) {
+  auto bytes = hash.as_slice();
+  std::vector<std::uint32_t> words(bytes.size() / 4);
+  std::memcpy(words.data(), bytes.data(), words.size() * 4);
+  std::seed_seq seq(words.begin(), words.end());
+  rng.seed(seq);
+}
+
+// Calls f(i) for i in [0, n). Index i always runs on thread i % THREADS.
+template <class F> void parallel_for(int n, F &&f) {
+  std::vector<std::thread> workers;
+  for (int t = 1; t < THREADS && t < n; t++) {
+    workers.emplace_back([&f, n, t] {
+      for (int i = t; i < n; i += THREADS) {
+        f(i);
+      }
+    });
+  }
+  for (int i = 0; i < n; i += THREADS) {
+    f(i);
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+// Written order of cells for a gene and back. Cells with a bigger index are
+// written first.
+std::vector<int> gene_to_order(const Gene &gene) {
+  int n = Gene::number_of_cells;
+  std::vector<int> perm(n);
+  for (int i = 0; i < n; i++) {
+    perm[i] = i;
+  }
+  gene.apply(perm);
+  std::vector<int> order(n);
+  for (int i = 0; i < n; i++) {
+    order[n - 1 - perm[i]] = i;
+  }
+  return order;
+}
+
+Gene order_to_gene(const std::vector<int> &order) {
+  int n = order.size();
+  std::vector<int> perm(n);
+  for (int k = 0; k < n; k++) {
+    perm[order[k]] = n - 1 - k;
+  }
+  return Gene(perm, 0);
+}
+
+enum class Strategy { Genetic, Annealing };
+const Strategy STRATEGY = Strategy::Genetic;
+
+// Annealing temperature, relative to the baseline compressed size; it decays
+// geometrically from start to end over the budget.
+const double ANNEAL_START_TEMPERATURE = 2e-3;
+const double ANNEAL_END_TEMPERATURE = 2e-5;
+
+const char *strategy_name(Strategy strategy) {
+  return strategy == Strategy::Genetic ? "genetic" : "annealing";
+}
+
+// Proposes batches of candidate orders and learns from their unfitness.
+// compress() owns the budget and the best output, so strategies only deal
+// with genes.
+class SearchStrategy {
+public:
+  virtual ~SearchStrategy() = default;
+  virtual std::vector<Gene> propose(const SearchScheduler &scheduler) = 0;
+  // Receives the evaluated prefix of the last proposal.
+  virtual void update(std::vector<Gene> genes,
+                      const SearchScheduler &scheduler) = 0;
+};
+
+class GeneticStrategy : public SearchStrategy {
+public:
+  std::vector<Gene> propose(const SearchScheduler &scheduler) override {
+    std::vector<Gene> genes;
+    if (population.empty()) {
+      population_size = scheduler.population_size(POPULATION, CHILDREN);
+      for (int i = 0; i < population_size; i++) {
+        genes.push_back(Gene());
+      }
+      return genes;
+    }
 
-    std::vector<Gene> childs, new_population;
     std::vector<long long> partial_sum_unfitness;
     long long tot_unfitness = 0;
     for (auto &gene : population) {
@@ -2104,37 +2368,262 @@ td::BufferSlice compress(td::Slice data) {
       return population[ind];
     };
 
-    for (int i = 0; i < CHILDREN; i++) {
-      if (is_timeout()) {
-        break;
-      }
+    const int children = scheduler.children_count(CHILDREN);
+    for (int i = 0; i < children; i++) {
       auto child =
           merge(get_random_by_unfittness(), get_random_by_unfittness());
       child.mutate(rng() % MUTATION);
-      evalGene(child);
-      if (child.unfitness == -1)
-        return best;
-      if (is_timeout()) {
+      genes.push_back(child);
+    }
+    return genes;
+  }
+
+  void update(std::vector<Gene> genes, const SearchScheduler &) override {
+    std::stable_sort(genes.begin(), genes.end());
+    if ((int)genes.size() > population_size) {
+      genes.resize(population_size);
+    }
+    if (!genes.empty()) {
+      population = std::move(genes);
+    }
+  }
+
+private:
+  int population_size{0};
+  std::vector<Gene> population;
+};
+
+// Simulated annealing over block moves in the written order of cells. The
+// block of a cell is the cell itself followed by the run of its descendants
+// right after it. A move either relocates one block or swaps the blocks of
+// two sibling subtrees. Each round proposes one neighbour per thread and
+// applies the Metropolis rule to the best of them.
+class AnnealingStrategy : public SearchStrategy {
+public:
+  AnnealingStrategy(std::vector<std::vector<int>> children,
+                    std::vector<int> order, int unfitness)
+      : children(std::move(children)), current(std::move(order)),
+        current_unfitness(unfitness), start_unfitness(unfitness) {
+    int n = current.size();
+    parents.resize(n);
+    for (int i = 0; i < n; i++) {
+      for (int child : this->children[i]) {
+        parents[child].push_back(i);
+      }
+      if (this->children[i].size() >= 2) {
+        forks.push_back(i);
+      }
+    }
+    mark.assign(n, 0);
+    update_positions();
+  }
+
+  std::vector<Gene> propose(const SearchScheduler &) override {
+    std::vector<Gene> genes;
+    proposed.clear();
+    for (int i = 0; i < (DETERMINISTIC ? THREADS : 1); i++) {
+      auto order = current;
+      if (!(rng() % 2 && swap_siblings(order))) {
+        move_block(order);
+      }
+      genes.push_back(order_to_gene(order));
+      proposed.push_back(std::move(order));
+    }
+    return genes;
+  }
+
+  void update(std::vector<Gene> genes,
+              const SearchScheduler &scheduler) override {
+    if (genes.empty()) {
+      return;
+    }
+    int pick = std::min_element(genes.begin(), genes.end()) - genes.begin();
+    double delta = genes[pick].unfitness - current_unfitness;
+    double progress = scheduler.progress();
+    double temperature =
+        start_unfitness * ANNEAL_START_TEMPERATURE *
+        std::pow(ANNEAL_END_TEMPERATURE / ANNEAL_START_TEMPERATURE, progress);
+    if (delta <= 0 || rng() / 4294967296.0 < std::exp(-delta / temperature)) {
+      current = std::move(proposed[pick]);
+      current_unfitness = genes[pick].unfitness;
+      update_positions();
+    }
+  }
+
+private:
+  std::vector<std::vector<int>> children, parents;
+  std::vector<int> forks;
+  std::vector<int> current, pos;
+  std::vector<std::vector<int>> proposed;
+  std::vector<int> mark;
+  int epoch{0};
+  int current_unfitness, start_unfitness;
+
+  void update_positions() {
+    pos.resize(current.size());
+    for (int k = 0; k < (int)current.size(); k++) {
+      pos[current[k]] = k;
+    }
+  }
+
+  // End of the block starting at position l of the current order.
+  int block_end(int l) {
+    epoch++;
+    mark[current[l]] = epoch;
+    int r = l + 1;
+    for (; r < (int)current.size(); r++) {
+      bool inside = false;
+      for (int parent : parents[current[r]]) {
+        inside |= mark[parent] == epoch;
+      }
+      if (!inside) {
         break;
       }
-      childs.push_back(child);
+      mark[current[r]] = epoch;
     }
-    if (is_timeout()) {
-      break;
+    return r;
+  }
+
+  void move_block(std::vector<int> &order) {
+    int n = order.size();
+    int l = rng() % n;
+    int r = block_end(l);
+    if (r - l == n) {
+      return;
+    }
+    std::vector<int> block(order.begin() + l, order.begin() + r);
+    order.erase(order.begin() + l, order.begin() + r);
+    int to = rng() % (order.size() + 1);
+    order.insert(order.begin() + to, block.begin(), block.end());
+  }
+
+  bool swap_siblings(std::vector<int> &order) {
+    if (forks.empty()) {
+      return false;
+    }
+    const auto &siblings = children[forks[rng() % forks.size()]];
+    int a = siblings[rng() % siblings.size()];
+    int b = siblings[rng() % siblings.size()];
+    if (pos[a] > pos[b]) {
+      std::swap(a, b);
+    }
+    int la = pos[a], ra = block_end(la);
+    int lb = pos[b], rb = block_end(lb);
+    if (a == b || ra > lb) {
+      return false;
     }
+    std::vector<int> swapped(order.begin(), order.begin() + la);
+    swapped.insert(swapped.end(), order.begin() + lb, order.begin() + rb);
+    swapped.insert(swapped.end(), order.begin() + ra, order.begin() + lb);
+    swapped.insert(swapped.end(), order.begin() + la, order.begin() + ra);
+    swapped.insert(swapped.end(), order.begin() + rb, order.end());
+    order = std::move(swapped);
+    return true;
+  }
+};
+
+struct SearchStats {
+  std::size_t baseline_size{0};
+  std::size_t best_size{0};
+  int evaluations{0};
+  double cpu_seconds{0};
+};
+
+td::BufferSlice compress(td::Slice data, Strategy strategy = STRATEGY,
+                         SearchStats *stats = nullptr) {
+  const std::clock_t cpu_start = std::clock();
+  SearchScheduler scheduler =
+      DETERMINISTIC
+          ? SearchScheduler(SearchScheduler::evals_for_size(data.size()))
+          : SearchScheduler(TIME_BUDGET, BUDGET_IN_CPU_TIME);
+  scheduler.predict_from_size(data.size());
 
-    std::sort(childs.begin(), childs.end());
-    childs.resize(POPULATION);
+  td::Ref<vm::Cell> root = vm::std_boc_deserialize(data).move_as_ok();
+  if (DETERMINISTIC) {
+    seed_rng(root->get_hash());
+  }
+  OrderingWorkspace workspace;
+  workspace.import(root, 0).ensure();
 
-    population = std::move(childs);
+  td::BufferSlice best;
+  scheduler.measure([&] {
+    best = lzma_compress(workspace.serialize(Gene(false)));
+  });
+  if (stats) {
+    stats->baseline_size = best.length();
+  }
+
+  auto compressGene = [&](const Gene &gene) {
+    return lzma_compress(workspace.serialize(gene));
+  };
 
-    if (is_timeout()) {
+  // Evaluates the longest prefix of genes that fits into the budget and
+  // returns its length. In deterministic mode the prefix is compressed in
+  // parallel, and the best result is still picked in index order.
+  auto evalGenes = [&](std::vector<Gene> &genes) {
+    int n = 0;
+    std::vector<td::BufferSlice> compressed(genes.size());
+    if (DETERMINISTIC) {
+      n = scheduler.take(genes.size());
+      parallel_for(n, [&](int i) { compressed[i] = compressGene(genes[i]); });
+    } else {
+      while (n < (int)genes.size() &&
+             scheduler.run([&] { compressed[n] = compressGene(genes[n]); })) {
+        n++;
+      }
+    }
+    for (int i = 0; i < n; i++) {
+      genes[i].unfitness = compressed[i].length();
+      if (compressed[i].length() < best.length()) {
+        best = std::move(compressed[i]);
+      }
+    }
+    return n;
+  };
+
+  std::unique_ptr<SearchStrategy> search;
+  if (strategy == Strategy::Annealing) {
+    search = std::make_unique<AnnealingStrategy>(
+        workspace.children(), gene_to_order(Gene(false)), best.length());
+  } else {
+    search = std::make_unique<GeneticStrategy>();
+  }
+
+  while (true) {
+    auto genes = search->propose(scheduler);
+    int proposed = genes.size();
+    genes.resize(evalGenes(genes));
+    bool out_of_budget = (int)genes.size() < proposed;
+    search->update(std::move(genes), scheduler);
+    if (out_of_budget) {
       break;
     }
   }
+
+  if (stats) {
+    stats->best_size = best.length();
+    stats->evaluations = scheduler.evaluations();
+    stats->cpu_seconds =
+        static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+  }
   return best;
 }
 
+// Runs every strategy on the same block and prints one line per strategy:
+// name, baseline size, best size, evaluations, CPU seconds and the
+// improvement in bytes per CPU-second.
+void bench(td::Slice data) {
+  for (auto strategy : {Strategy::Genetic, Strategy::Annealing}) {
+    SearchStats stats;
+    compress(data, strategy, &stats);
+    double gain = static_cast<double>(stats.baseline_size) - stats.best_size;
+    std::cout << strategy_name(strategy) << ' ' << stats.baseline_size << ' '
+              << stats.best_size << ' ' << stats.evaluations << ' '
+              << stats.cpu_seconds << ' ' << gain / stats.cpu_seconds
+              << std::endl;
+  }
+}
+
 td::BufferSlice decompress(td::Slice data) {
   td::BufferSlice serialized = lzma_decompress(data, 2 << 20).move_as_ok();
   auto root = my_std_boc_deserialize(serialized).move_as_ok();
@@ -2144,7 +2633,7 @@ td::BufferSlice decompress(td::Slice data) {
 int main() {
   std::string mode;
   std::cin >> mode;
-  CHECK(mode == "compress" || mode == "decompress");
+  CHECK(mode == "compress" || mode == "decompress" || mode == "bench");
 
   std::string base64_data;
   std::cin >> base64_data;
@@ -2152,6 +2641,11 @@ int main() {
 
   td::BufferSlice data(td::base64_decode(base64_data).move_as_ok());
 
+  if (mode == "bench") {
+    bench(data);
+    return 0;
+  }
+
   if (mode == "compress") {
     data = compress(data);
   } else {
@@ -0,0 +1,3430 @@
+#include <stddef.h>
+#include <stdint.h>
+int tinyLzmaEncodeRaw(const uint8_t *p_src, size_t src_len, uint8_t *p_dst,
+                      size_t *p_dst_len, uint8_t lc, uint8_t lp, uint8_t pb);
+#define R_OK 0
+#define R_ERR_MEMORY_RUNOUT 1
+#define R_ERR_UNSUPPORTED 2
+#define R_ERR_OUTPUT_OVERFLOW 3
+#include <stdlib.h>
+#include <string.h>
+#define RET_IF_ERROR(expression)                                               \
+  {                                                                            \
+    int res = (expression);                                                    \
+    if (res != R_OK)                                                           \
+      return res;                                                              \
+  }
+static uint32_t bitsReverse(uint32_t bits, uint32_t bit_count) {
+  uint32_t revbits = 0;
+  for (; bit_count > 0; bit_count--) {
+    revbits <<= 1;
+    revbits |= (bits & 1);
+    bits >>= 1;
+  }
+  return revbits;
+}
+static uint32_t countBit(uint32_t val) {
+  uint32_t count = 0;
+  for (; val != 0; val >>= 1)
+    count++;
+  return count;
+}
+#define RANGE_CODE_NORMALIZE_THRESHOLD (1 << 24)
+#define RANGE_CODE_MOVE_BITS 5
+#define RANGE_CODE_N_BIT_MODEL_TOTAL_BITS 11
+#define RANGE_CODE_BIT_MODEL_TOTAL (1 << RANGE_CODE_N_BIT_MODEL_TOTAL_BITS)
+#define RANGE_CODE_HALF_PROBABILITY (RANGE_CODE_BIT_MODEL_TOTAL >> 1)
+#define RANGE_CODE_CACHE_SIZE_MAX (~((size_t)0))
+typedef struct {
+  uint8_t overflow;
+  uint8_t cache;
+  uint8_t low_msb;
+  uint32_t low_lsb;
+  uint32_t range;
+  size_t cache_size;
+  uint8_t *p_dst;
+  uint8_t *p_dst_limit;
+} RangeEncoder_t;
+static RangeEncoder_t newRangeEncoder(uint8_t *p_dst, size_t dst_len) {
+  RangeEncoder_t coder;
+  coder.cache = 0;
+  coder.low_msb = 0;
+  coder.low_lsb = 0;
+  coder.range = 0xFFFFFFFF;
+  coder.cache_size = 1;
+  coder.p_dst = p_dst;
+  coder.p_dst_limit = p_dst + dst_len;
+  coder.overflow = 0;
+  return coder;
+}
+static void rangeEncodeOutByte(RangeEncoder_t *e, uint8_t byte) {
+  if (e->p_dst != e->p_dst_limit)
+    *(e->p_dst++) = byte;
+  else
+    e->overflow = 1;
+}
+static void rangeEncodeNormalize(RangeEncoder_t *e) {
+  if (e->range < RANGE_CODE_NORMALIZE_THRESHOLD) {
+    if (e->low_msb) {
+      rangeEncodeOutByte(e, e->cache + 1);
+      for (; e->cache_size > 1; e->cache_size--)
+        rangeEncodeOutByte(e, 0x00);
+      e->cache = (uint8_t)((e->low_lsb) >> 24);
+      e->cache_size = 0;
+    } else if (e->low_lsb < 0xFF000000) {
+      rangeEncodeOutByte(e, e->cache);
+      for (; e->cache_size > 1; e->cache_size--)
+        rangeEncodeOutByte(e, 0xFF);
+      e->cache = (uint8_t)((e->low_lsb) >> 24);
+      e->cache_size = 0;
+    }
+    if (e->cache_size < RANGE_CODE_CACHE_SIZE_MAX)
+      e->cache_size++;
+    e->low_msb = 0;
+    e->low_lsb <<= 8;
+    e->range <<= 8;
+  }
+}
+static void rangeEncodeTerminate(RangeEncoder_t *e) {
+  e->range = 0;
+  rangeEncodeNormalize(e);
+  rangeEncodeNormalize(e);
+  rangeEncodeNormalize(e);
+  rangeEncodeNormalize(e);
+  rangeEncodeNormalize(e);
+  rangeEncodeNormalize(e);
+}
+static void rangeEncodeIntByFixedProb(RangeEncoder_t *e, uint32_t val,
+                                      uint32_t bit_count) {
+  for (; bit_count > 0; bit_count--) {
+    uint8_t bit = 1 & (val >> (bit_count - 1));
+    rangeEncodeNormalize(e);
+    e->range >>= 1;
+    if (bit) {
+      if ((e->low_lsb + e->range) < e->low_lsb)
+        e->low_msb = 1;
+      e->low_lsb += e->range;
+    }
+  }
+}
+static void rangeEncodeBit(RangeEncoder_t *e, uint16_t *p_prob, uint8_t bit) {
+  uint32_t prob = *p_prob;
+  uint32_t bound;
+  rangeEncodeNormalize(e);
+  bound = (e->range >> RANGE_CODE_N_BIT_MODEL_TOTAL_BITS) * prob;
+  if (!bit) {
+    e->range = bound;
+    *p_prob = (uint16_t)(prob + ((RANGE_CODE_BIT_MODEL_TOTAL - prob) >>
+                                 RANGE_CODE_MOVE_BITS));
+  } else {
+    e->range -= bound;
+    if ((e->low_lsb + bound) < e->low_lsb)
+      e->low_msb = 1;
+    e->low_lsb += bound;
+    *p_prob = (uint16_t)(prob - (prob >> RANGE_CODE_MOVE_BITS));
+  }
+}
+static void rangeEncodeInt(RangeEncoder_t *e, uint16_t *p_prob, uint32_t val,
+                           uint32_t bit_count) {
+  uint32_t treepos = 1;
+  for (; bit_count > 0; bit_count--) {
+    uint8_t bit = (uint8_t)(1 & (val >> (bit_count - 1)));
+    rangeEncodeBit(e, p_prob + (treepos - 1), bit);
+    treepos <<= 1;
+    if (bit)
+      treepos |= 1;
+  }
+}
+static void rangeEncodeMB(RangeEncoder_t *e, uint16_t *p_prob, uint32_t byte,
+                          uint32_t match_byte) {
+  uint32_t i, treepos = 1, off0 = 0x100, off1;
+  for (i = 0; i < 8; i++) {
+    uint8_t bit = (uint8_t)(1 & (byte >> 7));
+    byte <<= 1;
+    match_byte <<= 1;
+    off1 = off0;
+    off0 &= match_byte;
+    rangeEncodeBit(e, p_prob + (off0 + off1 + treepos - 1), bit);
+    treepos <<= 1;
+    if (bit)
+      treepos |= 1;
+    else
+      off0 ^= off1;
+  }
+}
+#define LZ_LEN_MAX 273
+#define LZ_DIST_MAX_PLUS1 0x40000000
+#define HASH_LEVEL 2
+#define HASH_N_MIN 12
+#define HASH_N_MAX 23
+#define INVALID_HASH_ITEM (~((size_t)0))
+static uint32_t getHashBits(size_t src_len) {
+  uint32_t hash_n = HASH_N_MIN;
+  while (hash_n < HASH_N_MAX && ((size_t)1 << hash_n) < src_len)
+    hash_n++;
+  return hash_n;
+}
+static uint32_t getHash(const uint8_t *p_src, size_t src_len, size_t pos,
+                        uint32_t hash_mask) {
+  if (pos >= src_len || pos + 1 == src_len || pos + 2 == src_len)
+    return 0;
+  else
+    return ((p_src[pos + 2] << 16) + (p_src[pos + 1] << 8) + p_src[pos]) &
+           hash_mask;
+}
+static void updateHashTable(const uint8_t *p_src, size_t src_len, size_t pos,
+                            size_t hash_table[][HASH_LEVEL],
+                            uint32_t hash_mask) {
+  const uint32_t hash = getHash(p_src, src_len, pos, hash_mask);
+  uint32_t i, oldest_i = 0;
+  size_t oldest_pos = INVALID_HASH_ITEM;
+  if (pos >= src_len)
+    return;
+  for (i = 0; i < HASH_LEVEL; i++) {
+    if (hash_table[hash][i] == INVALID_HASH_ITEM) {
+      hash_table[hash][i] = pos;
+      return;
+    }
+    if (oldest_pos > hash_table[hash][i]) {
+      oldest_pos = hash_table[hash][i];
+      oldest_i = i;
+    }
+  }
+  hash_table[hash][oldest_i] = pos;
+}
+static uint32_t lenDistScore(uint32_t len, uint32_t dist, uint32_t rep0,
+                             uint32_t rep1, uint32_t rep2, uint32_t rep3) {
+  static const uint32_t TABLE_THRESHOLDS[] = {
+      12 * 12 * 12 * 12 * 12 * 5, 12 * 12 * 12 * 12 * 4, 12 * 12 * 12 * 3,
+      12 * 12 * 2, 12};
+  uint32_t score;
+  if (dist == rep0 || dist == rep1 || dist == rep2 || dist == rep3) {
+    score = 5;
+  } else {
+    for (score = 4; score > 0; score--)
+      if (dist <= TABLE_THRESHOLDS[score])
+        break;
+  }
+  if (len < 2)
+    return 8 + 5;
+  else if (len == 2)
+    return 8 + score + 1;
+  else
+    return 8 + score + len;
+}
+static void lzSearchMatch(const uint8_t *p_src, size_t src_len, size_t pos,
+                          size_t hash_table[][HASH_LEVEL], uint32_t hash_mask,
+                          uint32_t *p_len, uint32_t *p_dist) {
+  const uint32_t len_max =
+      ((src_len - pos) < LZ_LEN_MAX) ? (src_len - pos) : LZ_LEN_MAX;
+  const uint32_t hash = getHash(p_src, src_len, pos, hash_mask);
+  uint32_t i, j, score1, score2;
+  *p_len = 0;
+  *p_dist = 0;
+  score1 = lenDistScore(0, 0xFFFFFFFF, 0, 0, 0, 0);
+  for (i = 0; i < HASH_LEVEL + 2; i++) {
+    size_t ppos =
+        (i < HASH_LEVEL) ? hash_table[hash][i] : (pos - 1 - (i - HASH_LEVEL));
+    if (ppos != INVALID_HASH_ITEM && ppos < pos &&
+        (pos - ppos) < LZ_DIST_MAX_PLUS1) {
+      for (j = 0; j < len_max; j++)
+        if (p_src[pos + j] != p_src[ppos + j])
+          break;
+      score2 = lenDistScore(j, (pos - ppos), 0, 0, 0, 0);
+      if (j >= 2 && score1 < score2) {
+        score1 = score2;
+        *p_len = j;
+        *p_dist = pos - ppos;
+      }
+    }
+  }
+}
+static void lzSearchRep(const uint8_t *p_src, size_t src_len, size_t pos,
+                        uint32_t rep0, uint32_t rep1, uint32_t rep2,
+                        uint32_t rep3, uint32_t len_limit, uint32_t *p_len,
+                        uint32_t *p_dist) {
+  uint32_t len_max =
+      ((src_len - pos) < LZ_LEN_MAX) ? (src_len - pos) : LZ_LEN_MAX;
+  uint32_t reps[4];
+  uint32_t i, j;
+  if (len_max > len_limit)
+    len_max = len_limit;
+  reps[0] = rep0;
+  reps[1] = rep1;
+  reps[2] = rep2;
+  reps[3] = rep3;
+  *p_len = 0;
+  *p_dist = 0;
+  for (i = 0; i < 4; i++) {
+    if (reps[i] <= pos) {
+      size_t ppos = pos - reps[i];
+      for (j = 0; j < len_max; j++)
+        if (p_src[pos + j] != p_src[ppos + j])
+          break;
+      if (j >= 2 && j > *p_len) {
+        *p_len = j;
+        *p_dist = reps[i];
+      }
+    }
+  }
+}
+static void lzSearch(const uint8_t *p_src, size_t src_len, size_t pos,
+                     uint32_t rep0, uint32_t rep1, uint32_t rep2, uint32_t rep3,
+                     size_t hash_table[][HASH_LEVEL], uint32_t hash_mask,
+                     uint32_t *p_len, uint32_t *p_dist) {
+  uint32_t rlen, rdist;
+  uint32_t mlen, mdist;
+  lzSearchRep(p_src, src_len, pos, rep0, rep1, rep2, rep3, 0xFFFFFFFF, &rlen,
+              &rdist);
+  lzSearchMatch(p_src, src_len, pos, hash_table, hash_mask, &mlen, &mdist);
+  if (lenDistScore(rlen, rdist, rep0, rep1, rep2, rep3) >=
+      lenDistScore(mlen, mdist, rep0, rep1, rep2, rep3)) {
+    *p_len = rlen;
+    *p_dist = rdist;
+  } else {
+    *p_len = mlen;
+    *p_dist = mdist;
+  }
+}
+static uint8_t isShortRep(const uint8_t *p_src, size_t src_len, size_t pos,
+                          uint32_t rep0) {
+  return (pos >= rep0 && (p_src[pos] == p_src[pos - rep0])) ? 1 : 0;
+}
+typedef enum {
+  PKT_LIT,
+  PKT_MATCH,
+  PKT_SHORTREP,
+  PKT_REP0,
+  PKT_REP1,
+  PKT_REP2,
+  PKT_REP3
+} PACKET_t;
+static uint8_t stateTransition(uint8_t state, PACKET_t type) {
+  switch (state) {
+  case 0:
+    return (type == PKT_LIT)        ? 0
+           : (type == PKT_MATCH)    ? 7
+           : (type == PKT_SHORTREP) ? 9
+                                    : 8;
+  case 1:
+    return (type == PKT_LIT)        ? 0
+           : (type == PKT_MATCH)    ? 7
+           : (type == PKT_SHORTREP) ? 9
+                                    : 8;
+  case 2:
+    return (type == PKT_LIT)        ? 0
+           : (type == PKT_MATCH)    ? 7
+           : (type == PKT_SHORTREP) ? 9
+                                    : 8;
+  case 3:
+    return (type == PKT_LIT)        ? 0
+           : (type == PKT_MATCH)    ? 7
+           : (type == PKT_SHORTREP) ? 9
+                                    : 8;
+  case 4:
+    return (type == PKT_LIT)        ? 1
+           : (type == PKT_MATCH)    ? 7
+           : (type == PKT_SHORTREP) ? 9
+                                    : 8;
+  case 5:
+    return (type == PKT_LIT)        ? 2
+           : (type == PKT_MATCH)    ? 7
+           : (type == PKT_SHORTREP) ? 9
+                                    : 8;
+  case 6:
+    return (type == PKT_LIT)        ? 3
+           : (type == PKT_MATCH)    ? 7
+           : (type == PKT_SHORTREP) ? 9
+                                    : 8;
+  case 7:
+    return (type == PKT_LIT)        ? 4
+           : (type == PKT_MATCH)    ? 10
+           : (type == PKT_SHORTREP) ? 11
+                                    : 11;
+  case 8:
+    return (type == PKT_LIT)        ? 5
+           : (type == PKT_MATCH)    ? 10
+           : (type == PKT_SHORTREP) ? 11
+                                    : 11;
+  case 9:
+    return (type == PKT_LIT)        ? 6
+           : (type == PKT_MATCH)    ? 10
+           : (type == PKT_SHORTREP) ? 11
+                                    : 11;
+  case 10:
+    return (type == PKT_LIT)        ? 4
+           : (type == PKT_MATCH)    ? 10
+           : (type == PKT_SHORTREP) ? 11
+                                    : 11;
+  case 11:
+    return (type == PKT_LIT)        ? 5
+           : (type == PKT_MATCH)    ? 10
+           : (type == PKT_SHORTREP) ? 11
+                                    : 11;
+  default:
+    return 0xFF;
+  }
+}
+#define N_STATES 12
+#define N_LIT_STATES 7
+#define MAX_LC 8
+#define MAX_LP 4
+#define MAX_PB 4
+#define N_POS_STATES (1 << MAX_PB)
+#define N_LIT_PROBS (3 * (1 << 8))
+#define INIT_PROBS(probs)                                                      \
+  {                                                                            \
+    uint16_t *p = (uint16_t *)(probs);                                         \
+    uint16_t *q = p + (sizeof(probs) / sizeof(uint16_t));                      \
+    for (; p < q; p++)                                                         \
+      *p = RANGE_CODE_HALF_PROBABILITY;                                        \
+  }
+static int lzmaEncode(const uint8_t *p_src, size_t src_len, uint8_t *p_dst,
+                      size_t *p_dst_len, uint8_t with_end_mark, uint8_t lc,
+                      uint8_t lp, uint8_t pb) {
+  const uint8_t lc_shift = (8 - lc);
+  const uint32_t lc_mask = (1 << lc) - 1;
+  const uint32_t lp_mask = (1 << lp) - 1;
+  const uint32_t pb_mask = (1 << pb) - 1;
+  const uint32_t hash_n = getHashBits(src_len);
+  const uint32_t hash_mask = (1 << hash_n) - 1;
+  uint8_t state = 0;
+  size_t pos = 0;
+  uint32_t rep0 = 1;
+  uint32_t rep1 = 1;
+  uint32_t rep2 = 1;
+  uint32_t rep3 = 1;
+  uint32_t n_bypass = 0, len_bypass = 0, dist_bypass = 0;
+  RangeEncoder_t coder = newRangeEncoder(p_dst, *p_dst_len);
+  uint16_t probs_is_match[N_STATES][N_POS_STATES];
+  uint16_t probs_is_rep[N_STATES];
+  uint16_t probs_is_rep0[N_STATES];
+  uint16_t probs_is_rep0_long[N_STATES][N_POS_STATES];
+  uint16_t probs_is_rep1[N_STATES];
+  uint16_t probs_is_rep2[N_STATES];
+  uint16_t *probs_literal;
+  uint16_t probs_dist_slot[4][(1 << 6) - 1];
+  uint16_t probs_dist_special[10][(1 << 5) - 1];
+  uint16_t probs_dist_align[(1 << 4) - 1];
+  uint16_t probs_len_choice[2];
+  uint16_t probs_len_choice2[2];
+  uint16_t probs_len_low[2][N_POS_STATES][(1 << 3) - 1];
+  uint16_t probs_len_mid[2][N_POS_STATES][(1 << 3) - 1];
+  uint16_t probs_len_high[2][(1 << 8) - 1];
+  size_t(*hash_table)[HASH_LEVEL];
+  size_t n_literal_probs = ((size_t)N_LIT_PROBS << (lc + lp));
+  size_t i_literal;
+  hash_table = (size_t(*)[HASH_LEVEL])malloc(sizeof(size_t) * HASH_LEVEL
+                                             << hash_n);
+  if (hash_table == 0)
+    return R_ERR_MEMORY_RUNOUT;
+  memset(hash_table, 0xFF, sizeof(size_t) * HASH_LEVEL << hash_n);
+  probs_literal = (uint16_t *)malloc(sizeof(uint16_t) * n_literal_probs);
+  if (probs_literal == 0) {
+    free(hash_table);
+    return R_ERR_MEMORY_RUNOUT;
+  }
+  for (i_literal = 0; i_literal < n_literal_probs; i_literal++)
+    probs_literal[i_literal] = RANGE_CODE_HALF_PROBABILITY;
+  INIT_PROBS(probs_is_match);
+  INIT_PROBS(probs_is_rep);
+  INIT_PROBS(probs_is_rep0);
+  INIT_PROBS(probs_is_rep0_long);
+  INIT_PROBS(probs_is_rep1);
+  INIT_PROBS(probs_is_rep2);
+  INIT_PROBS(probs_dist_slot);
+  INIT_PROBS(probs_dist_special);
+  INIT_PROBS(probs_dist_align);
+  INIT_PROBS(probs_len_choice);
+  INIT_PROBS(probs_len_choice2);
+  INIT_PROBS(probs_len_low);
+  INIT_PROBS(probs_len_mid);
+  INIT_PROBS(probs_len_high);
+  while (!coder.overflow) {
+    const uint32_t lit_pos_state = lp_mask & (uint32_t)pos;
+    const uint32_t pos_state = pb_mask & (uint32_t)pos;
+    uint32_t curr_byte = 0, match_byte = 0, prev_byte_lc_msbs = 0;
+    uint32_t dist = 0, len = 0;
+    PACKET_t type;
+    if (pos < src_len)
+      curr_byte = p_src[pos];
+    if (pos > 0) {
+      match_byte = p_src[pos - rep0];
+      prev_byte_lc_msbs = (p_src[pos - 1] >> lc_shift) & lc_mask;
+    }
+    if (pos >= src_len) {
+      if (!with_end_mark)
+        break;
+      with_end_mark = 0;
+      type = PKT_MATCH;
+      len = 2;
+      dist = 0;
+    } else {
+      if (n_bypass > 0) {
+        len = 0;
+        dist = 0;
+        n_bypass--;
+      } else if (len_bypass > 0) {
+        len = len_bypass;
+        dist = dist_bypass;
+        len_bypass = 0;
+        dist_bypass = 0;
+      } else {
+        lzSearch(p_src, src_len, pos, rep0, rep1, rep2, rep3, hash_table,
+                 hash_mask, &len, &dist);
+        if ((src_len - pos) > 8 && len >= 2) {
+          const uint32_t score0 =
+              lenDistScore(len, dist, rep0, rep1, rep2, rep3);
+          uint32_t len1 = 0, dist1 = 0, score1 = 0;
+          uint32_t len2 = 0, dist2 = 0, score2 = 0;
+          lzSearch(p_src, src_len, pos + 1, rep0, rep1, rep2, rep3, hash_table,
+                   hash_mask, &len1, &dist1);
+          score1 = lenDistScore(len1, dist1, rep0, rep1, rep2, rep3);
+          if (len >= 3) {
+            lzSearch(p_src, src_len, pos + 2, rep0, rep1, rep2, rep3,
+                     hash_table, hash_mask, &len2, &dist2);
+            score2 = lenDistScore(len2, dist2, rep0, rep1, rep2, rep3) - 1;
+          }
+          if (score2 > score0 && score2 > score1) {
+            len = 0;
+            dist = 0;
+            lzSearchRep(p_src, src_len, pos, rep0, rep1, rep2, rep3, 2, &len,
+                        &dist);
+            len_bypass = len2;
+            dist_bypass = dist2;
+            n_bypass = (len < 2) ? 1 : 0;
+          } else if (score1 > score0) {
+            len = 0;
+            dist = 0;
+            len_bypass = len1;
+            dist_bypass = dist1;
+            n_bypass = 0;
+          }
+        }
+      }
+      if (len < 2) {
+        type = isShortRep(p_src, src_len, pos, rep0) ? PKT_SHORTREP : PKT_LIT;
+      } else if (dist == rep0) {
+        type = PKT_REP0;
+      } else if (dist == rep1) {
+        type = PKT_REP1;
+        rep1 = rep0;
+        rep0 = dist;
+      } else if (dist == rep2) {
+        type = PKT_REP2;
+        rep2 = rep1;
+        rep1 = rep0;
+        rep0 = dist;
+      } else if (dist == rep3) {
+        type = PKT_REP3;
+        rep3 = rep2;
+        rep2 = rep1;
+        rep1 = rep0;
+        rep0 = dist;
+      } else {
+        type = PKT_MATCH;
+        rep3 = rep2;
+        rep2 = rep1;
+        rep1 = rep0;
+        rep0 = dist;
+      }
+      {
+        const size_t pos2 =
+            pos + ((type == PKT_LIT || type == PKT_SHORTREP) ? 1 : len);
+        for (; pos < pos2; pos++)
+          updateHashTable(p_src, src_len, pos, hash_table, hash_mask);
+      }
+    }
+    switch (type) {
+    case PKT_LIT:
+      rangeEncodeBit(&coder, &probs_is_match[state][pos_state], 0);
+      break;
+    case PKT_MATCH:
+      rangeEncodeBit(&coder, &probs_is_match[state][pos_state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep[state], 0);
+      break;
+    case PKT_SHORTREP:
+      rangeEncodeBit(&coder, &probs_is_match[state][pos_state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep0[state], 0);
+      rangeEncodeBit(&coder, &probs_is_rep0_long[state][pos_state], 0);
+      break;
+    case PKT_REP0:
+      rangeEncodeBit(&coder, &probs_is_match[state][pos_state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep0[state], 0);
+      rangeEncodeBit(&coder, &probs_is_rep0_long[state][pos_state], 1);
+      break;
+    case PKT_REP1:
+      rangeEncodeBit(&coder, &probs_is_match[state][pos_state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep0[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep1[state], 0);
+      break;
+    case PKT_REP2:
+      rangeEncodeBit(&coder, &probs_is_match[state][pos_state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep0[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep1[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep2[state], 0);
+      break;
+    default:
+      rangeEncodeBit(&coder, &probs_is_match[state][pos_state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep0[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep1[state], 1);
+      rangeEncodeBit(&coder, &probs_is_rep2[state], 1);
+      break;
+    }
+    if (type == PKT_LIT) {
+      uint16_t *probs =
+          probs_literal +
+          ((lit_pos_state << lc) + prev_byte_lc_msbs) * N_LIT_PROBS;
+      if (state < N_LIT_STATES)
+        rangeEncodeInt(&coder, probs, curr_byte, 8);
+      else
+        rangeEncodeMB(&coder, probs, curr_byte, match_byte);
+    }
+    if (type == PKT_MATCH || type == PKT_REP0 || type == PKT_REP1 ||
+        type == PKT_REP2 || type == PKT_REP3) {
+      const uint8_t isrep = (type != PKT_MATCH);
+      if (len < 10) {
+        rangeEncodeBit(&coder, &probs_len_choice[isrep], 0);
+        rangeEncodeInt(&coder, probs_len_low[isrep][pos_state], len - 2, 3);
+      } else if (len < 18) {
+        rangeEncodeBit(&coder, &probs_len_choice[isrep], 1);
+        rangeEncodeBit(&coder, &probs_len_choice2[isrep], 0);
+        rangeEncodeInt(&coder, probs_len_mid[isrep][pos_state], len - 10, 3);
+      } else {
+        rangeEncodeBit(&coder, &probs_len_choice[isrep], 1);
+        rangeEncodeBit(&coder, &probs_len_choice2[isrep], 1);
+        rangeEncodeInt(&coder, probs_len_high[isrep], len - 18, 8);
+      }
+    }
+    if (type == PKT_MATCH) {
+      const uint32_t len_min5_minus2 = (len > 5) ? 3 : (len - 2);
+      uint32_t dist_slot, bcnt, bits;
+      dist--;
+      if (dist < 4) {
+        dist_slot = dist;
+      } else {
+        dist_slot = countBit(dist) - 1;
+        dist_slot = (dist_slot << 1) | ((dist >> (dist_slot - 1)) & 1);
+      }
+      rangeEncodeInt(&coder, probs_dist_slot[len_min5_minus2], dist_slot, 6);
+      bcnt = (dist_slot >> 1) - 1;
+      if (dist_slot >= 14) {
+        bcnt -= 4;
+        bits = (dist >> 4) & ((1 << bcnt) - 1);
+        rangeEncodeIntByFixedProb(&coder, bits, bcnt);
+        bits = dist & ((1 << 4) - 1);
+        bits = bitsReverse(bits, 4);
+        rangeEncodeInt(&coder, probs_dist_align, bits, 4);
+      } else if (dist_slot >= 4) {
+        bits = dist & ((1 << bcnt) - 1);
+        bits = bitsReverse(bits, bcnt);
+        rangeEncodeInt(&coder, probs_dist_special[dist_slot - 4], bits, bcnt);
+      }
+    }
+    state = stateTransition(state, type);
+  }
+  free(hash_table);
+  free(probs_literal);
+  rangeEncodeTerminate(&coder);
+  if (coder.overflow)
+    return R_ERR_OUTPUT_OVERFLOW;
+  *p_dst_len = coder.p_dst - p_dst;
+  return R_OK;
+}
+// Raw LZMA stream without the 13-byte header; lc/lp/pb and the uncompressed
+// size are stored by the caller.
+int tinyLzmaEncodeRaw(const uint8_t *p_src, size_t src_len, uint8_t *p_dst,
+                      size_t *p_dst_len, uint8_t lc, uint8_t lp, uint8_t pb) {
+  if (lc > MAX_LC || lp > MAX_LP || pb > MAX_PB)
+    return R_ERR_UNSUPPORTED;
+  return lzmaEncode(p_src, src_len, p_dst, p_dst_len, 0, lc, lp, pb);
+}
+#include <stddef.h>
+#include <stdint.h>
+int tinyLzmaDecodeRaw(const uint8_t *p_src, size_t src_len, uint8_t *p_dst,
+                      size_t *p_dst_len, uint8_t lc, uint8_t lp, uint8_t pb);
+#define R_OK 0
+#define R_ERR_MEMORY_RUNOUT 1
+#define R_ERR_UNSUPPORTED 2
+#define R_ERR_OUTPUT_OVERFLOW 3
+#define R_ERR_INPUT_OVERFLOW 4
+#define R_ERR_DATA 5
+#define R_ERR_OUTPUT_LEN_MISMATCH 6
+#include <stdlib.h>
+#define RET_IF_ERROR(expression)                                               \
+  {                                                                            \
+    int res = (expression);                                                    \
+    if (res != R_OK)                                                           \
+      return res;                                                              \
+  }
+#define RANGE_CODE_NORMALIZE_THRESHOLD (1 << 24)
+#define RANGE_CODE_MOVE_BITS 5
+#define RANGE_CODE_N_BIT_MODEL_TOTAL_BITS 11
+#define RANGE_CODE_BIT_MODEL_TOTAL (1 << RANGE_CODE_N_BIT_MODEL_TOTAL_BITS)
+#define RANGE_CODE_HALF_PROBABILITY (RANGE_CODE_BIT_MODEL_TOTAL >> 1)
+typedef struct {
+  uint32_t code;
+  uint32_t range;
+  const uint8_t *p_src;
+  const uint8_t *p_src_limit;
+  uint8_t overflow;
+} RangeDecoder_t;
+static void rangeDecodeNormalize(RangeDecoder_t *d) {
+  if (d->range < RANGE_CODE_NORMALIZE_THRESHOLD) {
+    if (d->p_src != d->p_src_limit) {
+      d->range <<= 8;
+      d->code <<= 8;
+      d->code |= (uint32_t)(*(d->p_src));
+      d->p_src++;
+    } else {
+      d->overflow = 1;
+    }
+  }
+}
+static RangeDecoder_t newRangeDecoder(const uint8_t *p_src, size_t src_len) {
+  RangeDecoder_t coder;
+  coder.code = 0;
+  coder.range = 0;
+  coder.p_src = p_src;
+  coder.p_src_limit = p_src + src_len;
+  coder.overflow = 0;
+  rangeDecodeNormalize(&coder);
+  rangeDecodeNormalize(&coder);
+  rangeDecodeNormalize(&coder);
+  rangeDecodeNormalize(&coder);
+  rangeDecodeNormalize(&coder);
+  coder.range = 0xFFFFFFFF;
+  return coder;
+}
+static uint32_t rangeDecodeIntByFixedProb(RangeDecoder_t *d,
+                                          uint32_t bit_count) {
+  uint32_t val = 0, b;
+  for (; bit_count > 0; bit_count--) {
+    rangeDecodeNormalize(d);
+    d->range >>= 1;
+    d->code -= d->range;
+    b = !(1 & (d->code >> 31));
+    if (!b)
+      d->code += d->range;
+    val <<= 1;
+    val |= b;
+  }
+  return val;
+}
+static uint32_t rangeDecodeBit(RangeDecoder_t *d, uint16_t *p_prob) {
+  uint32_t prob = *p_prob;
+  uint32_t bound;
+  rangeDecodeNormalize(d);
+  bound = (d->range >> RANGE_CODE_N_BIT_MODEL_TOTAL_BITS) * prob;
+  if (d->code < bound) {
+    d->range = bound;
+    *p_prob = (uint16_t)(prob + ((RANGE_CODE_BIT_MODEL_TOTAL - prob) >>
+                                 RANGE_CODE_MOVE_BITS));
+    return 0;
+  } else {
+    d->range -= bound;
+    d->code -= bound;
+    *p_prob = (uint16_t)(prob - (prob >> RANGE_CODE_MOVE_BITS));
+    return 1;
+  }
+}
+static uint32_t rangeDecodeInt(RangeDecoder_t *d, uint16_t *p_prob,
+                               uint32_t bit_count) {
+  uint32_t val = 1;
+  uint32_t i;
+  for (i = 0; i < bit_count; i++) {
+    if (!rangeDecodeBit(d, p_prob + val - 1)) {
+      val <<= 1;
+    } else {
+      val <<= 1;
+      val |= 1;
+    }
+  }
+  return val & ((1 << bit_count) - 1);
+}
+static uint32_t rangeDecodeMB(RangeDecoder_t *d, uint16_t *p_prob,
+                              uint32_t match_byte) {
+  uint32_t i, val = 1, off0 = 0x100, off1;
+  for (i = 0; i < 8; i++) {
+    match_byte <<= 1;
+    off1 = off0;
+    off0 &= match_byte;
+    if (!rangeDecodeBit(d, (p_prob + (off0 + off1 + val - 1)))) {
+      val <<= 1;
+      off0 ^= off1;
+    } else {
+      val <<= 1;
+      val |= 1;
+    }
+  }
+  return val & 0xFF;
+}
+#define N_STATES 12
+#define N_LIT_STATES 7
+#define MAX_LC 8
+#define N_PREV_BYTE_LC_MSBS (1 << MAX_LC)
+#define MAX_LP 4
+#define N_LIT_POS_STATES (1 << MAX_LP)
+#define MAX_PB 4
+#define N_POS_STATES (1 << MAX_PB)
+#define INIT_PROBS(probs)                                                      \
+  {                                                                            \
+    uint16_t *p = (uint16_t *)(probs);                                         \
+    uint16_t *q = p + (sizeof(probs) / sizeof(uint16_t));                      \
+    for (; p < q; p++)                                                         \
+      *p = RANGE_CODE_HALF_PROBABILITY;                                        \
+  }
+#define INIT_PROBS_LITERAL(probs)                                              \
+  {                                                                            \
+    uint16_t *p = (uint16_t *)(probs);                                         \
+    uint16_t *q = p + (N_LIT_POS_STATES * N_PREV_BYTE_LC_MSBS * 3 * (1 << 8)); \
+    for (; p < q; p++)                                                         \
+      *p = RANGE_CODE_HALF_PROBABILITY;                                        \
+  }
+static int lzmaDecode(const uint8_t *p_src, size_t src_len, uint8_t *p_dst,
+                      size_t *p_dst_len, uint8_t lc, uint8_t lp, uint8_t pb) {
+  const uint8_t lc_shift = (8 - lc);
+  const uint8_t lc_mask = (1 << lc) - 1;
+  const uint8_t lp_mask = (1 << lp) - 1;
+  const uint8_t pb_mask = (1 << pb) - 1;
+  uint8_t prev_byte = 0;
+  uint8_t state = 0;
+  size_t pos = 0;
+  uint32_t rep0 = 1;
+  uint32_t rep1 = 1;
+  uint32_t rep2 = 1;
+  uint32_t rep3 = 1;
+  RangeDecoder_t coder = newRangeDecoder(p_src, src_len);
+  uint16_t probs_is_match[N_STATES][N_POS_STATES];
+  uint16_t probs_is_rep[N_STATES];
+  uint16_t probs_is_rep0[N_STATES];
+  uint16_t probs_is_rep0_long[N_STATES][N_POS_STATES];
+  uint16_t probs_is_rep1[N_STATES];
+  uint16_t probs_is_rep2[N_STATES];
+  uint16_t probs_dist_slot[4][(1 << 6) - 1];
+  uint16_t probs_dist_special[10][(1 << 5) - 1];
+  uint16_t probs_dist_align[(1 << 4) - 1];
+  uint16_t probs_len_choice[2];
+  uint16_t probs_len_choice2[2];
+  uint16_t probs_len_low[2][N_POS_STATES][(1 << 3) - 1];
+  uint16_t probs_len_mid[2][N_POS_STATES][(1 << 3) - 1];
+  uint16_t probs_len_high[2][(1 << 8) - 1];
+  uint16_t(*probs_literal)[N_PREV_BYTE_LC_MSBS][3 * (1 << 8)];
+  probs_literal = (uint16_t(*)[N_PREV_BYTE_LC_MSBS][3 * (1 << 8)]) malloc(
+      sizeof(uint16_t) * N_PREV_BYTE_LC_MSBS * N_LIT_POS_STATES * 3 * (1 << 8));
+  if (probs_literal == 0)
+    return R_ERR_MEMORY_RUNOUT;
+  INIT_PROBS(probs_is_match);
+  INIT_PROBS(probs_is_rep);
+  INIT_PROBS(probs_is_rep0);
+  INIT_PROBS(probs_is_rep0_long);
+  INIT_PROBS(probs_is_rep1);
+  INIT_PROBS(probs_is_rep2);
+  INIT_PROBS(probs_dist_slot);
+  INIT_PROBS(probs_dist_special);
+  INIT_PROBS(probs_dist_align);
+  INIT_PROBS(probs_len_choice);
+  INIT_PROBS(probs_len_choice2);
+  INIT_PROBS(probs_len_low);
+  INIT_PROBS(probs_len_mid);
+  INIT_PROBS(probs_len_high);
+  INIT_PROBS_LITERAL(probs_literal);
+  while (pos < *p_dst_len) {
+    const uint8_t prev_byte_lc_msbs = lc_mask & (prev_byte >> lc_shift);
+    const uint8_t literal_pos_state = lp_mask & (uint32_t)pos;
+    const uint8_t pos_state = pb_mask & (uint32_t)pos;
+    uint32_t dist = 0, len = 0;
+    PACKET_t type;
+    if (coder.overflow)
+      return R_ERR_INPUT_OVERFLOW;
+    if (!rangeDecodeBit(&coder, &probs_is_match[state][pos_state])) {
+      type = PKT_LIT;
+    } else if (!rangeDecodeBit(&coder, &probs_is_rep[state])) {
+      type = PKT_MATCH;
+    } else if (!rangeDecodeBit(&coder, &probs_is_rep0[state])) {
+      type = rangeDecodeBit(&coder, &probs_is_rep0_long[state][pos_state])
+                 ? PKT_REP0
+                 : PKT_SHORTREP;
+    } else if (!rangeDecodeBit(&coder, &probs_is_rep1[state])) {
+      type = PKT_REP1;
+    } else {
+      type =
+          rangeDecodeBit(&coder, &probs_is_rep2[state]) ? PKT_REP3 : PKT_REP2;
+    }
+    if (type == PKT_LIT) {
+      if (state < N_LIT_STATES) {
+        prev_byte = rangeDecodeInt(
+            &coder, probs_literal[literal_pos_state][prev_byte_lc_msbs], 8);
+      } else {
+        uint8_t match_byte = 0;
+        if (pos >= (size_t)rep0)
+          match_byte = p_dst[pos - rep0];
+        prev_byte = rangeDecodeMB(
+            &coder, probs_literal[literal_pos_state][prev_byte_lc_msbs],
+            match_byte);
+      }
+    }
+    state = stateTransition(state, type);
+    switch (type) {
+    case PKT_SHORTREP:
+    case PKT_REP0:
+      dist = rep0;
+      break;
+    case PKT_REP1:
+      dist = rep1;
+      break;
+    case PKT_REP2:
+      dist = rep2;
+      break;
+    case PKT_REP3:
+      dist = rep3;
+      break;
+    default:
+      break;
+    }
+    switch (type) {
+    case PKT_LIT:
+    case PKT_SHORTREP:
+      len = 1;
+      break;
+    case PKT_MATCH:
+    case PKT_REP3:
+      rep3 = rep2;
+    case PKT_REP2:
+      rep2 = rep1;
+    case PKT_REP1:
+      rep1 = rep0;
+      break;
+    default:
+      break;
+    }
+    if (len == 0) {
+      const uint32_t is_rep = (type != PKT_MATCH);
+      if (!rangeDecodeBit(&coder, &probs_len_choice[is_rep]))
+        len = 2 + rangeDecodeInt(&coder, probs_len_low[is_rep][pos_state], 3);
+      else if (!rangeDecodeBit(&coder, &probs_len_choice2[is_rep]))
+        len = 10 + rangeDecodeInt(&coder, probs_len_mid[is_rep][pos_state], 3);
+      else
+        len = 18 + rangeDecodeInt(&coder, probs_len_high[is_rep], 8);
+    }
+    if (type == PKT_MATCH) {
+      const uint32_t len_min5_minus2 = (len > 5) ? 3 : (len - 2);
+      uint32_t dist_slot, bcnt;
+      dist_slot = rangeDecodeInt(&coder, probs_dist_slot[len_min5_minus2], 6);
+      bcnt = (dist_slot >> 1) - 1;
+      dist = (2 | (dist_slot & 1));
+      dist <<= bcnt;
+      if (dist_slot >= 14) {
+        dist |= rangeDecodeIntByFixedProb(&coder, bcnt - 4) << 4;
+        dist |= bitsReverse(rangeDecodeInt(&coder, probs_dist_align, 4), 4);
+      } else if (dist_slot >= 4) {
+        dist |= bitsReverse(
+            rangeDecodeInt(&coder, probs_dist_special[dist_slot - 4], bcnt),
+            bcnt);
+      } else {
+        dist = dist_slot;
+      }
+      if (dist == 0xFFFFFFFF)
+        break;
+      dist++;
+    }
+    if ((size_t)dist > pos)
+      return R_ERR_DATA;
+    if ((pos + len) > *p_dst_len)
+      return R_ERR_OUTPUT_OVERFLOW;
+    if (type == PKT_LIT)
+      p_dst[pos] = prev_byte;
+    else
+      rep0 = dist;
+    for (; len > 0; len--) {
+      p_dst[pos] = prev_byte = p_dst[pos - dist];
+      pos++;
+    }
+  }
+  free(probs_literal);
+  *p_dst_len = pos;
+  return R_OK;
+}
+int tinyLzmaDecodeRaw(const uint8_t *p_src, size_t src_len, uint8_t *p_dst,
+                      size_t *p_dst_len, uint8_t lc, uint8_t lp, uint8_t pb) {
+  if (lc > MAX_LC || lp > MAX_LP || pb > MAX_PB)
+    return R_ERR_UNSUPPORTED;
+  return lzmaDecode(p_src, src_len, p_dst, p_dst_len, lc, lp, pb);
+}
+
+/*
+ * solution_multistream.cpp
+ *
+ * Multi-stream container. Cells are visited in DFS preorder from the root and
+ * their fields are split into independent streams (descriptors, ref indices,
+ * bit lengths, payloads). Every stream is compressed on its own thread with
+ * the coder and parameters that suit it best, so the statistics of one
+ * stream never pollute another one.
+ *
+ * The walk starts from the root as a Block and follows block.tlb: every cell
+ * whose type is known is split field by field into column streams of like
+ * values (addresses, logical times, Grams, hashes, ...). Cells that do not
+ * match their type, and cells of unknown type, keep their raw bits.
+ */
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "td/utils/base64.h"
+#include "td/utils/lz4.h"
+#include "td/utils/misc.h"
+#include "block/block-parse.h"
+#include "vm/boc.h"
+#include "vm/cells/CellBuilder.h"
+
+void store_varint(std::string &out, unsigned long long x) {
+  while (x >= 0x80) {
+    out.push_back(static_cast<char>((x & 0x7f) | 0x80));
+    x >>= 7;
+  }
+  out.push_back(static_cast<char>(x));
+}
+
+unsigned long long zigzag(long long x) {
+  return (static_cast<unsigned long long>(x) << 1) ^ (x >> 63);
+}
+
+long long unzigzag(unsigned long long x) {
+  return static_cast<long long>(x >> 1) ^ -static_cast<long long>(x & 1);
+}
+
+class StreamReader {
+public:
+  StreamReader() = default;
+  explicit StreamReader(td::Slice data) : data(data) {}
+
+  bool empty() const { return data.empty(); }
+
+  td::Result<td::Slice> bytes(std::size_t n) {
+    if (data.size() < n) {
+      return td::Status::Error("unexpected end of stream");
+    }
+    auto res = data.substr(0, n);
+    data.remove_prefix(n);
+    return res;
+  }
+
+  td::Result<unsigned char> byte() {
+    TRY_RESULT(res, bytes(1));
+    return res.ubegin()[0];
+  }
+
+  td::Result<unsigned long long> uint(int n) {
+    TRY_RESULT(res, bytes(n));
+    unsigned long long x = 0;
+    for (int i = 0; i < n; i++) {
+      x = (x << 8) | res.ubegin()[i];
+    }
+    return x;
+  }
+
+  td::Result<unsigned long long> varint() {
+    unsigned long long x = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      TRY_RESULT(b, byte());
+      x |= static_cast<unsigned long long>(b & 0x7f) << shift;
+      if (!(b & 0x80)) {
+        return x;
+      }
+    }
+    return td::Status::Error("varint is too long");
+  }
+
+private:
+  td::Slice data;
+};
+
+enum class Coder : unsigned char { Raw = 0, Lz4 = 1, Lzma = 2 };
+
+struct CoderParams {
+  Coder coder;
+  unsigned char lc, lp, pb;
+
+  unsigned char lzma_properties() const { return (pb * 5 + lp) * 9 + lc; }
+  static CoderParams from_bytes(unsigned char coder, unsigned char properties) {
+    return {static_cast<Coder>(coder),
+            static_cast<unsigned char>(properties % 9),
+            static_cast<unsigned char>(properties / 9 % 5),
+            static_cast<unsigned char>(properties / 45)};
+  }
+};
+
+// Coders tried for every stream, the smallest output wins. Byte-oriented
+// streams like high lc, fixed-width integer streams like lp/pb matching
+// their width.
+const CoderParams CANDIDATES[] = {
+    {Coder::Raw, 0, 0, 0},  {Coder::Lz4, 0, 0, 0},  {Coder::Lzma, 8, 0, 0},
+    {Coder::Lzma, 3, 0, 0}, {Coder::Lzma, 0, 0, 0}, {Coder::Lzma, 0, 1, 1},
+    {Coder::Lzma, 0, 2, 2},
+};
+
+td::Result<std::string> encode_stream(td::Slice data, CoderParams params) {
+  switch (params.coder) {
+  case Coder::Raw:
+    return data.str();
+  case Coder::Lz4:
+    return td::lz4_compress(data).as_slice().str();
+  case Coder::Lzma: {
+    std::string res(data.size() + (data.size() >> 2) + 4096, '\0');
+    std::size_t len = res.size();
+    if (tinyLzmaEncodeRaw(data.ubegin(), data.size(),
+                          reinterpret_cast<uint8_t *>(&res[0]), &len,
+                          params.lc, params.lp, params.pb) != R_OK) {
+      return td::Status::Error("lzma encoding failed");
+    }
+    res.resize(len);
+    return res;
+  }
+  }
+  return td::Status::Error("unknown coder");
+}
+
+td::Result<std::string> decode_stream(td::Slice data, CoderParams params,
+                                      std::size_t raw_size) {
+  switch (params.coder) {
+  case Coder::Raw:
+    return data.str();
+  case Coder::Lz4: {
+    TRY_RESULT(res, td::lz4_decompress(data, static_cast<int>(raw_size)));
+    return res.as_slice().str();
+  }
+  case Coder::Lzma: {
+    std::string res(raw_size, '\0');
+    std::size_t len = raw_size;
+    if (tinyLzmaDecodeRaw(data.ubegin(), data.size(),
+                          reinterpret_cast<uint8_t *>(&res[0]), &len,
+                          params.lc, params.lp, params.pb) != R_OK ||
+        len != raw_size) {
+      return td::Status::Error("lzma decoding failed");
+    }
+    return res;
+  }
+  }
+  return td::Status::Error("unknown coder");
+}
+
+// [varint stream_count]
+// per stream: [coder] [lzma properties (pb * 5 + lp) * 9 + lc]
+//             [varint raw_size] [varint coded_size]
+// then all coded streams in the same order
+std::string pack_streams(const std::vector<std::string> &streams) {
+  struct Coded {
+    CoderParams params{Coder::Raw, 0, 0, 0};
+    std::string data;
+  };
+  std::vector<Coded> coded(streams.size());
+
+  auto pick = [&](std::size_t i) {
+    coded[i].data = streams[i];
+    for (const auto &params : CANDIDATES) {
+      if (streams[i].empty()) {
+        break;
+      }
+      auto r_data = encode_stream(streams[i], params);
+      if (r_data.is_ok() && r_data.ok().size() < coded[i].data.size()) {
+        coded[i].params = params;
+        coded[i].data = r_data.move_as_ok();
+      }
+    }
+  };
+  std::vector<std::thread> workers;
+  for (std::size_t i = 0; i < streams.size(); i++) {
+    workers.emplace_back(pick, i);
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  std::string res;
+  store_varint(res, streams.size());
+  for (std::size_t i = 0; i < streams.size(); i++) {
+    res.push_back(static_cast<char>(coded[i].params.coder));
+    res.push_back(static_cast<char>(coded[i].params.lzma_properties()));
+    store_varint(res, streams[i].size());
+    store_varint(res, coded[i].data.size());
+  }
+  for (const auto &c : coded) {
+    res += c.data;
+  }
+  return res;
+}
+
+td::Result<std::vector<std::string>> unpack_streams(td::Slice data) {
+  StreamReader reader(data);
+  TRY_RESULT(count, reader.varint());
+  if (count > 256) {
+    return td::Status::Error("too many streams");
+  }
+  std::vector<CoderParams> params(count);
+  std::vector<std::size_t> raw_size(count), coded_size(count);
+  for (std::size_t i = 0; i < count; i++) {
+    TRY_RESULT(coder, reader.byte());
+    TRY_RESULT(properties, reader.byte());
+    TRY_RESULT(raw, reader.varint());
+    TRY_RESULT(size, reader.varint());
+    if (coder > static_cast<unsigned char>(Coder::Lzma) || raw > (64 << 20)) {
+      return td::Status::Error("invalid stream header");
+    }
+    params[i] = CoderParams::from_bytes(coder, properties);
+    raw_size[i] = raw;
+    coded_size[i] = size;
+  }
+  std::vector<std::string> streams(count);
+  for (std::size_t i = 0; i < count; i++) {
+    TRY_RESULT(coded, reader.bytes(coded_size[i]));
+    TRY_RESULT_ASSIGN(streams[i], decode_stream(coded, params[i], raw_size[i]));
+  }
+  return streams;
+}
+
+// Cells are numbered in DFS preorder from the root, every stream lists the
+// fields of the cells in that order. Cells whose TL-B type is known from
+// their parent are split field by field into the columns after TYPED, the
+// bits a transcoder does not cover stay in PAYLOAD.
+enum StreamId {
+  DESCRIPTOR, // d1: refs count, special flag and level mask
+  BIT_LENGTH, // data length in bits, 2 bytes big-endian
+  REFS,       // per ref a varint: 0 = new cell visited next, k = cell next - k
+  PAYLOAD,    // data bits no transcoder covers, coded by PayloadModel
+  TYPED,      // per special cell or cell of a known type: 1 = split, 0 = raw
+  FLAGS,      // tags, booleans and short lengths, bit-packed
+  ACCOUNT,    // distinct account ids, 32 bytes each
+  ACCOUNT_INDEX, // per account id a varint: 0 = next new id, k = k-th id
+  ADDRESS,    // distinct addr_std: workchain byte and 32-byte address
+  ADDRESS_INDEX, // per addr_std a varint, like ACCOUNT_INDEX
+  LT,         // logical times, 8 bytes big-endian, delta coded
+  TIME,       // unix times, 4 bytes big-endian, delta coded
+  GRAMS,      // VarUInteger amounts, range coded by AmountModel
+  HASH,       // 256-bit hashes, except the ones derivable from the block
+  HASH_REF,   // per derivable hash field a varint: 0 = next value in HASH,
+              // otherwise distance back to the cell * 4 + hash level
+  KEY,        // label bits of dictionaries whose keys are not listed
+  DICT_KEYS,  // sorted key lists of dictionaries, labels derived from them
+  INTEGER,    // every other integer field
+  STREAM_COUNT
+};
+
+const int FIRST_COLUMN = FLAGS;
+
+// Every column but FLAGS starts each field on a byte boundary, integers are
+// right-aligned and bit strings left-aligned in their bytes.
+bool is_byte_aligned(int column) { return column != FLAGS; }
+
+// Values repeated all over a block are interned per field class: the column
+// lists every distinct value once and the index column refers to them.
+int index_column(int column) {
+  return column == ACCOUNT ? ACCOUNT_INDEX : ADDRESS_INDEX;
+}
+
+// Logical times and unix times of neighbouring transactions and messages are
+// close to each other, so these columns are stored as zigzag varints of the
+// difference to the previous value of the same column instead.
+const std::pair<StreamId, int> DELTA_COLUMNS[] = {{LT, 8}, {TIME, 4}};
+
+std::string delta_encode(td::Slice column, int width) {
+  std::string res;
+  unsigned long long prev = 0;
+  for (std::size_t i = 0; i + width <= column.size(); i += width) {
+    unsigned long long x = 0;
+    for (int j = 0; j < width; j++) {
+      x = (x << 8) | column.ubegin()[i + j];
+    }
+    store_varint(res, zigzag(static_cast<long long>(x - prev)));
+    prev = x;
+  }
+  return res;
+}
+
+td::Result<std::string> delta_decode(td::Slice data, int width) {
+  std::string res;
+  StreamReader reader(data);
+  unsigned long long prev = 0;
+  while (!reader.empty()) {
+    TRY_RESULT(delta, reader.varint());
+    unsigned long long x = prev + static_cast<unsigned long long>(unzigzag(delta));
+    if (width < 8 && (x >> (width * 8))) {
+      return td::Status::Error("delta out of range");
+    }
+    for (int j = width - 1; j >= 0; j--) {
+      res.push_back(static_cast<char>(x >> (j * 8)));
+    }
+    prev = x;
+  }
+  return res;
+}
+
+class BitReader {
+public:
+  BitReader() = default;
+  BitReader(const unsigned char *data, std::size_t bits)
+      : data(data), bits(bits) {}
+
+  std::size_t position() const { return pos; }
+  std::size_t remaining() const { return bits - pos; }
+
+  bool read(int n, unsigned long long &value) {
+    if (n > 64 || remaining() < static_cast<std::size_t>(n)) {
+      return false;
+    }
+    value = 0;
+    for (int i = 0; i < n; i++, pos++) {
+      value = (value << 1) | ((data[pos >> 3] >> (7 - (pos & 7))) & 1);
+    }
+    return true;
+  }
+
+  bool skip(std::size_t n) {
+    if (remaining() < n) {
+      return false;
+    }
+    pos += n;
+    return true;
+  }
+
+  void align() { pos = std::min(bits, (pos + 7) & ~std::size_t{7}); }
+
+private:
+  const unsigned char *data{nullptr};
+  std::size_t bits{0};
+  std::size_t pos{0};
+};
+
+class BitWriter {
+public:
+  std::size_t size() const { return bits; }
+  const std::string &data() const { return buf; }
+
+  void write(unsigned long long value, int n) {
+    for (int i = n - 1; i >= 0; i--, bits++) {
+      if ((bits & 7) == 0) {
+        buf.push_back(0);
+      }
+      if ((value >> i) & 1) {
+        buf.back() = static_cast<char>(buf.back() | (0x80 >> (bits & 7)));
+      }
+    }
+  }
+
+  // Copies everything left in reader.
+  void append(BitReader &reader) {
+    while (reader.remaining() > 0) {
+      int n = static_cast<int>(std::min<std::size_t>(reader.remaining(), 64));
+      unsigned long long value;
+      reader.read(n, value);
+      write(value, n);
+    }
+  }
+
+  void align() { bits = buf.size() * 8; }
+
+  void truncate(std::size_t n) {
+    buf.resize((n + 7) / 8);
+    bits = n;
+    if (bits & 7) {
+      buf.back() = static_cast<char>(buf.back() & (0xff00 >> (bits & 7)));
+    }
+  }
+
+private:
+  std::string buf;
+  std::size_t bits{0};
+};
+
+void write_varint(BitWriter &writer, unsigned long long x) {
+  while (x >= 0x80) {
+    writer.write((x & 0x7f) | 0x80, 8);
+    x >>= 7;
+  }
+  writer.write(x, 8);
+}
+
+bool read_varint(BitReader &reader, unsigned long long &x) {
+  x = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    unsigned long long b;
+    if (!reader.read(8, b)) {
+      return false;
+    }
+    x |= (b & 0x7f) << shift;
+    if (!(b & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Overwrites n bits of data starting at bit offset with the first n bits of
+// src.
+void store_bits_at(std::string &data, std::size_t offset,
+                   const unsigned char *src, int n) {
+  for (int i = 0; i < n; i++, offset++) {
+    unsigned char mask = static_cast<unsigned char>(0x80 >> (offset & 7));
+    if ((src[i >> 3] >> (7 - (i & 7))) & 1) {
+      data[offset >> 3] = static_cast<char>(data[offset >> 3] | mask);
+    } else {
+      data[offset >> 3] = static_cast<char>(data[offset >> 3] & ~mask);
+    }
+  }
+}
+
+// Cells whose visit is complete, by each of their hashes. A hash field equal
+// to one of them is stored as a reference and recomputed by the decoder once
+// the cell is built, which the post-order build guarantees happens first.
+struct HashTarget {
+  int id;
+  int level;
+};
+using HashIndex = std::unordered_map<std::string, HashTarget>;
+
+// A hash the decoder fills in at build time.
+struct HashPatch {
+  std::size_t offset;
+  int target;
+  int level;
+};
+
+// Distinct values of an interned column in order of first occurrence.
+struct InternTable {
+  std::map<std::string, unsigned long long> index;
+  std::vector<std::string> values;
+
+  void truncate(std::size_t n) {
+    while (values.size() > n) {
+      index.erase(values.back());
+      values.pop_back();
+    }
+  }
+};
+
+// bits needed for #<= m
+int bits_for(int m) {
+  int w = 0;
+  while ((1 << w) <= m) {
+    w++;
+  }
+  return w;
+}
+
+// Keys of a dictionary listed ahead of its root edge, ascending, each one
+// n bits zero-padded to whole bytes.
+struct DictKeys {
+  int n;
+  std::vector<std::string> keys;
+};
+
+bool key_bit(const std::string &key, int i) {
+  return (static_cast<unsigned char>(key[i >> 3]) >> (7 - (i & 7))) & 1;
+}
+
+unsigned long long key_value(const std::string &key, int n) {
+  BitReader reader(reinterpret_cast<const unsigned char *>(key.data()), n);
+  unsigned long long x = 0;
+  reader.read(n, x);
+  return x;
+}
+
+// [varint count], then per key: up to 64 bits a varint of the difference to
+// the previous key minus one, longer keys the length of the prefix shared
+// with the previous key and the bits after the first differing one, which
+// is always 0 in the previous key and 1 in this one.
+void write_keys(BitWriter &out, const DictKeys &dict) {
+  write_varint(out, dict.keys.size());
+  for (std::size_t i = 0; i < dict.keys.size(); i++) {
+    const auto &key = dict.keys[i];
+    if (dict.n <= 64) {
+      unsigned long long x = key_value(key, dict.n);
+      write_varint(out, i == 0 ? x : x - key_value(dict.keys[i - 1], dict.n) - 1);
+      continue;
+    }
+    int from = 0;
+    if (i > 0) {
+      const auto &prev = dict.keys[i - 1];
+      while (from < dict.n && key_bit(prev, from) == key_bit(key, from)) {
+        from++;
+      }
+      write_varint(out, from);
+      from++;
+    }
+    BitReader reader(reinterpret_cast<const unsigned char *>(key.data()),
+                     dict.n);
+    reader.skip(std::min(from, dict.n));
+    out.append(reader);
+    out.align();
+  }
+}
+
+bool read_keys(BitReader &in, DictKeys &dict) {
+  unsigned long long count;
+  if (!read_varint(in, count) || count == 0 || count > (1 << 20)) {
+    return false;
+  }
+  unsigned long long limit = dict.n == 64 ? ~0ull : (1ull << dict.n) - 1;
+  for (unsigned long long i = 0; i < count; i++) {
+    BitWriter key;
+    if (dict.n <= 64) {
+      unsigned long long delta;
+      if (!read_varint(in, delta)) {
+        return false;
+      }
+      unsigned long long prev = i == 0 ? 0 : key_value(dict.keys.back(), dict.n);
+      if (i == 0 ? delta > limit : delta >= limit - prev) {
+        return false;
+      }
+      key.write(i == 0 ? delta : prev + delta + 1, dict.n);
+    } else {
+      int from = 0;
+      if (i > 0) {
+        unsigned long long shared;
+        const auto &prev = dict.keys.back();
+        if (!read_varint(in, shared) ||
+            shared >= static_cast<unsigned long long>(dict.n) ||
+            key_bit(prev, static_cast<int>(shared))) {
+          return false;
+        }
+        BitReader reader(reinterpret_cast<const unsigned char *>(prev.data()),
+                         shared);
+        key.append(reader);
+        key.write(1, 1);
+        from = static_cast<int>(shared) + 1;
+      }
+      for (int done = from; done < dict.n; done += 64) {
+        int chunk = std::min(64, dict.n - done);
+        unsigned long long x;
+        if (!in.read(chunk, x)) {
+          return false;
+        }
+        key.write(x, chunk);
+      }
+      in.align();
+    }
+    dict.keys.push_back(key.data());
+  }
+  return true;
+}
+
+// Appends the label vm::Dictionary writes above the keys [lo, hi) of dict,
+// which agree on their first depth bits: hml_same when it is the shortest,
+// otherwise hml_long when it beats hml_short. Returns the label length, or
+// -1 when the range cannot hang below such an edge.
+int canonical_label(const DictKeys &dict, int lo, int hi, int depth,
+                    BitWriter &out) {
+  int max_len = dict.n - depth;
+  if (lo < 0 || lo >= hi || hi > static_cast<int>(dict.keys.size()) ||
+      max_len < 0) {
+    return -1;
+  }
+  const auto &first = dict.keys[lo], &last = dict.keys[hi - 1];
+  int len = 0;
+  if (hi - lo == 1) {
+    len = max_len;
+  } else {
+    while (len < max_len &&
+           key_bit(first, depth + len) == key_bit(last, depth + len)) {
+      len++;
+    }
+    if (len == max_len) {
+      return -1;
+    }
+  }
+  int k = bits_for(max_len);
+  bool same = true;
+  for (int i = 1; i < len && same; i++) {
+    same = key_bit(first, depth + i) == key_bit(first, depth);
+  }
+  if (len > 1 && same && k < 2 * len - 1) {
+    out.write(3, 2);
+    out.write(key_bit(first, depth), 1);
+    out.write(len, k);
+    return len;
+  }
+  if (k < len) {
+    out.write(2, 2);
+    out.write(len, k);
+  } else {
+    out.write(0, 1);
+    for (int i = 0; i < len; i++) {
+      out.write(1, 1);
+    }
+    out.write(0, 1);
+  }
+  for (int i = 0; i < len; i++) {
+    out.write(key_bit(first, depth + i), 1);
+  }
+  return len;
+}
+
+// First key of [lo, hi) with a 1 at the given bit.
+int split_point(const DictKeys &dict, int lo, int hi, int bit) {
+  while (lo < hi && !key_bit(dict.keys[lo], bit)) {
+    lo++;
+  }
+  return lo;
+}
+
+// Binary range coder in the style of LZMA: 32-bit range, 11-bit
+// probabilities adapted by 1/32 of the error after every bit.
+const int PROB_BITS = 11;
+const uint16_t PROB_INIT = 1 << (PROB_BITS - 1);
+const int PROB_SHIFT = 5;
+
+class RangeEncoder {
+public:
+  void bit(uint16_t &prob, unsigned bit) {
+    encode((range >> PROB_BITS) * prob, bit);
+    if (bit == 0) {
+      prob += ((1 << PROB_BITS) - prob) >> PROB_SHIFT;
+    } else {
+      prob -= prob >> PROB_SHIFT;
+    }
+  }
+
+  // Codes a bit that is 1 with probability p1 / 4096, for predictions that
+  // come from a model rather than a single adaptive probability.
+  void predicted(unsigned p1, unsigned bit) {
+    encode((range >> 12) * (4096 - p1), bit);
+  }
+
+  std::string finish() {
+    for (int i = 0; i < 5; i++) {
+      shift_low();
+    }
+    return std::move(out);
+  }
+
+private:
+  std::string out;
+  uint64_t low{0};
+  uint32_t range{0xFFFFFFFF};
+  unsigned char cache{0};
+  uint64_t cache_size{1};
+
+  void encode(uint32_t bound, unsigned bit) {
+    if (bit == 0) {
+      range = bound;
+    } else {
+      low += bound;
+      range -= bound;
+    }
+    while (range < (1u << 24)) {
+      range <<= 8;
+      shift_low();
+    }
+  }
+
+  void shift_low() {
+    if (static_cast<uint32_t>(low) < 0xFF000000u || (low >> 32) != 0) {
+      unsigned char carry = static_cast<unsigned char>(low >> 32);
+      unsigned char temp = cache;
+      do {
+        out.push_back(static_cast<char>(temp + carry));
+        temp = 0xFF;
+      } while (--cache_size != 0);
+      cache = static_cast<unsigned char>(low >> 24);
+    }
+    cache_size++;
+    low = (low & 0x00FFFFFF) << 8;
+  }
+};
+
+// Reads past the end as zero bytes, a corrupted stream decodes to garbage
+// that the joiner then rejects.
+class RangeDecoder {
+public:
+  RangeDecoder() = default;
+  RangeDecoder(const unsigned char *data, std::size_t size)
+      : data(data), size(size) {
+    for (int i = 0; i < 5; i++) {
+      code = (code << 8) | next();
+    }
+  }
+
+  void bit(uint16_t &prob, unsigned &bit) {
+    bit = decode((range >> PROB_BITS) * prob);
+    if (bit == 0) {
+      prob += ((1 << PROB_BITS) - prob) >> PROB_SHIFT;
+    } else {
+      prob -= prob >> PROB_SHIFT;
+    }
+  }
+
+  void predicted(unsigned p1, unsigned &bit) {
+    bit = decode((range >> 12) * (4096 - p1));
+  }
+
+private:
+  const unsigned char *data{nullptr};
+  std::size_t size{0};
+  std::size_t pos{0};
+  uint32_t code{0};
+  uint32_t range{0xFFFFFFFF};
+
+  unsigned char next() { return pos < size ? data[pos++] : 0; }
+
+  unsigned decode(uint32_t bound) {
+    unsigned bit = 0;
+    if (code < bound) {
+      range = bound;
+    } else {
+      code -= bound;
+      range -= bound;
+      bit = 1;
+    }
+    while (range < (1u << 24)) {
+      range <<= 8;
+      code = (code << 8) | next();
+    }
+    return bit;
+  }
+};
+
+// Codes the n low bits of value, most significant first, with a bit tree of
+// 2^n probabilities. The decoder passes any value and gets the decoded one.
+template <class Coder>
+void code_tree(Coder &coder, uint16_t *probs, int n, unsigned &value) {
+  unsigned node = 1;
+  for (int i = n - 1; i >= 0; i--) {
+    unsigned bit = (value >> i) & 1;
+    coder.bit(probs[node], bit);
+    node = node * 2 + bit;
+  }
+  value = node - (1u << n);
+}
+
+// What a VarUInteger amount is in the block. Fees are mostly short and
+// similar to each other, values and balances are longer and often round.
+enum class Role : unsigned char { Value, Fee, Balance, Currency };
+const int ROLE_COUNT = 4;
+
+// VarUInteger n amount: len:(#< n) then len bytes of value.
+struct Amount {
+  Role role;
+  int len_bits;
+  std::string bytes;
+};
+
+// Adaptive model of the GRAMS stream. The length has a bit tree per role,
+// every value byte one per role, length and position of the byte.
+class AmountModel {
+public:
+  AmountModel()
+      : len_probs(ROLE_COUNT * 32, PROB_INIT),
+        byte_probs(ROLE_COUNT * 32 * 32 * 256, PROB_INIT) {}
+
+  template <class Coder> void code(Coder &coder, Amount &amount) {
+    int role = static_cast<int>(amount.role);
+    unsigned len = static_cast<unsigned>(amount.bytes.size());
+    code_tree(coder, &len_probs[role * 32], amount.len_bits, len);
+    amount.bytes.resize(len);
+    for (unsigned i = 0; i < len; i++) {
+      unsigned byte = static_cast<unsigned char>(amount.bytes[i]);
+      code_tree(coder, &byte_probs[((role * 32 + len) * 32 + i) * 256], 8,
+                byte);
+      amount.bytes[i] = static_cast<char>(byte);
+    }
+  }
+
+private:
+  std::vector<uint16_t> len_probs;
+  std::vector<uint16_t> byte_probs;
+};
+
+std::string encode_amounts(std::vector<Amount> amounts) {
+  AmountModel model;
+  RangeEncoder coder;
+  for (auto &amount : amounts) {
+    model.code(coder, amount);
+  }
+  return coder.finish();
+}
+
+// Decodes the amounts one at a time, as the joiner meets them.
+class AmountDecoder {
+public:
+  AmountDecoder() = default;
+  AmountDecoder(const unsigned char *data, std::size_t size)
+      : coder(data, size) {}
+
+  void decode(Amount &amount) { model.code(coder, amount); }
+
+private:
+  AmountModel model;
+  RangeDecoder coder;
+};
+
+// Types the transcoders below understand. Cell types describe a whole cell,
+// the others are values embedded inline into a dictionary leaf.
+enum class Kind : unsigned char {
+  Unknown,
+  None,
+  // cells
+  Block,
+  BlockInfo,
+  ExtBlkRef,
+  BlkPrevInfo2,
+  ValueFlow,
+  ValueFlowPart,
+  BlockExtra,
+  AugDict, // HashmapAugE n X Y
+  Dict,    // root edge of Hashmap n X, or HashmapAug n X Y
+  Edge,    // edge below the root, aug when y is not None
+  Transaction,
+  TransactionIo,
+  TransactionDescr,
+  ComputeDetails,
+  ActionPhase,
+  HashUpdate,
+  Message,
+  MsgEnvelope,
+  StateInit,
+  PrunedBranch,
+  // inline values
+  AccountBlock,
+  InMsg,
+  OutMsg,
+  ImportFees,
+  CurrencyCollection,
+  TransactionRef,
+  MessageRef,
+  VarUInt32,
+};
+
+struct CellType {
+  Kind kind{Kind::Unknown};
+  int n{0};
+  Kind x{Kind::None};
+  Kind y{Kind::None};
+  // edges of a listed dictionary: its index and the keys [lo, hi) below
+  int dict{-1};
+  int lo{0};
+  int hi{0};
+};
+
+// State shared by the splitters of all cells of a block.
+struct SplitState {
+  std::array<BitWriter, STREAM_COUNT> columns;
+  std::array<InternTable, STREAM_COUNT> tables;
+  HashIndex hashes;
+  std::vector<DictKeys> dicts;
+  std::vector<Amount> amounts;
+};
+
+// State shared by the joiners of all cells of a block.
+struct JoinState {
+  std::array<BitReader, STREAM_COUNT> columns;
+  std::array<InternTable, STREAM_COUNT> tables;
+  std::vector<DictKeys> dicts;
+  AmountDecoder amounts;
+};
+
+// Lists the keys of the dictionary whose root edge starts at the given bit
+// and ref of the cell being split. Fails unless every label below is the
+// canonical one, so that the labels can be derived from the keys.
+using KeyLister = std::function<bool(std::size_t bit, unsigned ref, int n,
+                                     std::vector<std::string> &keys)>;
+
+// Tells whether the extra of a fork, from the given bit of the cell being
+// split to its end, is what the augmentation of a dictionary of x computes
+// from the extras of the two children, which have n key bits left.
+using ExtraChecker = std::function<bool(std::size_t bit, Kind x, int n)>;
+
+// A fork extra the decoder recomputes at build time.
+struct ExtraPatch {
+  std::size_t offset;
+  Kind x;
+  int n;
+};
+
+// Moves the fields of a cell into the columns, used by the encoder.
+class FieldSplitter {
+public:
+  std::vector<CellType> ref_types;
+
+  FieldSplitter(const unsigned char *data, unsigned bits, unsigned refs,
+                SplitState &state, int cell_id, KeyLister list_keys = {},
+                ExtraChecker check_extra = {})
+      : cell(data, bits), refs(refs), state(state), cell_id(cell_id),
+        list_keys(std::move(list_keys)), check_extra(std::move(check_extra)) {}
+
+  bool uint(int column, int n, unsigned long long &value) {
+    if (!cell.read(n, value)) {
+      return false;
+    }
+    state.columns[column].write(value,
+                                is_byte_aligned(column) ? (n + 7) / 8 * 8 : n);
+    return true;
+  }
+
+  bool uint(int column, int n) {
+    unsigned long long value;
+    return uint(column, n, value);
+  }
+
+  bool bits(int column, int n) {
+    for (int done = 0; done < n; done += 64) {
+      int chunk = std::min(64, n - done);
+      unsigned long long value;
+      if (!cell.read(chunk, value)) {
+        return false;
+      }
+      state.columns[column].write(value, chunk);
+    }
+    if (is_byte_aligned(column)) {
+      state.columns[column].align();
+    }
+    return true;
+  }
+
+  bool interned(int column, int n) {
+    BitWriter value;
+    if (!read_bits(n, value)) {
+      return false;
+    }
+    auto &table = state.tables[column];
+    auto it = table.index.find(value.data());
+    if (it != table.index.end()) {
+      write_varint(state.columns[index_column(column)], it->second);
+      return true;
+    }
+    table.values.push_back(value.data());
+    table.index[value.data()] = table.values.size();
+    write_varint(state.columns[index_column(column)], 0);
+    BitReader reader(reinterpret_cast<const unsigned char *>(value.data().data()),
+                     n);
+    state.columns[column].append(reader);
+    state.columns[column].align();
+    return true;
+  }
+
+  bool hash() {
+    BitWriter value;
+    if (!read_bits(256, value)) {
+      return false;
+    }
+    auto it = state.hashes.find(value.data());
+    if (it != state.hashes.end()) {
+      write_varint(state.columns[HASH_REF],
+                   (cell_id - it->second.id) * 4ull + it->second.level);
+      return true;
+    }
+    write_varint(state.columns[HASH_REF], 0);
+    BitReader reader(reinterpret_cast<const unsigned char *>(value.data().data()),
+                     256);
+    state.columns[HASH].append(reader);
+    return true;
+  }
+
+  bool list_dict(int n, int &id) {
+    DictKeys dict{n, {}};
+    bool listed = list_keys && list_keys(cell.position(),
+                                         static_cast<unsigned>(ref_types.size()),
+                                         n, dict.keys);
+    state.columns[FLAGS].write(listed ? 1 : 0, 1);
+    id = -1;
+    if (listed) {
+      write_keys(state.columns[DICT_KEYS], dict);
+      id = static_cast<int>(state.dicts.size());
+      state.dicts.push_back(std::move(dict));
+    }
+    return true;
+  }
+
+  const DictKeys &dict_keys(int id) const { return state.dicts[id]; }
+
+  bool amount(Role role, int len_bits) {
+    Amount amount{role, len_bits, {}};
+    unsigned long long len, byte;
+    if (!cell.read(len_bits, len)) {
+      return false;
+    }
+    for (unsigned long long i = 0; i < len; i++) {
+      if (!cell.read(8, byte)) {
+        return false;
+      }
+      amount.bytes.push_back(static_cast<char>(byte));
+    }
+    state.amounts.push_back(std::move(amount));
+    return true;
+  }
+
+  bool fork_extra(Kind x, int n, bool &derived) {
+    derived = check_extra && check_extra(cell.position(), x, n);
+    state.columns[FLAGS].write(derived ? 1 : 0, 1);
+    return !derived || cell.skip(cell.remaining());
+  }
+
+  bool tag(unsigned long long expected, int n) {
+    unsigned long long value;
+    return cell.read(n, value) && value == expected;
+  }
+
+  bool ref(CellType type) {
+    if (ref_types.size() >= refs) {
+      return false;
+    }
+    ref_types.push_back(type);
+    return true;
+  }
+
+  BitReader &rest() { return cell; }
+
+private:
+  BitReader cell;
+  unsigned refs;
+  SplitState &state;
+  int cell_id;
+  KeyLister list_keys;
+  ExtraChecker check_extra;
+
+  bool read_bits(int n, BitWriter &value) {
+    for (int done = 0; done < n; done += 64) {
+      int chunk = std::min(64, n - done);
+      unsigned long long x;
+      if (!cell.read(chunk, x)) {
+        return false;
+      }
+      value.write(x, chunk);
+    }
+    return true;
+  }
+};
+
+// Moves the fields back from the columns into a cell, used by the decoder.
+class FieldJoiner {
+public:
+  std::vector<CellType> ref_types;
+  std::vector<HashPatch> patches;
+  std::vector<ExtraPatch> extras;
+  BitWriter cell;
+
+  FieldJoiner(unsigned bits, unsigned refs, JoinState &state, int cell_id)
+      : bits_limit(bits), refs(refs), state(state), cell_id(cell_id) {}
+
+  bool uint(int column, int n, unsigned long long &value) {
+    int width = is_byte_aligned(column) ? (n + 7) / 8 * 8 : n;
+    if (!state.columns[column].read(width, value) ||
+        (n < 64 && (value >> n))) {
+      return false;
+    }
+    return put(value, n);
+  }
+
+  bool uint(int column, int n) {
+    unsigned long long value;
+    return uint(column, n, value);
+  }
+
+  bool bits(int column, int n) {
+    for (int done = 0; done < n; done += 64) {
+      int chunk = std::min(64, n - done);
+      unsigned long long value;
+      if (!state.columns[column].read(chunk, value) || !put(value, chunk)) {
+        return false;
+      }
+    }
+    if (is_byte_aligned(column)) {
+      state.columns[column].align();
+    }
+    return true;
+  }
+
+  bool interned(int column, int n) {
+    auto &table = state.tables[column];
+    unsigned long long k;
+    if (!read_varint(state.columns[index_column(column)], k) ||
+        k > table.values.size()) {
+      return false;
+    }
+    if (k == 0) {
+      BitWriter value;
+      for (int done = 0; done < n; done += 64) {
+        int chunk = std::min(64, n - done);
+        unsigned long long x;
+        if (!state.columns[column].read(chunk, x)) {
+          return false;
+        }
+        value.write(x, chunk);
+      }
+      state.columns[column].align();
+      table.values.push_back(value.data());
+      k = table.values.size();
+    }
+    const auto &value = table.values[k - 1];
+    if (value.size() * 8 < static_cast<std::size_t>(n) ||
+        cell.size() + n > bits_limit) {
+      return false;
+    }
+    BitReader reader(reinterpret_cast<const unsigned char *>(value.data()), n);
+    cell.append(reader);
+    return true;
+  }
+
+  bool hash() {
+    unsigned long long ref;
+    if (!read_varint(state.columns[HASH_REF], ref)) {
+      return false;
+    }
+    if (ref == 0) {
+      return bits(HASH, 256);
+    }
+    if (ref / 4 > static_cast<unsigned long long>(cell_id) || ref < 4) {
+      return false;
+    }
+    patches.push_back({cell.size(), cell_id - static_cast<int>(ref / 4),
+                       static_cast<int>(ref % 4)});
+    return put(0, 64) && put(0, 64) && put(0, 64) && put(0, 64);
+  }
+
+  bool list_dict(int n, int &id) {
+    unsigned long long listed;
+    if (!state.columns[FLAGS].read(1, listed)) {
+      return false;
+    }
+    id = -1;
+    if (listed) {
+      DictKeys dict{n, {}};
+      if (!read_keys(state.columns[DICT_KEYS], dict)) {
+        return false;
+      }
+      id = static_cast<int>(state.dicts.size());
+      state.dicts.push_back(std::move(dict));
+    }
+    return true;
+  }
+
+  const DictKeys &dict_keys(int id) const { return state.dicts[id]; }
+
+  bool amount(Role role, int len_bits) {
+    Amount amount{role, len_bits, {}};
+    state.amounts.decode(amount);
+    if (!put(amount.bytes.size(), len_bits)) {
+      return false;
+    }
+    for (char byte : amount.bytes) {
+      if (!put(static_cast<unsigned char>(byte), 8)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // A derived extra runs to the end of the fork; its bits are reserved here
+  // and filled in once the children are built.
+  bool fork_extra(Kind x, int n, bool &derived) {
+    unsigned long long flag;
+    if (!state.columns[FLAGS].read(1, flag)) {
+      return false;
+    }
+    derived = flag != 0;
+    if (derived) {
+      extras.push_back({cell.size(), x, n});
+      while (cell.size() < bits_limit) {
+        put(0, std::min<int>(64, bits_limit - cell.size()));
+      }
+    }
+    return true;
+  }
+
+  bool tag(unsigned long long expected, int n) { return put(expected, n); }
+
+  bool ref(CellType type) {
+    if (ref_types.size() >= refs) {
+      return false;
+    }
+    ref_types.push_back(type);
+    return true;
+  }
+
+private:
+  unsigned bits_limit;
+  unsigned refs;
+  JoinState &state;
+  int cell_id;
+
+  bool put(unsigned long long value, int n) {
+    if (cell.size() + n > bits_limit) {
+      return false;
+    }
+    cell.write(value, n);
+    return true;
+  }
+};
+
+// Transcoders, one per block.tlb type. Each one is written once against the
+// Io interface above, so the splitter and the joiner always agree on the
+// layout. Fields after the last one a transcoder knows stay in PAYLOAD.
+
+template <class Io> bool parse_type(Io &io, const CellType &type);
+
+template <class Io, class F> bool parse_maybe(Io &io, F f) {
+  unsigned long long present;
+  return io.uint(FLAGS, 1, present) && (!present || f());
+}
+
+template <class Io> bool parse_var_uint(Io &io, int column, int len_bits) {
+  unsigned long long len;
+  return io.uint(column, len_bits, len) &&
+         io.bits(column, static_cast<int>(len * 8));
+}
+
+template <class Io> bool parse_grams(Io &io, Role role) {
+  return io.amount(role, 4);
+}
+
+template <class Io> bool parse_currencies(Io &io, Role role) {
+  return parse_grams(io, role) && parse_maybe(io, [&] {
+           return io.ref({Kind::Dict, 32, Kind::VarUInt32});
+         });
+}
+
+template <class Io> bool parse_address_int(Io &io) {
+  unsigned long long tag, depth, len;
+  if (!io.uint(FLAGS, 2, tag) || tag < 2 ||
+      !parse_maybe(io, [&] {
+        return io.uint(FLAGS, 5, depth) && depth >= 1 && depth <= 30 &&
+               io.bits(INTEGER, static_cast<int>(depth));
+      })) {
+    return false;
+  }
+  if (tag == 2) {
+    return io.interned(ADDRESS, 8 + 256);
+  }
+  return io.uint(FLAGS, 9, len) && io.uint(INTEGER, 32) &&
+         io.bits(INTEGER, static_cast<int>(len));
+}
+
+template <class Io> bool parse_address_ext(Io &io) {
+  unsigned long long tag, len;
+  if (!io.uint(FLAGS, 2, tag) || tag > 1) {
+    return false;
+  }
+  return tag == 0 ||
+         (io.uint(FLAGS, 9, len) && io.bits(INTEGER, static_cast<int>(len)));
+}
+
+template <class Io> bool parse_interm_address(Io &io) {
+  unsigned long long tag, use_dest_bits;
+  if (!io.uint(FLAGS, 1, tag)) {
+    return false;
+  }
+  if (tag == 0) {
+    return io.uint(FLAGS, 7, use_dest_bits) && use_dest_bits <= 96;
+  }
+  return io.uint(FLAGS, 1, tag) && io.uint(INTEGER, tag ? 32 : 8) &&
+         io.uint(INTEGER, 64);
+}
+
+template <class Io> bool parse_state_init(Io &io) {
+  auto any_ref = [&] { return io.ref({}); };
+  return parse_maybe(io, [&] { return io.uint(FLAGS, 5); }) &&
+         parse_maybe(io, [&] { return io.uint(FLAGS, 2); }) &&
+         parse_maybe(io, any_ref) && parse_maybe(io, any_ref) &&
+         parse_maybe(io, any_ref);
+}
+
+template <class Io> bool parse_message(Io &io) {
+  unsigned long long tag, either;
+  if (!io.uint(FLAGS, 1, tag)) {
+    return false;
+  }
+  if (tag == 0) {
+    if (!(io.uint(FLAGS, 3) && parse_address_int(io) &&
+          parse_address_int(io) && parse_currencies(io, Role::Value) &&
+          parse_grams(io, Role::Fee) && parse_grams(io, Role::Fee) &&
+          io.uint(LT, 64) && io.uint(TIME, 32))) {
+      return false;
+    }
+  } else {
+    if (!io.uint(FLAGS, 1, tag)) {
+      return false;
+    }
+    if (tag == 0 ? !(parse_address_ext(io) && parse_address_int(io) &&
+                     parse_grams(io, Role::Fee))
+                 : !(parse_address_int(io) && parse_address_ext(io) &&
+                     io.uint(LT, 64) && io.uint(TIME, 32))) {
+      return false;
+    }
+  }
+  if (!parse_maybe(io, [&] {
+        return io.uint(FLAGS, 1, either) &&
+               (either ? io.ref({Kind::StateInit}) : parse_state_init(io));
+      })) {
+    return false;
+  }
+  // an inline body stays in PAYLOAD
+  return io.uint(FLAGS, 1, either) && (!either || io.ref({}));
+}
+
+template <class Io> bool parse_msg_envelope(Io &io) {
+  unsigned long long tag;
+  if (!(io.uint(FLAGS, 4, tag) && (tag == 4 || tag == 5) &&
+        parse_interm_address(io) && parse_interm_address(io) &&
+        parse_grams(io, Role::Fee) && io.ref({Kind::Message}))) {
+    return false;
+  }
+  return tag == 4 ||
+         (parse_maybe(io, [&] { return io.uint(LT, 64); }) &&
+          parse_maybe(io, [&] {
+            return io.tag(0, 4) && io.uint(INTEGER, 32) &&
+                   parse_address_int(io) && io.uint(LT, 64);
+          }));
+}
+
+template <class Io> bool parse_status_change(Io &io) {
+  unsigned long long changed;
+  return io.uint(FLAGS, 1, changed) && (!changed || io.uint(FLAGS, 1));
+}
+
+template <class Io> bool parse_storage_phase(Io &io) {
+  return parse_grams(io, Role::Fee) &&
+         parse_maybe(io, [&] { return parse_grams(io, Role::Fee); }) &&
+         parse_status_change(io);
+}
+
+template <class Io> bool parse_credit_phase(Io &io) {
+  return parse_maybe(io, [&] { return parse_grams(io, Role::Fee); }) &&
+         parse_currencies(io, Role::Value);
+}
+
+template <class Io> bool parse_compute_phase(Io &io) {
+  unsigned long long vm, reason;
+  if (!io.uint(FLAGS, 1, vm)) {
+    return false;
+  }
+  if (!vm) {
+    // cskip_suspended$110 is the only three-bit reason
+    return io.uint(FLAGS, 2, reason) &&
+           (reason != 3 || (io.uint(FLAGS, 1, reason) && reason == 0));
+  }
+  return io.uint(FLAGS, 3) && parse_grams(io, Role::Fee) &&
+         io.ref({Kind::ComputeDetails});
+}
+
+template <class Io> bool parse_storage_used_short(Io &io) {
+  return parse_var_uint(io, INTEGER, 3) && parse_var_uint(io, INTEGER, 3);
+}
+
+template <class Io> bool parse_bounce_phase(Io &io) {
+  unsigned long long ok, no_funds;
+  if (!io.uint(FLAGS, 1, ok)) {
+    return false;
+  }
+  if (ok) {
+    return parse_storage_used_short(io) && parse_grams(io, Role::Fee) &&
+           parse_grams(io, Role::Fee);
+  }
+  return io.uint(FLAGS, 1, no_funds) &&
+         (!no_funds ||
+          (parse_storage_used_short(io) && parse_grams(io, Role::Fee)));
+}
+
+template <class Io> bool parse_transaction_descr(Io &io) {
+  unsigned long long tag, storage_only;
+  auto storage = [&] { return parse_storage_phase(io); };
+  auto action = [&] { return io.ref({Kind::ActionPhase}); };
+  if (!io.uint(FLAGS, 3, tag)) {
+    return false;
+  }
+  if (tag == 0) {
+    if (!io.uint(FLAGS, 1, storage_only)) {
+      return false;
+    }
+    if (storage_only) {
+      return parse_storage_phase(io);
+    }
+    return io.uint(FLAGS, 1) && parse_maybe(io, storage) &&
+           parse_maybe(io, [&] { return parse_credit_phase(io); }) &&
+           parse_compute_phase(io) && parse_maybe(io, action) &&
+           io.uint(FLAGS, 1) &&
+           parse_maybe(io, [&] { return parse_bounce_phase(io); }) &&
+           io.uint(FLAGS, 1);
+  }
+  if (tag == 1) {
+    return io.uint(FLAGS, 1) && parse_storage_phase(io) &&
+           parse_compute_phase(io) && parse_maybe(io, action) &&
+           io.uint(FLAGS, 2);
+  }
+  // split and merge transactions keep their raw payload
+  return false;
+}
+
+template <class Io> bool parse_compute_details(Io &io) {
+  return parse_var_uint(io, INTEGER, 3) && parse_var_uint(io, INTEGER, 3) &&
+         parse_maybe(io, [&] { return parse_var_uint(io, INTEGER, 2); }) &&
+         io.uint(INTEGER, 8) && io.uint(INTEGER, 32) &&
+         parse_maybe(io, [&] { return io.uint(INTEGER, 32); }) &&
+         io.uint(INTEGER, 32) && io.bits(HASH, 256) && io.bits(HASH, 256);
+}
+
+template <class Io> bool parse_action_phase(Io &io) {
+  auto grams = [&] { return parse_grams(io, Role::Fee); };
+  return io.uint(FLAGS, 3) && parse_status_change(io) &&
+         parse_maybe(io, grams) && parse_maybe(io, grams) &&
+         io.uint(INTEGER, 32) &&
+         parse_maybe(io, [&] { return io.uint(INTEGER, 32); }) &&
+         io.uint(INTEGER, 16) && io.uint(INTEGER, 16) &&
+         io.uint(INTEGER, 16) && io.uint(INTEGER, 16) &&
+         io.bits(HASH, 256) && parse_storage_used_short(io);
+}
+
+template <class Io> bool parse_transaction(Io &io) {
+  return io.tag(0x7, 4) && io.interned(ACCOUNT, 256) && io.uint(LT, 64) &&
+         io.hash() && io.uint(LT, 64) && io.uint(TIME, 32) &&
+         io.uint(INTEGER, 15) && io.uint(FLAGS, 4) &&
+         io.ref({Kind::TransactionIo}) && parse_currencies(io, Role::Fee) &&
+         io.ref({Kind::HashUpdate}) && io.ref({Kind::TransactionDescr});
+}
+
+template <class Io> bool parse_transaction_io(Io &io) {
+  return parse_maybe(io, [&] { return io.ref({Kind::Message}); }) &&
+         parse_maybe(io, [&] {
+           return io.ref({Kind::Dict, 15, Kind::MessageRef});
+         });
+}
+
+template <class Io> bool parse_label(Io &io, int max_len, int &rest) {
+  unsigned long long tag, len = 0, bit;
+  if (!io.uint(FLAGS, 1, tag)) {
+    return false;
+  }
+  if (tag == 0) {
+    // hml_short$0: unary length, then the key bits
+    while (true) {
+      if (!io.uint(FLAGS, 1, bit)) {
+        return false;
+      }
+      if (!bit) {
+        break;
+      }
+      if (++len > static_cast<unsigned long long>(max_len)) {
+        return false;
+      }
+    }
+    if (!io.bits(KEY, static_cast<int>(len))) {
+      return false;
+    }
+  } else {
+    if (!io.uint(FLAGS, 1, tag)) {
+      return false;
+    }
+    if (tag == 0) {
+      // hml_long$10
+      if (!io.uint(FLAGS, bits_for(max_len), len) ||
+          len > static_cast<unsigned long long>(max_len) ||
+          !io.bits(KEY, static_cast<int>(len))) {
+        return false;
+      }
+    } else {
+      // hml_same$11
+      if (!io.uint(FLAGS, 1) || !io.uint(FLAGS, bits_for(max_len), len) ||
+          len > static_cast<unsigned long long>(max_len)) {
+        return false;
+      }
+    }
+  }
+  rest = max_len - static_cast<int>(len);
+  return true;
+}
+
+// Label of an edge of a listed dictionary, derived from its keys.
+template <class Io>
+bool parse_listed_label(Io &io, const CellType &type, int &rest) {
+  const auto &dict = io.dict_keys(type.dict);
+  BitWriter label;
+  int len = canonical_label(dict, type.lo, type.hi, dict.n - type.n, label);
+  if (len < 0) {
+    return false;
+  }
+  BitReader reader(reinterpret_cast<const unsigned char *>(label.data().data()),
+                   label.size());
+  while (reader.remaining() > 0) {
+    int chunk = static_cast<int>(std::min<std::size_t>(reader.remaining(), 64));
+    unsigned long long value;
+    reader.read(chunk, value);
+    if (!io.tag(value, chunk)) {
+      return false;
+    }
+  }
+  rest = type.n - len;
+  return true;
+}
+
+// The extra of a fork is normally the aggregate of the extras of its
+// children, in which case it is flagged and recomputed by the decoder.
+template <class Io>
+bool parse_fork_extra(Io &io, const CellType &type, int n) {
+  bool derived;
+  return io.fork_extra(type.x, n, derived) &&
+         (derived || parse_type(io, {type.y}));
+}
+
+template <class Io> bool parse_edge(Io &io, const CellType &type) {
+  int m;
+  if (type.dict >= 0 ? !parse_listed_label(io, type, m)
+                     : !parse_label(io, type.n, m)) {
+    return false;
+  }
+  bool aug = type.y != Kind::None;
+  if (m == 0) {
+    return (!aug || parse_type(io, {type.y})) && parse_type(io, {type.x});
+  }
+  CellType left = type, right = type;
+  left.kind = right.kind = Kind::Edge;
+  left.n = right.n = m - 1;
+  if (type.dict >= 0) {
+    const auto &dict = io.dict_keys(type.dict);
+    int mid = split_point(dict, type.lo, type.hi, dict.n - m);
+    if (mid == type.lo || mid == type.hi) {
+      return false;
+    }
+    left.hi = right.lo = mid;
+  }
+  return io.ref(left) && io.ref(right) &&
+         (!aug || parse_fork_extra(io, type, m - 1));
+}
+
+// The keys of a dictionary are listed before its root edge whenever the
+// encoder finds every label below to be the canonical one; the labels are
+// then derived from the keys instead of stored.
+template <class Io> bool parse_dict(Io &io, CellType type) {
+  if (!io.list_dict(type.n, type.dict)) {
+    return false;
+  }
+  if (type.dict >= 0) {
+    type.lo = 0;
+    type.hi = static_cast<int>(io.dict_keys(type.dict).keys.size());
+  }
+  return parse_edge(io, type);
+}
+
+template <class Io> bool parse_aug_dict(Io &io, const CellType &type) {
+  return parse_maybe(io, [&] {
+           return io.ref({Kind::Dict, type.n, type.x, type.y});
+         }) &&
+         parse_type(io, {type.y});
+}
+
+template <class Io> bool parse_in_msg(Io &io) {
+  unsigned long long tag, deferred;
+  auto msg = [&] { return io.ref({Kind::Message}); };
+  auto env = [&] { return io.ref({Kind::MsgEnvelope}); };
+  auto tx = [&] { return io.ref({Kind::Transaction}); };
+  if (!io.uint(FLAGS, 3, tag)) {
+    return false;
+  }
+  switch (tag) {
+  case 0:
+    return msg() && tx();
+  case 1:
+    // msg_import_deferred_fin$00100, msg_import_deferred_tr$00101
+    if (!io.uint(FLAGS, 2, deferred) || deferred > 1) {
+      return false;
+    }
+    return deferred == 0 ? env() && tx() && parse_grams(io, Role::Fee)
+                         : env() && env();
+  case 2:
+    return msg() && tx() && parse_grams(io, Role::Fee) && io.ref({});
+  case 3:
+  case 4:
+    return env() && tx() && parse_grams(io, Role::Fee);
+  case 5:
+    return env() && env() && parse_grams(io, Role::Fee);
+  case 6:
+    return env() && io.uint(LT, 64) && parse_grams(io, Role::Fee);
+  default:
+    return env() && io.uint(LT, 64) && parse_grams(io, Role::Fee) && io.ref({});
+  }
+}
+
+template <class Io> bool parse_out_msg(Io &io) {
+  unsigned long long tag, sub;
+  auto env = [&] { return io.ref({Kind::MsgEnvelope}); };
+  auto tx = [&] { return io.ref({Kind::Transaction}); };
+  auto in_msg = [&] { return io.ref({Kind::InMsg}); };
+  if (!io.uint(FLAGS, 3, tag)) {
+    return false;
+  }
+  switch (tag) {
+  case 0:
+    return io.ref({Kind::Message}) && tx();
+  case 1:
+    return env() && tx();
+  case 2:
+    return env() && tx() && in_msg();
+  case 3:
+  case 4:
+  case 7:
+    return env() && in_msg();
+  case 5:
+    // msg_export_new_defer$10100, msg_export_deferred_tr$10101
+    if (!io.uint(FLAGS, 2, sub) || sub > 1) {
+      return false;
+    }
+    return sub == 0 ? env() && tx() : env() && in_msg();
+  default:
+    // msg_export_deq$1100, msg_export_deq_short$1101
+    if (!io.uint(FLAGS, 1, sub)) {
+      return false;
+    }
+    return sub == 0 ? env() && io.uint(LT, 63)
+                    : io.hash() && io.uint(INTEGER, 32) &&
+                          io.uint(INTEGER, 64) && io.uint(LT, 64);
+  }
+}
+
+template <class Io> bool parse_account_block(Io &io) {
+  return io.tag(0x5, 4) && io.interned(ACCOUNT, 256) &&
+         parse_dict(io, {Kind::Dict, 64, Kind::TransactionRef,
+                         Kind::CurrencyCollection}) &&
+         io.ref({Kind::HashUpdate});
+}
+
+template <class Io> bool parse_ext_blk_ref(Io &io) {
+  return io.uint(LT, 64) && io.uint(INTEGER, 32) && io.bits(HASH, 256) &&
+         io.bits(HASH, 256);
+}
+
+template <class Io> bool parse_block_info(Io &io) {
+  unsigned long long flag_bits, flags;
+  if (!(io.tag(0x9bc7a987, 32) && io.uint(INTEGER, 32) &&
+        io.uint(FLAGS, 8, flag_bits) && io.uint(FLAGS, 8, flags) &&
+        flags <= 1 && io.uint(INTEGER, 32) && io.uint(INTEGER, 32))) {
+    return false;
+  }
+  bool not_master = (flag_bits >> 7) & 1, after_merge = (flag_bits >> 6) & 1,
+       vert_seqno_incr = flag_bits & 1;
+  // shard_ident$00, gen_utime, start_lt, end_lt and four uint32 counters
+  if (!(io.tag(0, 2) && io.uint(FLAGS, 6) && io.uint(INTEGER, 32) &&
+        io.uint(INTEGER, 64) && io.uint(TIME, 32) && io.uint(LT, 64) &&
+        io.uint(LT, 64) && io.uint(INTEGER, 32) && io.uint(INTEGER, 32) &&
+        io.uint(INTEGER, 32) && io.uint(INTEGER, 32))) {
+    return false;
+  }
+  // gen_software:capabilities#c4
+  if (flags && !(io.tag(0xc4, 8) && io.uint(INTEGER, 32) &&
+                 io.uint(INTEGER, 64))) {
+    return false;
+  }
+  return (!not_master || io.ref({Kind::ExtBlkRef})) &&
+         io.ref({after_merge ? Kind::BlkPrevInfo2 : Kind::ExtBlkRef}) &&
+         (!vert_seqno_incr || io.ref({Kind::ExtBlkRef}));
+}
+
+template <class Io> bool parse_value_flow(Io &io) {
+  unsigned long long tag;
+  if (!io.uint(FLAGS, 32, tag) || (tag != 0xb8e48dfb && tag != 0x3ebf98b7)) {
+    return false;
+  }
+  return io.ref({Kind::ValueFlowPart}) && parse_currencies(io, Role::Balance) &&
+         (tag != 0x3ebf98b7 || parse_currencies(io, Role::Balance)) &&
+         io.ref({Kind::ValueFlowPart});
+}
+
+template <class Io> bool parse_block_extra(Io &io) {
+  return io.tag(0x4a33f6fd, 32) &&
+         io.ref({Kind::AugDict, 256, Kind::InMsg, Kind::ImportFees}) &&
+         io.ref({Kind::AugDict, 256, Kind::OutMsg, Kind::CurrencyCollection}) &&
+         io.ref({Kind::AugDict, 256, Kind::AccountBlock,
+                 Kind::CurrencyCollection}) &&
+         io.bits(HASH, 256) && io.bits(HASH, 256) &&
+         parse_maybe(io, [&] { return io.ref({}); });
+}
+
+// Special cells are only split when they are pruned branches, whose hashes
+// often belong to cells kept on the other side of a Merkle update.
+template <class Io> bool parse_pruned_branch(Io &io) {
+  unsigned long long mask;
+  if (!(io.tag(1, 8) && io.uint(FLAGS, 8, mask) && mask >= 1 && mask <= 7)) {
+    return false;
+  }
+  int count = static_cast<int>((mask & 1) + ((mask >> 1) & 1) + (mask >> 2));
+  for (int i = 0; i < count; i++) {
+    if (!io.hash()) {
+      return false;
+    }
+  }
+  for (int i = 0; i < count; i++) {
+    if (!io.uint(INTEGER, 16)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class Io> bool parse_type(Io &io, const CellType &type) {
+  switch (type.kind) {
+  case Kind::Unknown:
+    return false;
+  case Kind::None:
+    return true;
+  case Kind::Block:
+    return io.tag(0x11ef55aa, 32) && io.uint(INTEGER, 32) &&
+           io.ref({Kind::BlockInfo}) && io.ref({Kind::ValueFlow}) &&
+           io.ref({}) && io.ref({Kind::BlockExtra});
+  case Kind::BlockInfo:
+    return parse_block_info(io);
+  case Kind::ExtBlkRef:
+    return parse_ext_blk_ref(io);
+  case Kind::BlkPrevInfo2:
+    return io.ref({Kind::ExtBlkRef}) && io.ref({Kind::ExtBlkRef});
+  case Kind::ValueFlow:
+    return parse_value_flow(io);
+  case Kind::ValueFlowPart:
+    return parse_currencies(io, Role::Balance) &&
+           parse_currencies(io, Role::Balance) &&
+           parse_currencies(io, Role::Balance) &&
+           parse_currencies(io, Role::Balance);
+  case Kind::BlockExtra:
+    return parse_block_extra(io);
+  case Kind::AugDict:
+    return parse_aug_dict(io, type);
+  case Kind::Dict:
+    return parse_dict(io, type);
+  case Kind::Edge:
+    return parse_edge(io, type);
+  case Kind::Transaction:
+    return parse_transaction(io);
+  case Kind::TransactionIo:
+    return parse_transaction_io(io);
+  case Kind::TransactionDescr:
+    return parse_transaction_descr(io);
+  case Kind::ComputeDetails:
+    return parse_compute_details(io);
+  case Kind::ActionPhase:
+    return parse_action_phase(io);
+  case Kind::HashUpdate:
+    return io.tag(0x72, 8) && io.hash() && io.hash();
+  case Kind::Message:
+    return parse_message(io);
+  case Kind::MsgEnvelope:
+    return parse_msg_envelope(io);
+  case Kind::StateInit:
+    return parse_state_init(io);
+  case Kind::PrunedBranch:
+    return parse_pruned_branch(io);
+  case Kind::AccountBlock:
+    return parse_account_block(io);
+  case Kind::InMsg:
+    return parse_in_msg(io);
+  case Kind::OutMsg:
+    return parse_out_msg(io);
+  case Kind::ImportFees:
+    return parse_grams(io, Role::Fee) && parse_currencies(io, Role::Value);
+  case Kind::CurrencyCollection:
+    return parse_currencies(io, Role::Fee);
+  case Kind::TransactionRef:
+    return io.ref({Kind::Transaction});
+  case Kind::MessageRef:
+    return io.ref({Kind::Message});
+  case Kind::VarUInt32:
+    return io.amount(Role::Currency, 5);
+  }
+  return false;
+}
+
+// Reads hashmap labels straight from a cell.
+class LabelScanner {
+public:
+  explicit LabelScanner(BitReader &reader) : reader(reader) {}
+
+  bool uint(int, int n, unsigned long long &value) {
+    return reader.read(n, value);
+  }
+
+  bool uint(int column, int n) {
+    unsigned long long value;
+    return uint(column, n, value);
+  }
+
+  bool bits(int, int n) { return reader.skip(n); }
+
+private:
+  BitReader &reader;
+};
+
+// Length of the hashmap label at the start of an edge with n key bits left,
+// or -1.
+int label_length(const unsigned char *data, std::size_t bits, int n) {
+  BitReader reader(data, bits);
+  LabelScanner scanner(reader);
+  int m;
+  return parse_label(scanner, n, m) ? static_cast<int>(reader.position()) : -1;
+}
+
+// Augmentations of the dictionaries whose fork extras are recomputed.
+const vm::AugmentationData *augmentation(Kind x) {
+  switch (x) {
+  case Kind::InMsg:
+    return &block::tlb::aug_InMsgDescr;
+  case Kind::OutMsg:
+    return &block::tlb::aug_OutMsgDescr;
+  case Kind::AccountBlock:
+    return &block::tlb::aug_ShardAccountBlocks;
+  case Kind::TransactionRef:
+    return &block::tlb::aug_AccountTransactions;
+  default:
+    return nullptr;
+  }
+}
+
+// Logistic domain of the payload mixer: squash maps a stretched prediction
+// in [-2047, 2047] to a 12-bit probability, interpolating 33 points of
+// 4096 / (1 + e^(-d / 256)).
+int squash(int d) {
+  static const int t[33] = {1,    2,    3,    6,    10,   16,   27,
+                            45,   73,   120,  194,  310,  488,  747,
+                            1101, 1546, 2047, 2549, 2994, 3348, 3607,
+                            3785, 3901, 3975, 4022, 4050, 4068, 4079,
+                            4085, 4089, 4092, 4093, 4094};
+  if (d > 2047) {
+    return 4095;
+  }
+  if (d < -2047) {
+    return 0;
+  }
+  int w = d & 127;
+  d = (d >> 7) + 16;
+  return (t[d] * (128 - w) + t[d + 1] * w + 64) >> 7;
+}
+
+// What the decoder knows about a cell when it reaches its payload.
+struct PayloadContext {
+  Kind kind;
+  bool typed;
+  unsigned char d1;
+  unsigned char d2;
+  unsigned offset; // first payload bit in the cell data
+  unsigned char head; // first data byte, the offset bits before the payload
+};
+
+// The first byte of data with only its first known bits kept.
+unsigned char known_head(const unsigned char *data, std::size_t known) {
+  return known == 0 ? 0
+                    : data[0] & static_cast<unsigned char>(
+                                    0xFF00 >> std::min<std::size_t>(known, 8));
+}
+
+// Tags cells by structural signature: the type their parent gives them,
+// whether they were split, d1, d2 and the first data byte, which holds the
+// constructor tag of most cells. Ids are handed out in order of first
+// appearance, so the decoder derives the same ones without side information.
+// Id 0 stands for a cell whose first byte is not known yet.
+class CellClassifier {
+public:
+  static const int MAX_CLASSES = 256;
+
+  int classify(const PayloadContext &ctx, unsigned char head) {
+    uint64_t signature = static_cast<uint64_t>(ctx.kind) |
+                         static_cast<uint64_t>(ctx.typed) << 8 |
+                         static_cast<uint64_t>(ctx.d1) << 16 |
+                         static_cast<uint64_t>(ctx.d2) << 24 |
+                         static_cast<uint64_t>(head) << 32;
+    auto it = classes.find(signature);
+    if (it != classes.end()) {
+      return it->second;
+    }
+    int id = std::min(static_cast<int>(classes.size()) + 1, MAX_CLASSES - 1);
+    classes.emplace(signature, id);
+    return id;
+  }
+
+private:
+  std::unordered_map<uint64_t, int> classes;
+};
+
+// Bitwise context-mixing model of PAYLOAD. Each bit is predicted from its
+// position in the cell and the class of the cell, the descriptors and type
+// of the cell, the bits at the same offset of the previous cell with the
+// same layout, and the bits before it in the cell. A mixer per class, picked
+// further by the bit of that previous cell, combines the predictions. The
+// class is known once the first byte of the cell is. Contexts are hashed
+// once per nibble and the bits of the nibble so far index a 16-slot block,
+// so every model touches one cache line per nibble.
+class PayloadModel {
+public:
+  PayloadModel()
+      : tables(MODELS, std::vector<uint16_t>(1 << TABLE_BITS, 1 << 15)),
+        weights(CellClassifier::MAX_CLASSES * 3 * INPUTS, 1 << 14) {
+    int next = 0;
+    for (int x = -2047; x <= 2047; x++) {
+      for (int v = squash(x); next <= v; next++) {
+        stretch[next] = x;
+      }
+    }
+    for (; next < 4096; next++) {
+      stretch[next] = 2047;
+    }
+  }
+
+  // Codes the first n bits of bytes, the decoder passes zeros and gets the
+  // decoded bits.
+  template <class Coder>
+  void code(Coder &coder, const PayloadContext &ctx, std::string &bytes,
+            std::size_t n) {
+    uint64_t layout =
+        mix(mix(mix(mix(mix(0, static_cast<uint64_t>(ctx.kind)), ctx.typed),
+                    ctx.d1),
+                ctx.d2),
+            ctx.offset);
+    std::string &prev = previous[layout];
+    auto prev_bit = [&](std::size_t i) -> unsigned {
+      return i / 8 < prev.size()
+                 ? (static_cast<unsigned char>(prev[i / 8]) >> (7 - i % 8)) & 1
+                 : 0;
+    };
+
+    uint64_t kind = static_cast<uint64_t>(ctx.kind);
+    // payload bits that complete the first byte of the cell
+    std::size_t head_bits =
+        ctx.offset >= 8 || ctx.offset + n < 8 ? 0 : 8 - ctx.offset;
+    int cell_class = 0;
+    auto class_base = [&](std::size_t pos) {
+      return (mix(mix(mix(1, kind), cell_class), pos) >> (64 - TABLE_BITS)) &
+             ~std::size_t{15};
+    };
+
+    uint64_t history = 0;
+    std::array<std::size_t, MODELS> base{};
+    unsigned node = 1;
+    for (std::size_t i = 0; i < n; i++) {
+      std::size_t pos = ctx.offset + i;
+      if (i == head_bits) {
+        unsigned char first = ctx.head;
+        if (head_bits > 0) {
+          first |= static_cast<unsigned char>(bytes[0]) >> ctx.offset;
+        }
+        cell_class = classifier.classify(ctx, first);
+        base[0] = class_base(pos - i % 4);
+      }
+      if (i % 4 == 0) {
+        uint64_t window = prev.empty() ? 1 << 12 : 0;
+        for (std::size_t j = i; j < i + 12; j++) {
+          window = window << 1 | prev_bit(j);
+        }
+        uint64_t hashes[MODELS] = {
+            0,
+            mix(mix(mix(mix(2, kind), ctx.d1), ctx.d2), pos),
+            mix(mix(3, kind), window),
+            mix(mix(4, kind), history & 0xFFFF),
+            mix(5, history & 0xFFFFFFFF),
+        };
+        base[0] = class_base(pos);
+        for (int k = 1; k < MODELS; k++) {
+          base[k] = (hashes[k] >> (64 - TABLE_BITS)) & ~std::size_t{15};
+        }
+        node = 1;
+      }
+      unsigned mixer = cell_class * 3 + (prev.empty() ? 2 : prev_bit(i));
+      int *w = &weights[mixer * INPUTS];
+      int st[INPUTS];
+      long long dot = 0;
+      for (int k = 0; k < MODELS; k++) {
+        st[k] = stretch[tables[k][base[k] | node] >> 4];
+      }
+      st[MODELS] = 256;
+      for (int k = 0; k < INPUTS; k++) {
+        dot += static_cast<long long>(w[k]) * st[k];
+      }
+      int p = std::min(4095, std::max(1, squash(static_cast<int>(dot >> 16))));
+
+      unsigned bit =
+          (static_cast<unsigned char>(bytes[i / 8]) >> (7 - i % 8)) & 1;
+      coder.predicted(static_cast<unsigned>(p), bit);
+      if (bit) {
+        bytes[i / 8] = static_cast<char>(bytes[i / 8] | (0x80 >> (i % 8)));
+      }
+
+      int err = (static_cast<int>(bit) << 12) - p;
+      for (int k = 0; k < INPUTS; k++) {
+        w[k] += (st[k] * err) >> 10;
+      }
+      for (int k = 0; k < MODELS; k++) {
+        uint16_t &t = tables[k][base[k] | node];
+        if (bit) {
+          t += (65535 - t) >> 4;
+        } else {
+          t -= t >> 4;
+        }
+      }
+      node = node * 2 + bit;
+      history = history << 1 | bit;
+    }
+    prev = bytes;
+  }
+
+private:
+  static const int MODELS = 5;
+  static const int INPUTS = MODELS + 1; // and a bias
+  static const int TABLE_BITS = 18;
+
+  std::vector<std::vector<uint16_t>> tables;
+  std::vector<int> weights;
+  std::array<int, 4096> stretch;
+  std::unordered_map<uint64_t, std::string> previous;
+  CellClassifier classifier;
+
+  static uint64_t mix(uint64_t h, uint64_t x) {
+    h = (h ^ x) * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 29);
+  }
+};
+
+class BlockEncoder {
+public:
+  std::vector<std::string> streams;
+
+  td::Status encode(td::Ref<vm::Cell> root) {
+    streams.assign(STREAM_COUNT, {});
+    state = {};
+    visited.clear();
+    next_id = 0;
+    payload_model = PayloadModel();
+    payload_coder = RangeEncoder();
+    TRY_RESULT(dc, load_data_cell(root));
+    TRY_STATUS(visit(std::move(dc), {Kind::Block}));
+    for (int i = FIRST_COLUMN; i < STREAM_COUNT; i++) {
+      streams[i] = state.columns[i].data();
+    }
+    streams[GRAMS] = encode_amounts(std::move(state.amounts));
+    streams[PAYLOAD] = payload_coder.finish();
+    return td::Status::OK();
+  }
+
+private:
+  td::HashMap<vm::Cell::Hash, int> visited;
+  SplitState state;
+  PayloadModel payload_model;
+  RangeEncoder payload_coder;
+  int next_id{0};
+
+  static td::Result<td::Ref<vm::DataCell>>
+  load_data_cell(const td::Ref<vm::Cell> &cell) {
+    TRY_RESULT(loaded, cell->load_cell());
+    return std::move(loaded.data_cell);
+  }
+
+  // Collects the keys below an edge starting at bit pos and ref of dc in
+  // ascending order, along with the label of every edge in preorder.
+  bool walk_edge(const vm::DataCell &dc, std::size_t pos, unsigned ref, int n,
+                 const BitWriter &prefix, std::vector<std::string> &keys,
+                 std::vector<BitWriter> &labels) {
+    BitReader reader(dc.get_data(), dc.get_bits());
+    LabelScanner scanner(reader);
+    int m;
+    if (!reader.skip(pos) || !parse_label(scanner, n, m)) {
+      return false;
+    }
+    BitReader label(dc.get_data(), reader.position());
+    label.skip(pos);
+    labels.emplace_back();
+    labels.back().append(label);
+
+    // the key bits are the tail of hml_short and hml_long, hml_same$11
+    // repeats its third bit
+    int len = n - m;
+    BitWriter key = prefix;
+    BitReader raw(reinterpret_cast<const unsigned char *>(
+                      labels.back().data().data()),
+                  labels.back().size());
+    unsigned long long same, v;
+    raw.read(2, same);
+    if (same == 3) {
+      raw.read(1, v);
+      for (int i = 0; i < len; i++) {
+        key.write(v, 1);
+      }
+    } else {
+      raw.skip(raw.remaining() - len);
+      key.append(raw);
+    }
+    if (m == 0) {
+      keys.push_back(key.data());
+      return true;
+    }
+    if (ref + 2 > dc.size_refs()) {
+      return false;
+    }
+    for (unsigned side = 0; side < 2; side++) {
+      auto r_child = load_data_cell(dc.get_ref(ref + side));
+      if (r_child.is_error() || r_child.ok()->is_special()) {
+        return false;
+      }
+      BitWriter child_prefix = key;
+      child_prefix.write(side, 1);
+      if (!walk_edge(*r_child.ok(), 0, 0, m - 1, child_prefix, keys, labels)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static bool check_labels(const DictKeys &dict, int lo, int hi, int depth,
+                           const std::vector<BitWriter> &labels,
+                           std::size_t &next) {
+    BitWriter label;
+    int len = canonical_label(dict, lo, hi, depth, label);
+    if (len < 0 || next >= labels.size() ||
+        label.size() != labels[next].size() ||
+        label.data() != labels[next].data()) {
+      return false;
+    }
+    next++;
+    if (depth + len == dict.n) {
+      return true;
+    }
+    int mid = split_point(dict, lo, hi, depth + len);
+    return check_labels(dict, lo, mid, depth + len + 1, labels, next) &&
+           check_labels(dict, mid, hi, depth + len + 1, labels, next);
+  }
+
+  bool list_keys(const vm::DataCell &dc, std::size_t pos, unsigned ref, int n,
+                 std::vector<std::string> &keys) {
+    DictKeys dict{n, {}};
+    std::vector<BitWriter> labels;
+    if (!walk_edge(dc, pos, ref, n, BitWriter(), dict.keys, labels)) {
+      return false;
+    }
+    std::size_t next = 0;
+    if (!check_labels(dict, 0, static_cast<int>(dict.keys.size()), 0, labels,
+                      next) ||
+        next != labels.size()) {
+      return false;
+    }
+    keys = std::move(dict.keys);
+    return true;
+  }
+
+  // Only extras without refs are derived, so the fork keeps exactly its two
+  // children and the recomputed bits can be checked against the stored ones.
+  bool check_extra(const vm::DataCell &dc, std::size_t pos, Kind x, int n) {
+    auto aug = augmentation(x);
+    if (!aug || dc.size_refs() != 2) {
+      return false;
+    }
+    vm::CellSlice children[2];
+    for (unsigned k = 0; k < 2; k++) {
+      auto r_child = load_data_cell(dc.get_ref(k));
+      if (r_child.is_error() || r_child.ok()->is_special()) {
+        return false;
+      }
+      int len =
+          label_length(r_child.ok()->get_data(), r_child.ok()->get_bits(), n);
+      children[k] = vm::CellSlice(vm::NoVmOrd(), dc.get_ref(k));
+      if (len < 0 || !children[k].advance(len)) {
+        return false;
+      }
+    }
+    vm::CellBuilder cb;
+    if (!aug->eval_fork(cb, children[0], children[1]) || cb.size_refs() != 0 ||
+        cb.size() != dc.get_bits() - pos) {
+      return false;
+    }
+    BitReader stored(dc.get_data(), dc.get_bits());
+    BitReader computed(cb.get_data(), cb.size());
+    stored.skip(pos);
+    while (stored.remaining() > 0) {
+      int chunk =
+          static_cast<int>(std::min<std::size_t>(64, stored.remaining()));
+      unsigned long long a, b;
+      if (!stored.read(chunk, a) || !computed.read(chunk, b) || a != b) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Splits the cell into the columns, or leaves them untouched and returns
+  // false when the cell does not match its type.
+  bool split(FieldSplitter &io, const CellType &type) {
+    std::array<std::size_t, STREAM_COUNT> sizes, table_sizes;
+    for (int i = FIRST_COLUMN; i < STREAM_COUNT; i++) {
+      sizes[i] = state.columns[i].size();
+      table_sizes[i] = state.tables[i].values.size();
+    }
+    std::size_t dict_count = state.dicts.size();
+    std::size_t amount_count = state.amounts.size();
+    if (parse_type(io, type)) {
+      return true;
+    }
+    for (int i = FIRST_COLUMN; i < STREAM_COUNT; i++) {
+      state.columns[i].truncate(sizes[i]);
+      state.tables[i].truncate(table_sizes[i]);
+    }
+    state.dicts.resize(dict_count);
+    state.amounts.resize(amount_count);
+    return false;
+  }
+
+  td::Status visit(td::Ref<vm::DataCell> dc, CellType type) {
+    int id = next_id++;
+    visited[dc->get_hash()] = id;
+
+    unsigned char buf[256];
+    dc->serialize(buf, 256, false);
+    unsigned bits = dc->get_bits();
+    streams[DESCRIPTOR].push_back(static_cast<char>(buf[0]));
+    streams[BIT_LENGTH].push_back(static_cast<char>(bits >> 8));
+    streams[BIT_LENGTH].push_back(static_cast<char>(bits & 0xff));
+
+    std::vector<CellType> ref_types(dc->size_refs());
+    FieldSplitter io(buf + 2, bits, dc->size_refs(), state, id,
+                     [&](std::size_t bit, unsigned ref, int n,
+                         std::vector<std::string> &keys) {
+                       return list_keys(*dc, bit, ref, n, keys);
+                     },
+                     [&](std::size_t bit, Kind x, int n) {
+                       return check_extra(*dc, bit, x, n);
+                     });
+    BitReader rest(buf + 2, bits);
+    if (dc->is_special()) {
+      type = {Kind::PrunedBranch};
+    }
+    bool typed = false;
+    if (type.kind != Kind::Unknown) {
+      typed = split(io, type);
+      streams[TYPED].push_back(typed ? 1 : 0);
+      if (typed) {
+        std::copy(io.ref_types.begin(), io.ref_types.end(), ref_types.begin());
+        rest = io.rest();
+      }
+    }
+    std::size_t rest_bits = rest.remaining();
+    BitWriter payload;
+    payload.append(rest);
+    std::string payload_bytes = payload.data();
+    unsigned offset = static_cast<unsigned>(bits - rest_bits);
+    payload_model.code(payload_coder,
+                       {type.kind, typed, buf[0], buf[1], offset,
+                        known_head(buf + 2, offset)},
+                       payload_bytes, rest_bits);
+
+    for (unsigned k = 0; k < dc->size_refs(); k++) {
+      TRY_RESULT(child, load_data_cell(dc->get_ref(k)));
+      auto it = visited.find(child->get_hash());
+      if (it != visited.end()) {
+        store_varint(streams[REFS], next_id - it->second);
+      } else {
+        store_varint(streams[REFS], 0);
+        TRY_STATUS(visit(std::move(child), ref_types[k]));
+      }
+    }
+    for (unsigned level = 0; level <= dc->get_level(); level++) {
+      state.hashes.emplace(dc->get_hash(level).as_slice().str(),
+                     HashTarget{id, static_cast<int>(level)});
+    }
+    return td::Status::OK();
+  }
+};
+
+class BlockDecoder {
+public:
+  td::Result<td::Ref<vm::Cell>> decode(const std::vector<std::string> &data) {
+    if (data.size() != STREAM_COUNT) {
+      return td::Status::Error("unexpected number of streams");
+    }
+    for (int i = 0; i < STREAM_COUNT; i++) {
+      streams[i] = StreamReader(data[i]);
+    }
+    state = {};
+    for (int i = 0; i < STREAM_COUNT; i++) {
+      state.columns[i] = BitReader(
+          reinterpret_cast<const unsigned char *>(data[i].data()),
+          data[i].size() * 8);
+    }
+    state.amounts = AmountDecoder(
+        reinterpret_cast<const unsigned char *>(data[GRAMS].data()),
+        data[GRAMS].size());
+    payload_model = PayloadModel();
+    payload_decoder = RangeDecoder(
+        reinterpret_cast<const unsigned char *>(data[PAYLOAD].data()),
+        data[PAYLOAD].size());
+    cells.clear();
+    build_order.clear();
+    TRY_STATUS(parse_cell({Kind::Block}));
+
+    std::vector<td::Ref<vm::Cell>> built(cells.size());
+    for (int id : build_order) {
+      auto &cell = cells[id];
+      for (const auto &patch : cell.patches) {
+        if (built[patch.target].is_null()) {
+          return td::Status::Error("hash of a cell that is not built yet");
+        }
+        auto hash = built[patch.target]->get_hash(patch.level);
+        store_bits_at(cell.payload, patch.offset, hash.as_slice().ubegin(), 256);
+      }
+      for (const auto &patch : cell.extras) {
+        TRY_STATUS(recompute_extra(cell, patch, built));
+      }
+      vm::CellBuilder cb;
+      cb.store_bits(reinterpret_cast<const unsigned char *>(cell.payload.data()),
+                    cell.bits);
+      for (int ref : cell.refs) {
+        cb.store_ref(built[ref]);
+      }
+      TRY_RESULT(dc, cb.finalize_novm_nothrow((cell.d1 & 8) != 0));
+      built[id] = std::move(dc);
+    }
+    return std::move(built[0]);
+  }
+
+private:
+  struct Cell {
+    unsigned char d1;
+    unsigned bits;
+    std::string payload;
+    std::vector<int> refs;
+    std::vector<HashPatch> patches;
+    std::vector<ExtraPatch> extras;
+  };
+  std::array<StreamReader, STREAM_COUNT> streams;
+  JoinState state;
+  PayloadModel payload_model;
+  RangeDecoder payload_decoder;
+  std::vector<Cell> cells;
+  std::vector<int> build_order;
+
+  td::Status recompute_extra(Cell &cell, const ExtraPatch &patch,
+                             const std::vector<td::Ref<vm::Cell>> &built) {
+    auto aug = augmentation(patch.x);
+    if (!aug || cell.refs.size() != 2) {
+      return td::Status::Error("invalid derived extra");
+    }
+    vm::CellSlice children[2];
+    for (unsigned k = 0; k < 2; k++) {
+      const auto &child = cells[cell.refs[k]];
+      int len = label_length(
+          reinterpret_cast<const unsigned char *>(child.payload.data()),
+          child.bits, patch.n);
+      children[k] = vm::CellSlice(vm::NoVmOrd(), built[cell.refs[k]]);
+      if (len < 0 || !children[k].advance(len)) {
+        return td::Status::Error("invalid child of a derived extra");
+      }
+    }
+    vm::CellBuilder cb;
+    if (!aug->eval_fork(cb, children[0], children[1]) || cb.size_refs() != 0 ||
+        patch.offset + cb.size() != cell.bits) {
+      return td::Status::Error("derived extra does not fit");
+    }
+    store_bits_at(cell.payload, patch.offset, cb.get_data(), cb.size());
+    return td::Status::OK();
+  }
+
+  td::Status parse_cell(CellType type) {
+    int id = cells.size();
+    cells.emplace_back();
+    TRY_RESULT(d1, streams[DESCRIPTOR].byte());
+    TRY_RESULT(bits, streams[BIT_LENGTH].uint(2));
+    if ((d1 & 7) > 4 || bits > 1023) {
+      return td::Status::Error("invalid cell descriptor");
+    }
+
+    std::vector<CellType> ref_types(d1 & 7);
+    FieldJoiner io(static_cast<unsigned>(bits), d1 & 7, state, id);
+    if (d1 & 8) {
+      type = {Kind::PrunedBranch};
+    }
+    bool typed = false;
+    if (type.kind != Kind::Unknown) {
+      TRY_RESULT(flag, streams[TYPED].byte());
+      typed = flag != 0;
+      if (typed && !parse_type(io, type)) {
+        return td::Status::Error("invalid typed cell");
+      }
+      std::copy(io.ref_types.begin(), io.ref_types.end(), ref_types.begin());
+    }
+    std::size_t rest = bits - io.cell.size();
+    std::string tail((rest + 7) / 8, '\0');
+    auto offset = static_cast<unsigned>(io.cell.size());
+    payload_model.code(
+        payload_decoder,
+        {type.kind, typed, d1,
+         static_cast<unsigned char>((bits + 7) / 8 + bits / 8), offset,
+         known_head(reinterpret_cast<const unsigned char *>(
+                        io.cell.data().data()),
+                    offset)},
+        tail, rest);
+    BitReader tail_reader(reinterpret_cast<const unsigned char *>(tail.data()),
+                          rest);
+    io.cell.append(tail_reader);
+    cells[id].d1 = d1;
+    cells[id].bits = static_cast<unsigned>(bits);
+    cells[id].payload = io.cell.data();
+    cells[id].patches = std::move(io.patches);
+    cells[id].extras = std::move(io.extras);
+
+    for (int k = 0; k < (d1 & 7); k++) {
+      TRY_RESULT(back, streams[REFS].varint());
+      int child_id;
+      if (back == 0) {
+        child_id = cells.size();
+        TRY_STATUS(parse_cell(ref_types[k]));
+      } else {
+        if (back > cells.size()) {
+          return td::Status::Error("invalid back reference");
+        }
+        child_id = static_cast<int>(cells.size() - back);
+      }
+      cells[id].refs.push_back(child_id);
+    }
+    build_order.push_back(id);
+    return td::Status::OK();
+  }
+};
+
+td::BufferSlice compress(td::Slice data) {
+  td::Ref<vm::Cell> root = vm::std_boc_deserialize(data).move_as_ok();
+  BlockEncoder encoder;
+  encoder.encode(root).ensure();
+  for (const auto &column : DELTA_COLUMNS) {
+    auto &stream = encoder.streams[column.first];
+    stream = delta_encode(stream, column.second);
+  }
+  return td::BufferSlice(pack_streams(encoder.streams));
+}
+
+td::BufferSlice decompress(td::Slice data) {
+  auto streams = unpack_streams(data).move_as_ok();
+  CHECK(streams.size() == STREAM_COUNT);
+  for (const auto &column : DELTA_COLUMNS) {
+    auto &stream = streams[column.first];
+    stream = delta_decode(stream, column.second).move_as_ok();
+  }
+  auto root = BlockDecoder().decode(streams).move_as_ok();
+  return vm::std_boc_serialize(root, 31).move_as_ok();
+}
+
+int main() {
+  std::string mode;
+  std::cin >> mode;
+  CHECK(mode == "compress" || mode == "decompress");
+
+  std::string base64_data;
+  std::cin >> base64_data;
+  CHECK(!base64_data.empty());
+
+  td::BufferSlice data(td::base64_decode(base64_data).move_as_ok());
+
+  if (mode == "compress") {
+    data = compress(data);
+  } else {
+    data = decompress(data);
+  }
+
+  std::cout << td::base64_encode(data) << std::endl;
+}
@@ -1196,7 +1196,13 @@ int tinyLzmaDecompress(const uint8_t *p_src, size_t src_len, uint8_t *p_dst,
 #include "td/utils/base64.h"
 #include "vm/boc.h"
 #include "bitshuffle_core.h"
+#include "bitshuffle_internals.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <thread>
+#include <vector>
 td::BufferSlice lzma_compress(td::Slice data) {
   const std::size_t src_len = data.size();
   auto dst_len = src_len + (src_len >> 2) + 4096;
@@ -1217,14 +1223,321 @@ td::Result<td::BufferSlice> lzma_decompress(td::Slice data,
   output.truncate(dst_len);
   return output;
 }
+// ---------------------------------------------------------------------------
+// Element size sweep
+//   Every element size in [1..MAX_ELEM_SIZE] is pre-screened by a greedy LZ
+//   estimate of its bitshuffled data, about 1/25 of an LZMA run. Only the
+//   TOP_K best estimates get the real coder.
+// ---------------------------------------------------------------------------
+const size_t MAX_ELEM_SIZE = 1024;
+const size_t TOP_K = 8;
+const int THREADS = 4;
+const int ESTIMATE_HASH_BITS = 16;
+const size_t ESTIMATE_MIN_MATCH = 4;
+const double ESTIMATE_MATCH_BITS = 24;
+
+// Calls f(i) for i in [0, n). Index i always runs on thread i % THREADS.
+template <class F> void parallel_for(int n, F &&f) {
+  std::vector<std::thread> workers;
+  for (int t = 1; t < THREADS && t < n; t++) {
+    workers.emplace_back([&f, n, t] {
+      for (int i = t; i < n; i += THREADS) {
+        f(i);
+      }
+    });
+  }
+  for (int i = 0; i < n; i += THREADS) {
+    f(i);
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+}
+
+// The input zero-padded to whole elements of es bytes, bitshuffled.
+std::vector<uint8_t> bitshuffled(const std::vector<uint8_t> &input,
+                                 size_t es) {
+  size_t remainder = input.size() % es;
+  size_t pad = (remainder == 0) ? 0 : (es - remainder);
+  std::vector<uint8_t> padded_input(input.size() + pad, 0);
+  std::memcpy(padded_input.data(), input.data(), input.size());
+
+  std::vector<uint8_t> shuffled_out(padded_input.size());
+  int64_t ret = bshuf_bitshuffle(padded_input.data(), shuffled_out.data(),
+                                 padded_input.size() / es, es,
+                                 0 /* block_size=0 => automatic */);
+  CHECK(ret >= 0);
+  return shuffled_out;
+}
+
+// Rough LZMA size of the bytes, in bits: a greedy parse against the last
+// position of each 4-byte hash, every match at ESTIMATE_MATCH_BITS and
+// every literal at its order-0 cost.
+double estimate_lzma_bits(const std::vector<uint8_t> &bytes) {
+  const size_t n = bytes.size();
+  size_t counts[256] = {0};
+  for (uint8_t byte : bytes) {
+    counts[byte]++;
+  }
+  double literal_bits[256];
+  for (int i = 0; i < 256; i++) {
+    literal_bits[i] = counts[i] ? -std::log2((double)counts[i] / n) : 0;
+  }
+
+  std::vector<uint32_t> last(1 << ESTIMATE_HASH_BITS, UINT32_MAX);
+  double bits = 0;
+  size_t i = 0;
+  while (i < n) {
+    if (i + ESTIMATE_MIN_MATCH <= n) {
+      uint32_t word;
+      std::memcpy(&word, &bytes[i], 4);
+      uint32_t &candidate =
+          last[(word * 2654435761u) >> (32 - ESTIMATE_HASH_BITS)];
+      size_t match = candidate;
+      candidate = (uint32_t)i;
+      if (match != UINT32_MAX) {
+        size_t length = 0;
+        while (i + length < n && bytes[match + length] == bytes[i + length]) {
+          length++;
+        }
+        if (length >= ESTIMATE_MIN_MATCH) {
+          bits += ESTIMATE_MATCH_BITS;
+          i += length;
+          continue;
+        }
+      }
+    }
+    bits += literal_bits[bytes[i]];
+    i++;
+  }
+  return bits;
+}
+
+// ---------------------------------------------------------------------------
+// Structure-aware transpose (elem_size STRUCTURE_TRANSPOSE in the header)
+//   The cells of the serialized BoC are grouped by layout: cells with the
+//   same d1/d2 descriptor have the same refs and data bit length, so their
+//   bodies (data + refs) line up as the rows of a matrix. The cell area is
+//   rewritten as the descriptors of all cells, in order, followed by each
+//   group's matrix bit-transposed with bshuf_trans_bit_elem, groups in
+//   order of first appearance. The BoC header is kept, and the descriptors
+//   give the group boundaries back, so no side info is written.
+// ---------------------------------------------------------------------------
+const size_t STRUCTURE_TRANSPOSE = 0;
+
+struct BocCells {
+  size_t begin = 0;  // offset of the first cell
+  size_t end = 0;    // offset past the last cell
+  size_t count = 0;
+  size_t ref_size = 0;
+};
+
+size_t read_be(const uint8_t *p, size_t bytes) {
+  size_t value = 0;
+  for (size_t i = 0; i < bytes; i++) {
+    value = (value << 8) | p[i];
+  }
+  return value;
+}
+
+// Finds the cell area of a serialized BoC. Returns false if data is not
+// one or its header does not fit.
+bool find_boc_cells(const std::vector<uint8_t> &data, BocCells &cells) {
+  if (data.size() < 6 || read_be(data.data(), 4) != 0xb5ee9c72) {
+    return false;
+  }
+  bool has_index = data[4] & 0x80;
+  size_t ref_size = data[4] & 7;
+  size_t offset_size = data[5];
+  if (ref_size == 0 || ref_size > 4 || offset_size == 0 || offset_size > 8) {
+    return false;
+  }
+  size_t pos = 6;
+  if (data.size() < pos + 3 * ref_size + offset_size) {
+    return false;
+  }
+  size_t count = read_be(&data[pos], ref_size);
+  size_t roots = read_be(&data[pos + ref_size], ref_size);
+  pos += 3 * ref_size;
+  size_t cells_size = read_be(&data[pos], offset_size);
+  pos += offset_size + roots * ref_size;
+  if (has_index) {
+    pos += count * offset_size;
+  }
+  if (pos > data.size() || cells_size > data.size() - pos ||
+      2 * count > cells_size) {
+    return false;
+  }
+  cells.begin = pos;
+  cells.end = pos + cells_size;
+  cells.count = count;
+  cells.ref_size = ref_size;
+  return true;
+}
+
+// Body bytes (stored hashes and depths, data, refs) of a cell with
+// descriptor d1, d2. Absent cells are not handled.
+bool cell_body_size(uint8_t d1, uint8_t d2, size_t ref_size, size_t &size) {
+  if ((d1 & 7) > 4) {
+    return false;
+  }
+  size = (d2 >> 1) + (d2 & 1) + (d1 & 7) * ref_size;
+  if ((d1 & 16) != 0) {
+    // one hash and depth per level in the level mask, and one more
+    size += (__builtin_popcount(d1 >> 5) + 1) * (32 + 2);
+  }
+  return true;
+}
+
+struct CellGroup {
+  size_t body_size = 0;
+  std::vector<size_t> bodies;  // offsets of the bodies in the BoC
+};
+
+// Groups the cells by descriptor, reading descriptor i at
+// descriptors + 2 * i. Bodies are where they sit in the untransposed BoC.
+bool group_cells(const std::vector<uint8_t> &data, const BocCells &cells,
+                 size_t descriptors, std::vector<CellGroup> &groups) {
+  std::vector<int> group_of(1 << 16, -1);
+  size_t pos = cells.begin;
+  for (size_t i = 0; i < cells.count; i++) {
+    uint8_t d1 = data[descriptors + 2 * i];
+    uint8_t d2 = data[descriptors + 2 * i + 1];
+    size_t body_size;
+    if (!cell_body_size(d1, d2, cells.ref_size, body_size) ||
+        body_size + 2 > cells.end - pos) {
+      return false;
+    }
+    int &group = group_of[d1 << 8 | d2];
+    if (group < 0) {
+      group = (int)groups.size();
+      groups.emplace_back();
+      groups.back().body_size = body_size;
+    }
+    groups[group].bodies.push_back(pos + 2);
+    pos += 2 + body_size;
+  }
+  return pos == cells.end;
+}
+
+// Rows whose count is not a multiple of 8 are left as they are, like
+// bshuf_bitshuffle leaves the elements past its last block.
+void transpose_rows(const uint8_t *in, uint8_t *out, size_t rows,
+                    size_t row_size) {
+  size_t transposed = rows / 8 * 8;
+  if (transposed > 0 && row_size > 0) {
+    int64_t ret = bshuf_trans_bit_elem(in, out, transposed, row_size);
+    CHECK(ret >= 0);
+  }
+  size_t done = transposed * row_size;
+  std::memcpy(out + done, in + done, rows * row_size - done);
+}
+
+void untranspose_rows(const uint8_t *in, uint8_t *out, size_t rows,
+                      size_t row_size) {
+  size_t transposed = rows / 8 * 8;
+  if (transposed > 0 && row_size > 0) {
+    int64_t ret = bshuf_untrans_bit_elem(in, out, transposed, row_size);
+    CHECK(ret >= 0);
+  }
+  size_t done = transposed * row_size;
+  std::memcpy(out + done, in + done, rows * row_size - done);
+}
+
+// Returns false, leaving out alone, if input is not a BoC it can handle.
+bool transpose_cells(const std::vector<uint8_t> &input,
+                     std::vector<uint8_t> &out) {
+  BocCells cells;
+  std::vector<CellGroup> groups;
+  if (!find_boc_cells(input, cells)) {
+    return false;
+  }
+  // the descriptors of the untransposed BoC are in front of each body
+  std::vector<uint8_t> descriptors;
+  size_t pos = cells.begin;
+  for (size_t i = 0; i < cells.count && pos + 2 <= cells.end; i++) {
+    descriptors.push_back(input[pos]);
+    descriptors.push_back(input[pos + 1]);
+    size_t body_size;
+    if (!cell_body_size(input[pos], input[pos + 1], cells.ref_size,
+                        body_size)) {
+      return false;
+    }
+    pos += 2 + body_size;
+  }
+  if (descriptors.size() != 2 * cells.count) {
+    return false;
+  }
+  std::vector<uint8_t> transposed = input;
+  std::memcpy(&transposed[cells.begin], descriptors.data(),
+              descriptors.size());
+  if (!group_cells(transposed, cells, cells.begin, groups)) {
+    return false;
+  }
+
+  pos = cells.begin + descriptors.size();
+  std::vector<uint8_t> matrix;
+  for (const CellGroup &group : groups) {
+    matrix.resize(group.bodies.size() * group.body_size);
+    for (size_t r = 0; r < group.bodies.size(); r++) {
+      std::memcpy(&matrix[r * group.body_size], &input[group.bodies[r]],
+                  group.body_size);
+    }
+    transpose_rows(matrix.data(), &transposed[pos], group.bodies.size(),
+                   group.body_size);
+    pos += matrix.size();
+  }
+  out = std::move(transposed);
+  return true;
+}
+
+bool untranspose_cells(const std::vector<uint8_t> &input,
+                       std::vector<uint8_t> &out) {
+  BocCells cells;
+  std::vector<CellGroup> groups;
+  if (!find_boc_cells(input, cells) ||
+      !group_cells(input, cells, cells.begin, groups)) {
+    return false;
+  }
+  std::vector<uint8_t> untransposed = input;
+  size_t pos = cells.begin + 2 * cells.count;
+  std::vector<uint8_t> matrix;
+  for (const CellGroup &group : groups) {
+    matrix.resize(group.bodies.size() * group.body_size);
+    untranspose_rows(&input[pos], matrix.data(), group.bodies.size(),
+                     group.body_size);
+    for (size_t r = 0; r < group.bodies.size(); r++) {
+      size_t body = group.bodies[r];
+      std::memcpy(&untransposed[body], &matrix[r * group.body_size],
+                  group.body_size);
+    }
+    pos += matrix.size();
+  }
+  // and each descriptor back in front of its body
+  pos = cells.begin;
+  for (size_t i = 0; i < cells.count; i++) {
+    uint8_t d1 = input[cells.begin + 2 * i];
+    uint8_t d2 = input[cells.begin + 2 * i + 1];
+    size_t body_size;
+    cell_body_size(d1, d2, cells.ref_size, body_size);
+    untransposed[pos] = d1;
+    untransposed[pos + 1] = d2;
+    pos += 2 + body_size;
+  }
+  out = std::move(untransposed);
+  return true;
+}
+
 // ---------------------------------------------------------------------------
 // Example: compress
 //   1) Deserialize your data into cells.
 //   2) Serialize with std_boc_serialize(..., flags=0).
-//   3) For each elem_size in [1..128], do:
+//   3) Estimate every elem_size in [1..MAX_ELEM_SIZE], then for
+//      the TOP_K best estimates, in parallel:
 //       - pad the data if needed
 //       - bitshuffle
 //       - LZMA-compress
+//     and LZMA-compress the structure-aware transpose too;
 //     pick whichever yields the smallest compressed blob
 //   4) Write a small header: [2 bytes elem_size] + [4 bytes padding]
 //   5) Append the best-compressed blob
@@ -1241,56 +1554,56 @@ td::BufferSlice compress(td::Slice data) {
   std::vector<uint8_t> input_bytes(original_size);
   std::memcpy(input_bytes.data(), serialized.data(), original_size);
 
-  // Keep track of the best compression
-  size_t best_elem_size = 1;
-  size_t best_padding   = 0;
-  std::vector<uint8_t> best_compressed;
-  size_t best_size = SIZE_MAX;
-
-  // 3) Try all element sizes from 1 to 128
-  for (size_t es = 1; es <= 1024; es++) {
-    // 3a) Compute how much padding is needed
-    size_t remainder = original_size % es;
-    size_t pad = (remainder == 0) ? 0 : (es - remainder);
-    size_t padded_size = original_size + pad;
-
-    // 3b) Copy data into padded buffer
-    std::vector<uint8_t> padded_input(padded_size, 0);
-    std::memcpy(padded_input.data(), input_bytes.data(), original_size);
-    // (the extra bytes remain zero for padding)
-
-    // 3c) Allocate output buffer for bitshuffled data
-    //     Number of typed elements is padded_size / es
-    size_t num_elems = padded_size / es;
-    std::vector<uint8_t> shuffled_out(padded_size);
+  // 3a) Pre-screen every element size, ties going to the smaller one
+  std::vector<double> estimate(MAX_ELEM_SIZE + 1);
+  parallel_for(MAX_ELEM_SIZE, [&](int i) {
+    estimate[i + 1] = estimate_lzma_bits(bitshuffled(input_bytes, i + 1));
+  });
+  std::vector<size_t> candidates;
+  for (size_t es = 1; es <= MAX_ELEM_SIZE; es++) {
+    candidates.push_back(es);
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [&](size_t a, size_t b) {
+                     return estimate[a] < estimate[b];
+                   });
+  candidates.resize(std::min(TOP_K, candidates.size()));
+  std::vector<uint8_t> transposed;
+  if (transpose_cells(input_bytes, transposed)) {
+    candidates.push_back(STRUCTURE_TRANSPOSE);
+  }
 
-    // 3d) Do the bitshuffle
-    int64_t ret = bshuf_bitshuffle(
-        padded_input.data(),      // in
-        shuffled_out.data(),      // out
-        num_elems,                // size (number of elements)
-        es,                       // elem_size
-        0                         // block_size=0 => automatic
-    );
-    if (ret < 0) {
-      // You may want to handle the error, skip, etc.
-      continue;
+  // 3b) Bitshuffle (or transpose) and LZMA-compress the candidates
+  std::vector<td::BufferSlice> compressed(candidates.size());
+  parallel_for(candidates.size(), [&](int i) {
+    if (candidates[i] == STRUCTURE_TRANSPOSE) {
+      compressed[i] = lzma_compress(
+          td::Slice{transposed.data(), transposed.size()});
+      return;
     }
+    std::vector<uint8_t> shuffled_out =
+        bitshuffled(input_bytes, candidates[i]);
+    compressed[i] = lzma_compress(
+        td::Slice{shuffled_out.data(), shuffled_out.size()});
+  });
 
-    // 3e) LZMA compress the shuffled data
-    //     (Your own function that returns td::BufferSlice)
-    td::BufferSlice compressed_bs = lzma_compress(td::Slice{shuffled_out.data(), shuffled_out.size()});
-
-    // 3f) Track if this is better than what we have so far
-    if (compressed_bs.size() < best_size) {
-      best_elem_size = es;
-      best_padding   = pad;
-      best_size      = compressed_bs.size();
-
-      best_compressed.resize(best_size);
-      std::memcpy(best_compressed.data(), compressed_bs.data(), best_size);
+  // 3c) Keep the smallest, the smaller elem_size on ties
+  size_t best = 0;
+  for (size_t i = 1; i < candidates.size(); i++) {
+    if (compressed[i].size() < compressed[best].size() ||
+        (compressed[i].size() == compressed[best].size() &&
+         candidates[i] < candidates[best])) {
+      best = i;
     }
   }
+  size_t best_elem_size = candidates[best];
+  size_t best_padding = 0;
+  if (best_elem_size != STRUCTURE_TRANSPOSE) {
+    size_t remainder = original_size % best_elem_size;
+    best_padding = (remainder == 0) ? 0 : (best_elem_size - remainder);
+  }
+  const td::BufferSlice &best_compressed = compressed[best];
+  size_t best_size = best_compressed.size();
 
   // 4) Build the final output
   //    We store a small 6-byte header:
@@ -1316,12 +1629,11 @@ td::BufferSlice compress(td::Slice data) {
   return td::BufferSlice(td::Slice{final_data.data(), final_data.size()});
 }
 
-
 // ---------------------------------------------------------------------------
 // Example: decompress
 //   1) Read the 6-byte header: [2 bytes elem_size] + [4 bytes padding]
 //   2) LZMA-decompress the remainder
-//   3) bitunshuffle
+//   3) bitunshuffle (or untranspose, for elem_size STRUCTURE_TRANSPOSE)
 //   4) Remove the padding
 //   5) Deserialize => re-serialize with flags=31 (per your original code)
 // ---------------------------------------------------------------------------
@@ -1342,21 +1654,27 @@ td::BufferSlice decompress(td::Slice data) {
   td::Slice lzma_part(ptr + 6, data.size() - 6);
   td::BufferSlice bitshuffled = lzma_decompress(lzma_part, /*max_output_size=*/ 2 << 20).move_as_ok();
 
-  // 3) bitunshuffle
+  // 3) bitunshuffle, or undo the structure-aware transpose
   size_t bitshuffled_size = bitshuffled.size();
   // This should match the padded_size used before => padded_size = bitshuffled_size.
-  size_t num_elems = bitshuffled_size / es;
   std::vector<uint8_t> unshuffled(bitshuffled_size);
 
-  int64_t ret = bshuf_bitunshuffle(
-      bitshuffled.data(),      // in
-      unshuffled.data(),       // out
-      num_elems,               // size
-      es,                      // elem_size
-      0                        // block_size=0 => auto
-  );
-  if (ret < 0) {
-    // handle error...
+  if (es == STRUCTURE_TRANSPOSE) {
+    std::vector<uint8_t> transposed(bitshuffled.as_slice().ubegin(),
+                                    bitshuffled.as_slice().uend());
+    CHECK(untranspose_cells(transposed, unshuffled));
+  } else {
+    size_t num_elems = bitshuffled_size / es;
+    int64_t ret = bshuf_bitunshuffle(
+        bitshuffled.data(),      // in
+        unshuffled.data(),       // out
+        num_elems,               // size
+        es,                      // elem_size
+        0                        // block_size=0 => auto
+    );
+    if (ret < 0) {
+      // handle error...
+    }
   }
 
   // 4) Remove the padding
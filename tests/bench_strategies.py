@@ -0,0 +1,65 @@
+import argparse
+import glob
+import subprocess
+
+from colorama import Fore, Style, init
+
+
+def main():
+    """
+    Run the "bench" mode of an evolve solution on every test and compare the
+    search strategies by compression gain per CPU-second. Tests run one after
+    another so that CPU time is not skewed by other processes.
+    """
+    init(autoreset=True)
+
+    parser = argparse.ArgumentParser(
+        description="Compare search strategies of an evolve solution."
+    )
+    parser.add_argument(
+        "--bin",
+        default="../build/solution_evolve_tiny_lzma",
+        help="Path to the solution binary (default: ../build/solution_evolve_tiny_lzma).",
+    )
+    args = parser.parse_args()
+
+    test_files = sorted(glob.glob("cases/*.txt"))
+    if not test_files:
+        print("Error: no tests")
+        exit(2)
+
+    totals = {}
+    for test_file in test_files:
+        with open(test_file, "r") as f:
+            block = f.read().split()[1]
+        result = subprocess.run(
+            args.bin, input="bench\n" + block, text=True, capture_output=True
+        )
+        if result.returncode != 0:
+            print(f"{Fore.RED}{test_file}: exitcode={result.returncode}{Style.RESET_ALL}")
+            continue
+        line = f"{Fore.YELLOW}{test_file}{Style.RESET_ALL}"
+        for row in result.stdout.split("\n"):
+            if not row.strip():
+                continue
+            name, baseline, best, evals, cpu, _ = row.split()
+            gain = int(baseline) - int(best)
+            total = totals.setdefault(name, {"gain": 0, "cpu": 0.0, "evals": 0, "improved": 0})
+            total["gain"] += gain
+            total["cpu"] += float(cpu)
+            total["evals"] += int(evals)
+            total["improved"] += gain > 0
+            line += f"  {name} {Fore.CYAN}{gain:>+6}{Style.RESET_ALL} in {float(cpu):.2f}s"
+        print(line)
+
+    print(f"{Fore.YELLOW}{'Strategy':<10} {'Gain':>8} {'CPU s':>8} {'Evals':>7} {'Improved':>9} {'Gain/CPU s':>11}{Style.RESET_ALL}")
+    for name, total in totals.items():
+        per_second = total["gain"] / total["cpu"] if total["cpu"] > 0 else 0.0
+        print(
+            f"{name:<10} {total['gain']:>8} {total['cpu']:>8.2f} {total['evals']:>7} "
+            f"{total['improved']:>5}/{len(test_files):<3} {Fore.CYAN}{per_second:>11.1f}{Style.RESET_ALL}"
+        )
+
+
+if __name__ == "__main__":
+    main()
@@ -251,6 +251,11 @@ def main():
         default="../build/solution",
         help="Path to the solution binary (default: ../build/solution).",
     )
+    parser.add_argument(
+        "--baseline",
+        default=None,
+        help="Optional second binary; its compressed sizes are compared against --bin.",
+    )
     args = parser.parse_args()
 
     # Gather test files
@@ -302,6 +307,49 @@ def main():
     print(f"{Fore.YELLOW}Average points: {Fore.CYAN}{(total_points / n_tests):.3f}{Style.RESET_ALL}")
     print(f"{Fore.YELLOW}Total points:   {Fore.CYAN}{total_points:.3f}{Style.RESET_ALL}")
 
+    if args.baseline:
+        print_comparison(results, args.baseline, name_width, n_tests)
+
+
+def print_comparison(results, baseline_bin, name_width, n_tests):
+    """Run the baseline binary on the same tests and print per-test size deltas."""
+    args_list = [
+        (res["index"], res["test_file"], name_width, n_tests, baseline_bin)
+        for res in results
+    ]
+    with Pool() as pool:
+        baseline = pool.map(process_test, args_list)
+    baseline.sort(key=lambda x: x["index"])
+
+    print(f"{Fore.YELLOW}================ Comparison against {baseline_bin} ================{Style.RESET_ALL}")
+    print(f"{Fore.YELLOW}Idx  {'Name':<{name_width}} {'Base':>7} {'New':>7} {'Delta':>7}{Style.RESET_ALL}")
+
+    base_total = new_total = 0
+    base_points = new_points = 0.0
+    n_both = 0
+    for res, base in zip(results, baseline):
+        if not (res.get("success", False) and base.get("success", False)):
+            print(f"{Fore.YELLOW}{res['index']:>4}{Style.RESET_ALL} {res['test_file']:<{name_width}} "
+                  f"{Fore.RED}skipped (failed in one of the binaries){Style.RESET_ALL}")
+            continue
+        n_both += 1
+        delta = res["compressed_size"] - base["compressed_size"]
+        color = Fore.GREEN if delta < 0 else (Fore.RED if delta > 0 else Fore.CYAN)
+        print(f"{Fore.YELLOW}{res['index']:>4}{Style.RESET_ALL} {res['test_file']:<{name_width}} "
+              f"{base['compressed_size']:>7} {res['compressed_size']:>7} {color}{delta:>+7}{Style.RESET_ALL}")
+        base_total += base["compressed_size"]
+        new_total += res["compressed_size"]
+        base_points += base["points"]
+        new_points += res["points"]
+
+    if n_both == 0:
+        print(f"{Fore.RED}No tests passed in both binaries{Style.RESET_ALL}")
+        return
+    print(f"{Fore.YELLOW}Compared tests: {Fore.CYAN}{n_both}/{n_tests}{Style.RESET_ALL}")
+    print(f"{Fore.YELLOW}Total size:     {Fore.CYAN}{base_total} -> {new_total} "
+          f"({100.0 * (new_total - base_total) / base_total:+.3f}%){Style.RESET_ALL}")
+    print(f"{Fore.YELLOW}Average points: {Fore.CYAN}{base_points / n_both:.3f} -> {new_points / n_both:.3f}{Style.RESET_ALL}")
+
 
 if __name__ == "__main__":
     main()